@@ -0,0 +1,143 @@
+/**
+ * @file allocation_counter.cpp
+ * @author Carlos Salguero
+ * @brief Replaces the global allocation functions to count allocations
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// C++ Standard Library
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+// Project files
+#include "allocation_counter.h"
+
+// Replacing the global allocation functions makes every new in the
+// benchmark executable, including the ones inside std::vector and the
+// aligned allocator, pass through the counters below.
+
+namespace
+{
+    std::atomic<std::int64_t> g_allocations{0};
+    std::atomic<std::int64_t> g_bytes{0};
+
+    /**
+     * @brief
+     * Allocates memory, counting the allocation
+     * @param size Bytes requested
+     * @return void* The memory, never null
+     * @throws std::bad_alloc If the memory cannot be allocated
+     */
+    void *allocate(std::size_t size)
+    {
+        g_allocations.fetch_add(1, std::memory_order_relaxed);
+        g_bytes.fetch_add(static_cast<std::int64_t>(size), std::memory_order_relaxed);
+
+        if (void *pointer = std::malloc(size == 0 ? 1 : size))
+            return pointer;
+
+        throw std::bad_alloc();
+    }
+
+    /**
+     * @brief
+     * Allocates aligned memory, counting the allocation
+     * @param size Bytes requested
+     * @param alignment Alignment, a power of two
+     * @return void* The memory, never null
+     * @throws std::bad_alloc If the memory cannot be allocated
+     */
+    void *allocate(std::size_t size, std::align_val_t alignment)
+    {
+        g_allocations.fetch_add(1, std::memory_order_relaxed);
+        g_bytes.fetch_add(static_cast<std::int64_t>(size), std::memory_order_relaxed);
+
+        auto align = static_cast<std::size_t>(alignment);
+        auto rounded = (size + align - 1) / align * align;
+
+        if (void *pointer = std::aligned_alloc(align, rounded == 0 ? align : rounded))
+            return pointer;
+
+        throw std::bad_alloc();
+    }
+}
+
+namespace Benchmarks
+{
+    std::int64_t allocation_count()
+    {
+        return g_allocations.load(std::memory_order_relaxed);
+    }
+
+    std::int64_t allocated_bytes()
+    {
+        return g_bytes.load(std::memory_order_relaxed);
+    }
+}
+
+void *operator new(std::size_t size)
+{
+    return allocate(size);
+}
+
+void *operator new[](std::size_t size)
+{
+    return allocate(size);
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment)
+{
+    return allocate(size, alignment);
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return allocate(size, alignment);
+}
+
+void operator delete(void *pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete[](void *pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void *pointer, std::size_t) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete[](void *pointer, std::size_t) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void *pointer, std::align_val_t) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete[](void *pointer, std::align_val_t) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void *pointer, std::size_t, std::align_val_t) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete[](void *pointer, std::size_t, std::align_val_t) noexcept
+{
+    std::free(pointer);
+}
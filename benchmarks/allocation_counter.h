@@ -0,0 +1,71 @@
+/**
+ * @file allocation_counter.h
+ * @author Carlos Salguero
+ * @brief Reports the heap allocations of a benchmark loop as allocs/op
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#pragma once
+
+// C++ Standard Library
+#include <cstdint>
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+namespace Benchmarks
+{
+    /**
+     * @brief
+     * Number of heap allocations made by the process so far
+     * @return std::int64_t The number of allocations
+     */
+    std::int64_t allocation_count();
+
+    /**
+     * @brief
+     * Number of bytes requested from the heap by the process so far
+     * @return std::int64_t The number of bytes
+     */
+    std::int64_t allocated_bytes();
+
+    /**
+     * @class AllocationCounter
+     * @brief Counts the allocations between its construction and its
+     *        destruction and reports them per iteration, as the allocs/op
+     *        and bytes/op counters. Construct it right before the
+     *        benchmark loop so the setup is not counted.
+     */
+    class AllocationCounter
+    {
+    public:
+        // Constructors
+        explicit AllocationCounter(benchmark::State &state)
+            : m_state(state), m_allocations(allocation_count()), m_bytes(allocated_bytes()) {}
+
+        AllocationCounter(const AllocationCounter &) = delete;
+        AllocationCounter &operator=(const AllocationCounter &) = delete;
+
+        // Destructor
+        ~AllocationCounter()
+        {
+            // Read both totals before the counters map allocates
+            auto allocations = static_cast<double>(allocation_count() - m_allocations);
+            auto bytes = static_cast<double>(allocated_bytes() - m_bytes);
+
+            m_state.counters["allocs/op"] =
+                benchmark::Counter(allocations, benchmark::Counter::kAvgIterations);
+            m_state.counters["bytes/op"] =
+                benchmark::Counter(bytes, benchmark::Counter::kAvgIterations);
+        }
+
+    private:
+        benchmark::State &m_state;
+        std::int64_t m_allocations;
+        std::int64_t m_bytes;
+    };
+}
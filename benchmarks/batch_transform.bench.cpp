@@ -0,0 +1,119 @@
+/**
+ * @file batch_transform.bench.cpp
+ * @author Carlos Salguero
+ * @brief Benchmarks of the SoA batch transforms against per-point transforms
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// C++ Standard Library
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// Project files
+#include "utils/math/batch_transform.h"
+#include "utils/math/simd.h"
+
+namespace
+{
+    /**
+     * @brief
+     * Creates an affine transform: a rotation around z, a scale and a
+     * translation
+     * @return Math::Mat4 The transform
+     */
+    Math::Mat4 make_transform()
+    {
+        float c = std::cos(0.3f), s = std::sin(0.3f);
+
+        return Math::Mat4::translation(Math::Vec3(1.0f, -2.0f, 0.5f)) *
+               Math::Mat4(Math::Vec4(c, -s, 0.0f, 0.0f), Math::Vec4(s, c, 0.0f, 0.0f),
+                          Math::Vec4(0.0f, 0.0f, 1.0f, 0.0f),
+                          Math::Vec4(0.0f, 0.0f, 0.0f, 1.0f)) *
+               Math::Mat4::scaling(Math::Vec3(2.0f, 2.0f, 2.0f));
+    }
+
+    void BM_TransformPoints_Aos(benchmark::State &state)
+    {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        Math::Mat4 matrix = make_transform();
+        std::vector<Math::Vec3> points(count, Math::Vec3(1.0f, 2.0f, 3.0f));
+
+        for (auto _ : state)
+        {
+            for (auto &point : points)
+            {
+                Math::Vec4 result = matrix * Math::Vec4(point.x(), point.y(), point.z(), 1.0f);
+                point = Math::Vec3(result.x(), result.y(), result.z());
+            }
+
+            benchmark::DoNotOptimize(points.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void BM_TransformPoints_Float4x4(benchmark::State &state)
+    {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        Math::Simd::Float4x4 matrix(make_transform());
+        std::vector<Math::Simd::Float4> points(count,
+                                               Math::Simd::Float4(1.0f, 2.0f, 3.0f, 1.0f));
+
+        for (auto _ : state)
+        {
+            for (auto &point : points)
+                point = matrix * point;
+
+            benchmark::DoNotOptimize(points.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void BM_TransformPoints_Soa(benchmark::State &state)
+    {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        Math::Mat4 matrix = make_transform();
+        std::vector<float> x(count, 1.0f), y(count, 2.0f), z(count, 3.0f);
+        Math::SoaView points{x, y, z};
+
+        for (auto _ : state)
+        {
+            Math::transform_points(matrix, points, points);
+            benchmark::DoNotOptimize(x.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void BM_RotateTranslate_Soa(benchmark::State &state)
+    {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        auto rotation =
+            Math::Quaternion<float>::from_axis_angle(Math::Vec3(0.0f, 0.0f, 1.0f), 0.3f);
+        Math::Vec3 translation(1.0f, -2.0f, 0.5f);
+        std::vector<float> x(count, 1.0f), y(count, 2.0f), z(count, 3.0f);
+        Math::SoaView points{x, y, z};
+
+        for (auto _ : state)
+        {
+            Math::rotate_translate_points(rotation, translation, points, points);
+            benchmark::DoNotOptimize(x.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+}
+
+BENCHMARK(BM_TransformPoints_Aos)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(BM_TransformPoints_Float4x4)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(BM_TransformPoints_Soa)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(BM_RotateTranslate_Soa)->Arg(1 << 10)->Arg(1 << 16);
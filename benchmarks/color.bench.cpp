@@ -0,0 +1,509 @@
+/**
+ * @file color.bench.cpp
+ * @author Carlos Salguero
+ * @brief Benchmarks of the color arithmetic, the sRGB and color space
+ *        conversions and the pixel buffer and compositing kernels
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// Project files
+#include "allocation_counter.h"
+#include "utils/color/color.h"
+#include "utils/color/color32.h"
+#include "utils/color/color_kernels.h"
+#include "utils/color/color_space.h"
+#include "utils/color/composite.h"
+#include "utils/color/srgb.h"
+
+namespace
+{
+    /**
+     * @brief
+     * Creates colors with channels spread over [0, 1]
+     * @param count Number of colors
+     * @return std::vector<Color<float>> The colors
+     */
+    std::vector<Color<float>> make_colors(std::size_t count)
+    {
+        std::vector<Color<float>> colors;
+        colors.reserve(count);
+
+        for (std::size_t i = 0; i < count; ++i)
+            colors.emplace_back(static_cast<float>(i % 7) / 7.0f, static_cast<float>(i % 11) / 11.0f,
+                                static_cast<float>(i % 13) / 13.0f, 1.0f);
+
+        return colors;
+    }
+
+    void set_items(benchmark::State &state)
+    {
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void BM_Color_Add(benchmark::State &state)
+    {
+        auto colors = make_colors(static_cast<std::size_t>(state.range(0)));
+        Color<float> tint(0.1f, 0.2f, 0.3f, 0.0f);
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        for (auto _ : state)
+        {
+            for (auto &color : colors)
+                color += tint;
+
+            benchmark::DoNotOptimize(colors.data());
+        }
+
+        set_items(state);
+    }
+
+    void BM_Color_Multiply(benchmark::State &state)
+    {
+        auto colors = make_colors(static_cast<std::size_t>(state.range(0)));
+        std::vector<Color<float>> result(colors.size());
+        Color<float> tint(0.9f, 0.8f, 0.7f, 1.0f);
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        for (auto _ : state)
+        {
+            for (std::size_t i = 0; i < colors.size(); ++i)
+                result[i] = colors[i] * tint;
+
+            benchmark::DoNotOptimize(result.data());
+        }
+
+        set_items(state);
+    }
+
+    void BM_Color_Compare(benchmark::State &state)
+    {
+        auto colors = make_colors(static_cast<std::size_t>(state.range(0)));
+        Color<float> key(0.0f, 0.0f, 0.0f, 1.0f);
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        for (auto _ : state)
+        {
+            std::size_t matches = 0;
+
+            for (const auto &color : colors)
+                matches += color == key;
+
+            benchmark::DoNotOptimize(matches);
+        }
+
+        set_items(state);
+    }
+
+    void BM_Color_ToString(benchmark::State &state)
+    {
+        Color<float> color(0.25f, 0.5f, 0.75f, 1.0f);
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        for (auto _ : state)
+        {
+            auto text = color.to_string();
+            benchmark::DoNotOptimize(text.data());
+        }
+    }
+
+    void BM_Srgb_ToLinear(benchmark::State &state)
+    {
+        std::vector<float> values(static_cast<std::size_t>(state.range(0)));
+
+        for (std::size_t i = 0; i < values.size(); ++i)
+            values[i] = static_cast<float>(i % 256) / 255.0f;
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        for (auto _ : state)
+        {
+            float sum = 0.0f;
+
+            for (float value : values)
+                sum += Math::srgb_to_linear(value);
+
+            benchmark::DoNotOptimize(sum);
+        }
+
+        set_items(state);
+    }
+
+    void BM_Srgb8_ToLinear_Table(benchmark::State &state)
+    {
+        std::vector<std::uint8_t> values(static_cast<std::size_t>(state.range(0)));
+
+        for (std::size_t i = 0; i < values.size(); ++i)
+            values[i] = static_cast<std::uint8_t>(i * 31);
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        for (auto _ : state)
+        {
+            float sum = 0.0f;
+
+            for (auto value : values)
+                sum += Math::srgb8_to_linear(value);
+
+            benchmark::DoNotOptimize(sum);
+        }
+
+        set_items(state);
+    }
+
+    void BM_Srgb_FromLinear(benchmark::State &state)
+    {
+        std::vector<float> values(static_cast<std::size_t>(state.range(0)));
+
+        for (std::size_t i = 0; i < values.size(); ++i)
+            values[i] = static_cast<float>(i % 1024) / 1023.0f;
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        for (auto _ : state)
+        {
+            float sum = 0.0f;
+
+            for (float value : values)
+                sum += Math::linear_to_srgb(value);
+
+            benchmark::DoNotOptimize(sum);
+        }
+
+        set_items(state);
+    }
+
+    void BM_Srgb8_FromLinear_Table(benchmark::State &state)
+    {
+        std::vector<float> values(static_cast<std::size_t>(state.range(0)));
+        std::vector<std::uint8_t> result(values.size());
+
+        for (std::size_t i = 0; i < values.size(); ++i)
+            values[i] = static_cast<float>(i % 1024) / 1023.0f;
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        for (auto _ : state)
+        {
+            for (std::size_t i = 0; i < values.size(); ++i)
+                result[i] = Math::linear_to_srgb8(values[i]);
+
+            benchmark::DoNotOptimize(result.data());
+        }
+
+        set_items(state);
+    }
+
+    /**
+     * @brief
+     * Creates RGBA8 pixels with varied channels and alpha
+     * @param count Number of pixels
+     * @return std::vector<std::uint8_t> The pixels
+     */
+    std::vector<std::uint8_t> make_pixels(std::size_t count)
+    {
+        std::vector<std::uint8_t> pixels(count * 4);
+
+        for (std::size_t i = 0; i < pixels.size(); ++i)
+            pixels[i] = static_cast<std::uint8_t>(i * 37 + i / 4);
+
+        return pixels;
+    }
+
+    void set_pixels(benchmark::State &state)
+    {
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+        state.SetBytesProcessed(state.iterations() * state.range(0) * 4);
+    }
+
+    void BM_Pixels_Srgb8ToLinear_Scalar(benchmark::State &state)
+    {
+        auto pixels = make_pixels(static_cast<std::size_t>(state.range(0)));
+        std::vector<float> linear(pixels.size());
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        for (auto _ : state)
+        {
+            for (std::size_t i = 0; i < pixels.size(); i += 4)
+            {
+                for (std::size_t c = 0; c < 3; ++c)
+                    linear[i + c] = Math::srgb8_to_linear(pixels[i + c]);
+
+                linear[i + 3] = pixels[i + 3] / 255.0f;
+            }
+
+            benchmark::DoNotOptimize(linear.data());
+        }
+
+        set_pixels(state);
+    }
+
+    void BM_Pixels_Srgb8ToLinear(benchmark::State &state)
+    {
+        auto pixels = make_pixels(static_cast<std::size_t>(state.range(0)));
+        std::vector<float> linear(pixels.size());
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        for (auto _ : state)
+        {
+            Math::srgb8_to_linear(pixels, linear);
+            benchmark::DoNotOptimize(linear.data());
+        }
+
+        set_pixels(state);
+    }
+
+    void BM_Pixels_LinearToSrgb8(benchmark::State &state)
+    {
+        auto pixels = make_pixels(static_cast<std::size_t>(state.range(0)));
+        std::vector<float> linear(pixels.size());
+        Math::srgb8_to_linear(pixels, linear);
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        for (auto _ : state)
+        {
+            Math::linear_to_srgb8(linear, pixels);
+            benchmark::DoNotOptimize(pixels.data());
+        }
+
+        set_pixels(state);
+    }
+
+    void BM_Pixels_Unorm8ToFloat(benchmark::State &state)
+    {
+        auto pixels = make_pixels(static_cast<std::size_t>(state.range(0)));
+        std::vector<float> channels(pixels.size());
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        for (auto _ : state)
+        {
+            Math::unorm8_to_float(pixels, channels);
+            benchmark::DoNotOptimize(channels.data());
+        }
+
+        set_pixels(state);
+    }
+
+    void BM_Pixels_FloatToUnorm8(benchmark::State &state)
+    {
+        auto pixels = make_pixels(static_cast<std::size_t>(state.range(0)));
+        std::vector<float> channels(pixels.size());
+        Math::unorm8_to_float(pixels, channels);
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        for (auto _ : state)
+        {
+            Math::float_to_unorm8(channels, pixels);
+            benchmark::DoNotOptimize(pixels.data());
+        }
+
+        set_pixels(state);
+    }
+
+    void BM_Pixels_PremultiplyRoundTrip(benchmark::State &state)
+    {
+        auto pixels = make_pixels(static_cast<std::size_t>(state.range(0)));
+        std::vector<float> channels(pixels.size());
+        Math::unorm8_to_float(pixels, channels);
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        // Premultiplying repeatedly would decay the channels into denormals,
+        // so every iteration undoes its work
+        for (auto _ : state)
+        {
+            Math::premultiply_alpha(std::span<float>(channels));
+            Math::unpremultiply_alpha(std::span<float>(channels));
+            benchmark::DoNotOptimize(channels.data());
+        }
+
+        set_pixels(state);
+    }
+
+    void BM_Pixels_Premultiply8(benchmark::State &state)
+    {
+        auto source = make_pixels(static_cast<std::size_t>(state.range(0)));
+        auto pixels = source;
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        // Includes the copy that restores the straight alpha pixels
+        for (auto _ : state)
+        {
+            std::copy(source.begin(), source.end(), pixels.begin());
+            Math::premultiply_alpha(std::span<std::uint8_t>(pixels));
+            benchmark::DoNotOptimize(pixels.data());
+        }
+
+        set_pixels(state);
+    }
+
+    void BM_Pixels_SwizzleBgra(benchmark::State &state)
+    {
+        auto pixels = make_pixels(static_cast<std::size_t>(state.range(0)));
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        for (auto _ : state)
+        {
+            Math::swizzle_channels<2, 1, 0, 3>(pixels, pixels);
+            benchmark::DoNotOptimize(pixels.data());
+        }
+
+        set_pixels(state);
+    }
+
+    void BM_Composite_Colors(benchmark::State &state)
+    {
+        auto source = make_colors(static_cast<std::size_t>(state.range(0)));
+        auto background = make_colors(source.size());
+        auto destination = background;
+        Color<float> one(1.0f, 1.0f, 1.0f, 1.0f);
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        for (auto _ : state)
+        {
+            for (std::size_t i = 0; i < source.size(); ++i)
+            {
+                float alpha = source[i].get_alpha();
+                destination[i] = source[i] + background[i] * (one - Color<float>(alpha, alpha, alpha, alpha));
+            }
+
+            benchmark::DoNotOptimize(destination.data());
+        }
+
+        set_pixels(state);
+    }
+
+    void BM_Composite(benchmark::State &state, Math::BlendMode mode)
+    {
+        auto pixels = make_pixels(static_cast<std::size_t>(state.range(0)));
+        std::vector<float> source(pixels.size());
+        Math::unorm8_to_float(pixels, source);
+        Math::premultiply_alpha(std::span<float>(source));
+        auto background = source;
+        std::reverse(background.begin(), background.end());
+        auto destination = background;
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        // Blending repeatedly onto the same pixels can decay them into
+        // denormals, so every iteration restores the background first
+        for (auto _ : state)
+        {
+            std::copy(background.begin(), background.end(), destination.begin());
+            Math::composite(mode, source, destination);
+            benchmark::DoNotOptimize(destination.data());
+        }
+
+        set_pixels(state);
+    }
+
+    void BM_Composite8(benchmark::State &state, Math::BlendMode mode)
+    {
+        auto source = make_pixels(static_cast<std::size_t>(state.range(0)));
+        Math::premultiply_alpha(std::span<std::uint8_t>(source));
+        auto background = source;
+        std::reverse(background.begin(), background.end());
+        auto destination = background;
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        for (auto _ : state)
+        {
+            std::copy(background.begin(), background.end(), destination.begin());
+            Math::composite(mode, source, destination);
+            benchmark::DoNotOptimize(destination.data());
+        }
+
+        set_pixels(state);
+    }
+
+    void BM_Pack_Colors(benchmark::State &state)
+    {
+        auto colors = make_colors(static_cast<std::size_t>(state.range(0)));
+        std::vector<Color32> packed(colors.size());
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        for (auto _ : state)
+        {
+            Math::pack_colors(colors, packed);
+            benchmark::DoNotOptimize(packed.data());
+        }
+
+        set_pixels(state);
+    }
+
+    template <void (*Convert)(std::span<const float>, std::span<float>)>
+    void BM_ColorSpace(benchmark::State &state)
+    {
+        auto pixels = make_pixels(static_cast<std::size_t>(state.range(0)));
+        std::vector<float> source(pixels.size());
+        std::vector<float> destination(pixels.size());
+        Math::unorm8_to_float(pixels, source);
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        for (auto _ : state)
+        {
+            Convert(source, destination);
+            benchmark::DoNotOptimize(destination.data());
+        }
+
+        set_pixels(state);
+    }
+}
+
+BENCHMARK(BM_Color_Add)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK(BM_Color_Multiply)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK(BM_Color_Compare)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK(BM_Color_ToString);
+BENCHMARK(BM_Srgb_ToLinear)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK(BM_Srgb8_ToLinear_Table)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK(BM_Srgb_FromLinear)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK(BM_Srgb8_FromLinear_Table)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK(BM_Pixels_Srgb8ToLinear_Scalar)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK(BM_Pixels_Srgb8ToLinear)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK(BM_Pixels_LinearToSrgb8)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK(BM_Pixels_Unorm8ToFloat)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK(BM_Pixels_FloatToUnorm8)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK(BM_Pixels_PremultiplyRoundTrip)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK(BM_Pixels_Premultiply8)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK(BM_Pixels_SwizzleBgra)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK(BM_Composite_Colors)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK_CAPTURE(BM_Composite, SourceOver, Math::BlendMode::SourceOver)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK_CAPTURE(BM_Composite, Multiply, Math::BlendMode::Multiply)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK_CAPTURE(BM_Composite8, SourceOver, Math::BlendMode::SourceOver)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK_CAPTURE(BM_Composite8, Additive, Math::BlendMode::Additive)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK_CAPTURE(BM_Composite8, Multiply, Math::BlendMode::Multiply)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK_CAPTURE(BM_Composite8, Screen, Math::BlendMode::Screen)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK(BM_Pack_Colors)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK(BM_ColorSpace<Math::rgb_to_hsv>)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK(BM_ColorSpace<Math::hsv_to_rgb>)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK(BM_ColorSpace<Math::rgb_to_hsl>)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK(BM_ColorSpace<Math::hsl_to_rgb>)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK(BM_ColorSpace<Math::rgb_to_ycocg>)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK(BM_ColorSpace<Math::ycocg_to_rgb>)->RangeMultiplier(16)->Range(16, 1 << 16);
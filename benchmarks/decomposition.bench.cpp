@@ -0,0 +1,295 @@
+/**
+ * @file decomposition.bench.cpp
+ * @author Carlos Salguero
+ * @brief Throughput and accuracy of the decompositions and 4x4 inverses
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// C++ Standard Library
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <thread>
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// Project files
+#include "threads/thread_pool.h"
+#include "utils/math/decomposition.h"
+
+namespace
+{
+    /**
+     * @brief
+     * Creates a random square matrix with a heavy diagonal, so that it is
+     * well conditioned, or symmetric positive definite when asked for
+     * @param size Rows and columns of the matrix
+     * @param symmetric Whether to mirror the lower triangle
+     * @return Math::Matrix<double> Filled matrix
+     */
+    Math::Matrix<double> make_system(std::size_t size, bool symmetric = false)
+    {
+        std::mt19937 generator(7);
+        std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+        Math::Matrix<double> matrix(size, size);
+
+        for (std::size_t i = 0; i < size; ++i)
+            for (std::size_t j = 0; j < size; ++j)
+                matrix(i, j) = symmetric && j < i ? matrix(j, i) : distribution(generator);
+
+        for (std::size_t i = 0; i < size; ++i)
+            matrix(i, i) += static_cast<double>(size);
+
+        return matrix;
+    }
+
+    /**
+     * @brief
+     * Creates the right-hand side (1, 1, ..., 1)
+     */
+    Math::Vector<double> make_rhs(std::size_t size)
+    {
+        Math::Vector<double> result(size);
+
+        for (std::size_t i = 0; i < size; ++i)
+            result[i] = 1.0;
+
+        return result;
+    }
+
+    /**
+     * @brief
+     * Reports the largest element of |A x - b| relative to |A| |x|
+     * @param state Benchmark state
+     * @param a The system matrix
+     * @param x The computed solution
+     * @param b The right-hand side
+     */
+    void set_residual(benchmark::State &state, const Math::Matrix<double> &a,
+                      const Math::Vector<double> &x, const Math::Vector<double> &b)
+    {
+        double error = 0.0;
+        double scale = 0.0;
+
+        for (std::size_t i = 0; i < a.rows(); ++i)
+        {
+            double sum = -b[i];
+            double magnitude = 0.0;
+
+            for (std::size_t j = 0; j < a.cols(); ++j)
+            {
+                sum += a(i, j) * x[j];
+                magnitude += std::abs(a(i, j) * x[j]);
+            }
+
+            error = std::max(error, std::abs(sum));
+            scale = std::max(scale, magnitude);
+        }
+
+        state.counters["residual"] = error / scale;
+    }
+
+    /**
+     * @brief
+     * Reports the factorization cost as FLOP/s
+     * @param state Benchmark state
+     * @param flops Floating point operations per iteration
+     */
+    void set_flops(benchmark::State &state, double flops)
+    {
+        state.counters["FLOPS"] =
+            benchmark::Counter(flops, benchmark::Counter::kIsIterationInvariantRate);
+    }
+
+    void BM_Lu_Solve(benchmark::State &state)
+    {
+        auto size = static_cast<std::size_t>(state.range(0));
+        const auto a = make_system(size);
+        const auto b = make_rhs(size);
+        Math::Vector<double> x(size);
+
+        for (auto _ : state)
+        {
+            x = Math::LuDecomposition<double>(a).solve(b);
+            benchmark::DoNotOptimize(x[0]);
+        }
+
+        set_flops(state, 2.0 / 3.0 * std::pow(static_cast<double>(size), 3.0));
+        set_residual(state, a, x, b);
+    }
+
+    void BM_Lu_ThreadPool(benchmark::State &state)
+    {
+        auto size = static_cast<std::size_t>(state.range(0));
+        const auto a = make_system(size);
+        const auto b = make_rhs(size);
+        Math::Vector<double> x(size);
+        ThreadPool thread_pool(std::max(1u, std::thread::hardware_concurrency()));
+
+        for (auto _ : state)
+        {
+            x = Math::LuDecomposition<double>(a, &thread_pool).solve(b);
+            benchmark::DoNotOptimize(x[0]);
+        }
+
+        set_flops(state, 2.0 / 3.0 * std::pow(static_cast<double>(size), 3.0));
+        set_residual(state, a, x, b);
+    }
+
+    void BM_Cholesky_Solve(benchmark::State &state)
+    {
+        auto size = static_cast<std::size_t>(state.range(0));
+        const auto a = make_system(size, true);
+        const auto b = make_rhs(size);
+        Math::Vector<double> x(size);
+
+        for (auto _ : state)
+        {
+            x = Math::CholeskyDecomposition<double>(a).solve(b);
+            benchmark::DoNotOptimize(x[0]);
+        }
+
+        set_flops(state, 1.0 / 3.0 * std::pow(static_cast<double>(size), 3.0));
+        set_residual(state, a, x, b);
+    }
+
+    void BM_Qr_Solve(benchmark::State &state)
+    {
+        auto size = static_cast<std::size_t>(state.range(0));
+        const auto a = make_system(size);
+        const auto b = make_rhs(size);
+        Math::Vector<double> x(size);
+
+        for (auto _ : state)
+        {
+            x = Math::QrDecomposition<double>(a).solve(b);
+            benchmark::DoNotOptimize(x[0]);
+        }
+
+        set_flops(state, 4.0 / 3.0 * std::pow(static_cast<double>(size), 3.0));
+        set_residual(state, a, x, b);
+    }
+
+    /**
+     * @brief
+     * Creates a rotation, scale and translation matrix
+     */
+    Math::Mat4 make_model()
+    {
+        float c = std::cos(0.7f);
+        float s = std::sin(0.7f);
+        Math::Mat4 rotation = Math::Mat4::identity();
+
+        rotation(0, 0) = c;
+        rotation(0, 1) = -s;
+        rotation(1, 0) = s;
+        rotation(1, 1) = c;
+
+        return Math::Mat4::translation(Math::Vec3(3.0f, -2.0f, 5.0f)) * rotation *
+               Math::Mat4::scaling(Math::Vec3(2.0f, 0.5f, 1.5f));
+    }
+
+    /**
+     * @brief
+     * Reports the largest element of |M M^-1 - I|
+     */
+    void set_inverse_error(benchmark::State &state, const Math::Mat4 &matrix,
+                           const Math::Mat4 &inverse)
+    {
+        Math::Mat4 product = matrix * inverse;
+        double error = 0.0;
+
+        for (std::size_t i = 0; i < 4; ++i)
+            for (std::size_t j = 0; j < 4; ++j)
+                error = std::max(error, std::abs(static_cast<double>(product(i, j)) -
+                                                 (i == j ? 1.0 : 0.0)));
+
+        state.counters["residual"] = error;
+    }
+
+    void BM_Mat4_Inverse_Lu(benchmark::State &state)
+    {
+        auto model = make_model();
+        auto dynamic = model.to_matrix();
+        Math::Mat4 result;
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(dynamic.data());
+            result = Math::Mat4::from_matrix(Math::inverse(dynamic));
+            benchmark::DoNotOptimize(result);
+        }
+
+        set_inverse_error(state, model, result);
+    }
+
+    void BM_Mat4_Inverse_Simd(benchmark::State &state)
+    {
+        auto model = make_model();
+        Math::Mat4 result;
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(model);
+            result = Math::inverse(model);
+            benchmark::DoNotOptimize(result);
+        }
+
+        set_inverse_error(state, model, result);
+    }
+
+    void BM_Mat4_AffineInverse(benchmark::State &state)
+    {
+        auto model = make_model();
+        Math::Mat4 result;
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(model);
+            result = Math::affine_inverse(model);
+            benchmark::DoNotOptimize(result);
+        }
+
+        set_inverse_error(state, model, result);
+    }
+
+    void BM_Float4x4_Inverse(benchmark::State &state)
+    {
+        Math::Simd::Float4x4 model(make_model());
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(model);
+            auto result = model.inverse();
+            benchmark::DoNotOptimize(result);
+        }
+    }
+
+    void BM_Float4x4_AffineInverse(benchmark::State &state)
+    {
+        Math::Simd::Float4x4 model(make_model());
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(model);
+            auto result = model.affine_inverse();
+            benchmark::DoNotOptimize(result);
+        }
+    }
+}
+
+BENCHMARK(BM_Lu_Solve)->RangeMultiplier(4)->Range(16, 1024)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Lu_ThreadPool)->RangeMultiplier(2)->Range(256, 1024)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK(BM_Cholesky_Solve)->RangeMultiplier(4)->Range(16, 1024)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Qr_Solve)->RangeMultiplier(4)->Range(16, 1024)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Mat4_Inverse_Lu);
+BENCHMARK(BM_Mat4_Inverse_Simd);
+BENCHMARK(BM_Mat4_AffineInverse);
+BENCHMARK(BM_Float4x4_Inverse);
+BENCHMARK(BM_Float4x4_AffineInverse);
@@ -0,0 +1,190 @@
+/**
+ * @file fast_math.bench.cpp
+ * @author Carlos Salguero
+ * @brief Benchmarks of the fast approximations against libm
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// C++ Standard Library
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// Project files
+#include "utils/math/batch_transform.h"
+#include "utils/math/fast_math.h"
+
+namespace
+{
+    constexpr std::size_t VALUE_COUNT = 4096;
+
+    /**
+     * @brief
+     * Creates values spread over [-range, range]
+     * @param range Half the width of the interval
+     * @return std::vector<float> The values
+     */
+    std::vector<float> make_values(float range)
+    {
+        std::vector<float> result(VALUE_COUNT);
+
+        for (std::size_t i = 0; i < VALUE_COUNT; ++i)
+            result[i] = range * (2.0f * static_cast<float>(i) / VALUE_COUNT - 1.0f);
+
+        return result;
+    }
+
+    /**
+     * @brief
+     * Applies a function to every value with libm
+     */
+    template <float (*Function)(float)>
+    void run_std(benchmark::State &state, float range)
+    {
+        std::vector<float> input = make_values(range);
+        std::vector<float> output(VALUE_COUNT);
+
+        for (auto _ : state)
+        {
+            for (std::size_t i = 0; i < VALUE_COUNT; ++i)
+                output[i] = Function(input[i]);
+
+            benchmark::DoNotOptimize(output.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * VALUE_COUNT);
+    }
+
+    /**
+     * @brief
+     * Applies a function to every value with the widest SIMD vector
+     */
+    template <class F>
+    void run_fast(benchmark::State &state, float range, F function)
+    {
+        using Math::Simd::WideFloat;
+
+        std::vector<float> input = make_values(range);
+        std::vector<float> output(VALUE_COUNT);
+
+        for (auto _ : state)
+        {
+            for (std::size_t i = 0; i < VALUE_COUNT; i += WideFloat::width)
+                function(WideFloat::load(input.data() + i)).store(output.data() + i);
+
+            benchmark::DoNotOptimize(output.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * VALUE_COUNT);
+    }
+
+    float std_sin(float x) { return std::sin(x); }
+    float std_exp(float x) { return std::exp(x); }
+    float std_rsqrt(float x) { return 1.0f / std::sqrt(x); }
+
+    void BM_Sin_Std(benchmark::State &state) { run_std<std_sin>(state, 100.0f); }
+    void BM_Exp_Std(benchmark::State &state) { run_std<std_exp>(state, 80.0f); }
+    void BM_Rsqrt_Std(benchmark::State &state) { run_std<std_rsqrt>(state, 1000.0f); }
+
+    void BM_Sin_Fast(benchmark::State &state)
+    {
+        run_fast(state, 100.0f, [](const auto &x) { return Math::Fast::sin(x); });
+    }
+
+    void BM_Exp_Fast(benchmark::State &state)
+    {
+        run_fast(state, 80.0f, [](const auto &x) { return Math::Fast::exp(x); });
+    }
+
+    void BM_Rsqrt_Fast(benchmark::State &state)
+    {
+        run_fast(state, 1000.0f, [](const auto &x) { return Math::Fast::rsqrt(x); });
+    }
+
+    void BM_Atan2_Std(benchmark::State &state)
+    {
+        std::vector<float> y = make_values(10.0f), x = make_values(7.0f);
+        std::vector<float> output(VALUE_COUNT);
+
+        for (auto _ : state)
+        {
+            for (std::size_t i = 0; i < VALUE_COUNT; ++i)
+                output[i] = std::atan2(y[i], x[VALUE_COUNT - 1 - i]);
+
+            benchmark::DoNotOptimize(output.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * VALUE_COUNT);
+    }
+
+    void BM_Atan2_Fast(benchmark::State &state)
+    {
+        using Math::Simd::WideFloat;
+
+        std::vector<float> y = make_values(10.0f), x = make_values(7.0f);
+        std::vector<float> output(VALUE_COUNT);
+
+        for (auto _ : state)
+        {
+            for (std::size_t i = 0; i < VALUE_COUNT; i += WideFloat::width)
+                Math::Fast::atan2(WideFloat::load(y.data() + i), WideFloat::load(x.data() + i))
+                    .store(output.data() + i);
+
+            benchmark::DoNotOptimize(output.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * VALUE_COUNT);
+    }
+
+    void BM_Normalize_Std(benchmark::State &state)
+    {
+        std::vector<float> x = make_values(3.0f), y = make_values(5.0f), z(VALUE_COUNT, 1.0f);
+
+        for (auto _ : state)
+        {
+            for (std::size_t i = 0; i < VALUE_COUNT; ++i)
+            {
+                float length = std::sqrt(x[i] * x[i] + y[i] * y[i] + z[i] * z[i]);
+                x[i] /= length;
+                y[i] /= length;
+                z[i] /= length;
+            }
+
+            benchmark::DoNotOptimize(x.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * VALUE_COUNT);
+    }
+
+    void BM_Normalize_Fast(benchmark::State &state)
+    {
+        std::vector<float> x = make_values(3.0f), y = make_values(5.0f), z(VALUE_COUNT, 1.0f);
+        Math::SoaView directions{x, y, z};
+
+        for (auto _ : state)
+        {
+            Math::normalize_directions(directions, directions);
+            benchmark::DoNotOptimize(x.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * VALUE_COUNT);
+    }
+}
+
+BENCHMARK(BM_Sin_Std);
+BENCHMARK(BM_Sin_Fast);
+BENCHMARK(BM_Exp_Std);
+BENCHMARK(BM_Exp_Fast);
+BENCHMARK(BM_Rsqrt_Std);
+BENCHMARK(BM_Rsqrt_Fast);
+BENCHMARK(BM_Atan2_Std);
+BENCHMARK(BM_Atan2_Fast);
+BENCHMARK(BM_Normalize_Std);
+BENCHMARK(BM_Normalize_Fast);
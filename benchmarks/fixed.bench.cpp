@@ -0,0 +1,84 @@
+/**
+ * @file fixed.bench.cpp
+ * @author Carlos Salguero
+ * @brief Benchmarks of the fixed-point formats against float
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// C++ Standard Library
+#include <cstddef>
+#include <vector>
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// Project files
+#include "utils/math/fixed.h"
+
+namespace
+{
+    /**
+     * @brief
+     * Integrates positions with velocities, as a lockstep simulation step
+     * would, in the given number type
+     * @tparam T float, Q16_16 or Q32_32
+     */
+    template <class T>
+    void BM_Integrate(benchmark::State &state)
+    {
+        auto count = static_cast<std::size_t>(state.range(0));
+        std::vector<T> positions(count);
+        std::vector<T> velocities(count);
+        const T step(1.0 / 60.0);
+        const T damping(0.99);
+        const T gravity(-0.16);
+
+        for (std::size_t i = 0; i < count; ++i)
+            velocities[i] = T(static_cast<double>(i % 17) - 8.0);
+
+        for (auto _ : state)
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                velocities[i] = velocities[i] * damping + gravity;
+                positions[i] = positions[i] + velocities[i] * step;
+            }
+
+            benchmark::DoNotOptimize(positions.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    template <class T>
+    void BM_Divide(benchmark::State &state)
+    {
+        auto count = static_cast<std::size_t>(state.range(0));
+        std::vector<T> values(count);
+        std::vector<T> result(count);
+
+        for (std::size_t i = 0; i < count; ++i)
+            values[i] = T(static_cast<double>(i % 29) + 1.5);
+
+        for (auto _ : state)
+        {
+            for (std::size_t i = 0; i < count; ++i)
+                result[i] = T(1) / values[i];
+
+            benchmark::DoNotOptimize(result.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+}
+
+BENCHMARK_TEMPLATE(BM_Integrate, float)->Arg(1 << 12);
+BENCHMARK_TEMPLATE(BM_Integrate, Math::Q16_16)->Arg(1 << 12);
+BENCHMARK_TEMPLATE(BM_Integrate, Math::Q32_32)->Arg(1 << 12);
+BENCHMARK_TEMPLATE(BM_Divide, float)->Arg(1 << 12);
+BENCHMARK_TEMPLATE(BM_Divide, Math::Q16_16)->Arg(1 << 12);
+BENCHMARK_TEMPLATE(BM_Divide, Math::Q32_32)->Arg(1 << 12);
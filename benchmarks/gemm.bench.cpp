@@ -0,0 +1,115 @@
+/**
+ * @file gemm.bench.cpp
+ * @author Carlos Salguero
+ * @brief Benchmarks of the blocked GEMM against the naive triple loop
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// C++ Standard Library
+#include <cstddef>
+#include <algorithm>
+#include <thread>
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// Project files
+#include "threads/thread_pool.h"
+#include "utils/math/matrix.h"
+
+namespace
+{
+    /**
+     * @brief
+     * Creates a square matrix filled with a deterministic pattern
+     * @param size Rows and columns of the matrix
+     * @return Math::Matrix<float> Filled matrix
+     */
+    Math::Matrix<float> make_matrix(std::size_t size)
+    {
+        Math::Matrix<float> matrix(size, size);
+
+        for (std::size_t i = 0; i < matrix.size(); ++i)
+            matrix.data()[i] = static_cast<float>(i % 13) * 0.0625f - 0.375f;
+
+        return matrix;
+    }
+
+    /**
+     * @brief
+     * Reports the multiply-adds of a square product as FLOP/s
+     * @param state Benchmark state
+     * @param size Rows and columns of the matrices
+     */
+    void set_flops(benchmark::State &state, std::size_t size)
+    {
+        state.counters["FLOPS"] = benchmark::Counter(
+            2.0 * static_cast<double>(size * size * size),
+            benchmark::Counter::kIsIterationInvariantRate);
+    }
+
+    void BM_Gemm_Naive(benchmark::State &state)
+    {
+        auto size = static_cast<std::size_t>(state.range(0));
+        const auto a = make_matrix(size);
+        const auto b = make_matrix(size);
+        Math::Matrix<float> c(size, size);
+
+        for (auto _ : state)
+        {
+            for (std::size_t i = 0; i < size; ++i)
+                for (std::size_t j = 0; j < size; ++j)
+                {
+                    float sum = 0.0f;
+
+                    for (std::size_t k = 0; k < size; ++k)
+                        sum += a.data()[i * size + k] * b.data()[k * size + j];
+
+                    c.data()[i * size + j] = sum;
+                }
+
+            benchmark::DoNotOptimize(c.data());
+        }
+
+        set_flops(state, size);
+    }
+
+    void BM_Gemm_Blocked(benchmark::State &state)
+    {
+        auto size = static_cast<std::size_t>(state.range(0));
+        const auto a = make_matrix(size);
+        const auto b = make_matrix(size);
+
+        for (auto _ : state)
+        {
+            auto c = a.multiply(b);
+            benchmark::DoNotOptimize(c.data());
+        }
+
+        set_flops(state, size);
+    }
+
+    void BM_Gemm_ThreadPool(benchmark::State &state)
+    {
+        auto size = static_cast<std::size_t>(state.range(0));
+        const auto a = make_matrix(size);
+        const auto b = make_matrix(size);
+        ThreadPool thread_pool(std::max(1u, std::thread::hardware_concurrency()));
+
+        for (auto _ : state)
+        {
+            auto c = a.multiply(b, &thread_pool);
+            benchmark::DoNotOptimize(c.data());
+        }
+
+        set_flops(state, size);
+    }
+}
+
+BENCHMARK(BM_Gemm_Naive)->RangeMultiplier(2)->Range(16, 512)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Gemm_Blocked)->RangeMultiplier(2)->Range(16, 1024)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Gemm_ThreadPool)->RangeMultiplier(2)->Range(256, 1024)->Unit(benchmark::kMicrosecond)->UseRealTime();
@@ -0,0 +1,233 @@
+/**
+ * @file geometry.bench.cpp
+ * @author Carlos Salguero
+ * @brief Benchmarks of the scalar and batched intersection tests
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// C++ Standard Library
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// Project files
+#include "utils/math/geometry.h"
+
+namespace
+{
+    /**
+     * @brief
+     * Scatters boxes and spheres through a 200 unit cube
+     */
+    struct Scene
+    {
+        std::vector<Math::Aabb> boxes;
+        std::vector<Math::Aabb8> packets;
+        std::vector<float> x, y, z, radii;
+        std::vector<float> ex, ey, ez;
+
+        explicit Scene(std::size_t count)
+        {
+            std::mt19937 generator(5);
+            std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+            std::uniform_real_distribution<float> size(0.5f, 4.0f);
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                Math::Vec3 center(position(generator), position(generator), position(generator));
+                Math::Vec3 extents(size(generator), size(generator), size(generator));
+
+                boxes.emplace_back(center - extents, center + extents);
+                x.push_back(center.x());
+                y.push_back(center.y());
+                z.push_back(center.z());
+                radii.push_back(extents.magnitude());
+                ex.push_back(extents.x());
+                ey.push_back(extents.y());
+                ez.push_back(extents.z());
+            }
+
+            for (std::size_t i = 0; i < count; i += 8)
+                packets.push_back(Math::Aabb8::load(
+                    std::span(boxes).subspan(i, std::min<std::size_t>(8, count - i))));
+        }
+    };
+
+    /**
+     * @brief
+     * Builds the frustum of a 90 degree camera at the origin looking down -z
+     */
+    Math::Frustum make_frustum()
+    {
+        float near = 0.1f;
+        float far = 150.0f;
+        Math::Mat4 projection;
+
+        projection(0, 0) = 1.0f;
+        projection(1, 1) = 1.0f;
+        projection(2, 2) = (far + near) / (near - far);
+        projection(2, 3) = 2.0f * far * near / (near - far);
+        projection(3, 2) = -1.0f;
+
+        return Math::Frustum::from_matrix(projection);
+    }
+
+    void BM_RayAabb_Scalar(benchmark::State &state)
+    {
+        Scene scene(static_cast<std::size_t>(state.range(0)));
+        Math::Ray ray(Math::Vec3(-120.0f, 1.0f, 2.0f), Math::Vec3(1.0f, 0.05f, 0.02f));
+
+        for (auto _ : state)
+        {
+            std::size_t hits = 0;
+
+            for (const auto &box : scene.boxes)
+                hits += ray.intersect(box).has_value();
+
+            benchmark::DoNotOptimize(hits);
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void BM_RayAabb_Aabb8(benchmark::State &state)
+    {
+        Scene scene(static_cast<std::size_t>(state.range(0)));
+        Math::Ray ray(Math::Vec3(-120.0f, 1.0f, 2.0f), Math::Vec3(1.0f, 0.05f, 0.02f));
+
+        for (auto _ : state)
+        {
+            std::size_t hits = 0;
+
+            for (const auto &packet : scene.packets)
+                hits += std::popcount(static_cast<unsigned>(packet.intersect(ray, 1000.0f)));
+
+            benchmark::DoNotOptimize(hits);
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void BM_AabbOverlap_Scalar(benchmark::State &state)
+    {
+        Scene scene(static_cast<std::size_t>(state.range(0)));
+        Math::Aabb query(Math::Vec3(-20.0f), Math::Vec3(20.0f));
+
+        for (auto _ : state)
+        {
+            std::size_t overlaps = 0;
+
+            for (const auto &box : scene.boxes)
+                overlaps += box.intersects(query);
+
+            benchmark::DoNotOptimize(overlaps);
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void BM_AabbOverlap_Aabb8(benchmark::State &state)
+    {
+        Scene scene(static_cast<std::size_t>(state.range(0)));
+        Math::Aabb query(Math::Vec3(-20.0f), Math::Vec3(20.0f));
+
+        for (auto _ : state)
+        {
+            std::size_t overlaps = 0;
+
+            for (const auto &packet : scene.packets)
+                overlaps += std::popcount(static_cast<unsigned>(packet.intersects(query)));
+
+            benchmark::DoNotOptimize(overlaps);
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void BM_FrustumSpheres_Scalar(benchmark::State &state)
+    {
+        Scene scene(static_cast<std::size_t>(state.range(0)));
+        Math::Frustum frustum = make_frustum();
+        std::vector<std::uint8_t> visible(scene.x.size());
+
+        for (auto _ : state)
+        {
+            for (std::size_t i = 0; i < visible.size(); ++i)
+                visible[i] = frustum.intersects(
+                    Math::Sphere(Math::Vec3(scene.x[i], scene.y[i], scene.z[i]), scene.radii[i]));
+
+            benchmark::DoNotOptimize(visible.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void BM_FrustumSpheres_Batch(benchmark::State &state)
+    {
+        Scene scene(static_cast<std::size_t>(state.range(0)));
+        Math::Frustum frustum = make_frustum();
+        std::vector<std::uint8_t> visible(scene.x.size());
+
+        for (auto _ : state)
+        {
+            auto count = Math::cull_spheres(frustum, Math::ConstSoaView(scene.x, scene.y, scene.z),
+                                            scene.radii, visible);
+            benchmark::DoNotOptimize(count);
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void BM_FrustumBoxes_Scalar(benchmark::State &state)
+    {
+        Scene scene(static_cast<std::size_t>(state.range(0)));
+        Math::Frustum frustum = make_frustum();
+        std::vector<std::uint8_t> visible(scene.boxes.size());
+
+        for (auto _ : state)
+        {
+            for (std::size_t i = 0; i < visible.size(); ++i)
+                visible[i] = frustum.intersects(scene.boxes[i]);
+
+            benchmark::DoNotOptimize(visible.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void BM_FrustumBoxes_Batch(benchmark::State &state)
+    {
+        Scene scene(static_cast<std::size_t>(state.range(0)));
+        Math::Frustum frustum = make_frustum();
+        std::vector<std::uint8_t> visible(scene.boxes.size());
+
+        for (auto _ : state)
+        {
+            auto count = Math::cull_boxes(frustum, Math::ConstSoaView(scene.x, scene.y, scene.z),
+                                          Math::ConstSoaView(scene.ex, scene.ey, scene.ez),
+                                          visible);
+            benchmark::DoNotOptimize(count);
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+}
+
+BENCHMARK(BM_RayAabb_Scalar)->Arg(1 << 12);
+BENCHMARK(BM_RayAabb_Aabb8)->Arg(1 << 12);
+BENCHMARK(BM_AabbOverlap_Scalar)->Arg(1 << 12);
+BENCHMARK(BM_AabbOverlap_Aabb8)->Arg(1 << 12);
+BENCHMARK(BM_FrustumSpheres_Scalar)->Arg(1 << 12);
+BENCHMARK(BM_FrustumSpheres_Batch)->Arg(1 << 12);
+BENCHMARK(BM_FrustumBoxes_Scalar)->Arg(1 << 12);
+BENCHMARK(BM_FrustumBoxes_Batch)->Arg(1 << 12);
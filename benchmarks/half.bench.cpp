@@ -0,0 +1,110 @@
+/**
+ * @file half.bench.cpp
+ * @author Carlos Salguero
+ * @brief Benchmarks of the half to float array conversions
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// C++ Standard Library
+#include <cstddef>
+#include <vector>
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// Project files
+#include "utils/math/half.h"
+
+namespace
+{
+    /**
+     * @brief
+     * Creates floats spread over the range of a half
+     * @param count Number of floats
+     * @return std::vector<float> The floats
+     */
+    std::vector<float> make_floats(std::size_t count)
+    {
+        std::vector<float> values(count);
+
+        for (std::size_t i = 0; i < count; ++i)
+            values[i] = (static_cast<float>(i % 2001) - 1000.0f) * 0.37f;
+
+        return values;
+    }
+
+    void BM_PackHalves_Scalar(benchmark::State &state)
+    {
+        auto source = make_floats(static_cast<std::size_t>(state.range(0)));
+        std::vector<Math::Half> destination(source.size());
+
+        for (auto _ : state)
+        {
+            for (std::size_t i = 0; i < source.size(); ++i)
+                destination[i] = Math::Half(source[i]);
+
+            benchmark::DoNotOptimize(destination.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void BM_PackHalves(benchmark::State &state)
+    {
+        auto source = make_floats(static_cast<std::size_t>(state.range(0)));
+        std::vector<Math::Half> destination(source.size());
+
+        for (auto _ : state)
+        {
+            Math::pack_halves(source, destination);
+            benchmark::DoNotOptimize(destination.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void BM_UnpackHalves_Scalar(benchmark::State &state)
+    {
+        auto floats = make_floats(static_cast<std::size_t>(state.range(0)));
+        std::vector<Math::Half> source(floats.size());
+        std::vector<float> destination(floats.size());
+
+        Math::pack_halves(floats, source);
+
+        for (auto _ : state)
+        {
+            for (std::size_t i = 0; i < source.size(); ++i)
+                destination[i] = source[i];
+
+            benchmark::DoNotOptimize(destination.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void BM_UnpackHalves(benchmark::State &state)
+    {
+        auto floats = make_floats(static_cast<std::size_t>(state.range(0)));
+        std::vector<Math::Half> source(floats.size());
+        std::vector<float> destination(floats.size());
+
+        Math::pack_halves(floats, source);
+
+        for (auto _ : state)
+        {
+            Math::unpack_halves(source, destination);
+            benchmark::DoNotOptimize(destination.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+}
+
+BENCHMARK(BM_PackHalves_Scalar)->Arg(1 << 16);
+BENCHMARK(BM_PackHalves)->Arg(1 << 16);
+BENCHMARK(BM_UnpackHalves_Scalar)->Arg(1 << 16);
+BENCHMARK(BM_UnpackHalves)->Arg(1 << 16);
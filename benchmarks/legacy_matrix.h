@@ -0,0 +1,112 @@
+/**
+ * @file legacy_matrix.h
+ * @author Carlos Salguero
+ * @brief Hash map backed matrix kept as a baseline for the benchmarks
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#pragma once
+
+// C++ Standard Library
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+namespace Benchmarks
+{
+    /**
+     * @brief
+     * Hash of a (row, column) pair
+     */
+    struct PositionHash
+    {
+        std::size_t operator()(const std::pair<std::size_t, std::size_t> &position) const
+        {
+            std::size_t seed = std::hash<std::size_t>{}(position.first);
+            return seed ^ (std::hash<std::size_t>{}(position.second) +
+                           0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2));
+        }
+    };
+
+    /**
+     * @class LegacyMatrix
+     * @brief Previous storage of Math::Matrix: one hash map node per
+     *        (row, column) pair. Only the operations that are benchmarked
+     *        are reproduced.
+     * @tparam T Type of the elements
+     */
+    template <class T>
+    class LegacyMatrix
+    {
+    public:
+        // Constructors
+        LegacyMatrix(std::size_t rows, std::size_t cols)
+            : m_rows(rows), m_cols(cols) {}
+
+        // Operators
+        T &operator()(std::size_t row, std::size_t col)
+        {
+            if (row >= m_rows || col >= m_cols)
+                throw std::out_of_range("Matrix subscript out of range");
+
+            return m_elements[std::make_pair(row, col)];
+        }
+
+        const T &operator()(std::size_t row, std::size_t col) const
+        {
+            if (row >= m_rows || col >= m_cols)
+                throw std::out_of_range("Matrix subscript out of range");
+
+            return m_elements.at(std::make_pair(row, col));
+        }
+
+        LegacyMatrix &operator*=(const LegacyMatrix &other)
+        {
+            if (m_cols != other.m_rows)
+                throw std::invalid_argument("Matrix multiplication of incompatible sizes");
+
+            LegacyMatrix result(m_rows, other.m_cols);
+
+            for (std::size_t i = 0; i < m_rows; ++i)
+                for (std::size_t j = 0; j < other.m_cols; ++j)
+                    for (std::size_t k = 0; k < m_cols; ++k)
+                        result(i, j) += (*this)(i, k) * other(k, j);
+
+            *this = std::move(result);
+
+            return *this;
+        }
+
+        // Methods
+        std::size_t rows() const
+        {
+            return m_rows;
+        }
+
+        std::size_t cols() const
+        {
+            return m_cols;
+        }
+
+        LegacyMatrix transpose() const
+        {
+            LegacyMatrix result(m_cols, m_rows);
+
+            for (auto &element : m_elements)
+                result(element.first.second, element.first.first) = element.second;
+
+            return result;
+        }
+
+    private:
+        std::size_t m_rows;
+        std::size_t m_cols;
+        std::unordered_map<std::pair<std::size_t, std::size_t>, T, PositionHash> m_elements;
+    };
+}
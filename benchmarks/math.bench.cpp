@@ -0,0 +1,91 @@
+/**
+ * @file math.bench.cpp
+ * @author Carlos Salguero
+ * @brief Benchmarks of the scalar functions of the math namespace
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// C++ Standard Library
+#include <cstddef>
+#include <vector>
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// Project files
+#include "allocation_counter.h"
+#include "utils/math/math.h"
+
+namespace
+{
+    /**
+     * @brief
+     * Applies a scalar function to every element of an array of values in
+     * (0, range]
+     * @tparam Function The function to measure
+     * @param state The benchmark state
+     * @param range Largest input
+     */
+    template <float (*Function)(float)>
+    void run_unary(benchmark::State &state, float range)
+    {
+        std::vector<float> values(static_cast<std::size_t>(state.range(0)));
+
+        for (std::size_t i = 0; i < values.size(); ++i)
+            values[i] = range * static_cast<float>(i + 1) / static_cast<float>(values.size());
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        for (auto _ : state)
+        {
+            float sum = 0.0f;
+
+            for (float value : values)
+                sum += Function(value);
+
+            benchmark::DoNotOptimize(sum);
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    float lerp_half(float value)
+    {
+        return Math::lerp(value, 1.0f, 0.5f);
+    }
+
+    float power_three(float value)
+    {
+        return Math::power(value, 3);
+    }
+
+    void BM_SquareRoot(benchmark::State &state) { run_unary<Math::square_root<float>>(state, 100.0f); }
+    void BM_CubeRoot(benchmark::State &state) { run_unary<Math::cube_root<float>>(state, 100.0f); }
+    void BM_Sine(benchmark::State &state) { run_unary<Math::sine<float>>(state, 100.0f); }
+    void BM_Cosine(benchmark::State &state) { run_unary<Math::cosine<float>>(state, 100.0f); }
+    void BM_Tangent(benchmark::State &state) { run_unary<Math::tangent<float>>(state, 1.5f); }
+    void BM_ArcCosine(benchmark::State &state) { run_unary<Math::arc_cosine<float>>(state, 1.0f); }
+    void BM_Logarithm(benchmark::State &state) { run_unary<Math::logarithm<float>>(state, 100.0f); }
+    void BM_Absolute(benchmark::State &state) { run_unary<Math::absolute<float>>(state, 100.0f); }
+    void BM_Inverse(benchmark::State &state) { run_unary<Math::inverse<float>>(state, 100.0f); }
+    void BM_Power(benchmark::State &state) { run_unary<power_three>(state, 10.0f); }
+    void BM_Lerp(benchmark::State &state) { run_unary<lerp_half>(state, 100.0f); }
+    void BM_DegreesToRadians(benchmark::State &state) { run_unary<Math::degrees_to_radians<float>>(state, 360.0f); }
+}
+
+BENCHMARK(BM_SquareRoot)->Arg(1 << 12);
+BENCHMARK(BM_CubeRoot)->Arg(1 << 12);
+BENCHMARK(BM_Sine)->Arg(1 << 12);
+BENCHMARK(BM_Cosine)->Arg(1 << 12);
+BENCHMARK(BM_Tangent)->Arg(1 << 12);
+BENCHMARK(BM_ArcCosine)->Arg(1 << 12);
+BENCHMARK(BM_Logarithm)->Arg(1 << 12);
+BENCHMARK(BM_Absolute)->Arg(1 << 12);
+BENCHMARK(BM_Inverse)->Arg(1 << 12);
+BENCHMARK(BM_Power)->Arg(1 << 12);
+BENCHMARK(BM_Lerp)->Arg(1 << 12);
+BENCHMARK(BM_DegreesToRadians)->Arg(1 << 12);
@@ -0,0 +1,137 @@
+/**
+ * @file matrix.bench.cpp
+ * @author Carlos Salguero
+ * @brief Benchmarks of the dense matrix against the hash map baseline
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// C++ Standard Library
+#include <cstddef>
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// Project files
+#include "allocation_counter.h"
+#include "legacy_matrix.h"
+#include "utils/math/matrix.h"
+
+namespace
+{
+    /**
+     * @brief
+     * Creates a matrix filled with a deterministic pattern
+     * @tparam MatrixType Type of the matrix
+     * @param size Rows and columns of the matrix
+     * @return MatrixType Filled matrix
+     */
+    template <class MatrixType>
+    MatrixType make_matrix(std::size_t size)
+    {
+        MatrixType matrix(size, size);
+
+        for (std::size_t i = 0; i < size; ++i)
+            for (std::size_t j = 0; j < size; ++j)
+                matrix(i, j) = static_cast<float>((i * 7 + j * 3) % 11) * 0.125f;
+
+        return matrix;
+    }
+
+    template <class MatrixType>
+    void BM_ElementAccess(benchmark::State &state)
+    {
+        auto size = static_cast<std::size_t>(state.range(0));
+        const auto matrix = make_matrix<MatrixType>(size);
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        for (auto _ : state)
+        {
+            float sum = 0.0f;
+
+            for (std::size_t i = 0; i < size; ++i)
+                for (std::size_t j = 0; j < size; ++j)
+                    sum += matrix(i, j);
+
+            benchmark::DoNotOptimize(sum);
+        }
+
+        state.SetItemsProcessed(state.iterations() *
+                                static_cast<std::int64_t>(size * size));
+    }
+
+    template <class MatrixType>
+    void BM_Transpose(benchmark::State &state)
+    {
+        auto size = static_cast<std::size_t>(state.range(0));
+        const auto matrix = make_matrix<MatrixType>(size);
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        for (auto _ : state)
+        {
+            auto result = matrix.transpose();
+            benchmark::DoNotOptimize(result);
+        }
+
+        state.SetItemsProcessed(state.iterations() *
+                                static_cast<std::int64_t>(size * size));
+    }
+
+    template <class MatrixType>
+    void BM_Multiply(benchmark::State &state)
+    {
+        auto size = static_cast<std::size_t>(state.range(0));
+        const auto lhs = make_matrix<MatrixType>(size);
+        const auto rhs = make_matrix<MatrixType>(size);
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        for (auto _ : state)
+        {
+            auto result = lhs;
+            result *= rhs;
+            benchmark::DoNotOptimize(result);
+        }
+
+        state.SetItemsProcessed(state.iterations() *
+                                static_cast<std::int64_t>(size * size * size));
+    }
+
+    template <class MatrixType>
+    void BM_Expression(benchmark::State &state)
+    {
+        auto size = static_cast<std::size_t>(state.range(0));
+        const auto a = make_matrix<MatrixType>(size);
+        const auto b = make_matrix<MatrixType>(size);
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        for (auto _ : state)
+        {
+            MatrixType result = a + b * 2.0f - a;
+            benchmark::DoNotOptimize(result);
+        }
+
+        state.SetItemsProcessed(state.iterations() *
+                                static_cast<std::int64_t>(size * size));
+    }
+
+    using DenseMatrix = Math::Matrix<float>;
+    using ColumnMajorMatrix = Math::Matrix<float, Math::MatrixLayout::ColumnMajor>;
+    using HashMatrix = Benchmarks::LegacyMatrix<float>;
+}
+
+BENCHMARK_TEMPLATE(BM_ElementAccess, HashMatrix)->RangeMultiplier(4)->Range(16, 256);
+BENCHMARK_TEMPLATE(BM_ElementAccess, DenseMatrix)->RangeMultiplier(4)->Range(16, 256);
+BENCHMARK_TEMPLATE(BM_Transpose, HashMatrix)->RangeMultiplier(4)->Range(16, 256);
+BENCHMARK_TEMPLATE(BM_Transpose, DenseMatrix)->RangeMultiplier(4)->Range(16, 256);
+BENCHMARK_TEMPLATE(BM_Transpose, ColumnMajorMatrix)->RangeMultiplier(4)->Range(16, 256);
+BENCHMARK_TEMPLATE(BM_Multiply, HashMatrix)->RangeMultiplier(4)->Range(16, 64);
+BENCHMARK_TEMPLATE(BM_Multiply, DenseMatrix)->RangeMultiplier(4)->Range(16, 64);
+BENCHMARK_TEMPLATE(BM_Expression, DenseMatrix)->RangeMultiplier(4)->Range(16, 256);
+BENCHMARK_TEMPLATE(BM_Expression, ColumnMajorMatrix)->RangeMultiplier(4)->Range(16, 256);
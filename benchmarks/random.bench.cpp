@@ -0,0 +1,310 @@
+/**
+ * @file random.bench.cpp
+ * @author Carlos Salguero
+ * @brief Benchmarks of the random generators, distributions and engine
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <thread>
+#include <vector>
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// Project files
+#include "allocation_counter.h"
+#include "utils/random/random.h"
+#include "threads/thread_pool.h"
+
+namespace
+{
+    void set_items(benchmark::State &state)
+    {
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    template <class Generator>
+    void BM_Random_Generator(benchmark::State &state)
+    {
+        Generator generator(42);
+        std::vector<std::uint64_t> values(static_cast<std::size_t>(state.range(0)));
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        for (auto _ : state)
+        {
+            for (auto &value : values)
+                value = generator();
+
+            benchmark::DoNotOptimize(values.data());
+        }
+
+        set_items(state);
+    }
+
+    template <class Distribution>
+    void BM_Random_Distribution(benchmark::State &state)
+    {
+        Math::Xoshiro256StarStar generator(42);
+        Distribution distribution;
+        std::vector<typename Distribution::result_type> values(static_cast<std::size_t>(state.range(0)));
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        for (auto _ : state)
+        {
+            for (auto &value : values)
+                value = distribution(generator);
+
+            benchmark::DoNotOptimize(values.data());
+        }
+
+        set_items(state);
+    }
+
+    void BM_Random_ParallelGenerate(benchmark::State &state)
+    {
+        ThreadPool thread_pool(std::max(1u, std::thread::hardware_concurrency()));
+        std::vector<float> values(static_cast<std::size_t>(state.range(0)));
+        Math::UniformRealDistribution<float> distribution;
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        for (auto _ : state)
+        {
+            Math::parallel_generate(values.size(), 42, [&](std::size_t i, Math::Philox4x32 &generator)
+                                    { values[i] = distribution(generator); }, &thread_pool);
+
+            benchmark::DoNotOptimize(values.data());
+        }
+
+        set_items(state);
+    }
+
+    void BM_Random_Number(benchmark::State &state)
+    {
+        Math::RandomEngine<float> engine(0.0f, 1.0f);
+        std::vector<float> values(static_cast<std::size_t>(state.range(0)));
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        for (auto _ : state)
+        {
+            for (auto &value : values)
+                value = engine.get_random_number();
+
+            benchmark::DoNotOptimize(values.data());
+        }
+
+        set_items(state);
+    }
+
+    void BM_Random_NumberInRange(benchmark::State &state)
+    {
+        Math::RandomEngine<float> engine(0.0f, 1.0f);
+        std::vector<float> values(static_cast<std::size_t>(state.range(0)));
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        for (auto _ : state)
+        {
+            for (auto &value : values)
+                value = engine.get_random_number(-5.0f, 5.0f);
+
+            benchmark::DoNotOptimize(values.data());
+        }
+
+        set_items(state);
+    }
+
+    void BM_Random_FillUniform(benchmark::State &state)
+    {
+        Math::RandomEngine<float> engine(0.0f, 1.0f);
+        std::vector<float> values(static_cast<std::size_t>(state.range(0)));
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        for (auto _ : state)
+        {
+            engine.fill_uniform(values, -5.0f, 5.0f);
+            benchmark::DoNotOptimize(values.data());
+        }
+
+        set_items(state);
+    }
+
+    void BM_Random_Normal(benchmark::State &state)
+    {
+        Math::Xoshiro256StarStar generator(42);
+        Math::NormalDistribution<float> distribution;
+        std::vector<float> values(static_cast<std::size_t>(state.range(0)));
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        for (auto _ : state)
+        {
+            for (auto &value : values)
+                value = distribution(generator);
+
+            benchmark::DoNotOptimize(values.data());
+        }
+
+        set_items(state);
+    }
+
+    void BM_Random_FillNormal(benchmark::State &state)
+    {
+        Math::RandomEngine<float> engine(0.0f, 1.0f);
+        std::vector<float> values(static_cast<std::size_t>(state.range(0)));
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        for (auto _ : state)
+        {
+            engine.fill_normal(values, 0.0f, 1.0f);
+            benchmark::DoNotOptimize(values.data());
+        }
+
+        set_items(state);
+    }
+
+    void BM_Random_Directions3D(benchmark::State &state)
+    {
+        Math::RandomEngine<float> engine(-1.0f, 1.0f);
+        std::vector<Math::Vector<float>> values(static_cast<std::size_t>(state.range(0)));
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        for (auto _ : state)
+        {
+            for (auto &value : values)
+                value = engine.get_random_direction_vector3D();
+
+            benchmark::DoNotOptimize(values.data());
+        }
+
+        set_items(state);
+    }
+
+    void BM_Random_FillUnitVectors3(benchmark::State &state)
+    {
+        Math::RandomEngine<float> engine(0.0f, 1.0f);
+        std::size_t count = static_cast<std::size_t>(state.range(0));
+        std::vector<float> x(count), y(count), z(count);
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        for (auto _ : state)
+        {
+            engine.fill_unit_vectors3({x, y, z});
+            benchmark::DoNotOptimize(x.data());
+        }
+
+        set_items(state);
+    }
+
+    void BM_Random_Vector3D(benchmark::State &state)
+    {
+        Math::RandomEngine<float> engine(0.0f, 1.0f);
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        for (auto _ : state)
+        {
+            auto vector = engine.get_random_vector3D(-1.0f, 1.0f);
+            benchmark::DoNotOptimize(vector[0]);
+        }
+    }
+
+    void BM_Random_Direction3D(benchmark::State &state)
+    {
+        Math::RandomEngine<float> engine(-1.0f, 1.0f);
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        for (auto _ : state)
+        {
+            auto vector = engine.get_random_direction_vector3D();
+            benchmark::DoNotOptimize(vector[0]);
+        }
+    }
+
+    void BM_Random_Color(benchmark::State &state)
+    {
+        Math::RandomEngine<float> engine(0.0f, 1.0f);
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        for (auto _ : state)
+        {
+            auto color = engine.get_random_color();
+            benchmark::DoNotOptimize(color);
+        }
+    }
+
+    void BM_Random_Rotation(benchmark::State &state)
+    {
+        Math::RandomEngine<float> engine(0.0f, 1.0f);
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        for (auto _ : state)
+        {
+            auto rotation = engine.get_random_rotation();
+            benchmark::DoNotOptimize(rotation);
+        }
+    }
+
+    void BM_Random_Shuffle(benchmark::State &state)
+    {
+        Math::RandomEngine<float> engine(0.0f, 1.0f);
+        std::vector<float> values(static_cast<std::size_t>(state.range(0)));
+
+        for (std::size_t i = 0; i < values.size(); ++i)
+            values[i] = static_cast<float>(i);
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        for (auto _ : state)
+        {
+            engine.shuffle_vector(values);
+            benchmark::DoNotOptimize(values.data());
+        }
+
+        set_items(state);
+    }
+}
+
+BENCHMARK_TEMPLATE(BM_Random_Generator, std::mt19937_64)->Arg(1 << 12);
+BENCHMARK_TEMPLATE(BM_Random_Generator, Math::SplitMix64)->Arg(1 << 12);
+BENCHMARK_TEMPLATE(BM_Random_Generator, Math::Xoshiro256StarStar)->Arg(1 << 12);
+BENCHMARK_TEMPLATE(BM_Random_Generator, Math::Pcg64)->Arg(1 << 12);
+BENCHMARK_TEMPLATE(BM_Random_Generator, Math::Philox4x32)->Arg(1 << 12);
+BENCHMARK_TEMPLATE(BM_Random_Distribution, std::uniform_real_distribution<float>)->Arg(1 << 12);
+BENCHMARK_TEMPLATE(BM_Random_Distribution, Math::UniformRealDistribution<float>)->Arg(1 << 12);
+BENCHMARK_TEMPLATE(BM_Random_Distribution, std::uniform_int_distribution<int>)->Arg(1 << 12);
+BENCHMARK_TEMPLATE(BM_Random_Distribution, Math::UniformIntDistribution<int>)->Arg(1 << 12);
+BENCHMARK_TEMPLATE(BM_Random_Distribution, std::normal_distribution<float>)->Arg(1 << 12);
+BENCHMARK_TEMPLATE(BM_Random_Distribution, Math::NormalDistribution<float>)->Arg(1 << 12);
+BENCHMARK(BM_Random_ParallelGenerate)->RangeMultiplier(16)->Range(1 << 12, 1 << 20)->UseRealTime();
+BENCHMARK(BM_Random_Number)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK(BM_Random_NumberInRange)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK(BM_Random_FillUniform)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK(BM_Random_Normal)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK(BM_Random_FillNormal)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK(BM_Random_Directions3D)->Arg(100000);
+BENCHMARK(BM_Random_FillUnitVectors3)->Arg(100000);
+BENCHMARK(BM_Random_Vector3D);
+BENCHMARK(BM_Random_Direction3D);
+BENCHMARK(BM_Random_Color);
+BENCHMARK(BM_Random_Rotation);
+BENCHMARK(BM_Random_Shuffle)->RangeMultiplier(16)->Range(16, 1 << 16);
@@ -0,0 +1,174 @@
+/**
+ * @file simd.bench.cpp
+ * @author Carlos Salguero
+ * @brief Benchmarks of the SIMD 4x4 kernels against the scalar Mat4
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// C++ Standard Library
+#include <cstddef>
+#include <vector>
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// Project files
+#include "utils/math/simd.h"
+
+namespace
+{
+    constexpr std::size_t POINT_COUNT = 4096;
+
+    /**
+     * @brief
+     * Creates an invertible matrix with a deterministic pattern
+     * @param seed Value that varies the pattern
+     * @return Math::Mat4 The matrix
+     */
+    Math::Mat4 make_mat4(float seed)
+    {
+        Math::Mat4 result = Math::Mat4::identity() * 2.0f;
+
+        for (std::size_t i = 0; i < 4; ++i)
+            for (std::size_t j = 0; j < 4; ++j)
+                result(i, j) += static_cast<float>((i * 5 + j * 3) % 7) * 0.1f * seed;
+
+        return result;
+    }
+
+    void BM_Mat4Multiply_Scalar(benchmark::State &state)
+    {
+        Math::Mat4 a = make_mat4(1.0f);
+        Math::Mat4 b = make_mat4(0.5f);
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(a);
+            Math::Mat4 result = a * b;
+            benchmark::DoNotOptimize(result);
+        }
+    }
+
+    void BM_Mat4Multiply_Simd(benchmark::State &state)
+    {
+        Math::Simd::Float4x4 a(make_mat4(1.0f));
+        Math::Simd::Float4x4 b(make_mat4(0.5f));
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(a);
+            Math::Simd::Float4x4 result = a * b;
+            benchmark::DoNotOptimize(result);
+        }
+    }
+
+    void BM_Mat4Transform_Scalar(benchmark::State &state)
+    {
+        Math::Mat4 matrix = make_mat4(1.0f);
+        std::vector<Math::Vec4> points(POINT_COUNT, Math::Vec4(1.0f, 2.0f, 3.0f, 1.0f));
+
+        for (auto _ : state)
+        {
+            for (auto &point : points)
+                point = matrix * point;
+
+            benchmark::DoNotOptimize(points.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * POINT_COUNT);
+    }
+
+    void BM_Mat4Transform_Simd(benchmark::State &state)
+    {
+        Math::Simd::Float4x4 matrix(make_mat4(1.0f));
+        std::vector<Math::Simd::Float4> points(POINT_COUNT,
+                                               Math::Simd::Float4(1.0f, 2.0f, 3.0f, 1.0f));
+
+        for (auto _ : state)
+        {
+            for (auto &point : points)
+                point = matrix * point;
+
+            benchmark::DoNotOptimize(points.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * POINT_COUNT);
+    }
+
+    void BM_Mat4Inverse_Cofactor(benchmark::State &state)
+    {
+        Math::Mat4 matrix = make_mat4(1.0f);
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(matrix);
+            Math::Mat4 result;
+            float determinant = matrix.determinant();
+
+            for (std::size_t i = 0; i < 4; ++i)
+                for (std::size_t j = 0; j < 4; ++j)
+                {
+                    float sign = (i + j) % 2 == 0 ? 1.0f : -1.0f;
+                    result(j, i) = sign * matrix.minor(i, j).determinant() / determinant;
+                }
+
+            benchmark::DoNotOptimize(result);
+        }
+    }
+
+    void BM_Mat4Inverse_Simd(benchmark::State &state)
+    {
+        Math::Simd::Float4x4 matrix(make_mat4(1.0f));
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(matrix);
+            Math::Simd::Float4x4 result = matrix.inverse();
+            benchmark::DoNotOptimize(result);
+        }
+    }
+
+    void BM_Normalize3_Scalar(benchmark::State &state)
+    {
+        std::vector<Math::Vec3> vectors(POINT_COUNT, Math::Vec3(1.0f, 2.0f, 3.0f));
+
+        for (auto _ : state)
+        {
+            for (auto &vector : vectors)
+                vector = (vector * 2.0f).normalize();
+
+            benchmark::DoNotOptimize(vectors.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * POINT_COUNT);
+    }
+
+    void BM_Normalize3_Simd(benchmark::State &state)
+    {
+        std::vector<Math::Simd::Float4> vectors(POINT_COUNT,
+                                                Math::Simd::Float4(1.0f, 2.0f, 3.0f, 0.0f));
+
+        for (auto _ : state)
+        {
+            for (auto &vector : vectors)
+                vector = (vector * 2.0f).normalize3();
+
+            benchmark::DoNotOptimize(vectors.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * POINT_COUNT);
+    }
+}
+
+BENCHMARK(BM_Mat4Multiply_Scalar);
+BENCHMARK(BM_Mat4Multiply_Simd);
+BENCHMARK(BM_Mat4Transform_Scalar);
+BENCHMARK(BM_Mat4Transform_Simd);
+BENCHMARK(BM_Mat4Inverse_Cofactor);
+BENCHMARK(BM_Mat4Inverse_Simd);
+BENCHMARK(BM_Normalize3_Scalar);
+BENCHMARK(BM_Normalize3_Simd);
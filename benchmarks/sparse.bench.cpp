@@ -0,0 +1,193 @@
+/**
+ * @file sparse.bench.cpp
+ * @author Carlos Salguero
+ * @brief Benchmarks of the sparse products and iterative solvers
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// Project files
+#include "threads/thread_pool.h"
+#include "utils/math/sparse.h"
+
+namespace
+{
+    /**
+     * @brief
+     * Builds the stiffness-like matrix of a size x size grid of 3D nodes:
+     * a dense 3x3 tile for every node and each of its four neighbours
+     * @param size Nodes per side of the grid
+     * @return Math::SparseMatrix<float> The matrix
+     */
+    Math::SparseMatrix<float> make_grid(std::size_t size)
+    {
+        std::vector<Math::SparseEntry<float>> entries;
+
+        auto add_tile = [&](std::size_t node, std::size_t other, float value)
+        {
+            for (std::size_t r = 0; r < 3; ++r)
+                for (std::size_t c = 0; c < 3; ++c)
+                    entries.push_back({node * 3 + r, other * 3 + c, r == c ? value : value * 0.1f});
+        };
+
+        for (std::size_t y = 0; y < size; ++y)
+            for (std::size_t x = 0; x < size; ++x)
+            {
+                std::size_t node = y * size + x;
+                add_tile(node, node, 4.5f);
+
+                if (x > 0)
+                    add_tile(node, node - 1, -1.0f);
+                if (x + 1 < size)
+                    add_tile(node, node + 1, -1.0f);
+                if (y > 0)
+                    add_tile(node, node - size, -1.0f);
+                if (y + 1 < size)
+                    add_tile(node, node + size, -1.0f);
+            }
+
+        return Math::SparseMatrix<float>::from_entries(size * size * 3, size * size * 3,
+                                                       std::move(entries));
+    }
+
+    /**
+     * @brief
+     * Reports the bytes streamed by one product: the values, the indices
+     * and the vectors
+     */
+    void set_bytes(benchmark::State &state, std::size_t bytes)
+    {
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * bytes));
+    }
+
+    void BM_SpMV_Csr(benchmark::State &state)
+    {
+        auto matrix = make_grid(static_cast<std::size_t>(state.range(0)));
+        std::vector<float> x(matrix.cols(), 1.0f);
+        std::vector<float> y(matrix.rows());
+
+        for (auto _ : state)
+        {
+            matrix.multiply(x, y);
+            benchmark::DoNotOptimize(y.data());
+        }
+
+        set_bytes(state, matrix.non_zeros() * (sizeof(float) + sizeof(std::size_t)) +
+                             (x.size() + y.size()) * sizeof(float));
+    }
+
+    void BM_SpMV_Bsr(benchmark::State &state)
+    {
+        auto csr = make_grid(static_cast<std::size_t>(state.range(0)));
+        Math::BlockSparseMatrix<float, 3> matrix(csr);
+        std::vector<float> x(matrix.cols(), 1.0f);
+        std::vector<float> y(matrix.rows());
+
+        for (auto _ : state)
+        {
+            matrix.multiply(x, y);
+            benchmark::DoNotOptimize(y.data());
+        }
+
+        set_bytes(state, matrix.blocks() * (9 * sizeof(float) + sizeof(std::size_t)) +
+                             (x.size() + y.size()) * sizeof(float));
+    }
+
+    void BM_SpMV_Csr_ThreadPool(benchmark::State &state)
+    {
+        auto matrix = make_grid(static_cast<std::size_t>(state.range(0)));
+        std::vector<float> x(matrix.cols(), 1.0f);
+        std::vector<float> y(matrix.rows());
+        ThreadPool thread_pool(std::max(1u, std::thread::hardware_concurrency()));
+
+        for (auto _ : state)
+        {
+            matrix.multiply(x, y, &thread_pool);
+            benchmark::DoNotOptimize(y.data());
+        }
+
+        set_bytes(state, matrix.non_zeros() * (sizeof(float) + sizeof(std::size_t)) +
+                             (x.size() + y.size()) * sizeof(float));
+    }
+
+    void BM_SpMV_Bsr_ThreadPool(benchmark::State &state)
+    {
+        auto csr = make_grid(static_cast<std::size_t>(state.range(0)));
+        Math::BlockSparseMatrix<float, 3> matrix(csr);
+        std::vector<float> x(matrix.cols(), 1.0f);
+        std::vector<float> y(matrix.rows());
+        ThreadPool thread_pool(std::max(1u, std::thread::hardware_concurrency()));
+
+        for (auto _ : state)
+        {
+            matrix.multiply(x, y, &thread_pool);
+            benchmark::DoNotOptimize(y.data());
+        }
+
+        set_bytes(state, matrix.blocks() * (9 * sizeof(float) + sizeof(std::size_t)) +
+                             (x.size() + y.size()) * sizeof(float));
+    }
+
+    void BM_ConjugateGradient(benchmark::State &state)
+    {
+        auto matrix = make_grid(64);
+        Math::Vector<float> b(matrix.rows());
+        Math::SolverOptions<float> options;
+        options.tolerance = 1e-5f;
+        options.preconditioner = static_cast<Math::Preconditioner>(state.range(0));
+        std::size_t iterations = 0;
+
+        for (std::size_t i = 0; i < b.size(); ++i)
+            b[i] = 1.0f;
+
+        for (auto _ : state)
+        {
+            Math::Vector<float> x(matrix.rows());
+            iterations = Math::conjugate_gradient(matrix, b, x, options).iterations;
+            benchmark::DoNotOptimize(x[0]);
+        }
+
+        state.counters["iterations"] = static_cast<double>(iterations);
+    }
+
+    void BM_GaussSeidel(benchmark::State &state)
+    {
+        auto matrix = make_grid(64);
+        Math::Vector<float> b(matrix.rows());
+        Math::SolverOptions<float> options;
+        options.tolerance = 1e-5f;
+        options.max_iterations = 10000;
+        std::size_t iterations = 0;
+
+        for (std::size_t i = 0; i < b.size(); ++i)
+            b[i] = 1.0f;
+
+        for (auto _ : state)
+        {
+            Math::Vector<float> x(matrix.rows());
+            iterations = Math::gauss_seidel(matrix, b, x, options).iterations;
+            benchmark::DoNotOptimize(x[0]);
+        }
+
+        state.counters["iterations"] = static_cast<double>(iterations);
+    }
+}
+
+BENCHMARK(BM_SpMV_Csr)->RangeMultiplier(4)->Range(16, 512)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_SpMV_Bsr)->RangeMultiplier(4)->Range(16, 512)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_SpMV_Csr_ThreadPool)->RangeMultiplier(4)->Range(64, 512)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK(BM_SpMV_Bsr_ThreadPool)->RangeMultiplier(4)->Range(64, 512)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK(BM_ConjugateGradient)->DenseRange(0, 2)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_GaussSeidel)->Unit(benchmark::kMillisecond);
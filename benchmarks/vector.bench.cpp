@@ -0,0 +1,239 @@
+/**
+ * @file vector.bench.cpp
+ * @author Carlos Salguero
+ * @brief Benchmarks of the dynamic and statically sized vectors
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// C++ Standard Library
+#include <cstddef>
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// Project files
+#include "allocation_counter.h"
+#include "utils/math/vec.h"
+#include "utils/math/vector.h"
+
+namespace
+{
+    /**
+     * @brief
+     * Creates a dynamic vector filled with a deterministic pattern
+     * @param size Number of elements
+     * @param offset Shifts the pattern, so two vectors differ
+     * @return Math::Vector<float> The filled vector
+     */
+    Math::Vector<float> make_vector(std::size_t size, std::size_t offset = 0)
+    {
+        Math::Vector<float> vector(size);
+
+        for (std::size_t i = 0; i < size; ++i)
+            vector[i] = static_cast<float>((i + offset) % 13 + 1) * 0.25f;
+
+        return vector;
+    }
+
+    void set_items(benchmark::State &state)
+    {
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void BM_Vector_Construct(benchmark::State &state)
+    {
+        auto size = static_cast<std::size_t>(state.range(0));
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        for (auto _ : state)
+        {
+            Math::Vector<float> vector(size);
+            benchmark::DoNotOptimize(vector[0]);
+        }
+
+        set_items(state);
+    }
+
+    void BM_Vector_Expression(benchmark::State &state)
+    {
+        auto size = static_cast<std::size_t>(state.range(0));
+        auto a = make_vector(size);
+        auto b = make_vector(size, 5);
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        for (auto _ : state)
+        {
+            Math::Vector<float> result = a * b + 2.0f * a - b / 2.0f;
+            benchmark::DoNotOptimize(result[0]);
+        }
+
+        set_items(state);
+    }
+
+    void BM_Vector_CompoundAssign(benchmark::State &state)
+    {
+        auto size = static_cast<std::size_t>(state.range(0));
+        auto a = make_vector(size);
+        auto b = make_vector(size, 5);
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        for (auto _ : state)
+        {
+            a += b;
+            a -= b;
+            benchmark::DoNotOptimize(a[0]);
+        }
+
+        set_items(state);
+    }
+
+    void BM_Vector_Dot(benchmark::State &state)
+    {
+        auto size = static_cast<std::size_t>(state.range(0));
+        auto a = make_vector(size);
+        auto b = make_vector(size, 5);
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        for (auto _ : state)
+            benchmark::DoNotOptimize(a.dot(b));
+
+        set_items(state);
+    }
+
+    void BM_Vector_Magnitude(benchmark::State &state)
+    {
+        auto a = make_vector(static_cast<std::size_t>(state.range(0)));
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        for (auto _ : state)
+            benchmark::DoNotOptimize(a.magnitude());
+
+        set_items(state);
+    }
+
+    void BM_Vector_Normalize(benchmark::State &state)
+    {
+        auto a = make_vector(static_cast<std::size_t>(state.range(0)));
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        for (auto _ : state)
+        {
+            auto result = a.normalize();
+            benchmark::DoNotOptimize(result[0]);
+        }
+
+        set_items(state);
+    }
+
+    void BM_Vector_Lerp(benchmark::State &state)
+    {
+        auto size = static_cast<std::size_t>(state.range(0));
+        auto a = make_vector(size);
+        auto b = make_vector(size, 5);
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        for (auto _ : state)
+        {
+            auto result = a.lerp(b, 0.25f);
+            benchmark::DoNotOptimize(result[0]);
+        }
+
+        set_items(state);
+    }
+
+    void BM_Vector_Angle(benchmark::State &state)
+    {
+        auto size = static_cast<std::size_t>(state.range(0));
+        auto a = make_vector(size);
+        auto b = make_vector(size, 5);
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        for (auto _ : state)
+            benchmark::DoNotOptimize(a.angle(b));
+
+        set_items(state);
+    }
+
+    void BM_Vector_Cross(benchmark::State &state)
+    {
+        Math::Vector<float> a{1.0f, 2.0f, 3.0f};
+        Math::Vector<float> b{4.0f, 5.0f, 6.0f};
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        for (auto _ : state)
+        {
+            auto result = a.cross(b);
+            benchmark::DoNotOptimize(result[0]);
+        }
+    }
+
+    /**
+     * @brief
+     * Runs the same lerp and dot as the dynamic benchmarks on a vector
+     * whose size is known at compile time
+     */
+    void BM_Fixed_LerpDot(benchmark::State &state)
+    {
+        Math::Vec3 a(1.0f, 2.0f, 3.0f);
+        Math::Vec3 b(4.0f, 5.0f, 6.0f);
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(a);
+            benchmark::DoNotOptimize(a.lerp(b, 0.25f).dot(b));
+        }
+    }
+
+    void BM_Fixed_Normalize(benchmark::State &state)
+    {
+        Math::Vec3 a(1.0f, 2.0f, 3.0f);
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(a);
+            auto result = a.normalize();
+            benchmark::DoNotOptimize(result);
+        }
+    }
+
+    void BM_Dynamic_LerpDot(benchmark::State &state)
+    {
+        Math::Vector<float> a{1.0f, 2.0f, 3.0f};
+        Math::Vector<float> b{4.0f, 5.0f, 6.0f};
+
+        Benchmarks::AllocationCounter allocations(state);
+
+        for (auto _ : state)
+            benchmark::DoNotOptimize(a.lerp(b, 0.25f).dot(b));
+    }
+}
+
+BENCHMARK(BM_Vector_Construct)->RangeMultiplier(16)->Range(4, 1 << 16);
+BENCHMARK(BM_Vector_Expression)->RangeMultiplier(16)->Range(4, 1 << 16);
+BENCHMARK(BM_Vector_CompoundAssign)->RangeMultiplier(16)->Range(4, 1 << 16);
+BENCHMARK(BM_Vector_Dot)->RangeMultiplier(16)->Range(4, 1 << 16);
+BENCHMARK(BM_Vector_Magnitude)->RangeMultiplier(16)->Range(4, 1 << 16);
+BENCHMARK(BM_Vector_Normalize)->RangeMultiplier(16)->Range(4, 1 << 16);
+BENCHMARK(BM_Vector_Lerp)->RangeMultiplier(16)->Range(4, 1 << 16);
+BENCHMARK(BM_Vector_Angle)->RangeMultiplier(16)->Range(4, 1 << 16);
+BENCHMARK(BM_Vector_Cross);
+BENCHMARK(BM_Dynamic_LerpDot);
+BENCHMARK(BM_Fixed_LerpDot);
+BENCHMARK(BM_Fixed_Normalize);
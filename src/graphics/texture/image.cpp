@@ -0,0 +1,168 @@
+/**
+ * @file image.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of the Image class
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// C++ Standard Library
+#include <algorithm>
+#include <stdexcept>
+
+// STB Library
+#define STB_IMAGE_IMPLEMENTATION
+#include "stb_image.h"
+
+// Project files
+#include "image.h"
+
+// Constructors
+/**
+ * @brief
+ * Construct a new Image:: Image object filled with zeros
+ * @param width Width of the image in pixels
+ * @param height Height of the image in pixels
+ * @param channels Number of 8-bit channels per pixel
+ */
+Image::Image(std::uint32_t width, std::uint32_t height, std::uint32_t channels)
+    : m_width(width), m_height(height), m_channels(channels),
+      m_pixels(static_cast<std::size_t>(width) * height * channels)
+{
+}
+
+// Access Methods
+/**
+ * @brief
+ * Get the width of the image
+ * @return std::uint32_t Width in pixels
+ */
+std::uint32_t Image::get_width() const noexcept
+{
+    return m_width;
+}
+
+/**
+ * @brief
+ * Get the height of the image
+ * @return std::uint32_t Height in pixels
+ */
+std::uint32_t Image::get_height() const noexcept
+{
+    return m_height;
+}
+
+/**
+ * @brief
+ * Get the number of channels per pixel
+ * @return std::uint32_t Number of channels
+ */
+std::uint32_t Image::get_channels() const noexcept
+{
+    return m_channels;
+}
+
+/**
+ * @brief
+ * Get the size of the pixel data
+ * @return std::size_t Size in bytes
+ */
+std::size_t Image::get_size() const noexcept
+{
+    return m_pixels.size();
+}
+
+/**
+ * @brief
+ * Get a pointer to the first channel of a pixel
+ * @param x Column of the pixel
+ * @param y Row of the pixel
+ * @return std::uint8_t* Pointer to the pixel
+ */
+std::uint8_t *Image::get_pixel(std::uint32_t x, std::uint32_t y) noexcept
+{
+    return m_pixels.data() +
+           (static_cast<std::size_t>(y) * m_width + x) * m_channels;
+}
+
+/**
+ * @brief
+ * Get a pointer to the first channel of a pixel
+ * @param x Column of the pixel
+ * @param y Row of the pixel
+ * @return const std::uint8_t* Pointer to the pixel
+ */
+const std::uint8_t *Image::get_pixel(std::uint32_t x, std::uint32_t y) const noexcept
+{
+    return m_pixels.data() +
+           (static_cast<std::size_t>(y) * m_width + x) * m_channels;
+}
+
+/**
+ * @brief
+ * Get the pixel data
+ * @return std::vector<std::uint8_t>& Pixels, row by row
+ */
+std::vector<std::uint8_t> &Image::get_pixels() noexcept
+{
+    return m_pixels;
+}
+
+/**
+ * @brief
+ * Get the pixel data
+ * @return const std::vector<std::uint8_t>& Pixels, row by row
+ */
+const std::vector<std::uint8_t> &Image::get_pixels() const noexcept
+{
+    return m_pixels;
+}
+
+// Methods
+/**
+ * @brief
+ * Checks if the image has no pixels
+ * @return true The image is empty
+ * @return false The image has pixels
+ */
+bool Image::empty() const noexcept
+{
+    return m_pixels.empty();
+}
+
+// Static Methods
+/**
+ * @brief
+ * Decodes an encoded image (PNG, JPEG, TGA, ...) held in memory, such as
+ * the bytes returned by ResourceManager::get_resource
+ * @param data Encoded image
+ * @param channels Number of channels to decode to
+ * @return Image Decoded image
+ * @throw std::runtime_error The image could not be decoded
+ */
+Image Image::decode(const std::string &data, std::uint32_t channels)
+{
+    int width = 0;
+    int height = 0;
+    int file_channels = 0;
+
+    stbi_uc *pixels = stbi_load_from_memory(
+        reinterpret_cast<const stbi_uc *>(data.data()),
+        static_cast<int>(data.size()), &width, &height, &file_channels,
+        static_cast<int>(channels));
+
+    if (pixels == nullptr)
+        throw std::runtime_error(std::string("Failed to decode image: ") +
+                                 stbi_failure_reason());
+
+    Image image(static_cast<std::uint32_t>(width),
+                static_cast<std::uint32_t>(height), channels);
+    std::copy(pixels, pixels + image.get_size(), image.m_pixels.begin());
+
+    stbi_image_free(pixels);
+
+    return image;
+}
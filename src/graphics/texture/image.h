@@ -0,0 +1,58 @@
+/**
+ * @file image.h
+ * @author Carlos Salguero
+ * @brief Declaration of the Image class
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef IMAGE_H
+#define IMAGE_H
+
+// C++ Standard Library
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Class
+/**
+ * @class Image
+ * @brief Decoded image stored as tightly packed 8-bit channels
+ */
+class Image
+{
+public:
+    // Constructors
+    Image() = default;
+    Image(std::uint32_t, std::uint32_t, std::uint32_t = 4);
+
+    // Destructor
+    ~Image() = default;
+
+    // Access Methods
+    std::uint32_t get_width() const noexcept;
+    std::uint32_t get_height() const noexcept;
+    std::uint32_t get_channels() const noexcept;
+    std::size_t get_size() const noexcept;
+    std::uint8_t *get_pixel(std::uint32_t, std::uint32_t) noexcept;
+    const std::uint8_t *get_pixel(std::uint32_t, std::uint32_t) const noexcept;
+    std::vector<std::uint8_t> &get_pixels() noexcept;
+    const std::vector<std::uint8_t> &get_pixels() const noexcept;
+
+    // Methods
+    bool empty() const noexcept;
+
+    // Static Methods
+    static Image decode(const std::string &, std::uint32_t = 4);
+
+private:
+    std::uint32_t m_width = 0;
+    std::uint32_t m_height = 0;
+    std::uint32_t m_channels = 0;
+    std::vector<std::uint8_t> m_pixels;
+};
+
+#endif //! IMAGE_H
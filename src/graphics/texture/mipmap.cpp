@@ -0,0 +1,553 @@
+/**
+ * @file mipmap.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of the mipmap generator
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// C++ Standard Library
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numbers>
+#include <span>
+#include <stdexcept>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// Project files
+#include "mipmap.h"
+#include "../../utils/color/color_kernels.h"
+
+namespace
+{
+    // Rows processed by a single thread pool task
+    const std::uint32_t ROWS_PER_TASK = 32;
+
+    // Half width of the Kaiser kernel, in destination pixels
+    const int KAISER_RADIUS = 3;
+    const int KAISER_TAPS = 4 * KAISER_RADIUS;
+    const double KAISER_ALPHA = 4.0;
+
+    /**
+     * @struct Pixel
+     * @brief RGBA value of the filters, one SSE register when available
+     */
+    struct Pixel
+    {
+#if defined(__SSE2__)
+        __m128 value;
+#else
+        std::array<float, 4> value;
+#endif
+    };
+
+    /**
+     * @brief
+     * Loads four floats
+     * @param source Pointer to the floats
+     * @return Pixel Loaded pixel
+     */
+    inline Pixel load(const float *source)
+    {
+#if defined(__SSE2__)
+        return {_mm_loadu_ps(source)};
+#else
+        return {{source[0], source[1], source[2], source[3]}};
+#endif
+    }
+
+    /**
+     * @brief
+     * Stores four floats
+     * @param destination Pointer to the floats
+     * @param pixel Pixel to store
+     */
+    inline void store(float *destination, const Pixel &pixel)
+    {
+#if defined(__SSE2__)
+        _mm_storeu_ps(destination, pixel.value);
+#else
+        std::copy(pixel.value.begin(), pixel.value.end(), destination);
+#endif
+    }
+
+    /**
+     * @brief
+     * Pixel with every channel set to zero
+     * @return Pixel Zero pixel
+     */
+    inline Pixel zero()
+    {
+#if defined(__SSE2__)
+        return {_mm_setzero_ps()};
+#else
+        return {{0.0f, 0.0f, 0.0f, 0.0f}};
+#endif
+    }
+
+    /**
+     * @brief
+     * Adds the product of a pixel and a weight to an accumulator
+     * @param sum Accumulator
+     * @param pixel Pixel to add
+     * @param weight Weight of the pixel
+     * @return Pixel Updated accumulator
+     */
+    inline Pixel multiply_add(const Pixel &sum, const Pixel &pixel, float weight)
+    {
+#if defined(__SSE2__)
+        return {_mm_add_ps(sum.value, _mm_mul_ps(pixel.value, _mm_set1_ps(weight)))};
+#else
+        Pixel result;
+
+        for (std::size_t i = 0; i < 4; ++i)
+            result.value[i] = sum.value[i] + pixel.value[i] * weight;
+
+        return result;
+#endif
+    }
+
+    /**
+     * @brief
+     * Zeroth order modified Bessel function of the first kind
+     * @param x Argument
+     * @return double I0(x)
+     */
+    double bessel_i0(double x)
+    {
+        double sum = 1.0;
+        double term = 1.0;
+
+        for (int k = 1; k < 32; ++k)
+        {
+            term *= (x / (2.0 * k)) * (x / (2.0 * k));
+            sum += term;
+        }
+
+        return sum;
+    }
+
+    /**
+     * @brief
+     * Weights of the Kaiser windowed sinc kernel that halves a dimension.
+     * Tap j samples the source pixel 2 * i + j - (2 * radius - 1).
+     * @return const std::array<float, KAISER_TAPS>& Normalized weights
+     */
+    const std::array<float, KAISER_TAPS> &kaiser_weights()
+    {
+        static const auto weights = []()
+        {
+            std::array<float, KAISER_TAPS> values{};
+            double sum = 0.0;
+
+            for (int j = 0; j < KAISER_TAPS; ++j)
+            {
+                // Distance in source pixels between the tap and the center
+                double distance = j - (2 * KAISER_RADIUS - 1) - 0.5;
+                double x = distance / 2.0;
+                double sinc = x == 0.0 ? 1.0
+                                       : std::sin(std::numbers::pi * x) / (std::numbers::pi * x);
+                double ratio = x / KAISER_RADIUS;
+                double window = bessel_i0(KAISER_ALPHA * std::sqrt(1.0 - ratio * ratio)) /
+                                bessel_i0(KAISER_ALPHA);
+
+                values[j] = static_cast<float>(sinc * window);
+                sum += values[j];
+            }
+
+            for (auto &value : values)
+                value = static_cast<float>(value / sum);
+
+            return values;
+        }();
+
+        return weights;
+    }
+}
+
+// Constructors
+/**
+ * @brief
+ * Construct a new Mipmap Generator:: Mipmap Generator object
+ * @param filter Kernel used to downsample every level
+ * @param srgb Whether the color channels are sRGB encoded
+ * @param thread_pool Thread pool the rows are split across, or nullptr to
+ *        run on the calling thread. Must not be called from a task of the
+ *        same pool.
+ */
+MipmapGenerator::MipmapGenerator(MipFilter filter, bool srgb,
+                                 ThreadPool *thread_pool)
+    : m_filter(filter), m_srgb(srgb), m_thread_pool(thread_pool)
+{
+}
+
+// Access Methods
+/**
+ * @brief
+ * Get the downsampling filter
+ * @return MipFilter Downsampling filter
+ */
+MipFilter MipmapGenerator::get_filter() const noexcept
+{
+    return m_filter;
+}
+
+/**
+ * @brief
+ * Checks if the color channels are treated as sRGB
+ * @return true Color channels are sRGB
+ * @return false Color channels are linear
+ */
+bool MipmapGenerator::is_srgb() const noexcept
+{
+    return m_srgb;
+}
+
+// Methods
+/**
+ * @brief
+ * Generates the mip chain of an image. Every level is filtered from the
+ * full precision linear data of the previous one, so rounding errors do
+ * not accumulate down the chain.
+ * @param image Level 0, with 1 to 4 channels. Alpha is the last
+ *              channel of 2 and 4 channel images.
+ * @param max_levels Maximum number of levels, 0 for the full chain
+ * @return std::vector<Image> Mip levels, from largest to smallest
+ */
+std::vector<Image> MipmapGenerator::generate(const Image &image,
+                                             std::size_t max_levels) const
+{
+    if (image.empty() || image.get_channels() == 0 || image.get_channels() > 4)
+        throw std::invalid_argument("Mipmaps need a non-empty 1 to 4 channel image");
+
+    auto level_count = get_mip_count(image.get_width(), image.get_height());
+
+    if (max_levels != 0)
+        level_count = std::min(level_count, max_levels);
+
+    std::vector<Image> levels;
+    levels.reserve(level_count);
+    levels.push_back(image);
+
+    auto current = to_linear(image);
+
+    while (levels.size() < level_count)
+    {
+        current = reduce(current);
+        levels.push_back(to_image(current, image.get_channels()));
+    }
+
+    return levels;
+}
+
+/**
+ * @brief
+ * Halves the size of an image
+ * @param image Image to downsample
+ * @return Image Next mip level of the image
+ */
+Image MipmapGenerator::downsample(const Image &image) const
+{
+    if (image.empty() || image.get_channels() == 0 || image.get_channels() > 4)
+        throw std::invalid_argument("Mipmaps need a non-empty 1 to 4 channel image");
+
+    return to_image(reduce(to_linear(image)), image.get_channels());
+}
+
+// Static Methods
+/**
+ * @brief
+ * Gets the number of levels of a full mip chain
+ * @param width Width of level 0
+ * @param height Height of level 0
+ * @return std::size_t Number of levels down to 1x1
+ */
+std::size_t MipmapGenerator::get_mip_count(std::uint32_t width,
+                                           std::uint32_t height)
+{
+    std::size_t count = 1;
+    auto size = std::max(width, height);
+
+    while (size > 1)
+    {
+        size /= 2;
+        ++count;
+    }
+
+    return count;
+}
+
+// Methods (private)
+/**
+ * @brief
+ * Converts an image to linear, alpha premultiplied RGBA floats
+ * @param image Image to convert
+ * @return FloatImage Linear image
+ */
+MipmapGenerator::FloatImage MipmapGenerator::to_linear(const Image &image) const
+{
+    FloatImage result{image.get_width(), image.get_height(), {}};
+    result.pixels.resize(static_cast<std::size_t>(result.width) * result.height * 4);
+
+    auto channels = image.get_channels();
+    const auto &source = image.get_pixels();
+
+    if (channels == 4)
+    {
+        if (m_srgb)
+            Math::srgb8_to_linear(source, result.pixels);
+        else
+            Math::unorm8_to_float(source, result.pixels);
+
+        Math::premultiply_alpha(std::span<float>(result.pixels));
+        return result;
+    }
+
+    bool has_alpha = channels == 2;
+    std::uint32_t color_channels = has_alpha ? 1 : channels;
+
+    for (std::size_t i = 0; i < static_cast<std::size_t>(result.width) * result.height; ++i)
+    {
+        const auto *pixel = source.data() + i * channels;
+        auto *destination = result.pixels.data() + i * 4;
+
+        // Gray and alpha images keep their alpha in the second channel
+        float alpha = has_alpha ? pixel[color_channels] / 255.0f : 1.0f;
+
+        for (std::uint32_t c = 0; c < 3; ++c)
+        {
+            if (c >= color_channels)
+            {
+                destination[c] = 0.0f;
+                continue;
+            }
+
+            float value = m_srgb ? Math::srgb8_to_linear(pixel[c]) : pixel[c] / 255.0f;
+            destination[c] = value * alpha;
+        }
+
+        destination[3] = alpha;
+    }
+
+    return result;
+}
+
+/**
+ * @brief
+ * Converts linear, alpha premultiplied RGBA floats back to an 8-bit image
+ * @param source Linear image
+ * @param channels Number of channels of the result
+ * @return Image Converted image
+ */
+Image MipmapGenerator::to_image(const FloatImage &source,
+                                std::uint32_t channels) const
+{
+    Image result(source.width, source.height, channels);
+    auto &destination = result.get_pixels();
+
+    if (channels == 4)
+    {
+        auto straight = source.pixels;
+        Math::unpremultiply_alpha(std::span<float>(straight));
+
+        if (m_srgb)
+            Math::linear_to_srgb8(straight, destination);
+        else
+            Math::float_to_unorm8(straight, destination);
+
+        return result;
+    }
+
+    bool has_alpha = channels == 2;
+    std::uint32_t color_channels = has_alpha ? 1 : channels;
+
+    for (std::size_t i = 0; i < static_cast<std::size_t>(source.width) * source.height; ++i)
+    {
+        const auto *pixel = source.pixels.data() + i * 4;
+        auto *output = destination.data() + i * channels;
+
+        float alpha = std::clamp(pixel[3], 0.0f, 1.0f);
+        float scale = has_alpha && alpha > 0.0f ? 1.0f / alpha : 1.0f;
+
+        for (std::uint32_t c = 0; c < color_channels; ++c)
+        {
+            float value = std::clamp(pixel[c] * scale, 0.0f, 1.0f);
+
+            output[c] = m_srgb ? Math::linear_to_srgb8(value)
+                               : static_cast<std::uint8_t>(value * 255.0f + 0.5f);
+        }
+
+        // Alpha is linear coverage, never sRGB encoded
+        if (has_alpha)
+            output[color_channels] = static_cast<std::uint8_t>(alpha * 255.0f + 0.5f);
+    }
+
+    return result;
+}
+
+/**
+ * @brief
+ * Halves both dimensions of a linear image with the selected filter
+ * @param source Linear image
+ * @return FloatImage Downsampled image
+ */
+MipmapGenerator::FloatImage MipmapGenerator::reduce(const FloatImage &source) const
+{
+    FloatImage result{std::max(source.width / 2, 1u),
+                      std::max(source.height / 2, 1u), {}};
+    result.pixels.resize(static_cast<std::size_t>(result.width) * result.height * 4);
+
+    if (m_filter == MipFilter::Box)
+    {
+        for_each_row_band(result.height, [&](std::uint32_t begin, std::uint32_t end)
+                          { reduce_box(source, result, begin, end); });
+
+        return result;
+    }
+
+    // Separable filter: rows are reduced first, then the columns
+    FloatImage horizontal{result.width, source.height, {}};
+    horizontal.pixels.resize(static_cast<std::size_t>(horizontal.width) * horizontal.height * 4);
+
+    const auto &weights = kaiser_weights();
+    auto source_width = static_cast<int>(source.width);
+
+    for_each_row_band(source.height, [&](std::uint32_t begin, std::uint32_t end)
+                      {
+        for (std::uint32_t y = begin; y < end; ++y)
+        {
+            const float *row = source.pixels.data() + static_cast<std::size_t>(y) * source.width * 4;
+            float *output = horizontal.pixels.data() + static_cast<std::size_t>(y) * horizontal.width * 4;
+
+            for (std::uint32_t x = 0; x < horizontal.width; ++x)
+            {
+                Pixel sum = zero();
+                int first = 2 * static_cast<int>(x) - (2 * KAISER_RADIUS - 1);
+
+                for (int j = 0; j < KAISER_TAPS; ++j)
+                {
+                    int column = std::clamp(first + j, 0, source_width - 1);
+                    sum = multiply_add(sum, load(row + column * 4), weights[j]);
+                }
+
+                store(output + x * 4, sum);
+            }
+        } });
+
+    for_each_row_band(result.height, [&](std::uint32_t begin, std::uint32_t end)
+                      { reduce_kaiser(horizontal, result, begin, end); });
+
+    return result;
+}
+
+/**
+ * @brief
+ * Averages 2x2 blocks of a band of destination rows. Odd sizes clamp the
+ * last block to the edge of the source.
+ * @param source Linear image
+ * @param destination Downsampled image
+ * @param begin First destination row
+ * @param end Destination row after the last one
+ */
+void MipmapGenerator::reduce_box(const FloatImage &source,
+                                 FloatImage &destination, std::uint32_t begin,
+                                 std::uint32_t end) const
+{
+    for (std::uint32_t y = begin; y < end; ++y)
+    {
+        auto y0 = std::min(2 * y, source.height - 1);
+        auto y1 = std::min(2 * y + 1, source.height - 1);
+        const float *row0 = source.pixels.data() + static_cast<std::size_t>(y0) * source.width * 4;
+        const float *row1 = source.pixels.data() + static_cast<std::size_t>(y1) * source.width * 4;
+        float *output = destination.pixels.data() + static_cast<std::size_t>(y) * destination.width * 4;
+
+        for (std::uint32_t x = 0; x < destination.width; ++x)
+        {
+            auto x0 = std::min(2 * x, source.width - 1) * 4;
+            auto x1 = std::min(2 * x + 1, source.width - 1) * 4;
+
+            Pixel sum = zero();
+            sum = multiply_add(sum, load(row0 + x0), 0.25f);
+            sum = multiply_add(sum, load(row0 + x1), 0.25f);
+            sum = multiply_add(sum, load(row1 + x0), 0.25f);
+            sum = multiply_add(sum, load(row1 + x1), 0.25f);
+
+            store(output + x * 4, sum);
+        }
+    }
+}
+
+/**
+ * @brief
+ * Applies the vertical pass of the Kaiser filter to a band of destination
+ * rows
+ * @param source Horizontally reduced image
+ * @param destination Downsampled image
+ * @param begin First destination row
+ * @param end Destination row after the last one
+ */
+void MipmapGenerator::reduce_kaiser(const FloatImage &source,
+                                    FloatImage &destination,
+                                    std::uint32_t begin, std::uint32_t end) const
+{
+    const auto &weights = kaiser_weights();
+    auto source_height = static_cast<int>(source.height);
+    std::size_t stride = static_cast<std::size_t>(source.width) * 4;
+
+    for (std::uint32_t y = begin; y < end; ++y)
+    {
+        float *output = destination.pixels.data() + static_cast<std::size_t>(y) * destination.width * 4;
+        int first = 2 * static_cast<int>(y) - (2 * KAISER_RADIUS - 1);
+
+        for (std::uint32_t x = 0; x < destination.width; ++x)
+        {
+            Pixel sum = zero();
+
+            for (int j = 0; j < KAISER_TAPS; ++j)
+            {
+                int row = std::clamp(first + j, 0, source_height - 1);
+                sum = multiply_add(sum, load(source.pixels.data() + row * stride + x * 4),
+                                   weights[j]);
+            }
+
+            store(output + x * 4, sum);
+        }
+    }
+}
+
+/**
+ * @brief
+ * Runs a function over bands of rows, on the thread pool when there is one.
+ * The calling thread runs the last band.
+ * @tparam F Type of the function
+ * @param rows Number of rows
+ * @param function Function called with the first row and the row after the
+ *        last one of every band
+ */
+template <class F>
+void MipmapGenerator::for_each_row_band(std::uint32_t rows, F &&function) const
+{
+    if (m_thread_pool == nullptr || rows <= ROWS_PER_TASK)
+    {
+        function(0u, rows);
+        return;
+    }
+
+    // The bands write the caller's images: the group outlives none of them
+    TaskGroup tasks(*m_thread_pool);
+    std::uint32_t begin = 0;
+
+    for (; begin + ROWS_PER_TASK < rows; begin += ROWS_PER_TASK)
+        tasks.run([&function, begin]()
+                  { function(begin, begin + ROWS_PER_TASK); });
+
+    function(begin, rows);
+    tasks.wait();
+}
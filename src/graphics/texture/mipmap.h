@@ -0,0 +1,82 @@
+/**
+ * @file mipmap.h
+ * @author Carlos Salguero
+ * @brief Declaration of the mipmap generator
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef MIPMAP_H
+#define MIPMAP_H
+
+// C++ Standard Library
+#include <cstdint>
+#include <vector>
+
+// Project files
+#include "image.h"
+#include "../../threads/thread_pool.h"
+
+// Enums
+/**
+ * @enum MipFilter
+ * @brief Kernel used to downsample a mip level
+ */
+enum class MipFilter
+{
+    Box,
+    Kaiser
+};
+
+// Class
+/**
+ * @class MipmapGenerator
+ * @brief Builds mip chains for RGBA8 and single channel images. Filtering
+ *        runs on linear, alpha premultiplied values, so sRGB textures keep
+ *        their brightness and cutouts do not bleed into their background.
+ *        Rows of every level are split across the thread pool when given.
+ */
+class MipmapGenerator
+{
+public:
+    // Constructors
+    explicit MipmapGenerator(MipFilter = MipFilter::Box, bool = true,
+                             ThreadPool * = nullptr);
+
+    // Access Methods
+    MipFilter get_filter() const noexcept;
+    bool is_srgb() const noexcept;
+
+    // Methods
+    std::vector<Image> generate(const Image &, std::size_t = 0) const;
+    Image downsample(const Image &) const;
+
+    // Static Methods
+    static std::size_t get_mip_count(std::uint32_t, std::uint32_t);
+
+private:
+    struct FloatImage
+    {
+        std::uint32_t width;
+        std::uint32_t height;
+        std::vector<float> pixels;
+    };
+
+    MipFilter m_filter;
+    bool m_srgb;
+    ThreadPool *m_thread_pool;
+
+    // Methods
+    FloatImage to_linear(const Image &) const;
+    Image to_image(const FloatImage &, std::uint32_t) const;
+    FloatImage reduce(const FloatImage &) const;
+    void reduce_box(const FloatImage &, FloatImage &, std::uint32_t, std::uint32_t) const;
+    void reduce_kaiser(const FloatImage &, FloatImage &, std::uint32_t, std::uint32_t) const;
+    template <class F>
+    void for_each_row_band(std::uint32_t, F &&) const;
+};
+
+#endif //! MIPMAP_H
@@ -0,0 +1,302 @@
+/**
+ * @file texture.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of the Texture class
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+// Project files
+#include "texture.h"
+
+namespace
+{
+    // Cooked texture layout (little endian):
+    //   "GTEX" | version u32 | width u32 | height u32 | channels u32
+    //   mip count u32 | mip count * (offset u64 | size u64) | mip data
+    const char TEXTURE_MAGIC[4] = {'G', 'T', 'E', 'X'};
+    const std::uint32_t TEXTURE_VERSION = 1;
+    const std::size_t FIXED_HEADER_SIZE = 24;
+
+    /**
+     * @brief
+     * Appends an unsigned integer in little endian order
+     * @param buffer Buffer to append to
+     * @param value Value to append
+     * @param bytes Number of bytes to append
+     */
+    void append_integer(std::string &buffer, std::uint64_t value, int bytes)
+    {
+        for (int i = 0; i < bytes; ++i)
+            buffer.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+    }
+
+    /**
+     * @brief
+     * Reads an unsigned integer stored in little endian order
+     * @param buffer Buffer to read from
+     * @param offset Offset of the integer
+     * @param bytes Number of bytes of the integer
+     * @return std::uint64_t Value read
+     * @throw std::runtime_error The buffer is too short
+     */
+    std::uint64_t read_integer(const std::string &buffer, std::size_t offset,
+                               int bytes)
+    {
+        if (offset + bytes > buffer.size())
+            throw std::runtime_error("Corrupted cooked texture");
+
+        std::uint64_t value = 0;
+
+        for (int i = 0; i < bytes; ++i)
+            value |= static_cast<std::uint64_t>(
+                         static_cast<unsigned char>(buffer[offset + i]))
+                     << (8 * i);
+
+        return value;
+    }
+
+    /**
+     * @brief
+     * Computes the size a mip level must have from the dimensions of level 0
+     * @param header Header of the texture
+     * @param level Level of the mip
+     * @return std::uint64_t Size in bytes
+     * @throw std::runtime_error The size does not fit in 64 bits
+     */
+    std::uint64_t expected_mip_size(const CookedTextureHeader &header,
+                                    std::uint32_t level)
+    {
+        std::uint64_t pixels = std::uint64_t(std::max(header.width >> level, 1u)) *
+                               std::max(header.height >> level, 1u);
+
+        if (pixels > UINT64_MAX / header.channels)
+            throw std::runtime_error("Corrupted cooked texture");
+
+        return pixels * header.channels;
+    }
+}
+
+// Constructors
+/**
+ * @brief
+ * Construct a new Texture:: Texture object
+ * @param mips Mip levels, from largest to smallest
+ */
+Texture::Texture(std::vector<Image> mips)
+    : m_mips(std::move(mips))
+{
+}
+
+// Access Methods
+/**
+ * @brief
+ * Get the width of level 0
+ * @return std::uint32_t Width in pixels
+ */
+std::uint32_t Texture::get_width() const noexcept
+{
+    return m_mips.empty() ? 0 : m_mips.front().get_width();
+}
+
+/**
+ * @brief
+ * Get the height of level 0
+ * @return std::uint32_t Height in pixels
+ */
+std::uint32_t Texture::get_height() const noexcept
+{
+    return m_mips.empty() ? 0 : m_mips.front().get_height();
+}
+
+/**
+ * @brief
+ * Get the number of channels
+ * @return std::uint32_t Number of channels
+ */
+std::uint32_t Texture::get_channels() const noexcept
+{
+    return m_mips.empty() ? 0 : m_mips.front().get_channels();
+}
+
+/**
+ * @brief
+ * Get the number of mip levels
+ * @return std::size_t Number of levels
+ */
+std::size_t Texture::get_mip_count() const noexcept
+{
+    return m_mips.size();
+}
+
+/**
+ * @brief
+ * Get a mip level
+ * @param level Level, 0 being the largest
+ * @return const Image& Pixels of the level
+ */
+const Image &Texture::get_mip(std::size_t level) const
+{
+    return m_mips.at(level);
+}
+
+// Methods
+/**
+ * @brief
+ * Serializes the texture and its mip chain for the game data
+ * @return std::string Cooked texture
+ */
+std::string Texture::cook() const
+{
+    std::string buffer;
+
+    buffer.append(TEXTURE_MAGIC, sizeof(TEXTURE_MAGIC));
+    append_integer(buffer, TEXTURE_VERSION, 4);
+    append_integer(buffer, get_width(), 4);
+    append_integer(buffer, get_height(), 4);
+    append_integer(buffer, get_channels(), 4);
+    append_integer(buffer, m_mips.size(), 4);
+
+    std::uint64_t offset = get_cooked_header_size(m_mips.size());
+    std::vector<std::uint64_t> offsets(m_mips.size());
+
+    for (std::size_t level = m_mips.size(); level-- > 0;)
+    {
+        offsets[level] = offset;
+        offset += m_mips[level].get_size();
+    }
+
+    for (std::size_t level = 0; level < m_mips.size(); ++level)
+    {
+        append_integer(buffer, offsets[level], 8);
+        append_integer(buffer, m_mips[level].get_size(), 8);
+    }
+
+    for (std::size_t level = m_mips.size(); level-- > 0;)
+    {
+        const auto &pixels = m_mips[level].get_pixels();
+        buffer.append(reinterpret_cast<const char *>(pixels.data()), pixels.size());
+    }
+
+    return buffer;
+}
+
+// Static Methods
+/**
+ * @brief
+ * Creates a texture and generates its mip chain
+ * @param image Level 0 of the texture
+ * @param generator Generator of the mip levels
+ * @return Texture Mipmapped texture
+ */
+Texture Texture::from_image(const Image &image, const MipmapGenerator &generator)
+{
+    return Texture(generator.generate(image));
+}
+
+/**
+ * @brief
+ * Loads a cooked texture
+ * @param data Cooked texture
+ * @return Texture Texture with every stored level
+ * @throw std::runtime_error The data is not a valid cooked texture
+ */
+Texture Texture::from_cooked(const std::string &data)
+{
+    auto header = read_cooked_header(data);
+
+    // The largest level is stored last, so it ends where the data must end.
+    // Checked before any level is allocated from the sizes in the header.
+    if (header.mip_offsets[0] > data.size() ||
+        header.mip_sizes[0] > data.size() - header.mip_offsets[0])
+        throw std::runtime_error("Corrupted cooked texture");
+
+    std::vector<Image> mips;
+
+    for (std::uint32_t level = 0; level < header.mip_count; ++level)
+    {
+        Image mip(std::max(header.width >> level, 1u),
+                  std::max(header.height >> level, 1u), header.channels);
+
+        std::memcpy(mip.get_pixels().data(), data.data() + header.mip_offsets[level],
+                    mip.get_size());
+        mips.push_back(std::move(mip));
+    }
+
+    return Texture(std::move(mips));
+}
+
+/**
+ * @brief
+ * Reads the header and mip table of a cooked texture. Only the first
+ * get_cooked_header_size(mip count) bytes are needed, which lets the
+ * streaming code read the header without the pixels.
+ * The mip table is checked against the layout written by cook(): every
+ * level has the size given by the dimensions, and the levels follow the
+ * table back to back from the smallest to the largest.
+ * @param data Beginning of a cooked texture
+ * @return CookedTextureHeader Header of the texture
+ * @throw std::runtime_error The data is not a valid cooked texture
+ */
+CookedTextureHeader Texture::read_cooked_header(const std::string &data)
+{
+    if (data.size() < FIXED_HEADER_SIZE ||
+        !std::equal(TEXTURE_MAGIC, TEXTURE_MAGIC + 4, data.begin()))
+        throw std::runtime_error("Invalid cooked texture");
+
+    if (read_integer(data, 4, 4) != TEXTURE_VERSION)
+        throw std::runtime_error("Unsupported cooked texture version");
+
+    CookedTextureHeader header;
+    header.width = static_cast<std::uint32_t>(read_integer(data, 8, 4));
+    header.height = static_cast<std::uint32_t>(read_integer(data, 12, 4));
+    header.channels = static_cast<std::uint32_t>(read_integer(data, 16, 4));
+    header.mip_count = static_cast<std::uint32_t>(read_integer(data, 20, 4));
+
+    if (header.width == 0 || header.height == 0 || header.channels == 0 ||
+        header.channels > 4 || header.mip_count == 0 || header.mip_count > 32)
+        throw std::runtime_error("Corrupted cooked texture");
+
+    for (std::uint32_t level = 0; level < header.mip_count; ++level)
+    {
+        auto entry = FIXED_HEADER_SIZE + level * 16;
+
+        header.mip_offsets.push_back(read_integer(data, entry, 8));
+        header.mip_sizes.push_back(read_integer(data, entry + 8, 8));
+    }
+
+    std::uint64_t offset = get_cooked_header_size(header.mip_count);
+
+    for (std::uint32_t level = header.mip_count; level-- > 0;)
+    {
+        if (header.mip_offsets[level] != offset ||
+            header.mip_sizes[level] != expected_mip_size(header, level) ||
+            header.mip_sizes[level] > UINT64_MAX - offset)
+            throw std::runtime_error("Corrupted cooked texture");
+
+        offset += header.mip_sizes[level];
+    }
+
+    return header;
+}
+
+/**
+ * @brief
+ * Gets the size of the header of a cooked texture
+ * @param mip_count Number of mip levels, or 0 for the fixed part that
+ *        holds the mip count
+ * @return std::size_t Size in bytes
+ */
+std::size_t Texture::get_cooked_header_size(std::size_t mip_count)
+{
+    return FIXED_HEADER_SIZE + mip_count * 16;
+}
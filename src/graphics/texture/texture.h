@@ -0,0 +1,72 @@
+/**
+ * @file texture.h
+ * @author Carlos Salguero
+ * @brief Declaration of the Texture class
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef TEXTURE_H
+#define TEXTURE_H
+
+// C++ Standard Library
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Project files
+#include "image.h"
+#include "mipmap.h"
+
+// Structs
+/**
+ * @struct CookedTextureHeader
+ * @brief Header of a cooked texture. Levels are stored from the smallest to
+ *        the largest, so the low mips are the first bytes after the table.
+ */
+struct CookedTextureHeader
+{
+    std::uint32_t width;
+    std::uint32_t height;
+    std::uint32_t channels;
+    std::uint32_t mip_count;
+    std::vector<std::uint64_t> mip_offsets;
+    std::vector<std::uint64_t> mip_sizes;
+};
+
+// Class
+/**
+ * @class Texture
+ * @brief CPU side texture made of a chain of mip levels
+ */
+class Texture
+{
+public:
+    // Constructors
+    Texture() = default;
+    explicit Texture(std::vector<Image>);
+
+    // Access Methods
+    std::uint32_t get_width() const noexcept;
+    std::uint32_t get_height() const noexcept;
+    std::uint32_t get_channels() const noexcept;
+    std::size_t get_mip_count() const noexcept;
+    const Image &get_mip(std::size_t) const;
+
+    // Methods
+    std::string cook() const;
+
+    // Static Methods
+    static Texture from_image(const Image &, const MipmapGenerator &);
+    static Texture from_cooked(const std::string &);
+    static CookedTextureHeader read_cooked_header(const std::string &);
+    static std::size_t get_cooked_header_size(std::size_t);
+
+private:
+    std::vector<Image> m_mips;
+};
+
+#endif //! TEXTURE_H
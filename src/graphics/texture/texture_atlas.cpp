@@ -0,0 +1,424 @@
+/**
+ * @file texture_atlas.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of the skyline rectangle packer and the texture atlas
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+// Project files
+#include "texture_atlas.h"
+
+// SkylinePacker
+// Constructors
+/**
+ * @brief
+ * Construct a new Skyline Packer:: Skyline Packer object
+ * @param width Width of the bin
+ * @param height Height of the bin
+ */
+SkylinePacker::SkylinePacker(std::uint32_t width, std::uint32_t height)
+    : m_width(width), m_height(height)
+{
+    clear();
+}
+
+// Access Methods
+/**
+ * @brief
+ * Get the width of the bin
+ * @return std::uint32_t Width of the bin
+ */
+std::uint32_t SkylinePacker::get_width() const noexcept
+{
+    return m_width;
+}
+
+/**
+ * @brief
+ * Get the height of the bin
+ * @return std::uint32_t Height of the bin
+ */
+std::uint32_t SkylinePacker::get_height() const noexcept
+{
+    return m_height;
+}
+
+/**
+ * @brief
+ * Get the fraction of the bin covered by packed rectangles
+ * @return float Occupancy between 0 and 1
+ */
+float SkylinePacker::get_occupancy() const noexcept
+{
+    return static_cast<float>(m_used_area) /
+           (static_cast<float>(m_width) * static_cast<float>(m_height));
+}
+
+// Methods
+/**
+ * @brief
+ * Places a rectangle at the position that keeps the skyline lowest
+ * @param width Width of the rectangle
+ * @param height Height of the rectangle
+ * @param x Receives the column of the placed rectangle
+ * @param y Receives the row of the placed rectangle
+ * @return true The rectangle was placed
+ * @return false The rectangle does not fit in the bin
+ */
+bool SkylinePacker::insert(std::uint32_t width, std::uint32_t height,
+                           std::uint32_t &x, std::uint32_t &y)
+{
+    auto best_top = std::numeric_limits<std::uint32_t>::max();
+    auto best_width = std::numeric_limits<std::uint32_t>::max();
+    auto best_index = m_skyline.size();
+    std::uint32_t best_y = 0;
+
+    for (std::size_t i = 0; i < m_skyline.size(); ++i)
+    {
+        std::uint32_t top;
+
+        if (!fits(i, width, height, top))
+            continue;
+
+        if (top + height < best_top ||
+            (top + height == best_top && m_skyline[i].width < best_width))
+        {
+            best_top = top + height;
+            best_width = m_skyline[i].width;
+            best_index = i;
+            best_y = top;
+        }
+    }
+
+    if (best_index == m_skyline.size())
+        return false;
+
+    x = m_skyline[best_index].x;
+    y = best_y;
+
+    add_level(best_index, x, y, width, height);
+    m_used_area += static_cast<std::uint64_t>(width) * height;
+
+    return true;
+}
+
+/**
+ * @brief
+ * Removes every rectangle from the bin
+ */
+void SkylinePacker::clear()
+{
+    m_used_area = 0;
+    m_skyline.assign(1, Node{0, 0, m_width});
+}
+
+// Methods (private)
+/**
+ * @brief
+ * Checks if a rectangle fits with its left edge on a skyline node
+ * @param index Index of the skyline node
+ * @param width Width of the rectangle
+ * @param height Height of the rectangle
+ * @param top Receives the row the rectangle would rest on
+ * @return true The rectangle fits
+ * @return false The rectangle does not fit
+ */
+bool SkylinePacker::fits(std::size_t index, std::uint32_t width,
+                         std::uint32_t height, std::uint32_t &top) const
+{
+    if (m_skyline[index].x + width > m_width)
+        return false;
+
+    std::int64_t width_left = width;
+    top = m_skyline[index].y;
+
+    while (width_left > 0)
+    {
+        if (index == m_skyline.size())
+            return false;
+
+        top = std::max(top, m_skyline[index].y);
+
+        if (top + height > m_height)
+            return false;
+
+        width_left -= m_skyline[index].width;
+        ++index;
+    }
+
+    return true;
+}
+
+/**
+ * @brief
+ * Raises the skyline over a placed rectangle and merges flat segments
+ * @param index Index of the node the rectangle starts on
+ * @param x Column of the rectangle
+ * @param y Row of the rectangle
+ * @param width Width of the rectangle
+ * @param height Height of the rectangle
+ */
+void SkylinePacker::add_level(std::size_t index, std::uint32_t x,
+                              std::uint32_t y, std::uint32_t width,
+                              std::uint32_t height)
+{
+    m_skyline.insert(m_skyline.begin() + index, Node{x, y + height, width});
+
+    for (std::size_t i = index + 1; i < m_skyline.size();)
+    {
+        auto &previous = m_skyline[i - 1];
+        auto &node = m_skyline[i];
+
+        if (node.x >= previous.x + previous.width)
+            break;
+
+        auto shrink = previous.x + previous.width - node.x;
+
+        if (node.width <= shrink)
+        {
+            m_skyline.erase(m_skyline.begin() + i);
+            continue;
+        }
+
+        node.x += shrink;
+        node.width -= shrink;
+        break;
+    }
+
+    for (std::size_t i = 0; i + 1 < m_skyline.size();)
+    {
+        if (m_skyline[i].y == m_skyline[i + 1].y)
+        {
+            m_skyline[i].width += m_skyline[i + 1].width;
+            m_skyline.erase(m_skyline.begin() + i + 1);
+        }
+
+        else
+            ++i;
+    }
+}
+
+// TextureAtlas
+// Constructors
+/**
+ * @brief
+ * Construct a new Texture Atlas:: Texture Atlas object
+ * @param page_width Width of every page
+ * @param page_height Height of every page
+ * @param padding Pixels around every sprite, filled by extruding its edges
+ *        so filtering never samples a neighbour
+ */
+TextureAtlas::TextureAtlas(std::uint32_t page_width, std::uint32_t page_height,
+                           std::uint32_t padding)
+    : m_page_width(page_width), m_page_height(page_height), m_padding(padding)
+{
+}
+
+// Access Methods
+/**
+ * @brief
+ * Get the region of a sprite
+ * @param name Name of the sprite
+ * @return const AtlasRegion& Region of the sprite
+ * @throw std::out_of_range The sprite is not in the atlas
+ */
+const AtlasRegion &TextureAtlas::get_region(const std::string &name) const
+{
+    return m_regions.at(name);
+}
+
+/**
+ * @brief
+ * Get the UV table of the atlas
+ * @return const std::unordered_map<std::string, AtlasRegion>& Regions by
+ *         sprite name
+ */
+const std::unordered_map<std::string, AtlasRegion> &TextureAtlas::get_regions() const noexcept
+{
+    return m_regions;
+}
+
+/**
+ * @brief
+ * Get a page of the atlas
+ * @param page Index of the page
+ * @return const Image& RGBA8 pixels of the page
+ */
+const Image &TextureAtlas::get_page(std::size_t page) const
+{
+    return m_pages.at(page);
+}
+
+/**
+ * @brief
+ * Get the number of pages
+ * @return std::size_t Number of pages
+ */
+std::size_t TextureAtlas::get_page_count() const noexcept
+{
+    return m_pages.size();
+}
+
+// Methods
+/**
+ * @brief
+ * Checks if a sprite is in the atlas
+ * @param name Name of the sprite
+ * @return true The sprite has a region
+ * @return false The sprite is not packed
+ */
+bool TextureAtlas::has_region(const std::string &name) const
+{
+    return m_regions.find(name) != m_regions.end();
+}
+
+/**
+ * @brief
+ * Queues an image to be packed by the next call to build
+ * @param name Name of the sprite
+ * @param image RGBA8 image of the sprite
+ */
+void TextureAtlas::add_image(const std::string &name, Image image)
+{
+    m_pending.emplace_back(name, std::move(image));
+}
+
+/**
+ * @brief
+ * Packs every queued image. Images are sorted from tallest to shortest
+ * before packing, which fills the pages far better than arrival order.
+ */
+void TextureAtlas::build()
+{
+    std::stable_sort(m_pending.begin(), m_pending.end(),
+                     [](const auto &a, const auto &b)
+                     {
+                         if (a.second.get_height() != b.second.get_height())
+                             return a.second.get_height() > b.second.get_height();
+
+                         return a.second.get_width() > b.second.get_width();
+                     });
+
+    for (const auto &[name, image] : m_pending)
+        insert(name, image);
+
+    m_pending.clear();
+}
+
+/**
+ * @brief
+ * Packs a single image into the first page with room for it, creating a
+ * new page when every page is full
+ * @param name Name of the sprite
+ * @param image RGBA8 image of the sprite
+ * @return const AtlasRegion& Region of the sprite
+ * @throw std::invalid_argument The image is empty, not RGBA8 or larger than
+ *        a page
+ */
+const AtlasRegion &TextureAtlas::insert(const std::string &name,
+                                        const Image &image)
+{
+    if (image.get_channels() != 4 || image.empty())
+        throw std::invalid_argument("Atlas images must be non-empty RGBA8");
+
+    auto padded_width = image.get_width() + 2 * m_padding;
+    auto padded_height = image.get_height() + 2 * m_padding;
+
+    if (padded_width > m_page_width || padded_height > m_page_height)
+        throw std::invalid_argument("Image does not fit in an atlas page: " + name);
+
+    std::uint32_t x = 0;
+    std::uint32_t y = 0;
+    std::size_t page = 0;
+
+    while (page < m_packers.size() &&
+           !m_packers[page].insert(padded_width, padded_height, x, y))
+        ++page;
+
+    if (page == m_packers.size())
+    {
+        add_page();
+        m_packers.back().insert(padded_width, padded_height, x, y);
+    }
+
+    blit(page, x, y, image);
+
+    AtlasRegion region;
+    region.page = page;
+    region.x = x + m_padding;
+    region.y = y + m_padding;
+    region.width = image.get_width();
+    region.height = image.get_height();
+    region.u0 = static_cast<float>(region.x) / m_page_width;
+    region.v0 = static_cast<float>(region.y) / m_page_height;
+    region.u1 = static_cast<float>(region.x + region.width) / m_page_width;
+    region.v1 = static_cast<float>(region.y + region.height) / m_page_height;
+
+    return m_regions[name] = region;
+}
+
+/**
+ * @brief
+ * Removes every page, region and queued image
+ */
+void TextureAtlas::clear()
+{
+    m_pages.clear();
+    m_packers.clear();
+    m_pending.clear();
+    m_regions.clear();
+}
+
+// Methods (private)
+/**
+ * @brief
+ * Adds an empty page
+ */
+void TextureAtlas::add_page()
+{
+    m_pages.emplace_back(m_page_width, m_page_height, 4);
+    m_packers.emplace_back(m_page_width, m_page_height);
+}
+
+/**
+ * @brief
+ * Copies an image into a page and extrudes its edges into the padding
+ * @param page Index of the page
+ * @param x Column of the padded rectangle
+ * @param y Row of the padded rectangle
+ * @param image RGBA8 image to copy
+ */
+void TextureAtlas::blit(std::size_t page, std::uint32_t x, std::uint32_t y,
+                        const Image &image)
+{
+    auto &target = m_pages[page];
+    auto width = image.get_width();
+    auto height = image.get_height();
+
+    for (std::uint32_t row = 0; row < height + 2 * m_padding; ++row)
+    {
+        auto source_row = std::min(row > m_padding ? row - m_padding : 0,
+                                   height - 1);
+        auto *destination = target.get_pixel(x, y + row);
+        const auto *source = image.get_pixel(0, source_row);
+
+        for (std::uint32_t i = 0; i < m_padding; ++i)
+            std::memcpy(destination + 4 * i, source, 4);
+
+        std::memcpy(destination + 4 * m_padding, source, 4 * width);
+
+        for (std::uint32_t i = 0; i < m_padding; ++i)
+            std::memcpy(destination + 4 * (m_padding + width + i),
+                        source + 4 * (width - 1), 4);
+    }
+}
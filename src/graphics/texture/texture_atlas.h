@@ -0,0 +1,123 @@
+/**
+ * @file texture_atlas.h
+ * @author Carlos Salguero
+ * @brief Declaration of the skyline rectangle packer and the texture atlas
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef TEXTURE_ATLAS_H
+#define TEXTURE_ATLAS_H
+
+// C++ Standard Library
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Project files
+#include "image.h"
+
+// Structs
+/**
+ * @struct AtlasRegion
+ * @brief Location of a sprite inside an atlas page, in pixels and in UV
+ *        coordinates of the page
+ */
+struct AtlasRegion
+{
+    std::size_t page;
+    std::uint32_t x;
+    std::uint32_t y;
+    std::uint32_t width;
+    std::uint32_t height;
+    float u0;
+    float v0;
+    float u1;
+    float v1;
+};
+
+// Classes
+/**
+ * @class SkylinePacker
+ * @brief Packs rectangles into a fixed size bin with the skyline
+ *        bottom-left heuristic
+ */
+class SkylinePacker
+{
+public:
+    // Constructors
+    SkylinePacker(std::uint32_t, std::uint32_t);
+
+    // Access Methods
+    std::uint32_t get_width() const noexcept;
+    std::uint32_t get_height() const noexcept;
+    float get_occupancy() const noexcept;
+
+    // Methods
+    bool insert(std::uint32_t, std::uint32_t, std::uint32_t &, std::uint32_t &);
+    void clear();
+
+private:
+    struct Node
+    {
+        std::uint32_t x;
+        std::uint32_t y;
+        std::uint32_t width;
+    };
+
+    std::uint32_t m_width;
+    std::uint32_t m_height;
+    std::uint64_t m_used_area;
+    std::vector<Node> m_skyline;
+
+    // Methods
+    bool fits(std::size_t, std::uint32_t, std::uint32_t, std::uint32_t &) const;
+    void add_level(std::size_t, std::uint32_t, std::uint32_t, std::uint32_t, std::uint32_t);
+};
+
+/**
+ * @class TextureAtlas
+ * @brief Packs images into large RGBA8 pages and keeps the UV table used to
+ *        draw every sprite from its page. Images can be queued and packed
+ *        together by build (offline cooking, best packing) or inserted one
+ *        at a time at runtime.
+ */
+class TextureAtlas
+{
+public:
+    // Constructors
+    TextureAtlas(std::uint32_t = 2048, std::uint32_t = 2048, std::uint32_t = 1);
+
+    // Access Methods
+    const AtlasRegion &get_region(const std::string &) const;
+    const std::unordered_map<std::string, AtlasRegion> &get_regions() const noexcept;
+    const Image &get_page(std::size_t) const;
+    std::size_t get_page_count() const noexcept;
+
+    // Methods
+    bool has_region(const std::string &) const;
+    void add_image(const std::string &, Image);
+    void build();
+    const AtlasRegion &insert(const std::string &, const Image &);
+    void clear();
+
+private:
+    std::uint32_t m_page_width;
+    std::uint32_t m_page_height;
+    std::uint32_t m_padding;
+    std::vector<Image> m_pages;
+    std::vector<SkylinePacker> m_packers;
+    std::vector<std::pair<std::string, Image>> m_pending;
+    std::unordered_map<std::string, AtlasRegion> m_regions;
+
+    // Methods
+    void add_page();
+    void blit(std::size_t, std::uint32_t, std::uint32_t, const Image &);
+};
+
+#endif //! TEXTURE_ATLAS_H
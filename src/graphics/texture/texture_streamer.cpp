@@ -0,0 +1,557 @@
+/**
+ * @file texture_streamer.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of the texture streamer
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// C++ Standard Library
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+// Project files
+#include "texture_streamer.h"
+#include "../../utils/logging/logging.h"
+
+namespace
+{
+    /**
+     * @brief
+     * Reads a mip level of a cooked texture
+     * @param file_system File system holding the texture
+     * @param path Path to the cooked texture
+     * @param header Header of the texture
+     * @param level Level to read
+     * @return Image Pixels of the level
+     */
+    Image read_mip(const VirtualFileSystem &file_system, const std::string &path,
+                   const CookedTextureHeader &header, std::size_t level)
+    {
+        auto data = file_system.read(path, header.mip_offsets[level],
+                                     header.mip_sizes[level]);
+
+        if (data.size() != header.mip_sizes[level])
+            throw std::runtime_error("Corrupted cooked texture: " + path);
+
+        Image mip(std::max(header.width >> level, 1u),
+                  std::max(header.height >> level, 1u), header.channels);
+
+        std::memcpy(mip.get_pixels().data(), data.data(), data.size());
+
+        return mip;
+    }
+}
+
+// StreamingTexture
+// Constructors
+/**
+ * @brief
+ * Construct a new Streaming Texture:: Streaming Texture object with no
+ * resident level
+ * @param path Path to the cooked texture
+ * @param header Header of the cooked texture
+ */
+StreamingTexture::StreamingTexture(const std::string &path,
+                                   CookedTextureHeader header)
+    : m_path(path), m_header(std::move(header)), m_mips(m_header.mip_count),
+      m_resident_mip(m_header.mip_count), m_tail_mip(m_header.mip_count - 1),
+      m_desired_mip(m_header.mip_count - 1), m_loadable_mip(0), m_priority(0.0f),
+      m_pending_mip(m_header.mip_count)
+{
+}
+
+// Access Methods
+/**
+ * @brief
+ * Get the path of the cooked texture
+ * @return const std::string& Path to the texture
+ */
+const std::string &StreamingTexture::get_path() const noexcept
+{
+    return m_path;
+}
+
+/**
+ * @brief
+ * Get the header of the cooked texture
+ * @return const CookedTextureHeader& Header with the mip table
+ */
+const CookedTextureHeader &StreamingTexture::get_header() const noexcept
+{
+    return m_header;
+}
+
+/**
+ * @brief
+ * Get the number of mip levels of the texture
+ * @return std::size_t Number of levels
+ */
+std::size_t StreamingTexture::get_mip_count() const noexcept
+{
+    return m_mips.size();
+}
+
+/**
+ * @brief
+ * Get the most detailed resident level
+ * @return std::size_t Level, 0 being the largest
+ */
+std::size_t StreamingTexture::get_resident_mip() const noexcept
+{
+    return m_resident_mip;
+}
+
+/**
+ * @brief
+ * Get the level wanted for the current screen size
+ * @return std::size_t Level, 0 being the largest
+ */
+std::size_t StreamingTexture::get_desired_mip() const noexcept
+{
+    return m_desired_mip;
+}
+
+/**
+ * @brief
+ * Get the most detailed level that can still be streamed in. Levels above
+ * a read that failed stay out of reach until the texture is reopened.
+ * @return std::size_t Level, 0 being the largest
+ */
+std::size_t StreamingTexture::get_loadable_mip() const noexcept
+{
+    return m_loadable_mip;
+}
+
+/**
+ * @brief
+ * Get the memory used by the resident levels
+ * @return std::size_t Size in bytes
+ */
+std::size_t StreamingTexture::get_resident_bytes() const noexcept
+{
+    std::size_t bytes = 0;
+
+    for (std::size_t level = m_resident_mip; level < m_mips.size(); ++level)
+        bytes += m_mips[level].get_size();
+
+    return bytes;
+}
+
+/**
+ * @brief
+ * Get the streaming priority
+ * @return float Priority, higher values stream first
+ */
+float StreamingTexture::get_priority() const noexcept
+{
+    return m_priority;
+}
+
+/**
+ * @brief
+ * Get a resident mip level
+ * @param level Level, 0 being the largest
+ * @return const Image& Pixels of the level
+ * @throw std::out_of_range The level is not resident
+ */
+const Image &StreamingTexture::get_mip(std::size_t level) const
+{
+    if (!is_resident(level))
+        throw std::out_of_range("Mip level is not resident");
+
+    return m_mips[level];
+}
+
+/**
+ * @brief
+ * Get the most detailed resident level
+ * @return const Image& Pixels of the level
+ */
+const Image &StreamingTexture::get_best_mip() const
+{
+    return get_mip(m_resident_mip);
+}
+
+// Methods
+/**
+ * @brief
+ * Checks if a level is resident
+ * @param level Level, 0 being the largest
+ * @return true The level can be sampled
+ * @return false The level is not loaded
+ */
+bool StreamingTexture::is_resident(std::size_t level) const noexcept
+{
+    return level >= m_resident_mip && level < m_mips.size();
+}
+
+// TextureStreamer
+// Constructors
+/**
+ * @brief
+ * Construct a new Texture Streamer:: Texture Streamer object
+ * @param file_system File system the cooked textures are read from
+ * @param thread_pool Thread pool the reads run on
+ * @param budget Memory budget of the streamed levels, in bytes
+ * @param tail_size Levels whose sides are at most this size are loaded
+ *        when a texture is opened and never dropped
+ * @param max_pending Maximum number of reads in flight
+ */
+TextureStreamer::TextureStreamer(VirtualFileSystem &file_system,
+                                 ThreadPool &thread_pool, std::size_t budget,
+                                 std::uint32_t tail_size,
+                                 std::size_t max_pending)
+    : m_file_system(file_system), m_thread_pool(thread_pool), m_budget(budget),
+      m_tail_size(tail_size), m_max_pending(max_pending), m_resident_bytes(0),
+      m_pending_bytes(0)
+{
+}
+
+// Destructor
+/**
+ * @brief
+ * Destroy the Texture Streamer:: Texture Streamer object. Waits for the
+ * reads in flight.
+ */
+TextureStreamer::~TextureStreamer()
+{
+    for (auto &[name, texture] : m_textures)
+        if (texture->m_pending.valid())
+            texture->m_pending.wait();
+}
+
+// Access Methods
+/**
+ * @brief
+ * Get an opened texture
+ * @param name Name of the texture
+ * @return const StreamingTexture& Streaming texture
+ * @throw std::out_of_range The texture is not opened
+ */
+const StreamingTexture &TextureStreamer::get_texture(const std::string &name) const
+{
+    return *m_textures.at(name);
+}
+
+/**
+ * @brief
+ * Get the memory budget
+ * @return std::size_t Budget in bytes
+ */
+std::size_t TextureStreamer::get_budget() const noexcept
+{
+    return m_budget;
+}
+
+/**
+ * @brief
+ * Get the memory used by the resident levels of every texture
+ * @return std::size_t Size in bytes
+ */
+std::size_t TextureStreamer::get_resident_bytes() const noexcept
+{
+    return m_resident_bytes;
+}
+
+/**
+ * @brief
+ * Get the memory reserved by the reads in flight
+ * @return std::size_t Size in bytes
+ */
+std::size_t TextureStreamer::get_pending_bytes() const noexcept
+{
+    return m_pending_bytes;
+}
+
+// Mutator Methods
+/**
+ * @brief
+ * Set the memory budget. A smaller budget drops levels on the next update.
+ * @param budget Budget in bytes
+ */
+void TextureStreamer::set_budget(std::size_t budget)
+{
+    m_budget = budget;
+}
+
+/**
+ * @brief
+ * Set how the texture is seen this frame. The screen size picks the level
+ * that gives about one texel per pixel; the distance lowers the priority
+ * of far away textures of the same screen size.
+ * @param name Name of the texture
+ * @param screen_size Size of the textured surface on screen, in pixels
+ * @param distance Distance from the camera to the surface
+ */
+void TextureStreamer::set_priority(const std::string &name, float screen_size,
+                                   float distance)
+{
+    auto &texture = *m_textures.at(name);
+    const auto &header = texture.m_header;
+
+    if (screen_size <= 0.0f)
+    {
+        texture.m_desired_mip = texture.m_tail_mip;
+        texture.m_priority = 0.0f;
+        return;
+    }
+
+    float texels = static_cast<float>(std::max(header.width, header.height));
+    float level = std::floor(std::log2(std::max(texels / screen_size, 1.0f)));
+
+    texture.m_desired_mip = std::min(static_cast<std::size_t>(level),
+                                     texture.m_tail_mip);
+    texture.m_priority = screen_size / (1.0f + std::max(distance, 0.0f));
+}
+
+// Methods
+/**
+ * @brief
+ * Opens a cooked texture. The header and the mip tail are read right away
+ * in a single read, so the texture can be sampled immediately.
+ * @param name Name of the texture
+ * @param path Path to the cooked texture
+ * @return const StreamingTexture& Streaming texture
+ * @throw std::runtime_error The texture does not exist or is corrupted
+ */
+const StreamingTexture &TextureStreamer::open(const std::string &name,
+                                              const std::string &path)
+{
+    if (m_textures.find(name) != m_textures.end())
+        close(name);
+
+    auto header = Texture::read_cooked_header(
+        m_file_system.read(path, 0, Texture::get_cooked_header_size(32)));
+
+    auto texture = std::make_unique<StreamingTexture>(path, header);
+
+    while (texture->m_tail_mip > 0 &&
+           std::max(header.width >> (texture->m_tail_mip - 1), 1u) <= m_tail_size &&
+           std::max(header.height >> (texture->m_tail_mip - 1), 1u) <= m_tail_size)
+        --texture->m_tail_mip;
+
+    // Levels are stored from the smallest to the largest, so the tail is one
+    // contiguous range
+    auto last = header.mip_count - 1;
+    auto begin = header.mip_offsets[last];
+    auto end = header.mip_offsets[texture->m_tail_mip] +
+               header.mip_sizes[texture->m_tail_mip];
+    auto data = m_file_system.read(path, begin, end - begin);
+
+    if (data.size() != end - begin)
+        throw std::runtime_error("Corrupted cooked texture: " + path);
+
+    for (auto level = texture->m_tail_mip; level <= last; ++level)
+    {
+        Image mip(std::max(header.width >> level, 1u),
+                  std::max(header.height >> level, 1u), header.channels);
+
+        if (mip.get_size() != header.mip_sizes[level])
+            throw std::runtime_error("Corrupted cooked texture: " + path);
+
+        std::memcpy(mip.get_pixels().data(),
+                    data.data() + (header.mip_offsets[level] - begin), mip.get_size());
+
+        m_resident_bytes += mip.get_size();
+        texture->m_mips[level] = std::move(mip);
+    }
+
+    texture->m_resident_mip = texture->m_tail_mip;
+    texture->m_desired_mip = texture->m_tail_mip;
+
+    return *(m_textures[name] = std::move(texture));
+}
+
+/**
+ * @brief
+ * Closes a texture and frees its levels
+ * @param name Name of the texture
+ */
+void TextureStreamer::close(const std::string &name)
+{
+    auto it = m_textures.find(name);
+
+    if (it == m_textures.end())
+        return;
+
+    auto &texture = *it->second;
+
+    if (texture.m_pending.valid())
+    {
+        texture.m_pending.wait();
+        m_pending_bytes -= texture.m_header.mip_sizes[texture.m_pending_mip];
+    }
+
+    m_resident_bytes -= texture.get_resident_bytes();
+    m_textures.erase(it);
+}
+
+/**
+ * @brief
+ * Installs the finished reads, drops levels when the budget is exceeded and
+ * starts the reads of the most important missing levels. Call once a frame
+ * after the priorities are set.
+ */
+void TextureStreamer::update()
+{
+    collect_loads();
+    evict(0, nullptr);
+    request_loads();
+}
+
+// Methods (private)
+/**
+ * @brief
+ * Installs the levels whose reads have finished. A failed read is logged
+ * and puts its level and the ones above it out of reach.
+ */
+void TextureStreamer::collect_loads()
+{
+    for (auto &[name, texture] : m_textures)
+    {
+        auto &pending = texture->m_pending;
+
+        if (!pending.valid() ||
+            pending.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+            continue;
+
+        auto level = texture->m_pending_mip;
+        m_pending_bytes -= texture->m_header.mip_sizes[level];
+        texture->m_pending_mip = texture->m_mips.size();
+
+        try
+        {
+            texture->m_mips[level] = pending.get();
+            texture->m_resident_mip = level;
+            m_resident_bytes += texture->m_mips[level].get_size();
+        }
+        catch (const std::exception &e)
+        {
+            // Reading the level again would fail the same way every frame
+            texture->m_loadable_mip = level + 1;
+            Logging::get_instance().log(Logging::ERROR, e.what());
+        }
+    }
+}
+
+/**
+ * @brief
+ * Drops levels until the resident, pending and requested memory fit in the
+ * budget. Levels more detailed than needed go first, then the levels of the
+ * textures with the lowest priority. The mip tail is never dropped.
+ * @param requested Memory about to be requested, in bytes
+ * @param requester Texture asking for the memory, or nullptr. Only textures
+ *        less important than the requester lose levels for it.
+ */
+void TextureStreamer::evict(std::size_t requested, const StreamingTexture *requester)
+{
+    while (m_resident_bytes + m_pending_bytes + requested > m_budget)
+    {
+        StreamingTexture *victim = nullptr;
+
+        for (auto &[name, texture] : m_textures)
+        {
+            if (texture.get() == requester ||
+                texture->m_resident_mip >= texture->m_tail_mip ||
+                texture->m_pending.valid())
+                continue;
+
+            bool over_detailed = texture->m_resident_mip < texture->m_desired_mip;
+
+            if (requester != nullptr && !over_detailed &&
+                texture->m_priority >= requester->m_priority)
+                continue;
+
+            if (victim == nullptr)
+            {
+                victim = texture.get();
+                continue;
+            }
+
+            bool victim_over_detailed = victim->m_resident_mip < victim->m_desired_mip;
+
+            if (over_detailed != victim_over_detailed)
+            {
+                if (over_detailed)
+                    victim = texture.get();
+            }
+
+            else if (texture->m_priority < victim->m_priority)
+                victim = texture.get();
+        }
+
+        if (victim == nullptr)
+            return;
+
+        drop_mip(*victim);
+    }
+}
+
+/**
+ * @brief
+ * Starts reading the next level of the textures that need more detail, from
+ * the highest priority down, while reads are available and the budget allows
+ */
+void TextureStreamer::request_loads()
+{
+    std::vector<StreamingTexture *> candidates;
+    std::size_t pending = 0;
+
+    for (auto &[name, texture] : m_textures)
+    {
+        if (texture->m_pending.valid())
+            ++pending;
+
+        else if (texture->m_resident_mip >
+                 std::max(texture->m_desired_mip, texture->m_loadable_mip))
+            candidates.push_back(texture.get());
+    }
+
+    std::sort(candidates.begin(), candidates.end(),
+              [](const StreamingTexture *a, const StreamingTexture *b)
+              { return a->m_priority > b->m_priority; });
+
+    for (auto *texture : candidates)
+    {
+        if (pending >= m_max_pending)
+            break;
+
+        auto level = texture->m_resident_mip - 1;
+        auto size = static_cast<std::size_t>(texture->m_header.mip_sizes[level]);
+
+        evict(size, texture);
+
+        if (m_resident_bytes + m_pending_bytes + size > m_budget)
+            continue;
+
+        texture->m_pending_mip = level;
+        texture->m_pending = m_thread_pool.enqueue(
+            [file_system = &m_file_system, path = texture->m_path,
+             header = texture->m_header, level]()
+            { return read_mip(*file_system, path, header, level); });
+
+        m_pending_bytes += size;
+        ++pending;
+    }
+}
+
+/**
+ * @brief
+ * Frees the most detailed resident level of a texture
+ * @param texture Texture to drop the level of
+ */
+void TextureStreamer::drop_mip(StreamingTexture &texture)
+{
+    auto &mip = texture.m_mips[texture.m_resident_mip];
+
+    m_resident_bytes -= mip.get_size();
+    mip = Image();
+    ++texture.m_resident_mip;
+}
@@ -0,0 +1,131 @@
+/**
+ * @file texture_streamer.h
+ * @author Carlos Salguero
+ * @brief Declaration of the texture streamer
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef TEXTURE_STREAMER_H
+#define TEXTURE_STREAMER_H
+
+// C++ Standard Library
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Project files
+#include "image.h"
+#include "texture.h"
+#include "../../resource/virtual_file_system.h"
+#include "../../threads/thread_pool.h"
+
+// Classes
+/**
+ * @class StreamingTexture
+ * @brief Cooked texture whose mip levels are loaded on demand. The resident
+ *        levels always form a chain from the most detailed resident level
+ *        down to the smallest one. A level whose read fails is not asked
+ *        for again, nor any level above it, until the texture is reopened.
+ */
+class StreamingTexture
+{
+public:
+    // Constructors
+    StreamingTexture(const std::string &, CookedTextureHeader);
+
+    // Access Methods
+    const std::string &get_path() const noexcept;
+    const CookedTextureHeader &get_header() const noexcept;
+    std::size_t get_mip_count() const noexcept;
+    std::size_t get_resident_mip() const noexcept;
+    std::size_t get_desired_mip() const noexcept;
+    std::size_t get_loadable_mip() const noexcept;
+    std::size_t get_resident_bytes() const noexcept;
+    float get_priority() const noexcept;
+    const Image &get_mip(std::size_t) const;
+    const Image &get_best_mip() const;
+
+    // Methods
+    bool is_resident(std::size_t) const noexcept;
+
+private:
+    friend class TextureStreamer;
+
+    std::string m_path;
+    CookedTextureHeader m_header;
+    std::vector<Image> m_mips;
+    std::size_t m_resident_mip;
+    std::size_t m_tail_mip;
+    std::size_t m_desired_mip;
+    std::size_t m_loadable_mip;
+    float m_priority;
+    std::future<Image> m_pending;
+    std::size_t m_pending_mip;
+};
+
+/**
+ * @class TextureStreamer
+ * @brief Keeps the small mips of every opened texture resident and streams
+ *        the larger ones in by priority, within a memory budget. When the
+ *        budget is exceeded the most detailed mips of the least important
+ *        textures are dropped first. All methods must be called from the
+ *        same thread; the reads run on the thread pool.
+ */
+class TextureStreamer
+{
+public:
+    // Constructors
+    TextureStreamer(VirtualFileSystem &, ThreadPool &, std::size_t,
+                    std::uint32_t = 64, std::size_t = 4);
+
+    // Deleted Constructors
+    TextureStreamer(const TextureStreamer &) = delete;
+    TextureStreamer(TextureStreamer &&) = delete;
+
+    // Destructor
+    ~TextureStreamer();
+
+    // Deleted Operators
+    TextureStreamer &operator=(const TextureStreamer &) = delete;
+    TextureStreamer &operator=(TextureStreamer &&) = delete;
+
+    // Access Methods
+    const StreamingTexture &get_texture(const std::string &) const;
+    std::size_t get_budget() const noexcept;
+    std::size_t get_resident_bytes() const noexcept;
+    std::size_t get_pending_bytes() const noexcept;
+
+    // Mutator Methods
+    void set_budget(std::size_t);
+    void set_priority(const std::string &, float, float);
+
+    // Methods
+    const StreamingTexture &open(const std::string &, const std::string &);
+    void close(const std::string &);
+    void update();
+
+private:
+    VirtualFileSystem &m_file_system;
+    ThreadPool &m_thread_pool;
+    std::size_t m_budget;
+    std::uint32_t m_tail_size;
+    std::size_t m_max_pending;
+    std::size_t m_resident_bytes;
+    std::size_t m_pending_bytes;
+    std::unordered_map<std::string, std::unique_ptr<StreamingTexture>> m_textures;
+
+    // Methods
+    void collect_loads();
+    void evict(std::size_t, const StreamingTexture *);
+    void request_loads();
+    void drop_mip(StreamingTexture &);
+};
+
+#endif //! TEXTURE_STREAMER_H
@@ -10,22 +10,28 @@
  */
 
 // C++ Standard Library
-#include <fstream>
 #include <iostream>
 #include <thread>
-#include <sstream>
 
 // Project files
 #include "resource_manager.h"
 
+namespace
+{
+    // Memory budget of the streamed texture levels
+    const std::size_t TEXTURE_STREAMING_BUDGET = 256u * 1024u * 1024u;
+}
+
 // Constructors
 /**
  * @brief
  * Construct a new Resource Manager:: Resource Manager object
  */
 ResourceManager::ResourceManager()
-    : m_resource_path("resources"), m_thread_pool(std::thread::hardware_concurrency())
+    : m_resource_path("resources"), m_thread_pool(std::thread::hardware_concurrency()),
+      m_texture_streamer(m_file_system, m_thread_pool, TEXTURE_STREAMING_BUDGET)
 {
+    m_resource_mount = m_file_system.mount_directory("", m_resource_path);
 }
 
 /**
@@ -34,8 +40,10 @@ ResourceManager::ResourceManager()
  * @param resource_path Path to the resources folder
  */
 ResourceManager::ResourceManager(const std::string &resource_path)
-    : m_resource_path(resource_path), m_thread_pool(std::thread::hardware_concurrency())
+    : m_resource_path(resource_path), m_thread_pool(std::thread::hardware_concurrency()),
+      m_texture_streamer(m_file_system, m_thread_pool, TEXTURE_STREAMING_BUDGET)
 {
+    m_resource_mount = m_file_system.mount_directory("", m_resource_path);
 }
 
 /**
@@ -45,8 +53,10 @@ ResourceManager::ResourceManager(const std::string &resource_path)
  * @param thread_count Number of threads to use
  */
 ResourceManager::ResourceManager(const std::string &resource_path, const std::size_t &thread_count)
-    : m_resource_path(resource_path), m_thread_pool(thread_count)
+    : m_resource_path(resource_path), m_thread_pool(thread_count),
+      m_texture_streamer(m_file_system, m_thread_pool, TEXTURE_STREAMING_BUDGET)
 {
+    m_resource_mount = m_file_system.mount_directory("", m_resource_path);
 }
 
 // Destructor
@@ -116,6 +126,54 @@ const std::string &ResourceManager::get_resource_path(
     return m_resource_path;
 }
 
+/**
+ * @brief
+ * Get the virtual file system the resources are read from. Patches, mods and
+ * pak archives are mounted on top of the resources folder through it.
+ * @return VirtualFileSystem& Virtual file system
+ */
+VirtualFileSystem &ResourceManager::get_file_system()
+{
+    return m_file_system;
+}
+
+/**
+ * @brief
+ * Get a texture atlas
+ * @param atlas_name Name of the atlas
+ * @return const TextureAtlas& Texture atlas
+ * @throw std::out_of_range The atlas has not been built
+ */
+const TextureAtlas &ResourceManager::get_atlas(
+    const std::string &atlas_name) const
+{
+    return *m_atlases.at(atlas_name);
+}
+
+/**
+ * @brief
+ * Get a texture loaded with load_texture
+ * @param texture_name Name of the texture
+ * @return const Texture& Texture and its mip chain
+ * @throw std::out_of_range The texture is not loaded
+ */
+const Texture &ResourceManager::get_loaded_texture(
+    const std::string &texture_name) const
+{
+    return *m_textures.at(texture_name);
+}
+
+/**
+ * @brief
+ * Get the texture streamer. Cooked textures opened through it have their
+ * small mips available immediately and stream the larger ones by priority.
+ * @return TextureStreamer& Texture streamer
+ */
+TextureStreamer &ResourceManager::get_texture_streamer()
+{
+    return m_texture_streamer;
+}
+
 // Mutator Methods
 /**
  * @brief
@@ -125,6 +183,9 @@ const std::string &ResourceManager::get_resource_path(
 void ResourceManager::set_resource_path(const std::string &resource_path)
 {
     m_resource_path = resource_path;
+
+    m_file_system.unmount(m_resource_mount);
+    m_resource_mount = m_file_system.mount_directory("", m_resource_path);
 }
 
 // Methods
@@ -149,9 +210,7 @@ bool ResourceManager::resource_loaded(const std::string &resource_name)
  */
 bool ResourceManager::resource_exists(const std::string &resource_name)
 {
-    std::ifstream file(m_resource_path + resource_name);
-
-    return file.good();
+    return m_file_system.exists(resource_name);
 }
 
 /**
@@ -172,15 +231,8 @@ void ResourceManager::load_resource(const std::string &resource_name,
         return;
     }
 
-    std::ifstream file(m_resource_path + resource_path);
-
-    if (!file.good())
-        throw std::runtime_error("Resource does not exist");
-
-    std::stringstream buffer;
-    buffer << file.rdbuf();
-
-    m_resources[resource_name] = std::make_pair(buffer.str(), 1);
+    m_resources[resource_name] =
+        std::make_pair(m_file_system.read(resource_path), 1);
 }
 
 /**
@@ -202,6 +254,110 @@ void ResourceManager::unload_resource(const std::string &resource_name)
         m_resources.erase(it);
 }
 
+/**
+ * @brief
+ * Maps a resource into memory so binary files can be read in place. Files
+ * on disk are mapped; files from pak archives or memory mounts are copied
+ * into an aligned buffer.
+ * @param resource_path Path to the resource
+ * @return MappedFile Mapped resource
+ * @throw std::runtime_error Resource does not exist
+ */
+MappedFile ResourceManager::map_resource(const std::string &resource_path)
+{
+    auto real_path = m_file_system.get_real_path(resource_path);
+
+    if (!real_path.empty())
+        return MappedFile(real_path);
+
+    return MappedFile::from_bytes(m_file_system.read(resource_path));
+}
+
+/**
+ * @brief
+ * Builds a texture atlas from a set of textures. The textures are read and
+ * decoded in parallel on the thread pool and packed into pages of the given
+ * size. Every sprite is named after the path of its texture.
+ * @param atlas_name Name of the atlas
+ * @param texture_paths Paths to the textures
+ * @param page_size Width and height of the atlas pages
+ * @return const TextureAtlas& Texture atlas
+ * @throw std::runtime_error A texture does not exist or cannot be decoded
+ */
+const TextureAtlas &ResourceManager::build_atlas(
+    const std::string &atlas_name, const std::vector<std::string> &texture_paths,
+    std::uint32_t page_size)
+{
+    std::vector<std::future<Image>> images;
+    images.reserve(texture_paths.size());
+
+    for (const auto &texture_path : texture_paths)
+        images.push_back(m_thread_pool.enqueue(
+            [this, texture_path]()
+            { return Image::decode(m_file_system.read(texture_path)); }));
+
+    auto atlas = std::make_unique<TextureAtlas>(page_size, page_size);
+
+    for (std::size_t i = 0; i < texture_paths.size(); ++i)
+        atlas->add_image(texture_paths[i], images[i].get());
+
+    atlas->build();
+
+    return *(m_atlases[atlas_name] = std::move(atlas));
+}
+
+/**
+ * @brief
+ * Unload a texture atlas
+ * @param atlas_name Name of the atlas
+ */
+void ResourceManager::unload_atlas(const std::string &atlas_name)
+{
+    m_atlases.erase(atlas_name);
+}
+
+/**
+ * @brief
+ * Loads a texture with its mip chain. Cooked textures already carry their
+ * mips; any other image is decoded and its mips are generated on the
+ * thread pool at load time.
+ * @param texture_name Name of the texture
+ * @param texture_path Path to the cooked texture or the image
+ * @param filter Filter used to generate the mips of images
+ * @param srgb Whether the color channels of images are sRGB encoded
+ * @return const Texture& Loaded texture
+ * @throw std::runtime_error The texture does not exist or cannot be decoded
+ */
+const Texture &ResourceManager::load_texture(const std::string &texture_name,
+                                             const std::string &texture_path,
+                                             MipFilter filter, bool srgb)
+{
+    auto data = m_file_system.read(texture_path);
+    std::unique_ptr<Texture> texture;
+
+    if (data.compare(0, 4, "GTEX") == 0)
+        texture = std::make_unique<Texture>(Texture::from_cooked(data));
+
+    else
+    {
+        MipmapGenerator generator(filter, srgb, &m_thread_pool);
+        texture = std::make_unique<Texture>(
+            Texture::from_image(Image::decode(data), generator));
+    }
+
+    return *(m_textures[texture_name] = std::move(texture));
+}
+
+/**
+ * @brief
+ * Unload a texture loaded with load_texture
+ * @param texture_name Name of the texture
+ */
+void ResourceManager::unload_texture(const std::string &texture_name)
+{
+    m_textures.erase(texture_name);
+}
+
 // Methods (private)
 /**
  * @brief
@@ -221,13 +377,6 @@ void ResourceManager::load_resource_async(const std::string &resource_name,
         return;
     }
 
-    std::ifstream file(m_resource_path + resource_path);
-
-    if (!file.good())
-        throw std::runtime_error("Resource does not exist");
-
-    std::stringstream buffer;
-    buffer << file.rdbuf();
-
-    m_resources[resource_name] = std::make_pair(buffer.str(), 1);
+    m_resources[resource_name] =
+        std::make_pair(m_file_system.read(resource_path), 1);
 }
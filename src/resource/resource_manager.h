@@ -13,11 +13,18 @@
 #define RESOURCE_MANAGER_H
 
 // C++ Standard Library
+#include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 // Project files
 #include "../threads/thread_pool.h"
+#include "virtual_file_system.h"
+#include "../graphics/texture/texture_atlas.h"
+#include "../graphics/texture/texture.h"
+#include "../graphics/texture/texture_streamer.h"
+#include "../serialization/mapped_file.h"
 
 // Class
 /**
@@ -44,6 +51,10 @@ public:
     const std::string &get_texture(const std::string &) const;
     const std::string &get_resource_path() const;
     const std::string &get_resource_path(const std::string &) const;
+    VirtualFileSystem &get_file_system();
+    const TextureAtlas &get_atlas(const std::string &) const;
+    const Texture &get_loaded_texture(const std::string &) const;
+    TextureStreamer &get_texture_streamer();
 
     // Mutator Methods
     void set_resource_path(const std::string &);
@@ -57,11 +68,24 @@ public:
     bool resource_exists(const std::string &);
     void load_resource(const std::string &, const std::string &);
     void unload_resource(const std::string &);
+    MappedFile map_resource(const std::string &);
+    const TextureAtlas &build_atlas(const std::string &,
+                                    const std::vector<std::string> &,
+                                    std::uint32_t = 2048);
+    void unload_atlas(const std::string &);
+    const Texture &load_texture(const std::string &, const std::string &,
+                                MipFilter = MipFilter::Box, bool = true);
+    void unload_texture(const std::string &);
 
 private:
     std::string m_resource_path;
     std::unordered_map<std::string, std::pair<std::string, int>> m_resources;
+    std::unordered_map<std::string, std::unique_ptr<TextureAtlas>> m_atlases;
+    std::unordered_map<std::string, std::unique_ptr<Texture>> m_textures;
+    VirtualFileSystem m_file_system;
+    VirtualFileSystem::MountId m_resource_mount;
     ThreadPool m_thread_pool;
+    TextureStreamer m_texture_streamer;
 
     // Methods
     void load_resource_async(const std::string &, const std::string &);
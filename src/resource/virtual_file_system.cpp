@@ -0,0 +1,797 @@
+/**
+ * @file virtual_file_system.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of the virtual file system and its mount points
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// C++ Standard Library
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+
+// Project files
+#include "virtual_file_system.h"
+
+namespace
+{
+    // Pak archive layout (little endian):
+    //   "GPAK" | version u32 | entry count u32
+    //   entry count * (path length u32 | path | offset u64 | size u64)
+    //   file data
+    const char PAK_MAGIC[4] = {'G', 'P', 'A', 'K'};
+    const std::uint32_t PAK_VERSION = 1;
+    const std::uint64_t PAK_HEADER_SIZE = 12;
+    const std::uint64_t PAK_ENTRY_SIZE = 4 + 8 + 8;
+
+    /**
+     * @brief
+     * Writes an unsigned integer in little endian order
+     * @param stream Stream to write to
+     * @param value Value to write
+     * @param bytes Number of bytes to write
+     */
+    void write_integer(std::ostream &stream, std::uint64_t value, int bytes)
+    {
+        for (int i = 0; i < bytes; ++i)
+            stream.put(static_cast<char>((value >> (8 * i)) & 0xFF));
+    }
+
+    /**
+     * @brief
+     * Reads an unsigned integer stored in little endian order
+     * @param stream Stream to read from
+     * @param bytes Number of bytes to read
+     * @return std::uint64_t Value read
+     * @throw std::runtime_error The stream ended early
+     */
+    std::uint64_t read_integer(std::istream &stream, int bytes)
+    {
+        std::uint64_t value = 0;
+
+        for (int i = 0; i < bytes; ++i)
+        {
+            int byte = stream.get();
+
+            if (byte == std::char_traits<char>::eof())
+                throw std::runtime_error("Corrupted pak archive");
+
+            value |= static_cast<std::uint64_t>(byte) << (8 * i);
+        }
+
+        return value;
+    }
+
+    /**
+     * @brief
+     * Reads a range of bytes from a file of the real file system
+     * @param file_path Path to the file
+     * @param offset Offset of the first byte
+     * @param size Number of bytes to read
+     * @return std::string Bytes read
+     * @throw std::runtime_error The file could not be read
+     */
+    std::string read_file_range(const std::string &file_path,
+                                std::uint64_t offset, std::uint64_t size)
+    {
+        std::ifstream file(file_path, std::ios::binary);
+
+        if (!file.good())
+            throw std::runtime_error("Resource does not exist");
+
+        std::string buffer(size, '\0');
+        file.seekg(static_cast<std::streamoff>(offset));
+        file.read(buffer.data(), static_cast<std::streamsize>(size));
+
+        if (static_cast<std::uint64_t>(file.gcount()) != size)
+            throw std::runtime_error("Failed to read resource");
+
+        return buffer;
+    }
+
+    /**
+     * @brief
+     * Clamps a byte range to the size of a file
+     * @param file_size Size of the file
+     * @param offset Offset of the range
+     * @param size Size of the range
+     * @return std::size_t Size of the range inside the file
+     */
+    std::size_t clamp_range(std::size_t file_size, std::size_t offset,
+                            std::size_t size)
+    {
+        if (offset >= file_size)
+            return 0;
+
+        return std::min(size, file_size - offset);
+    }
+}
+
+// MountPoint
+/**
+ * @brief
+ * Gets the path of a file on the real file system, for sources that keep
+ * their files there
+ * @param file_path Path relative to the mount point
+ * @return std::string Real path, or an empty string
+ */
+std::string MountPoint::get_real_path(const std::string &) const
+{
+    return {};
+}
+
+// DirectoryMount
+/**
+ * @brief
+ * Construct a new Directory Mount:: Directory Mount object
+ * @param directory Directory of the real file system
+ */
+DirectoryMount::DirectoryMount(const std::string &directory)
+    : m_directory(directory)
+{
+}
+
+/**
+ * @brief
+ * Lists the files of the directory and its subdirectories. A missing
+ * directory is treated as empty.
+ * @return std::vector<std::pair<std::string, std::size_t>> Relative paths and
+ *         sizes of the files
+ */
+std::vector<std::pair<std::string, std::size_t>> DirectoryMount::list_files() const
+{
+    namespace fs = std::filesystem;
+
+    std::vector<std::pair<std::string, std::size_t>> files;
+    std::error_code error;
+
+    if (!fs::is_directory(m_directory, error))
+        return files;
+
+    for (auto it = fs::recursive_directory_iterator(m_directory, error);
+         it != fs::recursive_directory_iterator(); it.increment(error))
+    {
+        if (error)
+            break;
+
+        if (!it->is_regular_file(error))
+            continue;
+
+        auto relative = fs::relative(it->path(), m_directory, error);
+        files.emplace_back(relative.generic_string(), it->file_size(error));
+    }
+
+    return files;
+}
+
+/**
+ * @brief
+ * Reads a whole file
+ * @param file_path Path relative to the directory
+ * @return std::string Contents of the file
+ */
+std::string DirectoryMount::read(const std::string &file_path) const
+{
+    std::ifstream file(m_directory + "/" + file_path, std::ios::binary);
+
+    if (!file.good())
+        throw std::runtime_error("Resource does not exist");
+
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+
+    return buffer.str();
+}
+
+/**
+ * @brief
+ * Reads a range of a file
+ * @param file_path Path relative to the directory
+ * @param offset Offset of the first byte
+ * @param size Number of bytes to read
+ * @return std::string Bytes read
+ */
+std::string DirectoryMount::read(const std::string &file_path,
+                                 std::size_t offset, std::size_t size) const
+{
+    return read_file_range(m_directory + "/" + file_path, offset, size);
+}
+
+/**
+ * @brief
+ * Gets the path of a file on the real file system
+ * @param file_path Path relative to the directory
+ * @return std::string Real path
+ */
+std::string DirectoryMount::get_real_path(const std::string &file_path) const
+{
+    return m_directory + "/" + file_path;
+}
+
+// PakMount
+/**
+ * @brief
+ * Construct a new Pak Mount:: Pak Mount object. Reads the table of contents
+ * of the archive.
+ * @param archive_path Path to the archive
+ * @throw std::runtime_error The archive is missing or corrupted
+ */
+PakMount::PakMount(const std::string &archive_path)
+    : m_archive_path(archive_path)
+{
+    std::ifstream file(archive_path, std::ios::binary | std::ios::ate);
+
+    if (!file.good())
+        throw std::runtime_error("Pak archive does not exist: " + archive_path);
+
+    // Every length and count is checked against the size of the archive
+    // before anything is allocated for it
+    auto file_size = static_cast<std::uint64_t>(file.tellg());
+    file.seekg(0);
+
+    auto remaining = [&]()
+    { return file_size - static_cast<std::uint64_t>(file.tellg()); };
+
+    char magic[4];
+    file.read(magic, sizeof(magic));
+
+    if (file.gcount() != sizeof(magic) ||
+        !std::equal(magic, magic + 4, PAK_MAGIC))
+        throw std::runtime_error("Invalid pak archive: " + archive_path);
+
+    if (read_integer(file, 4) != PAK_VERSION)
+        throw std::runtime_error("Unsupported pak archive version: " + archive_path);
+
+    auto entry_count = read_integer(file, 4);
+
+    if (entry_count > (file_size - PAK_HEADER_SIZE) / PAK_ENTRY_SIZE)
+        throw std::runtime_error("Corrupted pak archive: " + archive_path);
+
+    for (std::uint64_t i = 0; i < entry_count; ++i)
+    {
+        auto path_size = read_integer(file, 4);
+
+        if (path_size > remaining())
+            throw std::runtime_error("Corrupted pak archive: " + archive_path);
+
+        std::string path(path_size, '\0');
+        file.read(path.data(), static_cast<std::streamsize>(path.size()));
+
+        if (static_cast<std::uint64_t>(file.gcount()) != path_size)
+            throw std::runtime_error("Corrupted pak archive: " + archive_path);
+
+        Entry entry;
+        entry.offset = read_integer(file, 8);
+        entry.size = read_integer(file, 8);
+
+        if (entry.offset > file_size || entry.size > file_size - entry.offset)
+            throw std::runtime_error("Corrupted pak archive: " + archive_path);
+
+        m_entries[VirtualFileSystem::normalize_path(path)] = entry;
+    }
+}
+
+/**
+ * @brief
+ * Lists the files stored in the archive
+ * @return std::vector<std::pair<std::string, std::size_t>> Paths and sizes of
+ *         the files
+ */
+std::vector<std::pair<std::string, std::size_t>> PakMount::list_files() const
+{
+    std::vector<std::pair<std::string, std::size_t>> files;
+    files.reserve(m_entries.size());
+
+    for (const auto &[path, entry] : m_entries)
+        files.emplace_back(path, entry.size);
+
+    return files;
+}
+
+/**
+ * @brief
+ * Reads a whole file from the archive
+ * @param file_path Path inside the archive
+ * @return std::string Contents of the file
+ */
+std::string PakMount::read(const std::string &file_path) const
+{
+    auto it = m_entries.find(file_path);
+
+    if (it == m_entries.end())
+        throw std::runtime_error("Resource does not exist");
+
+    return read_file_range(m_archive_path, it->second.offset, it->second.size);
+}
+
+/**
+ * @brief
+ * Reads a range of a file from the archive
+ * @param file_path Path inside the archive
+ * @param offset Offset of the first byte, relative to the file
+ * @param size Number of bytes to read
+ * @return std::string Bytes read
+ */
+std::string PakMount::read(const std::string &file_path,
+                           std::size_t offset, std::size_t size) const
+{
+    auto it = m_entries.find(file_path);
+
+    if (it == m_entries.end())
+        throw std::runtime_error("Resource does not exist");
+
+    size = clamp_range(it->second.size, offset, size);
+
+    return read_file_range(m_archive_path, it->second.offset + offset, size);
+}
+
+/**
+ * @brief
+ * Writes a pak archive. Used by the tools that cook the game data.
+ * @param archive_path Path of the archive to write
+ * @param files Paths and contents of the files to store
+ * @throw std::runtime_error The archive could not be written
+ */
+void PakMount::write_archive(
+    const std::string &archive_path,
+    const std::vector<std::pair<std::string, std::string>> &files)
+{
+    std::ofstream file(archive_path, std::ios::binary | std::ios::trunc);
+
+    if (!file.good())
+        throw std::runtime_error("Failed to create pak archive: " + archive_path);
+
+    std::uint64_t offset = PAK_HEADER_SIZE;
+
+    for (const auto &[path, data] : files)
+        offset += PAK_ENTRY_SIZE + path.size();
+
+    file.write(PAK_MAGIC, sizeof(PAK_MAGIC));
+    write_integer(file, PAK_VERSION, 4);
+    write_integer(file, files.size(), 4);
+
+    for (const auto &[path, data] : files)
+    {
+        write_integer(file, path.size(), 4);
+        file.write(path.data(), static_cast<std::streamsize>(path.size()));
+        write_integer(file, offset, 8);
+        write_integer(file, data.size(), 8);
+
+        offset += data.size();
+    }
+
+    for (const auto &[path, data] : files)
+        file.write(data.data(), static_cast<std::streamsize>(data.size()));
+
+    if (!file.good())
+        throw std::runtime_error("Failed to write pak archive: " + archive_path);
+}
+
+// MemoryMount
+/**
+ * @brief
+ * Adds or replaces a file. The virtual file system only sees the change
+ * after VirtualFileSystem::refresh is called.
+ * @param file_path Path of the file
+ * @param data Contents of the file
+ */
+void MemoryMount::add_file(const std::string &file_path, std::string data)
+{
+    std::unique_lock lock(m_mutex);
+
+    m_files[VirtualFileSystem::normalize_path(file_path)] = std::move(data);
+}
+
+/**
+ * @brief
+ * Removes a file. The virtual file system only sees the change after
+ * VirtualFileSystem::refresh is called.
+ * @param file_path Path of the file
+ */
+void MemoryMount::remove_file(const std::string &file_path)
+{
+    std::unique_lock lock(m_mutex);
+
+    m_files.erase(VirtualFileSystem::normalize_path(file_path));
+}
+
+/**
+ * @brief
+ * Lists the files stored in memory
+ * @return std::vector<std::pair<std::string, std::size_t>> Paths and sizes of
+ *         the files
+ */
+std::vector<std::pair<std::string, std::size_t>> MemoryMount::list_files() const
+{
+    std::shared_lock lock(m_mutex);
+
+    std::vector<std::pair<std::string, std::size_t>> files;
+    files.reserve(m_files.size());
+
+    for (const auto &[path, data] : m_files)
+        files.emplace_back(path, data.size());
+
+    return files;
+}
+
+/**
+ * @brief
+ * Reads a whole file
+ * @param file_path Path of the file
+ * @return std::string Contents of the file
+ */
+std::string MemoryMount::read(const std::string &file_path) const
+{
+    std::shared_lock lock(m_mutex);
+
+    auto it = m_files.find(file_path);
+
+    if (it == m_files.end())
+        throw std::runtime_error("Resource does not exist");
+
+    return it->second;
+}
+
+/**
+ * @brief
+ * Reads a range of a file
+ * @param file_path Path of the file
+ * @param offset Offset of the first byte
+ * @param size Number of bytes to read
+ * @return std::string Bytes read
+ */
+std::string MemoryMount::read(const std::string &file_path,
+                              std::size_t offset, std::size_t size) const
+{
+    std::shared_lock lock(m_mutex);
+
+    auto it = m_files.find(file_path);
+
+    if (it == m_files.end())
+        throw std::runtime_error("Resource does not exist");
+
+    size = clamp_range(it->second.size(), offset, size);
+
+    return it->second.substr(std::min(offset, it->second.size()), size);
+}
+
+// VirtualFileSystem
+// Access Methods
+/**
+ * @brief
+ * Gets the size of a file
+ * @param file_path Virtual path of the file
+ * @return std::size_t Size of the file in bytes
+ * @throw std::runtime_error The file does not exist
+ */
+std::size_t VirtualFileSystem::get_file_size(const std::string &file_path) const
+{
+    std::shared_lock lock(m_mutex);
+
+    return find_entry(file_path).size;
+}
+
+/**
+ * @brief
+ * Gets the number of files visible through the mounts
+ * @return std::size_t Number of files
+ */
+std::size_t VirtualFileSystem::get_file_count() const
+{
+    std::shared_lock lock(m_mutex);
+
+    return m_index.size();
+}
+
+/**
+ * @brief
+ * Gets the path of a file on the real file system, so it can be mapped
+ * into memory instead of read
+ * @param file_path Virtual path of the file
+ * @return std::string Real path, or an empty string when the file lives in
+ *         a pak archive or in memory
+ * @throw std::runtime_error The file does not exist
+ */
+std::string VirtualFileSystem::get_real_path(const std::string &file_path) const
+{
+    std::shared_lock lock(m_mutex);
+    const auto &entry = find_entry(file_path);
+
+    return entry.source->get_real_path(entry.source_path);
+}
+
+// Methods
+/**
+ * @brief
+ * Mounts a source of files
+ * @param virtual_root Virtual directory the files appear under
+ * @param source Source of the files
+ * @param priority Overlay priority. Higher priorities override lower ones,
+ *        and among equal priorities the most recent mount wins.
+ * @return MountId Identifier used to unmount the source
+ */
+VirtualFileSystem::MountId VirtualFileSystem::mount(
+    const std::string &virtual_root, std::unique_ptr<MountPoint> source,
+    int priority)
+{
+    return add_mount(virtual_root, std::move(source), priority);
+}
+
+/**
+ * @brief
+ * Mounts a directory of the real file system
+ * @param virtual_root Virtual directory the files appear under
+ * @param directory Directory to mount
+ * @param priority Overlay priority
+ * @return MountId Identifier used to unmount the directory
+ */
+VirtualFileSystem::MountId VirtualFileSystem::mount_directory(
+    const std::string &virtual_root, const std::string &directory,
+    int priority)
+{
+    return add_mount(virtual_root, std::make_shared<DirectoryMount>(directory),
+                     priority);
+}
+
+/**
+ * @brief
+ * Mounts a pak archive
+ * @param virtual_root Virtual directory the files appear under
+ * @param archive_path Path to the archive
+ * @param priority Overlay priority
+ * @return MountId Identifier used to unmount the archive
+ */
+VirtualFileSystem::MountId VirtualFileSystem::mount_pak(
+    const std::string &virtual_root, const std::string &archive_path,
+    int priority)
+{
+    return add_mount(virtual_root, std::make_shared<PakMount>(archive_path),
+                     priority);
+}
+
+/**
+ * @brief
+ * Mounts files stored in memory. The caller may keep adding files to the
+ * mount and call refresh to publish them.
+ * @param virtual_root Virtual directory the files appear under
+ * @param source Files stored in memory
+ * @param priority Overlay priority
+ * @return MountId Identifier used to unmount the files
+ */
+VirtualFileSystem::MountId VirtualFileSystem::mount_memory(
+    const std::string &virtual_root, std::shared_ptr<MemoryMount> source,
+    int priority)
+{
+    return add_mount(virtual_root, std::move(source), priority);
+}
+
+/**
+ * @brief
+ * Unmounts a source of files
+ * @param id Identifier returned when the source was mounted
+ */
+void VirtualFileSystem::unmount(MountId id)
+{
+    std::unique_lock lock(m_mutex);
+
+    m_mounts.erase(std::remove_if(m_mounts.begin(), m_mounts.end(),
+                                  [id](const Mount &mount)
+                                  { return mount.id == id; }),
+                   m_mounts.end());
+
+    rebuild_index();
+}
+
+/**
+ * @brief
+ * Rebuilds the path index. Needed after files are added to a mounted
+ * directory or memory mount.
+ */
+void VirtualFileSystem::refresh()
+{
+    std::unique_lock lock(m_mutex);
+
+    rebuild_index();
+}
+
+/**
+ * @brief
+ * Checks if a file exists
+ * @param file_path Virtual path of the file
+ * @return true The file exists
+ * @return false The file does not exist
+ */
+bool VirtualFileSystem::exists(const std::string &file_path) const
+{
+    std::shared_lock lock(m_mutex);
+
+    return m_index.find(normalize_path(file_path)) != m_index.end();
+}
+
+/**
+ * @brief
+ * Reads a whole file
+ * @param file_path Virtual path of the file
+ * @return std::string Contents of the file
+ * @throw std::runtime_error The file does not exist
+ */
+std::string VirtualFileSystem::read(const std::string &file_path) const
+{
+    std::shared_lock lock(m_mutex);
+    const auto &entry = find_entry(file_path);
+
+    return entry.source->read(entry.source_path);
+}
+
+/**
+ * @brief
+ * Reads a range of a file. The range is clamped to the end of the file.
+ * @param file_path Virtual path of the file
+ * @param offset Offset of the first byte
+ * @param size Number of bytes to read
+ * @return std::string Bytes read
+ * @throw std::runtime_error The file does not exist
+ */
+std::string VirtualFileSystem::read(const std::string &file_path,
+                                    std::size_t offset, std::size_t size) const
+{
+    std::shared_lock lock(m_mutex);
+    const auto &entry = find_entry(file_path);
+
+    return entry.source->read(entry.source_path, offset,
+                              clamp_range(entry.size, offset, size));
+}
+
+/**
+ * @brief
+ * Lists the files under a virtual directory
+ * @param directory Virtual directory, empty for the root
+ * @return std::vector<std::string> Sorted virtual paths of the files
+ */
+std::vector<std::string> VirtualFileSystem::list(const std::string &directory) const
+{
+    std::shared_lock lock(m_mutex);
+
+    auto prefix = normalize_path(directory);
+
+    if (!prefix.empty())
+        prefix += '/';
+
+    std::vector<std::string> files;
+
+    for (const auto &[path, entry] : m_index)
+        if (path.compare(0, prefix.size(), prefix) == 0)
+            files.push_back(path);
+
+    std::sort(files.begin(), files.end());
+
+    return files;
+}
+
+// Static Methods
+/**
+ * @brief
+ * Normalizes a virtual path: uses forward slashes, removes empty and "."
+ * segments, resolves ".." and drops leading and trailing slashes.
+ * @param file_path Path to normalize
+ * @return std::string Normalized path
+ */
+std::string VirtualFileSystem::normalize_path(const std::string &file_path)
+{
+    std::vector<std::string> segments;
+    std::string segment;
+
+    auto flush = [&]()
+    {
+        if (segment == "..")
+        {
+            if (!segments.empty())
+                segments.pop_back();
+        }
+
+        else if (!segment.empty() && segment != ".")
+            segments.push_back(segment);
+
+        segment.clear();
+    };
+
+    for (char character : file_path)
+    {
+        if (character == '/' || character == '\\')
+            flush();
+
+        else
+            segment += character;
+    }
+
+    flush();
+
+    std::string result;
+
+    for (const auto &part : segments)
+    {
+        if (!result.empty())
+            result += '/';
+
+        result += part;
+    }
+
+    return result;
+}
+
+// Methods (private)
+/**
+ * @brief
+ * Registers a mount and updates the index
+ * @param virtual_root Virtual directory the files appear under
+ * @param source Source of the files
+ * @param priority Overlay priority
+ * @return MountId Identifier of the mount
+ */
+VirtualFileSystem::MountId VirtualFileSystem::add_mount(
+    const std::string &virtual_root, std::shared_ptr<MountPoint> source,
+    int priority)
+{
+    if (!source)
+        throw std::invalid_argument("Cannot mount a null source");
+
+    std::unique_lock lock(m_mutex);
+
+    MountId id = m_next_id++;
+    m_mounts.push_back({id, normalize_path(virtual_root), std::move(source),
+                        priority});
+
+    rebuild_index();
+
+    return id;
+}
+
+/**
+ * @brief
+ * Rebuilds the path index from every mount, applying them from the lowest
+ * to the highest priority so overriding files replace the earlier entries.
+ * The caller must hold the lock.
+ */
+void VirtualFileSystem::rebuild_index()
+{
+    std::stable_sort(m_mounts.begin(), m_mounts.end(),
+                     [](const Mount &a, const Mount &b)
+                     { return a.priority < b.priority; });
+
+    m_index.clear();
+
+    for (const auto &mount : m_mounts)
+    {
+        for (auto &[path, size] : mount.source->list_files())
+        {
+            auto virtual_path = normalize_path(mount.virtual_root + "/" + path);
+
+            m_index[virtual_path] = {mount.source.get(), path, size};
+        }
+    }
+}
+
+/**
+ * @brief
+ * Finds the index entry of a file. The caller must hold the lock.
+ * @param file_path Virtual path of the file
+ * @return const IndexEntry& Entry of the file
+ * @throw std::runtime_error The file does not exist
+ */
+const VirtualFileSystem::IndexEntry &VirtualFileSystem::find_entry(
+    const std::string &file_path) const
+{
+    auto it = m_index.find(normalize_path(file_path));
+
+    if (it == m_index.end())
+        throw std::runtime_error("Resource does not exist");
+
+    return it->second;
+}
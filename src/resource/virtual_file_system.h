@@ -0,0 +1,191 @@
+/**
+ * @file virtual_file_system.h
+ * @author Carlos Salguero
+ * @brief Declaration of the virtual file system and its mount points
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef VIRTUAL_FILE_SYSTEM_H
+#define VIRTUAL_FILE_SYSTEM_H
+
+// C++ Standard Library
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Classes
+/**
+ * @class MountPoint
+ * @brief Source of files that can be mounted into the virtual file system.
+ *        Paths handled by a mount point are relative to its own root.
+ */
+class MountPoint
+{
+public:
+    // Destructor
+    virtual ~MountPoint() = default;
+
+    // Methods
+    virtual std::vector<std::pair<std::string, std::size_t>> list_files() const = 0;
+    virtual std::string read(const std::string &) const = 0;
+    virtual std::string read(const std::string &, std::size_t, std::size_t) const = 0;
+    virtual std::string get_real_path(const std::string &) const;
+};
+
+/**
+ * @class DirectoryMount
+ * @brief Exposes a directory of the real file system
+ */
+class DirectoryMount : public MountPoint
+{
+public:
+    // Constructors
+    explicit DirectoryMount(const std::string &);
+
+    // Methods
+    std::vector<std::pair<std::string, std::size_t>> list_files() const override;
+    std::string read(const std::string &) const override;
+    std::string read(const std::string &, std::size_t, std::size_t) const override;
+    std::string get_real_path(const std::string &) const override;
+
+private:
+    std::string m_directory;
+};
+
+/**
+ * @class PakMount
+ * @brief Exposes the contents of a pak archive. The table of contents is
+ *        read once when the archive is opened.
+ */
+class PakMount : public MountPoint
+{
+public:
+    // Constructors
+    explicit PakMount(const std::string &);
+
+    // Methods
+    std::vector<std::pair<std::string, std::size_t>> list_files() const override;
+    std::string read(const std::string &) const override;
+    std::string read(const std::string &, std::size_t, std::size_t) const override;
+
+    // Static Methods
+    static void write_archive(const std::string &,
+                              const std::vector<std::pair<std::string, std::string>> &);
+
+private:
+    struct Entry
+    {
+        std::uint64_t offset;
+        std::uint64_t size;
+    };
+
+    std::string m_archive_path;
+    std::unordered_map<std::string, Entry> m_entries;
+};
+
+/**
+ * @class MemoryMount
+ * @brief Exposes files stored in memory. Files can be added and removed
+ *        while other threads read through the virtual file system.
+ */
+class MemoryMount : public MountPoint
+{
+public:
+    // Mutator Methods
+    void add_file(const std::string &, std::string);
+    void remove_file(const std::string &);
+
+    // Methods
+    std::vector<std::pair<std::string, std::size_t>> list_files() const override;
+    std::string read(const std::string &) const override;
+    std::string read(const std::string &, std::size_t, std::size_t) const override;
+
+private:
+    std::unordered_map<std::string, std::string> m_files;
+    mutable std::shared_mutex m_mutex;
+};
+
+/**
+ * @class VirtualFileSystem
+ * @brief Resolves virtual paths against an ordered set of mount points.
+ *        Mounts with a higher priority override files of lower ones, so
+ *        patches and mods are mounted on top of the base game data. Every
+ *        lookup is answered from a prebuilt index and never touches the disk.
+ */
+class VirtualFileSystem
+{
+public:
+    // Type aliases
+    using MountId = std::size_t;
+
+    // Constructors
+    VirtualFileSystem() = default;
+
+    // Deleted Constructors
+    VirtualFileSystem(const VirtualFileSystem &) = delete;
+    VirtualFileSystem(VirtualFileSystem &&) = delete;
+
+    // Destructor
+    ~VirtualFileSystem() = default;
+
+    // Deleted Operators
+    VirtualFileSystem &operator=(const VirtualFileSystem &) = delete;
+    VirtualFileSystem &operator=(VirtualFileSystem &&) = delete;
+
+    // Access Methods
+    std::size_t get_file_size(const std::string &) const;
+    std::size_t get_file_count() const;
+    std::string get_real_path(const std::string &) const;
+
+    // Methods
+    MountId mount(const std::string &, std::unique_ptr<MountPoint>, int = 0);
+    MountId mount_directory(const std::string &, const std::string &, int = 0);
+    MountId mount_pak(const std::string &, const std::string &, int = 0);
+    MountId mount_memory(const std::string &, std::shared_ptr<MemoryMount>, int = 0);
+    void unmount(MountId);
+    void refresh();
+
+    bool exists(const std::string &) const;
+    std::string read(const std::string &) const;
+    std::string read(const std::string &, std::size_t, std::size_t) const;
+    std::vector<std::string> list(const std::string &) const;
+
+    // Static Methods
+    static std::string normalize_path(const std::string &);
+
+private:
+    struct Mount
+    {
+        MountId id;
+        std::string virtual_root;
+        std::shared_ptr<MountPoint> source;
+        int priority;
+    };
+
+    struct IndexEntry
+    {
+        const MountPoint *source;
+        std::string source_path;
+        std::size_t size;
+    };
+
+    std::vector<Mount> m_mounts;
+    std::unordered_map<std::string, IndexEntry> m_index;
+    MountId m_next_id = 0;
+    mutable std::shared_mutex m_mutex;
+
+    // Methods
+    MountId add_mount(const std::string &, std::shared_ptr<MountPoint>, int);
+    void rebuild_index();
+    const IndexEntry &find_entry(const std::string &) const;
+};
+
+#endif //! VIRTUAL_FILE_SYSTEM_H
@@ -0,0 +1,627 @@
+/**
+ * @file binary_format.h
+ * @author Carlos Salguero
+ * @brief Zero-copy binary format: relative pointers, schemas, writer and
+ *        in-place reader
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#pragma once
+
+// C++ Standard Library
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace Serialization
+{
+    /**
+     * @brief
+     * Alignment of every buffer holding a binary file. Stored types may not
+     * require more.
+     */
+    constexpr std::size_t MAX_ALIGNMENT = 16;
+
+    /**
+     * @brief
+     * Version of the container layout
+     */
+    constexpr std::uint32_t FORMAT_VERSION = 1;
+
+    /**
+     * @brief
+     * Hashes a schema description with FNV-1a
+     * @param name Name of the schema
+     * @param version Version of the schema
+     * @param size Size of the root type
+     * @return std::uint32_t Hash of the schema
+     */
+    constexpr std::uint32_t schema_hash(std::string_view name,
+                                        std::uint32_t version, std::size_t size)
+    {
+        std::uint32_t hash = 2166136261u;
+
+        for (char character : name)
+            hash = (hash ^ static_cast<std::uint8_t>(character)) * 16777619u;
+
+        for (std::uint64_t value : {std::uint64_t(version), std::uint64_t(size)})
+            for (int i = 0; i < 8; ++i)
+                hash = (hash ^ static_cast<std::uint8_t>(value >> (8 * i))) * 16777619u;
+
+        return hash;
+    }
+
+    /**
+     * @struct SchemaInfo
+     * @brief Describes a type that can be the root of a binary file.
+     *        Specialized with SERIALIZATION_SCHEMA.
+     * @tparam T Root type
+     */
+    template <class T>
+    struct SchemaInfo
+    {
+        static constexpr bool defined = false;
+    };
+
+    /**
+     * @class RelativePtr
+     * @brief Pointer stored as a signed byte offset from its own address, so
+     *        it stays valid wherever the file is mapped. Files are limited to
+     *        2 GB. Copying a relative pointer out of its buffer breaks it.
+     * @tparam T Type of the target
+     */
+    template <class T>
+    class RelativePtr
+    {
+    public:
+        /**
+         * @brief
+         * Gets the target
+         * @return const T* Target, or nullptr
+         */
+        const T *get() const noexcept
+        {
+            if (m_offset == 0)
+                return nullptr;
+
+            return reinterpret_cast<const T *>(
+                reinterpret_cast<const std::byte *>(this) + m_offset);
+        }
+
+        /**
+         * @brief
+         * Accesses the target
+         * @return const T* Target
+         */
+        const T *operator->() const noexcept
+        {
+            return get();
+        }
+
+        /**
+         * @brief
+         * Accesses the target
+         * @return const T& Target
+         */
+        const T &operator*() const noexcept
+        {
+            return *get();
+        }
+
+        /**
+         * @brief
+         * Checks if the pointer has a target
+         * @return true The pointer is set
+         * @return false The pointer is null
+         */
+        explicit operator bool() const noexcept
+        {
+            return m_offset != 0;
+        }
+
+    private:
+        friend class BinaryWriter;
+
+        std::int32_t m_offset = 0;
+    };
+
+    /**
+     * @class RelativeArray
+     * @brief Contiguous array stored as a relative offset and a count
+     * @tparam T Type of the elements
+     */
+    template <class T>
+    class RelativeArray
+    {
+    public:
+        /**
+         * @brief
+         * Gets the first element
+         * @return const T* First element, or nullptr when empty
+         */
+        const T *data() const noexcept
+        {
+            if (m_count == 0)
+                return nullptr;
+
+            return reinterpret_cast<const T *>(
+                reinterpret_cast<const std::byte *>(this) + m_offset);
+        }
+
+        /**
+         * @brief
+         * Gets the number of elements
+         * @return std::size_t Number of elements
+         */
+        std::size_t size() const noexcept
+        {
+            return m_count;
+        }
+
+        /**
+         * @brief
+         * Checks if the array has no elements
+         * @return true The array is empty
+         * @return false The array has elements
+         */
+        bool empty() const noexcept
+        {
+            return m_count == 0;
+        }
+
+        /**
+         * @brief
+         * Accesses an element
+         * @param index Index of the element
+         * @return const T& Element
+         */
+        const T &operator[](std::size_t index) const noexcept
+        {
+            return data()[index];
+        }
+
+        /**
+         * @brief
+         * Gets the begin iterator of the array
+         * @return const T* Begin iterator
+         */
+        const T *begin() const noexcept
+        {
+            return data();
+        }
+
+        /**
+         * @brief
+         * Gets the end iterator of the array
+         * @return const T* End iterator
+         */
+        const T *end() const noexcept
+        {
+            return data() + m_count;
+        }
+
+        /**
+         * @brief
+         * Views the elements as a span
+         * @return std::span<const T> Elements
+         */
+        std::span<const T> span() const noexcept
+        {
+            return {data(), m_count};
+        }
+
+    private:
+        friend class BinaryWriter;
+
+        std::int32_t m_offset = 0;
+        std::uint32_t m_count = 0;
+    };
+
+    /**
+     * @class RelativeString
+     * @brief Null terminated string stored as a relative array
+     */
+    class RelativeString
+    {
+    public:
+        /**
+         * @brief
+         * Views the string
+         * @return std::string_view Characters, without the terminator
+         */
+        std::string_view view() const noexcept
+        {
+            return m_characters.empty()
+                       ? std::string_view()
+                       : std::string_view(m_characters.data(), m_characters.size() - 1);
+        }
+
+        /**
+         * @brief
+         * Gets the null terminated characters
+         * @return const char* Characters
+         */
+        const char *c_str() const noexcept
+        {
+            return m_characters.empty() ? "" : m_characters.data();
+        }
+
+    private:
+        friend class BinaryWriter;
+
+        RelativeArray<char> m_characters;
+    };
+
+    /**
+     * @struct BinaryHeader
+     * @brief First bytes of every binary file
+     */
+    struct BinaryHeader
+    {
+        char magic[4];
+        std::uint32_t version;
+        std::uint32_t schema;
+        std::uint32_t root;
+        std::uint64_t size;
+    };
+
+    /**
+     * @brief
+     * Bytes reserved for the header, padded so the objects after it start
+     * aligned
+     */
+    constexpr std::uint32_t HEADER_SIZE = 32;
+
+    static_assert(sizeof(BinaryHeader) <= HEADER_SIZE);
+
+    /**
+     * @struct Offset
+     * @brief Position of an object inside a BinaryWriter. Unlike pointers,
+     *        offsets survive the growth of the buffer.
+     * @tparam T Type of the object
+     */
+    template <class T>
+    struct Offset
+    {
+        std::uint32_t value = 0;
+    };
+
+    /**
+     * @struct ArrayOffset
+     * @brief Position and size of an array inside a BinaryWriter
+     * @tparam T Type of the elements
+     */
+    template <class T>
+    struct ArrayOffset
+    {
+        Offset<T> first;
+        std::uint32_t count = 0;
+
+        /**
+         * @brief
+         * Gets the position of an element
+         * @param index Index of the element
+         * @return Offset<T> Position of the element
+         */
+        Offset<T> at(std::size_t index) const noexcept
+        {
+            return {static_cast<std::uint32_t>(first.value + index * sizeof(T))};
+        }
+    };
+
+    /**
+     * @class BinaryWriter
+     * @brief Builds a binary file. Children are written first and linked
+     *        into their owners, then the file is finished with its root.
+     *        Every object is aligned to its own alignment.
+     */
+    class BinaryWriter
+    {
+    public:
+        // Constructors
+        /**
+         * @brief
+         * Construct a new Binary Writer object with room for the header
+         */
+        BinaryWriter() : m_buffer(HEADER_SIZE, std::byte{0}) {}
+
+        // Access Methods
+        /**
+         * @brief
+         * Accesses a written object. The reference is invalidated by the
+         * next write.
+         * @tparam T Type of the object
+         * @param offset Position of the object
+         * @return T& Object
+         */
+        template <class T>
+        T &get(Offset<T> offset)
+        {
+            return *reinterpret_cast<T *>(m_buffer.data() + offset.value);
+        }
+
+        /**
+         * @brief
+         * Gets the position of a member of a written object
+         * @tparam Owner Type of the object
+         * @tparam T Type of the member
+         * @param owner Position of the object
+         * @param member Member of the object
+         * @return Offset<T> Position of the member
+         */
+        template <class Owner, class T>
+        Offset<T> field(Offset<Owner> owner, T Owner::*member)
+        {
+            auto *address = reinterpret_cast<std::byte *>(&(get(owner).*member));
+
+            return {static_cast<std::uint32_t>(address - m_buffer.data())};
+        }
+
+        /**
+         * @brief
+         * Gets the number of bytes written so far
+         * @return std::size_t Size in bytes
+         */
+        std::size_t size() const noexcept
+        {
+            return m_buffer.size();
+        }
+
+        // Methods
+        /**
+         * @brief
+         * Writes a copy of an object
+         * @tparam T Type of the object
+         * @param value Object to write
+         * @return Offset<T> Position of the object
+         */
+        template <class T>
+        Offset<T> write(const T &value)
+        {
+            check_type<T>();
+            auto offset = allocate_bytes(sizeof(T), alignof(T));
+            std::memcpy(m_buffer.data() + offset, &value, sizeof(T));
+
+            return {offset};
+        }
+
+        /**
+         * @brief
+         * Reserves a value initialized array, filled through get
+         * @tparam T Type of the elements
+         * @param count Number of elements
+         * @return ArrayOffset<T> Position of the array
+         */
+        template <class T>
+        ArrayOffset<T> allocate_array(std::size_t count)
+        {
+            check_type<T>();
+            auto offset = allocate_bytes(sizeof(T) * count, alignof(T));
+
+            for (std::size_t i = 0; i < count; ++i)
+                new (m_buffer.data() + offset + i * sizeof(T)) T();
+
+            return {{offset}, static_cast<std::uint32_t>(count)};
+        }
+
+        /**
+         * @brief
+         * Writes a copy of an array
+         * @tparam T Type of the elements
+         * @param values Elements to write
+         * @return ArrayOffset<T> Position of the array
+         */
+        template <class T>
+        ArrayOffset<T> write_array(std::span<const T> values)
+        {
+            check_type<T>();
+            auto offset = allocate_bytes(values.size_bytes(), alignof(T));
+
+            if (!values.empty())
+                std::memcpy(m_buffer.data() + offset, values.data(), values.size_bytes());
+
+            return {{offset}, static_cast<std::uint32_t>(values.size())};
+        }
+
+        /**
+         * @brief
+         * Writes a null terminated string
+         * @param value Characters to write
+         * @return ArrayOffset<char> Position of the characters, terminator
+         *         included
+         */
+        ArrayOffset<char> write_string(std::string_view value)
+        {
+            auto offset = allocate_bytes(value.size() + 1, 1);
+            std::memcpy(m_buffer.data() + offset, value.data(), value.size());
+
+            return {{offset}, static_cast<std::uint32_t>(value.size() + 1)};
+        }
+
+        /**
+         * @brief
+         * Points a relative pointer at a written object
+         * @tparam T Type of the target
+         * @param pointer Position of the pointer
+         * @param target Position of the target
+         */
+        template <class T>
+        void link(Offset<RelativePtr<T>> pointer, Offset<T> target)
+        {
+            get(pointer).m_offset = relative(pointer.value, target.value);
+        }
+
+        /**
+         * @brief
+         * Points a relative array at a written array
+         * @tparam T Type of the elements
+         * @param array Position of the relative array
+         * @param target Position of the elements
+         */
+        template <class T>
+        void link(Offset<RelativeArray<T>> array, ArrayOffset<T> target)
+        {
+            get(array).m_offset = relative(array.value, target.first.value);
+            get(array).m_count = target.count;
+        }
+
+        /**
+         * @brief
+         * Points a relative string at written characters
+         * @param string Position of the relative string
+         * @param target Position of the characters
+         */
+        void link(Offset<RelativeString> string, ArrayOffset<char> target)
+        {
+            link(field(string, &RelativeString::m_characters), target);
+        }
+
+        /**
+         * @brief
+         * Writes the header and returns the file. The size is padded to the
+         * maximum alignment so files can be concatenated into archives.
+         * @tparam Root Type of the root object, declared with
+         *         SERIALIZATION_SCHEMA
+         * @param root Position of the root object
+         * @return std::string Finished file
+         */
+        template <class Root>
+        std::string finish(Offset<Root> root)
+        {
+            static_assert(SchemaInfo<Root>::defined,
+                          "The root type needs a SERIALIZATION_SCHEMA");
+
+            allocate_bytes(0, MAX_ALIGNMENT);
+
+            BinaryHeader header{{'G', 'B', 'I', 'N'}, FORMAT_VERSION,
+                                SchemaInfo<Root>::hash, root.value,
+                                m_buffer.size()};
+            std::memcpy(m_buffer.data(), &header, sizeof(header));
+
+            return std::string(reinterpret_cast<const char *>(m_buffer.data()),
+                               m_buffer.size());
+        }
+
+    private:
+        std::vector<std::byte> m_buffer;
+
+        /**
+         * @brief
+         * Checks at compile time that a type can be stored
+         * @tparam T Type to check
+         */
+        template <class T>
+        static constexpr void check_type()
+        {
+            static_assert(std::is_trivially_copyable_v<T> && std::is_standard_layout_v<T>,
+                          "Stored types must be trivially copyable and standard layout");
+            static_assert(alignof(T) <= MAX_ALIGNMENT,
+                          "Stored types may not be over-aligned");
+        }
+
+        /**
+         * @brief
+         * Appends zeroed, aligned bytes
+         * @param size Number of bytes
+         * @param alignment Alignment of the first byte
+         * @return std::uint32_t Position of the first byte
+         */
+        std::uint32_t allocate_bytes(std::size_t size, std::size_t alignment)
+        {
+            auto offset = (m_buffer.size() + alignment - 1) / alignment * alignment;
+
+            if (offset + size > static_cast<std::size_t>(INT32_MAX))
+                throw std::length_error("Binary files are limited to 2 GB");
+
+            m_buffer.resize(offset + size, std::byte{0});
+
+            return static_cast<std::uint32_t>(offset);
+        }
+
+        /**
+         * @brief
+         * Computes a relative offset
+         * @param from Position of the relative pointer
+         * @param to Position of the target
+         * @return std::int32_t Offset from the pointer to the target
+         */
+        static std::int32_t relative(std::uint32_t from, std::uint32_t to)
+        {
+            return static_cast<std::int32_t>(static_cast<std::int64_t>(to) - from);
+        }
+    };
+
+    /**
+     * @brief
+     * Gets the root of a binary file without parsing or copying it. Checks
+     * the header, the schema and the bounds of the root; the relative
+     * pointers inside are trusted.
+     * @tparam Root Type of the root object, declared with
+     *         SERIALIZATION_SCHEMA
+     * @param data First byte of the file, aligned to MAX_ALIGNMENT
+     * @param size Size of the file
+     * @return const Root* Root object, pointing into the file
+     * @throw std::runtime_error The data is not a valid file of this schema
+     */
+    template <class Root>
+    const Root *get_root(const void *data, std::size_t size)
+    {
+        static_assert(SchemaInfo<Root>::defined,
+                      "The root type needs a SERIALIZATION_SCHEMA");
+
+        if (reinterpret_cast<std::uintptr_t>(data) % MAX_ALIGNMENT != 0)
+            throw std::runtime_error("Binary file is not aligned");
+
+        if (size < HEADER_SIZE)
+            throw std::runtime_error("Binary file is truncated");
+
+        BinaryHeader header;
+        std::memcpy(&header, data, sizeof(header));
+
+        if (std::memcmp(header.magic, "GBIN", 4) != 0 ||
+            header.version != FORMAT_VERSION)
+            throw std::runtime_error("Not a binary file of this version");
+
+        if (header.schema != SchemaInfo<Root>::hash)
+            throw std::runtime_error("Binary file has a different schema");
+
+        if (header.size > size || header.root % alignof(Root) != 0 ||
+            header.root < HEADER_SIZE || header.root + sizeof(Root) > header.size)
+            throw std::runtime_error("Binary file is corrupted");
+
+        return reinterpret_cast<const Root *>(
+            static_cast<const std::byte *>(data) + header.root);
+    }
+} // namespace Serialization
+
+/**
+ * @brief
+ * Declares a type as the root of binary files. Must be used at global
+ * scope. Changing the name, version or size of the type changes its schema
+ * hash, so stale files are rejected instead of misread.
+ * @param Type Root type
+ * @param Version Version of the schema
+ */
+#define SERIALIZATION_SCHEMA(Type, Version)                                              \
+    template <>                                                                          \
+    struct Serialization::SchemaInfo<Type>                                               \
+    {                                                                                    \
+        static_assert(std::is_trivially_copyable_v<Type> &&                              \
+                          std::is_standard_layout_v<Type>,                               \
+                      #Type " must be trivially copyable and standard layout");          \
+        static constexpr bool defined = true;                                            \
+        static constexpr std::uint32_t version = Version;                                \
+        static constexpr std::uint32_t hash =                                            \
+            Serialization::schema_hash(#Type, Version, sizeof(Type));                    \
+    }
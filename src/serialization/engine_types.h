@@ -0,0 +1,209 @@
+/**
+ * @file engine_types.h
+ * @author Carlos Salguero
+ * @brief Stored representations of the engine types
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#pragma once
+
+// C++ Standard Library
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Project files
+#include "binary_format.h"
+#include "../utils/math/vector.h"
+#include "../utils/color/color.h"
+
+namespace Serialization
+{
+    /**
+     * @struct StoredColor
+     * @brief Stored representation of a Color
+     * @tparam T Type of the channels
+     */
+    template <class T>
+    struct StoredColor
+    {
+        T red;
+        T green;
+        T blue;
+        T alpha;
+    };
+
+    /**
+     * @struct Serializer
+     * @brief Maps an engine type to its stored representation. Every
+     *        specialization provides:
+     *        - Stored: type placed in the file
+     *        - store(writer, target, value): fills an already written Stored,
+     *          writing and linking its children
+     *        - load(stored): rebuilds the engine type
+     *        Code that only reads uses the Stored types in place.
+     * @tparam T Engine type
+     */
+    template <class T, class = void>
+    struct Serializer;
+
+    /**
+     * @struct Serializer
+     * @brief Arithmetic types are stored as they are
+     * @tparam T Arithmetic type
+     */
+    template <class T>
+    struct Serializer<T, std::enable_if_t<std::is_arithmetic_v<T>>>
+    {
+        using Stored = T;
+
+        static void store(BinaryWriter &writer, Offset<Stored> target, const T &value)
+        {
+            writer.get(target) = value;
+        }
+
+        static T load(const Stored &stored)
+        {
+            return stored;
+        }
+    };
+
+    /**
+     * @struct Serializer
+     * @brief Strings are stored as null terminated relative strings
+     */
+    template <>
+    struct Serializer<std::string>
+    {
+        using Stored = RelativeString;
+
+        static void store(BinaryWriter &writer, Offset<Stored> target,
+                          const std::string &value)
+        {
+            writer.link(target, writer.write_string(value));
+        }
+
+        static std::string load(const Stored &stored)
+        {
+            return std::string(stored.view());
+        }
+    };
+
+    /**
+     * @struct Serializer
+     * @brief Colors are stored as four consecutive channels
+     * @tparam T Type of the channels
+     */
+    template <class T>
+    struct Serializer<Color<T>>
+    {
+        using Stored = StoredColor<T>;
+
+        static void store(BinaryWriter &writer, Offset<Stored> target,
+                          const Color<T> &value)
+        {
+            writer.get(target) = {value.get_red(), value.get_green(),
+                                  value.get_blue(), value.get_alpha()};
+        }
+
+        static Color<T> load(const Stored &stored)
+        {
+            return Color<T>(stored.red, stored.green, stored.blue, stored.alpha);
+        }
+    };
+
+    /**
+     * @struct Serializer
+     * @brief Vectors are stored as relative arrays of their components
+     * @tparam T Type of the components
+     */
+    template <class T>
+    struct Serializer<Math::Vector<T>>
+    {
+        using Stored = RelativeArray<T>;
+
+        static void store(BinaryWriter &writer, Offset<Stored> target,
+                          const Math::Vector<T> &value)
+        {
+            auto components = writer.allocate_array<T>(value.size());
+
+            for (std::size_t i = 0; i < value.size(); ++i)
+                writer.get(components.at(i)) = value[i];
+
+            writer.link(target, components);
+        }
+
+        static Math::Vector<T> load(const Stored &stored)
+        {
+            Math::Vector<T> value(stored.size());
+
+            for (std::size_t i = 0; i < stored.size(); ++i)
+                value[i] = stored[i];
+
+            return value;
+        }
+    };
+
+    /**
+     * @struct Serializer
+     * @brief Standard vectors are stored as relative arrays of the stored
+     *        representation of their elements
+     * @tparam T Type of the elements
+     */
+    template <class T>
+    struct Serializer<std::vector<T>>
+    {
+        using Stored = RelativeArray<typename Serializer<T>::Stored>;
+
+        static void store(BinaryWriter &writer, Offset<Stored> target,
+                          const std::vector<T> &value)
+        {
+            auto elements = writer.allocate_array<typename Serializer<T>::Stored>(value.size());
+
+            for (std::size_t i = 0; i < value.size(); ++i)
+                Serializer<T>::store(writer, elements.at(i), value[i]);
+
+            writer.link(target, elements);
+        }
+
+        static std::vector<T> load(const Stored &stored)
+        {
+            std::vector<T> value;
+            value.reserve(stored.size());
+
+            for (const auto &element : stored)
+                value.push_back(Serializer<T>::load(element));
+
+            return value;
+        }
+    };
+
+    /**
+     * @brief
+     * Type stored in files for an engine type
+     * @tparam T Engine type
+     */
+    template <class T>
+    using stored_t = typename Serializer<T>::Stored;
+
+    /**
+     * @brief
+     * Stores a member of an already written object
+     * @tparam Owner Stored type of the object
+     * @tparam T Engine type of the member
+     * @param writer Writer of the file
+     * @param owner Position of the object
+     * @param member Member of the object
+     * @param value Value to store
+     */
+    template <class Owner, class T>
+    void store_field(BinaryWriter &writer, Offset<Owner> owner,
+                     stored_t<T> Owner::*member, const T &value)
+    {
+        Serializer<T>::store(writer, writer.field(owner, member), value);
+    }
+} // namespace Serialization
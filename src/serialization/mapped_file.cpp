@@ -0,0 +1,222 @@
+/**
+ * @file mapped_file.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of the MappedFile class
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+// C++ Standard Library
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define MAPPED_FILE_POSIX
+#endif
+
+// Project files
+#include "mapped_file.h"
+
+// Constructors
+/**
+ * @brief
+ * Construct a new Mapped File:: Mapped File object by mapping a file
+ * @param file_path Path to the file
+ * @throw std::runtime_error The file cannot be opened
+ */
+MappedFile::MappedFile(const std::string &file_path)
+{
+#if defined(MAPPED_FILE_POSIX)
+    int descriptor = ::open(file_path.c_str(), O_RDONLY);
+
+    if (descriptor < 0)
+        throw std::runtime_error("Failed to open file: " + file_path);
+
+    struct stat status;
+
+    if (::fstat(descriptor, &status) != 0)
+    {
+        ::close(descriptor);
+        throw std::runtime_error("Failed to open file: " + file_path);
+    }
+
+    m_size = static_cast<std::size_t>(status.st_size);
+
+    if (m_size > 0)
+    {
+        void *address = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+
+        if (address == MAP_FAILED)
+        {
+            ::close(descriptor);
+            throw std::runtime_error("Failed to map file: " + file_path);
+        }
+
+        m_data = static_cast<const std::byte *>(address);
+        m_mapped = true;
+    }
+
+    ::close(descriptor);
+#else
+    std::ifstream file(file_path, std::ios::binary | std::ios::ate);
+
+    if (!file.good())
+        throw std::runtime_error("Failed to open file: " + file_path);
+
+    allocate(static_cast<std::size_t>(file.tellg()));
+    file.seekg(0);
+    file.read(reinterpret_cast<char *>(m_buffer.get()),
+              static_cast<std::streamsize>(m_size));
+#endif
+}
+
+/**
+ * @brief
+ * Construct a new Mapped File:: Mapped File object
+ * @param other Mapped file to take over
+ * @details Move constructor
+ */
+MappedFile::MappedFile(MappedFile &&other) noexcept
+    : m_data(std::exchange(other.m_data, nullptr)),
+      m_size(std::exchange(other.m_size, 0)),
+      m_mapped(std::exchange(other.m_mapped, false)),
+      m_buffer(std::move(other.m_buffer))
+{
+}
+
+// Destructor
+/**
+ * @brief
+ * Destroy the Mapped File:: Mapped File object. Unmaps the file.
+ */
+MappedFile::~MappedFile()
+{
+    close();
+}
+
+// Operators
+/**
+ * @brief
+ * Takes over another mapped file
+ * @param other Mapped file to take over
+ * @return MappedFile& This mapped file
+ */
+MappedFile &MappedFile::operator=(MappedFile &&other) noexcept
+{
+    if (this != &other)
+    {
+        close();
+
+        m_data = std::exchange(other.m_data, nullptr);
+        m_size = std::exchange(other.m_size, 0);
+        m_mapped = std::exchange(other.m_mapped, false);
+        m_buffer = std::move(other.m_buffer);
+    }
+
+    return *this;
+}
+
+// Access Methods
+/**
+ * @brief
+ * Get the bytes of the file
+ * @return const std::byte* First byte, aligned to the maximum alignment
+ */
+const std::byte *MappedFile::data() const noexcept
+{
+    return m_data;
+}
+
+/**
+ * @brief
+ * Get the size of the file
+ * @return std::size_t Size in bytes
+ */
+std::size_t MappedFile::size() const noexcept
+{
+    return m_size;
+}
+
+/**
+ * @brief
+ * Checks if the bytes are mapped rather than copied
+ * @return true The file is mapped
+ * @return false The bytes live in a buffer
+ */
+bool MappedFile::is_mapped() const noexcept
+{
+    return m_mapped;
+}
+
+// Methods
+/**
+ * @brief
+ * Checks if the file has no bytes
+ * @return true The file is empty or closed
+ * @return false The file has bytes
+ */
+bool MappedFile::empty() const noexcept
+{
+    return m_size == 0;
+}
+
+/**
+ * @brief
+ * Unmaps the file or frees its buffer
+ */
+void MappedFile::close() noexcept
+{
+#if defined(MAPPED_FILE_POSIX)
+    if (m_mapped)
+        ::munmap(const_cast<std::byte *>(m_data), m_size);
+#endif
+
+    m_buffer.reset();
+    m_data = nullptr;
+    m_size = 0;
+    m_mapped = false;
+}
+
+// Static Methods
+/**
+ * @brief
+ * Copies bytes that are already in memory, such as a resource read from a
+ * pak archive, into an aligned buffer
+ * @param bytes Bytes of the file
+ * @return MappedFile File holding a copy of the bytes
+ */
+MappedFile MappedFile::from_bytes(const std::string &bytes)
+{
+    MappedFile file;
+    file.allocate(bytes.size());
+
+    if (!bytes.empty())
+        std::memcpy(file.m_buffer.get(), bytes.data(), bytes.size());
+
+    return file;
+}
+
+// Methods (private)
+/**
+ * @brief
+ * Allocates an aligned buffer for the bytes
+ * @param size Size in bytes
+ */
+void MappedFile::allocate(std::size_t size)
+{
+    auto blocks = (size + sizeof(Block) - 1) / sizeof(Block);
+
+    m_buffer = std::make_unique<Block[]>(blocks);
+    m_data = reinterpret_cast<const std::byte *>(m_buffer.get());
+    m_size = size;
+    m_mapped = false;
+}
@@ -0,0 +1,91 @@
+/**
+ * @file mapped_file.h
+ * @author Carlos Salguero
+ * @brief Declaration of the MappedFile class
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+// C++ Standard Library
+#include <cstddef>
+#include <memory>
+#include <string>
+
+// Project files
+#include "binary_format.h"
+
+// Class
+/**
+ * @class MappedFile
+ * @brief Read-only view of a file mapped into memory. The bytes are aligned
+ *        to Serialization::MAX_ALIGNMENT, so binary files can be read in
+ *        place. Where mapping is not available the file is read into an
+ *        aligned buffer instead.
+ */
+class MappedFile
+{
+public:
+    // Constructors
+    MappedFile() = default;
+    explicit MappedFile(const std::string &);
+    MappedFile(MappedFile &&) noexcept;
+
+    // Deleted Constructors
+    MappedFile(const MappedFile &) = delete;
+
+    // Destructor
+    ~MappedFile();
+
+    // Operators
+    MappedFile &operator=(MappedFile &&) noexcept;
+
+    // Deleted Operators
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    // Access Methods
+    const std::byte *data() const noexcept;
+    std::size_t size() const noexcept;
+    bool is_mapped() const noexcept;
+
+    // Methods
+    bool empty() const noexcept;
+    void close() noexcept;
+
+    /**
+     * @brief
+     * Gets the root object of a binary file without copying it
+     * @tparam Root Type of the root object
+     * @return const Root* Root object, valid while the file is open
+     * @throw std::runtime_error The file is not a binary file of this schema
+     */
+    template <class Root>
+    const Root *root() const
+    {
+        return Serialization::get_root<Root>(m_data, m_size);
+    }
+
+    // Static Methods
+    static MappedFile from_bytes(const std::string &);
+
+private:
+    struct alignas(Serialization::MAX_ALIGNMENT) Block
+    {
+        std::byte bytes[Serialization::MAX_ALIGNMENT];
+    };
+
+    const std::byte *m_data = nullptr;
+    std::size_t m_size = 0;
+    bool m_mapped = false;
+    std::unique_ptr<Block[]> m_buffer;
+
+    // Methods
+    void allocate(std::size_t);
+};
+
+#endif //! MAPPED_FILE_H
@@ -84,4 +84,80 @@ private:
     bool m_stop;
 };
 
+/**
+ * @class TaskGroup
+ * @brief Tasks of a thread pool that share the stack of their caller. The
+ *        group waits for every task before it is destroyed, so an exception
+ *        cannot unwind the caller while a task still uses its locals.
+ */
+class TaskGroup
+{
+public:
+    // Constructor
+    /**
+     * @brief
+     * Construct a new Task Group object with no task
+     * @param thread_pool Thread pool the tasks run on
+     */
+    explicit TaskGroup(ThreadPool &thread_pool) : m_thread_pool(thread_pool) {}
+
+    // Deleted Constructors
+    TaskGroup(const TaskGroup &) = delete;
+
+    // Destructor
+    /**
+     * @brief
+     * Destroy the Task Group object. Waits for the tasks that were not
+     * waited for.
+     */
+    ~TaskGroup()
+    {
+        for (auto &task : m_tasks)
+            if (task.valid())
+                task.wait();
+    }
+
+    // Deleted Operators
+    TaskGroup &operator=(const TaskGroup &) = delete;
+
+    // Inline Methods
+    /**
+     * @brief
+     * Add a task to the thread pool
+     * @tparam F Type of the function
+     * @tparam Args Type of the arguments
+     * @param func Function to be executed, returning void
+     * @param args Arguments of the function
+     * @throw std::runtime_error If the thread pool is stopped
+     */
+    template <class F, class... Args>
+    void run(F &&func, Args &&...args)
+    {
+        // The slot exists before the task does, so a task is never queued
+        // without its future being kept
+        auto &task = m_tasks.emplace_back();
+        task = m_thread_pool.enqueue(std::forward<F>(func), std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief
+     * Waits for every task
+     * @throw Any exception thrown by a task, once every task has stopped
+     */
+    void wait()
+    {
+        for (auto &task : m_tasks)
+            if (task.valid())
+                task.wait();
+
+        for (auto &task : m_tasks)
+            if (task.valid())
+                task.get();
+    }
+
+private:
+    ThreadPool &m_thread_pool;
+    std::vector<std::future<void>> m_tasks;
+};
+
 #endif //! THREAD_POOL_H
\ No newline at end of file
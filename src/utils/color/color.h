@@ -12,6 +12,7 @@
 #pragma once
 
 // C++ Standard Libraries
+#include <sstream>
 #include <string>
 
 /**
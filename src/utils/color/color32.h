@@ -0,0 +1,253 @@
+/**
+ * @file color32.h
+ * @author Carlos Salguero
+ * @brief Color packed into 32 bits, 8 bits per channel
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#pragma once
+
+// C++ Standard Libraries
+#include <bit>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+
+// Project files
+#include "color.h"
+#include "color_kernels.h"
+
+/**
+ * @class Color32
+ * @brief RGBA color with 8-bit channels packed into one 32-bit word. The
+ *        channels are stored in memory in R, G, B, A order on every
+ *        target, so an array of Color32 is an RGBA8 pixel buffer and a
+ *        quarter of the size of the same Color<float> array.
+ */
+class Color32
+{
+public:
+    // Constructors
+    constexpr Color32() : m_value(0) {}
+
+    /**
+     * @brief
+     * Construct a new Color32 object
+     * @param red Red channel
+     * @param green Green channel
+     * @param blue Blue channel
+     * @param alpha Alpha channel
+     */
+    constexpr Color32(std::uint8_t red, std::uint8_t green, std::uint8_t blue,
+                      std::uint8_t alpha = 255)
+        : m_value(static_cast<std::uint32_t>(red) << shift(0) |
+                  static_cast<std::uint32_t>(green) << shift(1) |
+                  static_cast<std::uint32_t>(blue) << shift(2) |
+                  static_cast<std::uint32_t>(alpha) << shift(3)) {}
+
+    /**
+     * @brief
+     * Construct a new Color32 object from float channels, clamped to
+     * [0, 1] and rounded to nearest
+     * @param color The float color
+     */
+    explicit Color32(const Color<float> &color)
+        : Color32(Math::Detail::to_unorm8(color.get_red()), Math::Detail::to_unorm8(color.get_green()),
+                  Math::Detail::to_unorm8(color.get_blue()), Math::Detail::to_unorm8(color.get_alpha())) {}
+
+    // Getters
+    constexpr std::uint8_t get_red() const
+    {
+        return channel(0);
+    }
+
+    constexpr std::uint8_t get_green() const
+    {
+        return channel(1);
+    }
+
+    constexpr std::uint8_t get_blue() const
+    {
+        return channel(2);
+    }
+
+    constexpr std::uint8_t get_alpha() const
+    {
+        return channel(3);
+    }
+
+    // Setters
+    constexpr void set_red(std::uint8_t red)
+    {
+        set_channel(0, red);
+    }
+
+    constexpr void set_green(std::uint8_t green)
+    {
+        set_channel(1, green);
+    }
+
+    constexpr void set_blue(std::uint8_t blue)
+    {
+        set_channel(2, blue);
+    }
+
+    constexpr void set_alpha(std::uint8_t alpha)
+    {
+        set_channel(3, alpha);
+    }
+
+    // Operators
+    friend constexpr bool operator==(const Color32 &left, const Color32 &right) = default;
+
+    // Methods
+    /**
+     * @brief
+     * Gets the word as stored in memory, whose byte order is R, G, B, A
+     * @return std::uint32_t The native word
+     */
+    constexpr std::uint32_t packed() const
+    {
+        return m_value;
+    }
+
+    /**
+     * @brief
+     * Gets the color as 0xAARRGGBB, the layout of BGRA8 on little-endian
+     * targets and of most color pickers
+     * @return std::uint32_t The ARGB word
+     */
+    constexpr std::uint32_t to_argb() const
+    {
+        return static_cast<std::uint32_t>(get_alpha()) << 24 | static_cast<std::uint32_t>(get_red()) << 16 |
+               static_cast<std::uint32_t>(get_green()) << 8 | get_blue();
+    }
+
+    /**
+     * @brief
+     * Gets the color as 0xRRGGBBAA, the order of hexadecimal CSS colors
+     * @return std::uint32_t The RGBA word
+     */
+    constexpr std::uint32_t to_rgba() const
+    {
+        return static_cast<std::uint32_t>(get_red()) << 24 | static_cast<std::uint32_t>(get_green()) << 16 |
+               static_cast<std::uint32_t>(get_blue()) << 8 | get_alpha();
+    }
+
+    /**
+     * @brief
+     * Converts the color to float channels in [0, 1]
+     * @return Color<float> The float color
+     */
+    Color<float> to_color() const
+    {
+        constexpr float scale = 1.0f / 255.0f;
+
+        return Color<float>(get_red() * scale, get_green() * scale, get_blue() * scale,
+                            get_alpha() * scale);
+    }
+
+    // Static Methods
+    /**
+     * @brief
+     * Builds a color from a word in memory order, as returned by packed()
+     * @param value The native word
+     * @return Color32 The color
+     */
+    static constexpr Color32 from_packed(std::uint32_t value)
+    {
+        Color32 result;
+        result.m_value = value;
+        return result;
+    }
+
+    /**
+     * @brief
+     * Builds a color from 0xAARRGGBB
+     * @param value The ARGB word
+     * @return Color32 The color
+     */
+    static constexpr Color32 from_argb(std::uint32_t value)
+    {
+        return Color32(static_cast<std::uint8_t>(value >> 16), static_cast<std::uint8_t>(value >> 8),
+                       static_cast<std::uint8_t>(value), static_cast<std::uint8_t>(value >> 24));
+    }
+
+    /**
+     * @brief
+     * Builds a color from 0xRRGGBBAA
+     * @param value The RGBA word
+     * @return Color32 The color
+     */
+    static constexpr Color32 from_rgba(std::uint32_t value)
+    {
+        return Color32(static_cast<std::uint8_t>(value >> 24), static_cast<std::uint8_t>(value >> 16),
+                       static_cast<std::uint8_t>(value >> 8), static_cast<std::uint8_t>(value));
+    }
+
+private:
+    std::uint32_t m_value;
+
+    /**
+     * @brief
+     * Gets the bit offset of a channel inside the word, so that the
+     * channels are in R, G, B, A order in memory
+     * @param index Channel index, red first
+     * @return int The bit offset
+     */
+    static constexpr int shift(int index)
+    {
+        return std::endian::native == std::endian::little ? index * 8 : 24 - index * 8;
+    }
+
+    constexpr std::uint8_t channel(int index) const
+    {
+        return static_cast<std::uint8_t>(m_value >> shift(index));
+    }
+
+    constexpr void set_channel(int index, std::uint8_t value)
+    {
+        m_value = (m_value & ~(0xffu << shift(index))) | static_cast<std::uint32_t>(value) << shift(index);
+    }
+};
+
+// The batch conversions view Color32 arrays as RGBA8 bytes and Color<float>
+// arrays as RGBA floats
+static_assert(sizeof(Color32) == 4);
+static_assert(sizeof(Color<float>) == 4 * sizeof(float));
+
+namespace Math
+{
+    /**
+     * @brief
+     * Packs float colors into 32-bit colors, clamping to [0, 1] and
+     * rounding to nearest with float_to_unorm8
+     * @param source The float colors
+     * @param destination The packed colors
+     * @throws std::invalid_argument If the sizes differ
+     */
+    inline void pack_colors(std::span<const Color<float>> source, std::span<Color32> destination)
+    {
+        float_to_unorm8(std::span<const float>(reinterpret_cast<const float *>(source.data()), source.size() * 4),
+                        std::span<std::uint8_t>(reinterpret_cast<std::uint8_t *>(destination.data()),
+                                                destination.size() * 4));
+    }
+
+    /**
+     * @brief
+     * Unpacks 32-bit colors to float colors in [0, 1] with unorm8_to_float
+     * @param source The packed colors
+     * @param destination The float colors
+     * @throws std::invalid_argument If the sizes differ
+     */
+    inline void unpack_colors(std::span<const Color32> source, std::span<Color<float>> destination)
+    {
+        unorm8_to_float(std::span<const std::uint8_t>(reinterpret_cast<const std::uint8_t *>(source.data()),
+                                                      source.size() * 4),
+                        std::span<float>(reinterpret_cast<float *>(destination.data()), destination.size() * 4));
+    }
+}
@@ -0,0 +1,502 @@
+/**
+ * @file color_kernels.h
+ * @author Carlos Salguero
+ * @brief Conversions of whole pixel buffers between 8-bit and float
+ *        channels, sRGB and linear, and straight and premultiplied alpha
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#pragma once
+
+// C++ Standard Library
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+
+// Project files
+#include "../math/float4.h"
+#include "srgb.h"
+
+#if defined(MATH_SIMD_SSE) && defined(__SSSE3__) && !defined(MATH_SIMD_AVX2)
+#include <tmmintrin.h>
+#endif
+
+namespace Math
+{
+    // The kernels work on interleaved RGBA buffers: four channels per pixel,
+    // either bytes in [0, 255] or floats in [0, 1]. Every kernel produces the
+    // same result as its scalar loop, so the SIMD and tail paths agree to the
+    // bit and the output does not depend on the buffer length.
+
+    namespace Detail
+    {
+        /**
+         * @brief
+         * Checks that two channel buffers hold the same number of channels
+         * @param source Channels of the source
+         * @param destination Channels of the destination
+         * @return std::size_t The number of channels
+         * @throws std::invalid_argument If the sizes differ
+         */
+        inline std::size_t channel_count(std::size_t source, std::size_t destination)
+        {
+            if (destination != source)
+                throw std::invalid_argument("Source and destination must hold the same number of channels");
+
+            return source;
+        }
+
+        /**
+         * @brief
+         * Checks that a buffer holds whole RGBA pixels
+         * @param channels Channels of the buffer
+         * @return std::size_t The number of pixels
+         * @throws std::invalid_argument If the channels are not a multiple of four
+         */
+        inline std::size_t pixel_count(std::size_t channels)
+        {
+            if (channels % 4 != 0)
+                throw std::invalid_argument("Pixel buffers must hold whole RGBA pixels");
+
+            return channels / 4;
+        }
+
+        /**
+         * @brief
+         * Converts a float channel to 8 bits, rounding to nearest. NaN
+         * becomes zero.
+         * @param value The channel, clamped to [0, 1]
+         * @return std::uint8_t The 8-bit channel
+         */
+        inline std::uint8_t to_unorm8(float value)
+        {
+            value = value > 0.0f ? value : 0.0f;
+            value = value < 1.0f ? value : 1.0f;
+
+            return static_cast<std::uint8_t>(value * 255.0f + 0.5f);
+        }
+
+        /**
+         * @brief
+         * Multiplies two 8-bit channels as fractions of 255, rounding to
+         * nearest: (t + (t >> 8)) >> 8 with t = a * b + 128 equals
+         * round(a * b / 255) for all 8-bit inputs
+         * @param a The first channel
+         * @param b The second channel
+         * @return std::uint8_t The product
+         */
+        inline std::uint8_t multiply_unorm8(std::uint32_t a, std::uint32_t b)
+        {
+            std::uint32_t t = a * b + 128;
+            return static_cast<std::uint8_t>((t + (t >> 8)) >> 8);
+        }
+
+#if defined(MATH_SIMD_SSE)
+        /**
+         * @brief
+         * multiply_unorm8 on eight 16-bit lanes
+         * @param a The first channels, zero extended
+         * @param b The second channels, zero extended
+         * @return __m128i The products, zero extended
+         */
+        inline __m128i multiply_unorm8(__m128i a, __m128i b)
+        {
+            __m128i t = _mm_add_epi16(_mm_mullo_epi16(a, b), _mm_set1_epi16(128));
+            return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+        }
+
+        /**
+         * @brief
+         * Converts four float channels to rounded 32-bit integers in
+         * [0, scale], as scalar value * scale + 0.5 after clamping to [0, 1]
+         * @param value The channels
+         * @param scale Largest integer of each lane
+         * @return __m128i The integers
+         */
+        inline __m128i to_unorm(__m128 value, __m128 scale)
+        {
+            value = _mm_min_ps(_mm_max_ps(value, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+            return _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(value, scale), _mm_set1_ps(0.5f)));
+        }
+#endif
+    }
+
+    /**
+     * @brief
+     * Converts 8-bit channels to floats in [0, 1], sixteen at a time
+     * @param source The 8-bit channels
+     * @param destination The float channels
+     * @throws std::invalid_argument If the sizes differ
+     */
+    inline void unorm8_to_float(std::span<const std::uint8_t> source, std::span<float> destination)
+    {
+        std::size_t count = Detail::channel_count(source.size(), destination.size());
+        constexpr float scale = 1.0f / 255.0f;
+
+        const std::uint8_t *input = source.data();
+        float *output = destination.data();
+        std::size_t i = 0;
+
+#if defined(MATH_SIMD_SSE)
+        const __m128 factor = _mm_set1_ps(scale);
+        const __m128i zero = _mm_setzero_si128();
+
+        for (; i + 16 <= count; i += 16)
+        {
+            __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + i));
+            __m128i low = _mm_unpacklo_epi8(bytes, zero);
+            __m128i high = _mm_unpackhi_epi8(bytes, zero);
+
+            _mm_storeu_ps(output + i, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(low, zero)), factor));
+            _mm_storeu_ps(output + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(low, zero)), factor));
+            _mm_storeu_ps(output + i + 8, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(high, zero)), factor));
+            _mm_storeu_ps(output + i + 12, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(high, zero)), factor));
+        }
+#elif defined(MATH_SIMD_NEON)
+        const float32x4_t factor = vdupq_n_f32(scale);
+
+        for (; i + 16 <= count; i += 16)
+        {
+            uint8x16_t bytes = vld1q_u8(input + i);
+            uint16x8_t low = vmovl_u8(vget_low_u8(bytes));
+            uint16x8_t high = vmovl_u8(vget_high_u8(bytes));
+
+            vst1q_f32(output + i, vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(low))), factor));
+            vst1q_f32(output + i + 4, vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(low))), factor));
+            vst1q_f32(output + i + 8, vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(high))), factor));
+            vst1q_f32(output + i + 12, vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(high))), factor));
+        }
+#endif
+
+        for (; i < count; ++i)
+            output[i] = static_cast<float>(input[i]) * scale;
+    }
+
+    /**
+     * @brief
+     * Converts float channels to 8 bits, clamping to [0, 1] and rounding
+     * to nearest, sixteen at a time
+     * @param source The float channels
+     * @param destination The 8-bit channels
+     * @throws std::invalid_argument If the sizes differ
+     */
+    inline void float_to_unorm8(std::span<const float> source, std::span<std::uint8_t> destination)
+    {
+        std::size_t count = Detail::channel_count(source.size(), destination.size());
+
+        const float *input = source.data();
+        std::uint8_t *output = destination.data();
+        std::size_t i = 0;
+
+#if defined(MATH_SIMD_SSE)
+        const __m128 scale = _mm_set1_ps(255.0f);
+
+        for (; i + 16 <= count; i += 16)
+        {
+            // Saturating packs keep the values, which are already in [0, 255]
+            __m128i low = _mm_packs_epi32(Detail::to_unorm(_mm_loadu_ps(input + i), scale),
+                                          Detail::to_unorm(_mm_loadu_ps(input + i + 4), scale));
+            __m128i high = _mm_packs_epi32(Detail::to_unorm(_mm_loadu_ps(input + i + 8), scale),
+                                           Detail::to_unorm(_mm_loadu_ps(input + i + 12), scale));
+
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(output + i), _mm_packus_epi16(low, high));
+        }
+#elif defined(MATH_SIMD_NEON)
+        const float32x4_t zero = vdupq_n_f32(0.0f);
+        const float32x4_t one = vdupq_n_f32(1.0f);
+        const float32x4_t scale = vdupq_n_f32(255.0f);
+        const float32x4_t half = vdupq_n_f32(0.5f);
+
+        auto convert = [&](const float *channels)
+        {
+            float32x4_t value = vminq_f32(vmaxq_f32(vld1q_f32(channels), zero), one);
+            return vmovn_u32(vcvtq_u32_f32(vaddq_f32(vmulq_f32(value, scale), half)));
+        };
+
+        for (; i + 16 <= count; i += 16)
+        {
+            uint8x8_t low = vmovn_u16(vcombine_u16(convert(input + i), convert(input + i + 4)));
+            uint8x8_t high = vmovn_u16(vcombine_u16(convert(input + i + 8), convert(input + i + 12)));
+
+            vst1q_u8(output + i, vcombine_u8(low, high));
+        }
+#endif
+
+        for (; i < count; ++i)
+            output[i] = Detail::to_unorm8(input[i]);
+    }
+
+    /**
+     * @brief
+     * Decodes 8-bit sRGB pixels to linear floats through the lookup table.
+     * Alpha is linear and only rescaled to [0, 1]. With AVX2 two pixels
+     * are gathered from the table at a time.
+     * @param source The RGBA sRGB pixels
+     * @param destination The RGBA linear pixels
+     * @throws std::invalid_argument If the sizes differ or the buffers do
+     * not hold whole pixels
+     */
+    inline void srgb8_to_linear(std::span<const std::uint8_t> source, std::span<float> destination)
+    {
+        std::size_t count = Detail::pixel_count(Detail::channel_count(source.size(), destination.size()));
+        constexpr float scale = 1.0f / 255.0f;
+
+        const float *table = srgb8_to_linear_table().data();
+        const std::uint8_t *input = source.data();
+        float *output = destination.data();
+        std::size_t i = 0;
+
+#if defined(MATH_SIMD_AVX2)
+        const __m256 factor = _mm256_set1_ps(scale);
+
+        for (; i + 2 <= count; i += 2)
+        {
+            __m256i channels = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(input + i * 4)));
+            __m256 linear = _mm256_i32gather_ps(table, channels, 4);
+            __m256 alpha = _mm256_mul_ps(_mm256_cvtepi32_ps(channels), factor);
+
+            _mm256_storeu_ps(output + i * 4, _mm256_blend_ps(linear, alpha, 0x88));
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            const std::uint8_t *pixel = input + i * 4;
+            float *result = output + i * 4;
+
+            result[0] = table[pixel[0]];
+            result[1] = table[pixel[1]];
+            result[2] = table[pixel[2]];
+            result[3] = static_cast<float>(pixel[3]) * scale;
+        }
+    }
+
+    /**
+     * @brief
+     * Encodes linear float pixels as 8-bit sRGB through the lookup table,
+     * matching linear_to_srgb8 for every color channel. Alpha is rounded
+     * like float_to_unorm8. The table indices of a whole pixel are
+     * computed in one register.
+     * @param source The RGBA linear pixels, clamped to [0, 1]
+     * @param destination The RGBA sRGB pixels
+     * @throws std::invalid_argument If the sizes differ or the buffers do
+     * not hold whole pixels
+     */
+    inline void linear_to_srgb8(std::span<const float> source, std::span<std::uint8_t> destination)
+    {
+        std::size_t count = Detail::pixel_count(Detail::channel_count(source.size(), destination.size()));
+
+        const float *input = source.data();
+        std::uint8_t *output = destination.data();
+
+#if defined(MATH_SIMD_SSE)
+        // Color channels index the 12-bit table, alpha is its own 8-bit value
+        const std::uint8_t *table = linear_to_srgb8_table().data();
+        const __m128 scale = _mm_setr_ps(4095.0f, 4095.0f, 4095.0f, 255.0f);
+        alignas(16) std::int32_t indices[4];
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            _mm_store_si128(reinterpret_cast<__m128i *>(indices),
+                            Detail::to_unorm(_mm_loadu_ps(input + i * 4), scale));
+
+            std::uint8_t *result = output + i * 4;
+
+            result[0] = table[indices[0]];
+            result[1] = table[indices[1]];
+            result[2] = table[indices[2]];
+            result[3] = static_cast<std::uint8_t>(indices[3]);
+        }
+#else
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const float *pixel = input + i * 4;
+            std::uint8_t *result = output + i * 4;
+
+            result[0] = linear_to_srgb8(pixel[0]);
+            result[1] = linear_to_srgb8(pixel[1]);
+            result[2] = linear_to_srgb8(pixel[2]);
+            result[3] = Detail::to_unorm8(pixel[3]);
+        }
+#endif
+    }
+
+    /**
+     * @brief
+     * Multiplies the color channels of float pixels by their alpha, in
+     * place, one pixel per register
+     * @param pixels The RGBA pixels
+     * @throws std::invalid_argument If the buffer does not hold whole pixels
+     */
+    inline void premultiply_alpha(std::span<float> pixels)
+    {
+        using Simd::Float4;
+
+        std::size_t count = Detail::pixel_count(pixels.size());
+        const Float4 one(1.0f);
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            Float4 pixel = Float4::load(pixels.data() + i * 4);
+
+            // (a, a, 1, 1) rearranged to (a, a, a, 1)
+            Float4 factor = Float4::swizzle<0, 1, 0, 2>(Float4::shuffle<3, 3, 0, 0>(pixel, one));
+
+            (pixel * factor).store(pixels.data() + i * 4);
+        }
+    }
+
+    /**
+     * @brief
+     * Divides the color channels of premultiplied float pixels by their
+     * alpha, in place. Pixels with zero alpha become transparent black.
+     * @param pixels The RGBA pixels
+     * @throws std::invalid_argument If the buffer does not hold whole pixels
+     */
+    inline void unpremultiply_alpha(std::span<float> pixels)
+    {
+        using Simd::Float4;
+
+        std::size_t count = Detail::pixel_count(pixels.size());
+        const Float4 zero(0.0f);
+        const Float4 one(1.0f);
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            Float4 pixel = Float4::load(pixels.data() + i * 4);
+            Float4 alpha = Float4::splat<3>(pixel);
+            Float4 reciprocal = Float4::select(Float4::less(zero, alpha), one / alpha, zero);
+
+            // (1 / a, 1 / a, 1, 1) rearranged to (1 / a, 1 / a, 1 / a, 1)
+            Float4 factor = Float4::swizzle<0, 1, 0, 2>(Float4::shuffle<0, 0, 0, 0>(reciprocal, one));
+
+            (pixel * factor).store(pixels.data() + i * 4);
+        }
+    }
+
+    /**
+     * @brief
+     * Multiplies the color channels of 8-bit pixels by their alpha, in
+     * place, rounding to nearest, four pixels at a time
+     * @param pixels The RGBA pixels
+     * @throws std::invalid_argument If the buffer does not hold whole pixels
+     */
+    inline void premultiply_alpha(std::span<std::uint8_t> pixels)
+    {
+        std::size_t count = Detail::pixel_count(pixels.size());
+        std::uint8_t *data = pixels.data();
+        std::size_t i = 0;
+
+#if defined(MATH_SIMD_SSE)
+        // Alpha is multiplied by 255, which multiply_unorm8 leaves unchanged
+        const __m128i opaque = _mm_set_epi16(255, 0, 0, 0, 255, 0, 0, 0);
+        const __m128i zero = _mm_setzero_si128();
+
+        auto premultiply = [&](__m128i channels)
+        {
+            __m128i alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(channels, _MM_SHUFFLE(3, 3, 3, 3)),
+                                                _MM_SHUFFLE(3, 3, 3, 3));
+
+            return Detail::multiply_unorm8(channels, _mm_or_si128(alpha, opaque));
+        };
+
+        for (; i + 4 <= count; i += 4)
+        {
+            auto address = reinterpret_cast<__m128i *>(data + i * 4);
+            __m128i bytes = _mm_loadu_si128(address);
+
+            _mm_storeu_si128(address, _mm_packus_epi16(premultiply(_mm_unpacklo_epi8(bytes, zero)),
+                                                       premultiply(_mm_unpackhi_epi8(bytes, zero))));
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            std::uint8_t *pixel = data + i * 4;
+
+            for (std::size_t c = 0; c < 3; ++c)
+                pixel[c] = Detail::multiply_unorm8(pixel[c], pixel[3]);
+        }
+    }
+
+    /**
+     * @brief
+     * Divides the color channels of premultiplied 8-bit pixels by their
+     * alpha, in place, rounding to nearest and saturating. Pixels with
+     * zero alpha become transparent black. There is no SIMD integer
+     * division, so this one stays scalar.
+     * @param pixels The RGBA pixels
+     * @throws std::invalid_argument If the buffer does not hold whole pixels
+     */
+    inline void unpremultiply_alpha(std::span<std::uint8_t> pixels)
+    {
+        std::size_t count = Detail::pixel_count(pixels.size());
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            std::uint8_t *pixel = pixels.data() + i * 4;
+            std::uint32_t alpha = pixel[3];
+
+            for (std::size_t c = 0; c < 3; ++c)
+            {
+                std::uint32_t value = alpha ? (pixel[c] * 255u + alpha / 2) / alpha : 0u;
+                pixel[c] = static_cast<std::uint8_t>(value < 255u ? value : 255u);
+            }
+        }
+    }
+
+    /**
+     * @brief
+     * Reorders the channels of 8-bit pixels, four pixels at a time with
+     * SSSE3 or NEON. The source and destination may be the same buffer.
+     * swizzle_channels<2, 1, 0, 3> converts between RGBA and BGRA.
+     * @tparam R Source channel of the first channel
+     * @tparam G Source channel of the second channel
+     * @tparam B Source channel of the third channel
+     * @tparam A Source channel of the fourth channel
+     * @param source The pixels
+     * @param destination The reordered pixels
+     * @throws std::invalid_argument If the sizes differ or the buffers do
+     * not hold whole pixels
+     */
+    template <std::size_t R, std::size_t G, std::size_t B, std::size_t A>
+    void swizzle_channels(std::span<const std::uint8_t> source, std::span<std::uint8_t> destination)
+    {
+        static_assert(R < 4 && G < 4 && B < 4 && A < 4, "Swizzle channels must be between 0 and 3");
+
+        std::size_t count = Detail::pixel_count(Detail::channel_count(source.size(), destination.size()));
+
+        const std::uint8_t *input = source.data();
+        std::uint8_t *output = destination.data();
+        std::size_t i = 0;
+
+#if defined(MATH_SIMD_SSE) && defined(__SSSE3__)
+        const __m128i order = _mm_setr_epi8(R, G, B, A, R + 4, G + 4, B + 4, A + 4,
+                                            R + 8, G + 8, B + 8, A + 8, R + 12, G + 12, B + 12, A + 12);
+
+        for (; i + 4 <= count; i += 4)
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(output + i * 4),
+                             _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(input + i * 4)), order));
+#elif defined(MATH_SIMD_NEON) && defined(__aarch64__)
+        const uint8x16_t order = {R, G, B, A, R + 4, G + 4, B + 4, A + 4,
+                                  R + 8, G + 8, B + 8, A + 8, R + 12, G + 12, B + 12, A + 12};
+
+        for (; i + 4 <= count; i += 4)
+            vst1q_u8(output + i * 4, vqtbl1q_u8(vld1q_u8(input + i * 4), order));
+#endif
+
+        for (; i < count; ++i)
+        {
+            const std::uint8_t *pixel = input + i * 4;
+            std::uint8_t channels[4] = {pixel[R], pixel[G], pixel[B], pixel[A]};
+
+            for (std::size_t c = 0; c < 4; ++c)
+                output[i * 4 + c] = channels[c];
+        }
+    }
+}
@@ -0,0 +1,330 @@
+/**
+ * @file color_space.h
+ * @author Carlos Salguero
+ * @brief Conversions of pixel buffers between RGB and the HSV, HSL and
+ *        YCoCg color spaces
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstddef>
+#include <span>
+
+// Project files
+#include "../math/simd.h"
+#include "color_kernels.h"
+
+namespace Math
+{
+    // The conversions read and write interleaved RGBA float buffers. Hue is
+    // a fraction of a turn in [0, 1), so red is 0, green 1/3 and blue 2/3;
+    // saturation, value and lightness are in [0, 1]. Alpha is copied
+    // unchanged. Four pixels are transposed into one register per channel,
+    // converted with selects instead of branches and transposed back.
+
+    namespace Detail
+    {
+        /**
+         * @brief
+         * Converts the color channels of every pixel, four pixels at a
+         * time. The last partial group runs through a zero padded copy, so
+         * every pixel takes the same path.
+         * @tparam Kernel Type of the conversion
+         * @param source The RGBA pixels
+         * @param destination The converted pixels
+         * @param kernel Converts three registers of channels in place
+         * @throws std::invalid_argument If the sizes differ or the buffers
+         * do not hold whole pixels
+         */
+        template <class Kernel>
+        void convert_channels(std::span<const float> source, std::span<float> destination, Kernel kernel)
+        {
+            using Simd::Float4;
+            using Simd::Float4x4;
+
+            std::size_t count = pixel_count(channel_count(source.size(), destination.size()));
+
+            auto convert = [&](const float *input, float *output)
+            {
+                Float4x4 planes = Float4x4(Float4::load(input), Float4::load(input + 4),
+                                           Float4::load(input + 8), Float4::load(input + 12))
+                                      .transpose();
+
+                Float4 x = planes.column(0);
+                Float4 y = planes.column(1);
+                Float4 z = planes.column(2);
+
+                kernel(x, y, z);
+
+                Float4x4 pixels = Float4x4(x, y, z, planes.column(3)).transpose();
+
+                for (std::size_t i = 0; i < 4; ++i)
+                    pixels.column(i).store(output + i * 4);
+            };
+
+            std::size_t i = 0;
+
+            for (; i + 4 <= count; i += 4)
+                convert(source.data() + i * 4, destination.data() + i * 4);
+
+            if (i < count)
+            {
+                float input[16] = {};
+                float output[16];
+                std::size_t channels = (count - i) * 4;
+
+                std::copy_n(source.data() + i * 4, channels, input);
+                convert(input, output);
+                std::copy_n(output, channels, destination.data() + i * 4);
+            }
+        }
+
+        /**
+         * @brief
+         * Calculates the hue shared by HSV and HSL
+         * @param r Red channels
+         * @param g Green channels
+         * @param b Blue channels
+         * @param max Largest channel of every pixel
+         * @param chroma Largest minus smallest channel of every pixel
+         * @return Simd::Float4 The hues in [0, 1), zero for grays
+         */
+        inline Simd::Float4 hue(const Simd::Float4 &r, const Simd::Float4 &g, const Simd::Float4 &b,
+                                const Simd::Float4 &max, const Simd::Float4 &chroma)
+        {
+            using Simd::Float4;
+
+            const Float4 zero(0.0f);
+            const Float4 one(1.0f);
+            const Float4 six(6.0f);
+
+            // Grays divide by one and are zeroed below
+            Float4 colored = Float4::less(zero, chroma);
+            Float4 divisor = Float4::select(colored, chroma, one);
+
+            // Sextant of the largest channel: red wraps around zero
+            Float4 red = (g - b) / divisor;
+            red = Float4::select(Float4::less(red, zero), red + six, red);
+
+            Float4 green = (b - r) / divisor + Float4(2.0f);
+            Float4 blue = (r - g) / divisor + Float4(4.0f);
+
+            Float4 sextant = Float4::select(Float4::less(r, max),
+                                            Float4::select(Float4::less(g, max), blue, green), red);
+            Float4 turns = sextant / six;
+
+            // A tiny negative red sextant rounds up to a full turn
+            turns = Float4::select(Float4::less(turns, one), turns, turns - one);
+
+            return Float4::select(colored, turns, zero);
+        }
+    }
+
+    /**
+     * @brief
+     * Converts RGB pixels to hue, saturation and value
+     * @param source The RGBA pixels
+     * @param destination The HSVA pixels
+     * @throws std::invalid_argument If the sizes differ or the buffers do
+     * not hold whole pixels
+     */
+    inline void rgb_to_hsv(std::span<const float> source, std::span<float> destination)
+    {
+        using Simd::Float4;
+
+        Detail::convert_channels(source, destination, [](Float4 &r, Float4 &g, Float4 &b)
+                                 {
+                                     const Float4 zero(0.0f);
+
+                                     Float4 max = Float4::max(r, Float4::max(g, b));
+                                     Float4 chroma = max - Float4::min(r, Float4::min(g, b));
+
+                                     Float4 hue = Detail::hue(r, g, b, max, chroma);
+                                     Float4 saturation = Float4::select(Float4::less(zero, max),
+                                                                        chroma / max, zero);
+
+                                     r = hue;
+                                     g = saturation;
+                                     b = max; });
+    }
+
+    /**
+     * @brief
+     * Converts hue, saturation and value pixels to RGB
+     * @param source The HSVA pixels
+     * @param destination The RGBA pixels
+     * @throws std::invalid_argument If the sizes differ or the buffers do
+     * not hold whole pixels
+     */
+    inline void hsv_to_rgb(std::span<const float> source, std::span<float> destination)
+    {
+        using Simd::Float4;
+
+        Detail::convert_channels(source, destination, [](Float4 &h, Float4 &s, Float4 &v)
+                                 {
+                                     const Float4 zero(0.0f);
+                                     const Float4 one(1.0f);
+                                     const Float4 four(4.0f);
+                                     const Float4 six(6.0f);
+
+                                     Float4 sextant = h * six;
+                                     Float4 chroma = v * s;
+
+                                     // f(n) = v - c * clamp(min(k, 4 - k), 0, 1), k = (n + 6h) mod 6
+                                     auto channel = [&](float n)
+                                     {
+                                         Float4 k = Float4(n) + sextant;
+                                         k = Float4::select(Float4::less(k, six), k, k - six);
+
+                                         Float4 ramp = Float4::min(Float4::min(k, four - k), one);
+                                         return v - chroma * Float4::max(ramp, zero);
+                                     };
+
+                                     Float4 r = channel(5.0f);
+                                     Float4 g = channel(3.0f);
+                                     Float4 b = channel(1.0f);
+
+                                     h = r;
+                                     s = g;
+                                     v = b; });
+    }
+
+    /**
+     * @brief
+     * Converts RGB pixels to hue, saturation and lightness
+     * @param source The RGBA pixels
+     * @param destination The HSLA pixels
+     * @throws std::invalid_argument If the sizes differ or the buffers do
+     * not hold whole pixels
+     */
+    inline void rgb_to_hsl(std::span<const float> source, std::span<float> destination)
+    {
+        using Simd::Float4;
+
+        Detail::convert_channels(source, destination, [](Float4 &r, Float4 &g, Float4 &b)
+                                 {
+                                     const Float4 zero(0.0f);
+                                     const Float4 one(1.0f);
+
+                                     Float4 max = Float4::max(r, Float4::max(g, b));
+                                     Float4 min = Float4::min(r, Float4::min(g, b));
+                                     Float4 chroma = max - min;
+                                     Float4 lightness = (max + min) * Float4(0.5f);
+
+                                     // s = c / (1 - |2l - 1|), zero for grays
+                                     Float4 offset = max + min - one;
+                                     Float4 divisor = one - Float4::max(offset, -offset);
+                                     Float4 colored = Float4::less(zero, chroma);
+                                     Float4 saturation = Float4::select(
+                                         colored, chroma / Float4::select(colored, divisor, one), zero);
+
+                                     Float4 hue = Detail::hue(r, g, b, max, chroma);
+
+                                     r = hue;
+                                     g = saturation;
+                                     b = lightness; });
+    }
+
+    /**
+     * @brief
+     * Converts hue, saturation and lightness pixels to RGB
+     * @param source The HSLA pixels
+     * @param destination The RGBA pixels
+     * @throws std::invalid_argument If the sizes differ or the buffers do
+     * not hold whole pixels
+     */
+    inline void hsl_to_rgb(std::span<const float> source, std::span<float> destination)
+    {
+        using Simd::Float4;
+
+        Detail::convert_channels(source, destination, [](Float4 &h, Float4 &s, Float4 &l)
+                                 {
+                                     const Float4 one(1.0f);
+                                     const Float4 three(3.0f);
+                                     const Float4 nine(9.0f);
+                                     const Float4 twelve(12.0f);
+
+                                     Float4 turns = h * twelve;
+                                     Float4 amplitude = s * Float4::min(l, one - l);
+
+                                     // f(n) = l - a * clamp(min(k - 3, 9 - k), -1, 1), k = (n + 12h) mod 12
+                                     auto channel = [&](float n)
+                                     {
+                                         Float4 k = Float4(n) + turns;
+                                         k = Float4::select(Float4::less(k, twelve), k, k - twelve);
+
+                                         Float4 ramp = Float4::min(Float4::min(k - three, nine - k), one);
+                                         return l - amplitude * Float4::max(ramp, -one);
+                                     };
+
+                                     Float4 r = channel(0.0f);
+                                     Float4 g = channel(8.0f);
+                                     Float4 b = channel(4.0f);
+
+                                     h = r;
+                                     s = g;
+                                     l = b; });
+    }
+
+    /**
+     * @brief
+     * Converts RGB pixels to YCoCg: luma and the orange and green chroma.
+     * It is computed in lifting steps whose halvings are exact, so the
+     * round trip through ycocg_to_rgb is accurate to a few units in the
+     * last place. Co and Cg are in [-0.5, 0.5] and need a 0.5 offset to be
+     * stored in unsigned formats.
+     * @param source The RGBA pixels
+     * @param destination The YCoCgA pixels
+     * @throws std::invalid_argument If the sizes differ or the buffers do
+     * not hold whole pixels
+     */
+    inline void rgb_to_ycocg(std::span<const float> source, std::span<float> destination)
+    {
+        using Simd::Float4;
+
+        Detail::convert_channels(source, destination, [](Float4 &r, Float4 &g, Float4 &b)
+                                 {
+                                     const Float4 half(0.5f);
+
+                                     // Y = (r + 2g + b) / 4, Co = (r - b) / 2, Cg = (2g - r - b) / 4
+                                     Float4 co = (r - b) * half;
+                                     Float4 t = b + co;
+                                     Float4 cg = (g - t) * half;
+                                     Float4 y = t + cg;
+
+                                     r = y;
+                                     g = co;
+                                     b = cg; });
+    }
+
+    /**
+     * @brief
+     * Converts YCoCg pixels back to RGB
+     * @param source The YCoCgA pixels
+     * @param destination The RGBA pixels
+     * @throws std::invalid_argument If the sizes differ or the buffers do
+     * not hold whole pixels
+     */
+    inline void ycocg_to_rgb(std::span<const float> source, std::span<float> destination)
+    {
+        using Simd::Float4;
+
+        Detail::convert_channels(source, destination, [](Float4 &y, Float4 &co, Float4 &cg)
+                                 {
+                                     Float4 t = y - cg;
+                                     Float4 g = y + cg;
+                                     Float4 b = t - co;
+                                     Float4 r = b + co + co;
+
+                                     y = r;
+                                     co = g;
+                                     cg = b; });
+    }
+}
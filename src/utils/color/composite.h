@@ -0,0 +1,360 @@
+/**
+ * @file composite.h
+ * @author Carlos Salguero
+ * @brief Porter-Duff and separable blend modes over premultiplied pixel
+ *        buffers
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#pragma once
+
+// C++ Standard Library
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+// Project files
+#include "../math/float8.h"
+#include "color_kernels.h"
+
+namespace Math
+{
+    /**
+     * @enum BlendMode
+     * @brief How a premultiplied source pixel s is combined with the
+     *        destination pixel d beneath it. Every formula applies to all
+     *        four channels, alpha included.
+     */
+    enum class BlendMode
+    {
+        // s + d * (1 - sa)
+        SourceOver,
+        // s + d, saturating for 8-bit channels
+        Additive,
+        // s * d + s * (1 - da) + d * (1 - sa)
+        Multiply,
+        // s + d - s * d
+        Screen
+    };
+
+    namespace Detail
+    {
+        /**
+         * @brief
+         * Blends float channels. The same expression serves scalar lanes,
+         * Float4 and Float8, so every path rounds identically.
+         * @tparam Mode The blend mode
+         * @tparam T Type of the channels
+         * @param s Source channels
+         * @param d Destination channels
+         * @param sa Source alpha of every channel
+         * @param da Destination alpha of every channel
+         * @param one One in every channel
+         * @return T The blended channels
+         */
+        template <BlendMode Mode, class T>
+        T blend(const T &s, const T &d, const T &sa, const T &da, const T &one)
+        {
+            if constexpr (Mode == BlendMode::SourceOver)
+                return s + d * (one - sa);
+            else if constexpr (Mode == BlendMode::Additive)
+                return s + d;
+            else if constexpr (Mode == BlendMode::Multiply)
+                return s * d + s * (one - da) + d * (one - sa);
+            else
+                return s + d - s * d;
+        }
+
+        /**
+         * @brief
+         * Blends one 8-bit channel, rounding products to nearest and
+         * saturating at 255
+         * @tparam Mode The blend mode
+         * @param s Source channel
+         * @param d Destination channel
+         * @param sa Source alpha
+         * @param da Destination alpha
+         * @return std::uint8_t The blended channel
+         */
+        template <BlendMode Mode>
+        std::uint8_t blend_unorm8(std::uint32_t s, std::uint32_t d, std::uint32_t sa, std::uint32_t da)
+        {
+            std::uint32_t result;
+
+            if constexpr (Mode == BlendMode::SourceOver)
+                result = s + multiply_unorm8(d, 255 - sa);
+            else if constexpr (Mode == BlendMode::Additive)
+                result = s + d;
+            else if constexpr (Mode == BlendMode::Multiply)
+                result = multiply_unorm8(s, d) + multiply_unorm8(s, 255 - da) + multiply_unorm8(d, 255 - sa);
+            else
+                result = s + d - multiply_unorm8(s, d);
+
+            return static_cast<std::uint8_t>(result < 255 ? result : 255);
+        }
+
+#if defined(MATH_SIMD_SSE)
+        /**
+         * @brief
+         * blend_unorm8 on two pixels held as eight 16-bit lanes
+         * @tparam Mode The blend mode
+         * @param s Source pixels, zero extended
+         * @param d Destination pixels, zero extended
+         * @return __m128i The blended pixels, zero extended and saturated
+         */
+        template <BlendMode Mode>
+        __m128i blend_unorm8(__m128i s, __m128i d)
+        {
+            const __m128i max = _mm_set1_epi16(255);
+
+            auto alpha = [](__m128i pixels)
+            {
+                return _mm_shufflehi_epi16(_mm_shufflelo_epi16(pixels, _MM_SHUFFLE(3, 3, 3, 3)),
+                                           _MM_SHUFFLE(3, 3, 3, 3));
+            };
+
+            __m128i result;
+
+            if constexpr (Mode == BlendMode::SourceOver)
+                result = _mm_add_epi16(s, multiply_unorm8(d, _mm_sub_epi16(max, alpha(s))));
+            else if constexpr (Mode == BlendMode::Multiply)
+                result = _mm_add_epi16(_mm_add_epi16(multiply_unorm8(s, d),
+                                                     multiply_unorm8(s, _mm_sub_epi16(max, alpha(d)))),
+                                       multiply_unorm8(d, _mm_sub_epi16(max, alpha(s))));
+            else
+                result = _mm_sub_epi16(_mm_add_epi16(s, d), multiply_unorm8(s, d));
+
+            return _mm_min_epi16(result, max);
+        }
+#elif defined(MATH_SIMD_NEON)
+        /**
+         * @brief
+         * multiply_unorm8 on eight lanes: the rounding shifts compute
+         * (p + 128 + ((p + 128) >> 8)) >> 8 with p = a * b
+         * @param a The first channels
+         * @param b The second channels
+         * @return uint8x8_t The products
+         */
+        inline uint8x8_t multiply_unorm8(uint8x8_t a, uint8x8_t b)
+        {
+            uint16x8_t product = vmull_u8(a, b);
+            return vrshrn_n_u16(vrsraq_n_u16(product, product, 8), 8);
+        }
+
+        /**
+         * @brief
+         * multiply_unorm8 on sixteen lanes
+         * @param a The first channels
+         * @param b The second channels
+         * @return uint8x16_t The products
+         */
+        inline uint8x16_t multiply_unorm8(uint8x16_t a, uint8x16_t b)
+        {
+            return vcombine_u8(multiply_unorm8(vget_low_u8(a), vget_low_u8(b)),
+                               multiply_unorm8(vget_high_u8(a), vget_high_u8(b)));
+        }
+
+        /**
+         * @brief
+         * blend_unorm8 on one channel of sixteen deinterleaved pixels
+         * @tparam Mode The blend mode
+         * @param s Source channels
+         * @param d Destination channels
+         * @param sa Source alphas
+         * @param da Destination alphas
+         * @return uint8x16_t The blended channels
+         */
+        template <BlendMode Mode>
+        uint8x16_t blend_unorm8(uint8x16_t s, uint8x16_t d, uint8x16_t sa, uint8x16_t da)
+        {
+            if constexpr (Mode == BlendMode::SourceOver)
+                return vqaddq_u8(s, multiply_unorm8(d, vmvnq_u8(sa)));
+            else if constexpr (Mode == BlendMode::Multiply)
+                return vqaddq_u8(vqaddq_u8(multiply_unorm8(s, d), multiply_unorm8(s, vmvnq_u8(da))),
+                                 multiply_unorm8(d, vmvnq_u8(sa)));
+            else
+                // s + d - s * d never exceeds 255
+                return vsubq_u8(vaddq_u8(s, d), multiply_unorm8(s, d));
+        }
+#endif
+
+        /**
+         * @brief
+         * Blends float pixels, eight per iteration as four Float8 of two
+         * pixels each, and the remainder one Float4 pixel at a time
+         * @tparam Mode The blend mode
+         * @param source The premultiplied source pixels
+         * @param destination The premultiplied destination pixels
+         */
+        template <BlendMode Mode>
+        void composite_pixels(std::span<const float> source, std::span<float> destination)
+        {
+            using Simd::Float4;
+            using Simd::Float8;
+
+            std::size_t count = pixel_count(channel_count(source.size(), destination.size()));
+
+            const float *s = source.data();
+            float *d = destination.data();
+            std::size_t i = 0;
+
+            const Float8 one8(1.0f);
+
+            for (; i + 8 <= count; i += 8)
+            {
+                for (std::size_t j = 0; j < 32; j += 8)
+                {
+                    Float8 src = Float8::load(s + i * 4 + j);
+                    Float8 dst = Float8::load(d + i * 4 + j);
+
+                    blend<Mode>(src, dst, Float8::splat_halves<3>(src), Float8::splat_halves<3>(dst), one8)
+                        .store(d + i * 4 + j);
+                }
+            }
+
+            const Float4 one4(1.0f);
+
+            for (; i < count; ++i)
+            {
+                Float4 src = Float4::load(s + i * 4);
+                Float4 dst = Float4::load(d + i * 4);
+
+                blend<Mode>(src, dst, Float4::splat<3>(src), Float4::splat<3>(dst), one4).store(d + i * 4);
+            }
+        }
+
+        /**
+         * @brief
+         * Blends 8-bit pixels, sixteen per iteration
+         * @tparam Mode The blend mode
+         * @param source The premultiplied source pixels
+         * @param destination The premultiplied destination pixels
+         */
+        template <BlendMode Mode>
+        void composite_pixels(std::span<const std::uint8_t> source, std::span<std::uint8_t> destination)
+        {
+            std::size_t count = pixel_count(channel_count(source.size(), destination.size()));
+
+            const std::uint8_t *s = source.data();
+            std::uint8_t *d = destination.data();
+            std::size_t i = 0;
+
+#if defined(MATH_SIMD_SSE)
+            const __m128i zero = _mm_setzero_si128();
+
+            for (; i + 16 <= count; i += 16)
+            {
+                for (std::size_t j = 0; j < 64; j += 16)
+                {
+                    __m128i src = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i * 4 + j));
+                    auto address = reinterpret_cast<__m128i *>(d + i * 4 + j);
+                    __m128i dst = _mm_loadu_si128(address);
+
+                    if constexpr (Mode == BlendMode::Additive)
+                        _mm_storeu_si128(address, _mm_adds_epu8(src, dst));
+                    else
+                        _mm_storeu_si128(address,
+                                         _mm_packus_epi16(blend_unorm8<Mode>(_mm_unpacklo_epi8(src, zero),
+                                                                             _mm_unpacklo_epi8(dst, zero)),
+                                                          blend_unorm8<Mode>(_mm_unpackhi_epi8(src, zero),
+                                                                             _mm_unpackhi_epi8(dst, zero))));
+                }
+            }
+#elif defined(MATH_SIMD_NEON)
+            for (; i + 16 <= count; i += 16)
+            {
+                uint8x16x4_t src = vld4q_u8(s + i * 4);
+                uint8x16x4_t dst = vld4q_u8(d + i * 4);
+                uint8x16x4_t result;
+
+                for (int c = 0; c < 4; ++c)
+                {
+                    if constexpr (Mode == BlendMode::Additive)
+                        result.val[c] = vqaddq_u8(src.val[c], dst.val[c]);
+                    else
+                        result.val[c] = blend_unorm8<Mode>(src.val[c], dst.val[c], src.val[3], dst.val[3]);
+                }
+
+                vst4q_u8(d + i * 4, result);
+            }
+#endif
+
+            for (; i < count; ++i)
+            {
+                const std::uint8_t *src = s + i * 4;
+                std::uint8_t *dst = d + i * 4;
+                std::uint32_t sa = src[3];
+                std::uint32_t da = dst[3];
+
+                for (std::size_t c = 0; c < 4; ++c)
+                    dst[c] = blend_unorm8<Mode>(src[c], dst[c], sa, da);
+            }
+        }
+
+        /**
+         * @brief
+         * Dispatches a blend mode to its kernel
+         * @tparam Channel Type of the channels
+         * @param mode The blend mode
+         * @param source The premultiplied source pixels
+         * @param destination The premultiplied destination pixels
+         */
+        template <class Channel>
+        void composite_dispatch(BlendMode mode, std::span<const Channel> source, std::span<Channel> destination)
+        {
+            switch (mode)
+            {
+            case BlendMode::SourceOver:
+                composite_pixels<BlendMode::SourceOver>(source, destination);
+                break;
+            case BlendMode::Additive:
+                composite_pixels<BlendMode::Additive>(source, destination);
+                break;
+            case BlendMode::Multiply:
+                composite_pixels<BlendMode::Multiply>(source, destination);
+                break;
+            case BlendMode::Screen:
+                composite_pixels<BlendMode::Screen>(source, destination);
+                break;
+            }
+        }
+    }
+
+    /**
+     * @brief
+     * Blends premultiplied float pixels onto a destination buffer, in
+     * place. Channels are not clamped, so additive blending of HDR
+     * buffers keeps values above one.
+     * @param mode The blend mode
+     * @param source The RGBA source pixels
+     * @param destination The RGBA destination pixels, overwritten with the
+     * result
+     * @throws std::invalid_argument If the sizes differ or the buffers do
+     * not hold whole pixels
+     */
+    inline void composite(BlendMode mode, std::span<const float> source, std::span<float> destination)
+    {
+        Detail::composite_dispatch<float>(mode, source, destination);
+    }
+
+    /**
+     * @brief
+     * Blends premultiplied 8-bit pixels onto a destination buffer, in
+     * place, rounding products to nearest and saturating at 255
+     * @param mode The blend mode
+     * @param source The RGBA source pixels
+     * @param destination The RGBA destination pixels, overwritten with the
+     * result
+     * @throws std::invalid_argument If the sizes differ or the buffers do
+     * not hold whole pixels
+     */
+    inline void composite(BlendMode mode, std::span<const std::uint8_t> source,
+                          std::span<std::uint8_t> destination)
+    {
+        Detail::composite_dispatch<std::uint8_t>(mode, source, destination);
+    }
+}
@@ -0,0 +1,116 @@
+/**
+ * @file srgb.h
+ * @author Carlos Salguero
+ * @brief Conversions between the sRGB and linear color spaces
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#pragma once
+
+// C++ Standard Libraries
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+namespace Math
+{
+    /**
+     * @brief
+     * Converts an sRGB encoded channel to linear
+     * @param value sRGB channel in [0, 1]
+     * @return float Linear channel in [0, 1]
+     */
+    inline float srgb_to_linear(float value)
+    {
+        if (value <= 0.04045f)
+            return value / 12.92f;
+
+        return std::pow((value + 0.055f) / 1.055f, 2.4f);
+    }
+
+    /**
+     * @brief
+     * Converts a linear channel to sRGB
+     * @param value Linear channel in [0, 1]
+     * @return float sRGB channel in [0, 1]
+     */
+    inline float linear_to_srgb(float value)
+    {
+        if (value <= 0.0031308f)
+            return value * 12.92f;
+
+        return 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+    }
+
+    /**
+     * @brief
+     * Table with the linear value of every 8-bit sRGB channel
+     * @return const std::array<float, 256>& Decoding table
+     */
+    inline const std::array<float, 256> &srgb8_to_linear_table()
+    {
+        static const auto table = []()
+        {
+            std::array<float, 256> values{};
+
+            for (std::size_t i = 0; i < values.size(); ++i)
+                values[i] = srgb_to_linear(static_cast<float>(i) / 255.0f);
+
+            return values;
+        }();
+
+        return table;
+    }
+
+    /**
+     * @brief
+     * Table mapping 12-bit linear values to 8-bit sRGB channels. The
+     * encoding is within one unit of the exact conversion.
+     * @return const std::array<std::uint8_t, 4096>& Encoding table
+     */
+    inline const std::array<std::uint8_t, 4096> &linear_to_srgb8_table()
+    {
+        static const auto table = []()
+        {
+            std::array<std::uint8_t, 4096> values{};
+
+            for (std::size_t i = 0; i < values.size(); ++i)
+                values[i] = static_cast<std::uint8_t>(
+                    linear_to_srgb(static_cast<float>(i) / 4095.0f) * 255.0f + 0.5f);
+
+            return values;
+        }();
+
+        return table;
+    }
+
+    /**
+     * @brief
+     * Decodes an 8-bit sRGB channel to linear through the lookup table
+     * @param value sRGB channel
+     * @return float Linear channel in [0, 1]
+     */
+    inline float srgb8_to_linear(std::uint8_t value)
+    {
+        return srgb8_to_linear_table()[value];
+    }
+
+    /**
+     * @brief
+     * Encodes a linear channel as 8-bit sRGB through the lookup table
+     * @param value Linear channel, clamped to [0, 1]. NaN encodes as 0.
+     * @return std::uint8_t sRGB channel
+     */
+    inline std::uint8_t linear_to_srgb8(float value)
+    {
+        // Written so that NaN fails the first test and never indexes the table
+        value = value > 0.0f ? value : 0.0f;
+        value = value < 1.0f ? value : 1.0f;
+
+        return linear_to_srgb8_table()[static_cast<std::size_t>(value * 4095.0f + 0.5f)];
+    }
+} // namespace Math
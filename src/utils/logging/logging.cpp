@@ -17,6 +17,9 @@
 
 // static attributes
 Logging *Logging::instance = nullptr;
+const std::string Logging::INFO = "INFO";
+const std::string Logging::WARNING = "WARNING";
+const std::string Logging::ERROR = "ERROR";
 
 // Public Methods
 /**
@@ -0,0 +1,93 @@
+/**
+ * @file aligned_allocator.h
+ * @author Carlos Salguero
+ * @brief Allocator that returns memory aligned for SIMD loads
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#pragma once
+
+// C++ Standard Library
+#include <cstddef>
+#include <limits>
+#include <new>
+
+namespace Math
+{
+    /**
+     * @brief
+     * Default alignment of the math containers. One cache line, which also
+     * satisfies the alignment of every SSE, AVX and NEON load.
+     */
+    inline constexpr std::size_t DEFAULT_ALIGNMENT = 64;
+
+    /**
+     * @class AlignedAllocator
+     * @brief Standard allocator whose allocations start on an
+     *        Alignment-byte boundary
+     * @tparam T Type of the elements
+     * @tparam Alignment Alignment in bytes, a power of two
+     */
+    template <class T, std::size_t Alignment = DEFAULT_ALIGNMENT>
+    class AlignedAllocator
+    {
+        static_assert((Alignment & (Alignment - 1)) == 0,
+                      "Alignment must be a power of two");
+        static_assert(Alignment >= alignof(T),
+                      "Alignment must be at least the alignment of T");
+
+    public:
+        // Type aliases
+        using value_type = T;
+
+        template <class U>
+        struct rebind
+        {
+            using other = AlignedAllocator<U, Alignment>;
+        };
+
+        // Constructors
+        constexpr AlignedAllocator() noexcept = default;
+
+        template <class U>
+        constexpr AlignedAllocator(const AlignedAllocator<U, Alignment> &) noexcept {}
+
+        // Methods
+        /**
+         * @brief
+         * Allocates uninitialized storage for count elements
+         * @param count Number of elements
+         * @return T* Aligned storage
+         * @throws std::bad_array_new_length If the size overflows
+         */
+        [[nodiscard]] T *allocate(std::size_t count)
+        {
+            if (count > std::numeric_limits<std::size_t>::max() / sizeof(T))
+                throw std::bad_array_new_length();
+
+            return static_cast<T *>(::operator new(count * sizeof(T),
+                                                   std::align_val_t(Alignment)));
+        }
+
+        /**
+         * @brief
+         * Releases storage obtained from allocate
+         * @param pointer Storage to release
+         */
+        void deallocate(T *pointer, std::size_t) noexcept
+        {
+            ::operator delete(pointer, std::align_val_t(Alignment));
+        }
+
+        // Operators
+        template <class U>
+        constexpr bool operator==(const AlignedAllocator<U, Alignment> &) const noexcept
+        {
+            return true;
+        }
+    };
+}
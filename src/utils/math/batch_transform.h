@@ -0,0 +1,461 @@
+/**
+ * @file batch_transform.h
+ * @author Carlos Salguero
+ * @brief Transforms of whole arrays of points stored as structure of arrays
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#pragma once
+
+// C++ Standard Library
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+
+// Project files
+#include "fast_math.h"
+#include "float8.h"
+#include "mat.h"
+#include "quaternion.h"
+
+namespace Math
+{
+    // The kernels read and write points as structure of arrays: one array per
+    // coordinate. Every SIMD lane then holds a different point, so a 4x4
+    // transform is twelve multiply-adds per register of points with no
+    // shuffles, and the loop runs at the full width of the target.
+
+    /**
+     * @struct SoaView
+     * @brief Writable view of points stored as one array per coordinate
+     */
+    struct SoaView
+    {
+        std::span<float> x;
+        std::span<float> y;
+        std::span<float> z;
+
+        /**
+         * @brief
+         * Gets the number of points
+         * @return std::size_t The number of points
+         * @throws std::invalid_argument If the arrays differ in size
+         */
+        std::size_t size() const
+        {
+            if (y.size() != x.size() || z.size() != x.size())
+                throw std::invalid_argument("Coordinate arrays must be the same size");
+
+            return x.size();
+        }
+    };
+
+    /**
+     * @struct ConstSoaView
+     * @brief Read-only view of points stored as one array per coordinate
+     */
+    struct ConstSoaView
+    {
+        std::span<const float> x;
+        std::span<const float> y;
+        std::span<const float> z;
+
+        // Constructors
+        ConstSoaView() = default;
+
+        ConstSoaView(std::span<const float> x, std::span<const float> y,
+                     std::span<const float> z)
+            : x(x), y(y), z(z) {}
+
+        ConstSoaView(const SoaView &view) : x(view.x), y(view.y), z(view.z) {}
+
+        /**
+         * @brief
+         * Gets the number of points
+         * @return std::size_t The number of points
+         * @throws std::invalid_argument If the arrays differ in size
+         */
+        std::size_t size() const
+        {
+            if (y.size() != x.size() || z.size() != x.size())
+                throw std::invalid_argument("Coordinate arrays must be the same size");
+
+            return x.size();
+        }
+    };
+
+    namespace Detail
+    {
+        /**
+         * @brief
+         * Checks that the input and output hold the same number of points
+         * @param input The points to read
+         * @param output The points to write
+         * @return std::size_t The number of points
+         * @throws std::invalid_argument If the sizes differ
+         */
+        inline std::size_t batch_size(const ConstSoaView &input, const SoaView &output)
+        {
+            std::size_t count = input.size();
+
+            if (output.size() != count)
+                throw std::invalid_argument("Input and output must hold the same number of points");
+
+            return count;
+        }
+
+        /**
+         * @brief
+         * Transforms (x, y, z, w) by the upper three rows of a matrix. With
+         * w = 1 points are translated, with w = 0 directions are not.
+         * @param matrix The transform
+         * @param w The homogeneous coordinate of every point
+         * @param input The points to read
+         * @param output The points to write
+         */
+        inline void transform_soa(const Mat4 &matrix, float w,
+                                  const ConstSoaView &input, const SoaView &output)
+        {
+            using Simd::WideFloat;
+
+            std::size_t count = batch_size(input, output);
+            constexpr std::size_t width = WideFloat::width;
+
+            WideFloat m[3][4];
+
+            for (std::size_t i = 0; i < 3; ++i)
+            {
+                for (std::size_t j = 0; j < 3; ++j)
+                    m[i][j] = WideFloat(matrix(i, j));
+
+                m[i][3] = WideFloat(matrix(i, 3) * w);
+            }
+
+            std::size_t i = 0;
+
+            for (; i + width <= count; i += width)
+            {
+                WideFloat x = WideFloat::load(input.x.data() + i);
+                WideFloat y = WideFloat::load(input.y.data() + i);
+                WideFloat z = WideFloat::load(input.z.data() + i);
+
+                WideFloat out[3];
+
+                for (std::size_t r = 0; r < 3; ++r)
+                    out[r] = WideFloat::multiply_add(
+                        m[r][0], x,
+                        WideFloat::multiply_add(
+                            m[r][1], y, WideFloat::multiply_add(m[r][2], z, m[r][3])));
+
+                out[0].store(output.x.data() + i);
+                out[1].store(output.y.data() + i);
+                out[2].store(output.z.data() + i);
+            }
+
+            for (; i < count; ++i)
+            {
+                float x = input.x[i], y = input.y[i], z = input.z[i];
+
+                output.x[i] = matrix(0, 0) * x + matrix(0, 1) * y + matrix(0, 2) * z + matrix(0, 3) * w;
+                output.y[i] = matrix(1, 0) * x + matrix(1, 1) * y + matrix(1, 2) * z + matrix(1, 3) * w;
+                output.z[i] = matrix(2, 0) * x + matrix(2, 1) * y + matrix(2, 2) * z + matrix(2, 3) * w;
+            }
+        }
+    }
+
+    /**
+     * @brief
+     * Transforms points (w = 1) by a matrix. The output may be the input
+     * itself, but must not partially overlap it.
+     * @param matrix The transform, assumed affine: its last row is ignored
+     * @param input The points to transform
+     * @param output Where the transformed points are written
+     * @throws std::invalid_argument If the arrays differ in size
+     */
+    inline void transform_points(const Mat4 &matrix, const ConstSoaView &input,
+                                 const SoaView &output)
+    {
+        Detail::transform_soa(matrix, 1.0f, input, output);
+    }
+
+    /**
+     * @brief
+     * Transforms directions (w = 0) by a matrix, which ignores its
+     * translation. The output may be the input itself, but must not
+     * partially overlap it.
+     * @param matrix The transform, assumed affine: its last row is ignored
+     * @param input The directions to transform
+     * @param output Where the transformed directions are written
+     * @throws std::invalid_argument If the arrays differ in size
+     */
+    inline void transform_directions(const Mat4 &matrix, const ConstSoaView &input,
+                                     const SoaView &output)
+    {
+        Detail::transform_soa(matrix, 0.0f, input, output);
+    }
+
+    /**
+     * @brief
+     * Transforms points (w = 1) by a projective matrix and keeps the
+     * resulting w, for clipping or a later perspective divide. The output
+     * may be the input itself, but must not partially overlap it.
+     * @param matrix The transform
+     * @param input The points to transform
+     * @param output Where the transformed x, y and z are written
+     * @param output_w Where the transformed w is written
+     * @throws std::invalid_argument If the arrays differ in size
+     */
+    inline void transform_points_homogeneous(const Mat4 &matrix, const ConstSoaView &input,
+                                             const SoaView &output, std::span<float> output_w)
+    {
+        using Simd::WideFloat;
+
+        std::size_t count = Detail::batch_size(input, output);
+        constexpr std::size_t width = WideFloat::width;
+
+        if (output_w.size() != count)
+            throw std::invalid_argument("Input and output must hold the same number of points");
+
+        WideFloat m[4][4];
+
+        for (std::size_t i = 0; i < 4; ++i)
+            for (std::size_t j = 0; j < 4; ++j)
+                m[i][j] = WideFloat(matrix(i, j));
+
+        std::size_t i = 0;
+
+        for (; i + width <= count; i += width)
+        {
+            WideFloat x = WideFloat::load(input.x.data() + i);
+            WideFloat y = WideFloat::load(input.y.data() + i);
+            WideFloat z = WideFloat::load(input.z.data() + i);
+
+            WideFloat out[4];
+
+            for (std::size_t r = 0; r < 4; ++r)
+                out[r] = WideFloat::multiply_add(
+                    m[r][0], x,
+                    WideFloat::multiply_add(
+                        m[r][1], y, WideFloat::multiply_add(m[r][2], z, m[r][3])));
+
+            out[0].store(output.x.data() + i);
+            out[1].store(output.y.data() + i);
+            out[2].store(output.z.data() + i);
+            out[3].store(output_w.data() + i);
+        }
+
+        for (; i < count; ++i)
+        {
+            Vec4 point = matrix * Vec4(input.x[i], input.y[i], input.z[i], 1.0f);
+
+            output.x[i] = point.x();
+            output.y[i] = point.y();
+            output.z[i] = point.z();
+            output_w[i] = point.w();
+        }
+    }
+
+    /**
+     * @brief
+     * Rotates points by a unit quaternion and then translates them, the
+     * rigid transform of skinning and particles. Uses
+     * v' = v + w t + q x t with t = 2 (q x v), which is cheaper than going
+     * through a matrix. The output may be the input itself, but must not
+     * partially overlap it.
+     * @param rotation The rotation, of unit length
+     * @param translation The translation applied after the rotation
+     * @param input The points to transform
+     * @param output Where the transformed points are written
+     * @throws std::invalid_argument If the arrays differ in size
+     */
+    inline void rotate_translate_points(const Quaternion<float> &rotation, const Vec3 &translation,
+                                        const ConstSoaView &input, const SoaView &output)
+    {
+        using Simd::WideFloat;
+
+        std::size_t count = Detail::batch_size(input, output);
+        constexpr std::size_t width = WideFloat::width;
+
+        WideFloat qx(rotation.x()), qy(rotation.y()), qz(rotation.z()), qw(rotation.w());
+        WideFloat tx(translation.x()), ty(translation.y()), tz(translation.z());
+        WideFloat two(2.0f);
+
+        std::size_t i = 0;
+
+        for (; i + width <= count; i += width)
+        {
+            WideFloat x = WideFloat::load(input.x.data() + i);
+            WideFloat y = WideFloat::load(input.y.data() + i);
+            WideFloat z = WideFloat::load(input.z.data() + i);
+
+            WideFloat cx = (qy * z - qz * y) * two;
+            WideFloat cy = (qz * x - qx * z) * two;
+            WideFloat cz = (qx * y - qy * x) * two;
+
+            WideFloat::multiply_add(qw, cx, x + (qy * cz - qz * cy) + tx).store(output.x.data() + i);
+            WideFloat::multiply_add(qw, cy, y + (qz * cx - qx * cz) + ty).store(output.y.data() + i);
+            WideFloat::multiply_add(qw, cz, z + (qx * cy - qy * cx) + tz).store(output.z.data() + i);
+        }
+
+        for (; i < count; ++i)
+        {
+            Vec3 result = rotation.rotate(Vec3(input.x[i], input.y[i], input.z[i])) + translation;
+
+            output.x[i] = result.x();
+            output.y[i] = result.y();
+            output.z[i] = result.z();
+        }
+    }
+
+    /**
+     * @brief
+     * Rotates points or directions by a unit quaternion. The output may be
+     * the input itself, but must not partially overlap it.
+     * @param rotation The rotation, of unit length
+     * @param input The points to rotate
+     * @param output Where the rotated points are written
+     * @throws std::invalid_argument If the arrays differ in size
+     */
+    inline void rotate_points(const Quaternion<float> &rotation, const ConstSoaView &input,
+                              const SoaView &output)
+    {
+        rotate_translate_points(rotation, Vec3(), input, output);
+    }
+
+    /**
+     * @brief
+     * Scales directions to unit length with Fast::rsqrt, to within a
+     * relative error of 3e-7 (5e-6 without SIMD). The output may be the
+     * input itself, but must not partially overlap it.
+     * @param input The directions, none of which may be zero
+     * @param output Where the normalized directions are written
+     * @throws std::invalid_argument If the arrays differ in size
+     */
+    inline void normalize_directions(const ConstSoaView &input, const SoaView &output)
+    {
+        using Simd::WideFloat;
+
+        std::size_t count = Detail::batch_size(input, output);
+        constexpr std::size_t width = WideFloat::width;
+        std::size_t i = 0;
+
+        for (; i + width <= count; i += width)
+        {
+            WideFloat x = WideFloat::load(input.x.data() + i);
+            WideFloat y = WideFloat::load(input.y.data() + i);
+            WideFloat z = WideFloat::load(input.z.data() + i);
+            WideFloat scale = Fast::rsqrt(WideFloat::multiply_add(
+                x, x, WideFloat::multiply_add(y, y, z * z)));
+
+            (x * scale).store(output.x.data() + i);
+            (y * scale).store(output.y.data() + i);
+            (z * scale).store(output.z.data() + i);
+        }
+
+        for (; i < count; ++i)
+        {
+            float x = input.x[i], y = input.y[i], z = input.z[i];
+            float scale = Fast::rsqrt(Fast::Detail::multiply_add(x, x, Fast::Detail::multiply_add(y, y, z * z)));
+
+            output.x[i] = x * scale;
+            output.y[i] = y * scale;
+            output.z[i] = z * scale;
+        }
+    }
+
+    /**
+     * @brief
+     * Splits an array of points into one array per coordinate
+     * @param points The points to split
+     * @param output Where the coordinates are written
+     * @throws std::invalid_argument If the sizes differ
+     */
+    inline void aos_to_soa(std::span<const Vec3> points, const SoaView &output)
+    {
+        if (output.size() != points.size())
+            throw std::invalid_argument("Input and output must hold the same number of points");
+
+        for (std::size_t i = 0; i < points.size(); ++i)
+        {
+            output.x[i] = points[i].x();
+            output.y[i] = points[i].y();
+            output.z[i] = points[i].z();
+        }
+    }
+
+    /**
+     * @brief
+     * Gathers the x, y and z of interleaved records, such as vertices with
+     * further attributes after the position, into one array per coordinate
+     * @param records The interleaved floats
+     * @param stride Floats from the start of one record to the next
+     * @param offset Position of x within a record; y and z follow it
+     * @param output Where the coordinates are written, one per record
+     * @throws std::invalid_argument If the records do not fit the output
+     */
+    inline void aos_to_soa(std::span<const float> records, std::size_t stride,
+                           std::size_t offset, const SoaView &output)
+    {
+        std::size_t count = output.size();
+
+        if (offset + 3 > stride || records.size() < count * stride)
+            throw std::invalid_argument("Records do not hold a position for every point");
+
+        const float *record = records.data() + offset;
+
+        for (std::size_t i = 0; i < count; ++i, record += stride)
+        {
+            output.x[i] = record[0];
+            output.y[i] = record[1];
+            output.z[i] = record[2];
+        }
+    }
+
+    /**
+     * @brief
+     * Joins one array per coordinate into an array of points
+     * @param input The coordinates to join
+     * @param points Where the points are written
+     * @throws std::invalid_argument If the sizes differ
+     */
+    inline void soa_to_aos(const ConstSoaView &input, std::span<Vec3> points)
+    {
+        if (input.size() != points.size())
+            throw std::invalid_argument("Input and output must hold the same number of points");
+
+        for (std::size_t i = 0; i < points.size(); ++i)
+            points[i] = Vec3(input.x[i], input.y[i], input.z[i]);
+    }
+
+    /**
+     * @brief
+     * Scatters one array per coordinate into the positions of interleaved
+     * records, leaving the other floats of each record untouched
+     * @param input The coordinates to scatter
+     * @param records The interleaved floats
+     * @param stride Floats from the start of one record to the next
+     * @param offset Position of x within a record; y and z follow it
+     * @throws std::invalid_argument If the records do not fit the input
+     */
+    inline void soa_to_aos(const ConstSoaView &input, std::span<float> records,
+                           std::size_t stride, std::size_t offset)
+    {
+        std::size_t count = input.size();
+
+        if (offset + 3 > stride || records.size() < count * stride)
+            throw std::invalid_argument("Records do not hold a position for every point");
+
+        float *record = records.data() + offset;
+
+        for (std::size_t i = 0; i < count; ++i, record += stride)
+        {
+            record[0] = input.x[i];
+            record[1] = input.y[i];
+            record[2] = input.z[i];
+        }
+    }
+}
@@ -0,0 +1,797 @@
+/**
+ * @file decomposition.h
+ * @author Carlos Salguero
+ * @brief LU, Cholesky and QR decompositions and the solvers built on them
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// Project files
+#include "gemm.h"
+#include "matrix.h"
+#include "simd.h"
+#include "vector.h"
+
+namespace Math
+{
+    namespace Detail
+    {
+        // Columns per panel of the blocked LU. The panel is factored with
+        // row operations and the rest of the matrix is updated with one
+        // GEMM per panel, which does most of the work in cache blocks.
+        inline constexpr std::size_t LU_BLOCK = 64;
+
+        /**
+         * @brief
+         * Copies a matrix into row-major storage
+         * @tparam T Type of the elements
+         * @tparam Layout Storage order of the matrix
+         * @param matrix The matrix to copy
+         * @return Matrix<T> The row-major copy
+         */
+        template <class T, MatrixLayout Layout>
+        Matrix<T> to_row_major(const Matrix<T, Layout> &matrix)
+        {
+            if constexpr (Layout == MatrixLayout::RowMajor)
+                return matrix;
+            else
+            {
+                Matrix<T> result(matrix.rows(), matrix.cols());
+
+                for (std::size_t i = 0; i < matrix.rows(); ++i)
+                    for (std::size_t j = 0; j < matrix.cols(); ++j)
+                        result.data()[result.index_of(i, j)] =
+                            matrix.data()[matrix.index_of(i, j)];
+
+                return result;
+            }
+        }
+
+        /**
+         * @brief
+         * Copies a row-major matrix into the given layout
+         * @tparam Layout Storage order of the result
+         * @tparam T Type of the elements
+         * @param matrix The row-major matrix
+         * @return Matrix<T, Layout> The copy
+         */
+        template <MatrixLayout Layout, class T>
+        Matrix<T, Layout> from_row_major(Matrix<T> &&matrix)
+        {
+            if constexpr (Layout == MatrixLayout::RowMajor)
+                return std::move(matrix);
+            else
+            {
+                Matrix<T, Layout> result(matrix.rows(), matrix.cols());
+
+                for (std::size_t i = 0; i < matrix.rows(); ++i)
+                    for (std::size_t j = 0; j < matrix.cols(); ++j)
+                        result.data()[result.index_of(i, j)] =
+                            matrix.data()[matrix.index_of(i, j)];
+
+                return result;
+            }
+        }
+    }
+
+    /**
+     * @class LuDecomposition
+     * @brief PA = LU of a square matrix, with partial pivoting. L has a unit
+     *        diagonal and is stored with U in one matrix.
+     * @tparam T Type of the elements
+     */
+    template <class T>
+    class LuDecomposition
+    {
+    public:
+        // Constructors
+        /**
+         * @brief
+         * Factors a square matrix. Panels of LU_BLOCK columns are factored
+         * in turn and the trailing matrix is updated with the blocked GEMM,
+         * spread over the thread pool when one is given. A singular matrix
+         * is factored all the same; solving with it throws.
+         * @tparam Layout Storage order of the matrix
+         * @param matrix The matrix to factor
+         * @param thread_pool Thread pool for the trailing updates, or nullptr
+         * @throws std::invalid_argument If the matrix is not square
+         */
+        template <MatrixLayout Layout>
+        explicit LuDecomposition(const Matrix<T, Layout> &matrix,
+                                 ThreadPool *thread_pool = nullptr)
+            : m_lu(Detail::to_row_major(matrix)), m_pivots(matrix.rows())
+        {
+            if (matrix.rows() != matrix.cols())
+                throw std::invalid_argument("LU decomposition needs a square matrix");
+
+            factor(thread_pool);
+        }
+
+        // Access Methods
+        /**
+         * @brief
+         * Gets L and U packed in one matrix: U on and above the diagonal,
+         * L below it
+         * @return const Matrix<T>& The packed factors
+         */
+        const Matrix<T> &packed() const
+        {
+            return m_lu;
+        }
+
+        /**
+         * @brief
+         * Gets the row swapped with each row during the elimination
+         * @return const std::vector<std::size_t>& The pivot of every row
+         */
+        const std::vector<std::size_t> &pivots() const
+        {
+            return m_pivots;
+        }
+
+        // Methods
+        /**
+         * @brief
+         * Checks whether a zero pivot was found
+         * @return true If the matrix is singular
+         * @return false Otherwise
+         */
+        bool is_singular() const
+        {
+            return m_singular;
+        }
+
+        /**
+         * @brief
+         * Calculates the determinant from the diagonal of U
+         * @return T The determinant
+         */
+        T determinant() const
+        {
+            T result = m_sign;
+
+            for (std::size_t i = 0; i < m_lu.rows(); ++i)
+                result *= m_lu.data()[i * m_lu.cols() + i];
+
+            return result;
+        }
+
+        /**
+         * @brief
+         * Solves A x = b
+         * @param b The right-hand side
+         * @return Vector<T> The solution
+         * @throws std::invalid_argument If the sizes differ or A is singular
+         */
+        Vector<T> solve(const Vector<T> &b) const
+        {
+            std::size_t n = m_lu.rows();
+
+            if (b.size() != n)
+                throw std::invalid_argument("Right-hand side size does not match");
+
+            Matrix<T> x(n, 1);
+
+            for (std::size_t i = 0; i < n; ++i)
+                x.data()[i] = b[i];
+
+            solve_in_place(x);
+
+            Vector<T> result(n);
+
+            for (std::size_t i = 0; i < n; ++i)
+                result[i] = x.data()[i];
+
+            return result;
+        }
+
+        /**
+         * @brief
+         * Solves A X = B for every column of B at once
+         * @tparam Layout Storage order of B
+         * @param b The right-hand sides
+         * @return Matrix<T, Layout> The solutions
+         * @throws std::invalid_argument If the sizes differ or A is singular
+         */
+        template <MatrixLayout Layout>
+        Matrix<T, Layout> solve(const Matrix<T, Layout> &b) const
+        {
+            if (b.rows() != m_lu.rows())
+                throw std::invalid_argument("Right-hand side size does not match");
+
+            Matrix<T> x = Detail::to_row_major(b);
+            solve_in_place(x);
+
+            return Detail::from_row_major<Layout>(std::move(x));
+        }
+
+        /**
+         * @brief
+         * Calculates the inverse by solving for the identity
+         * @return Matrix<T> The inverse matrix
+         * @throws std::invalid_argument If the matrix is singular
+         */
+        Matrix<T> inverse() const
+        {
+            std::size_t n = m_lu.rows();
+            Matrix<T> result(n, n);
+
+            for (std::size_t i = 0; i < n; ++i)
+                result.data()[i * n + i] = T(1);
+
+            solve_in_place(result);
+            return result;
+        }
+
+    private:
+        Matrix<T> m_lu;
+        std::vector<std::size_t> m_pivots;
+        T m_sign = T(1);
+        bool m_singular = false;
+
+        // Methods (private)
+        /**
+         * @brief
+         * Runs the blocked elimination on m_lu
+         * @param thread_pool Thread pool for the trailing updates, or nullptr
+         */
+        void factor(ThreadPool *thread_pool)
+        {
+            std::size_t n = m_lu.rows();
+            T *a = m_lu.data();
+            std::vector<T, AlignedAllocator<T>> product;
+
+            for (std::size_t k0 = 0; k0 < n; k0 += Detail::LU_BLOCK)
+            {
+                std::size_t k1 = std::min(k0 + Detail::LU_BLOCK, n);
+
+                // Panel: eliminate below the diagonal of columns k0..k1,
+                // updating only the columns of the panel
+                for (std::size_t k = k0; k < k1; ++k)
+                {
+                    std::size_t pivot = k;
+
+                    for (std::size_t i = k + 1; i < n; ++i)
+                        if (std::abs(a[i * n + k]) > std::abs(a[pivot * n + k]))
+                            pivot = i;
+
+                    m_pivots[k] = pivot;
+
+                    if (pivot != k)
+                    {
+                        std::swap_ranges(a + k * n, a + (k + 1) * n, a + pivot * n);
+                        m_sign = -m_sign;
+                    }
+
+                    T diagonal = a[k * n + k];
+
+                    if (diagonal == T())
+                    {
+                        m_singular = true;
+                        continue;
+                    }
+
+                    for (std::size_t i = k + 1; i < n; ++i)
+                    {
+                        T *row = a + i * n;
+                        T factor = row[k] /= diagonal;
+
+                        for (std::size_t j = k + 1; j < k1; ++j)
+                            row[j] -= factor * a[k * n + j];
+                    }
+                }
+
+                if (k1 == n)
+                    break;
+
+                // U12 = L11^-1 A12, row by row
+                for (std::size_t k = k0; k < k1; ++k)
+                    for (std::size_t i = k + 1; i < k1; ++i)
+                    {
+                        T factor = a[i * n + k];
+
+                        for (std::size_t j = k1; j < n; ++j)
+                            a[i * n + j] -= factor * a[k * n + j];
+                    }
+
+                // A22 -= L21 U12
+                std::size_t rest = n - k1;
+                product.resize(rest * rest);
+                gemm(rest, rest, k1 - k0, a + k1 * n + k0, n, a + k0 * n + k1, n,
+                     product.data(), rest, thread_pool);
+
+                for (std::size_t i = 0; i < rest; ++i)
+                {
+                    T *row = a + (k1 + i) * n + k1;
+                    const T *update = product.data() + i * rest;
+
+                    for (std::size_t j = 0; j < rest; ++j)
+                        row[j] -= update[j];
+                }
+            }
+        }
+
+        /**
+         * @brief
+         * Overwrites B with the solution of A X = B
+         * @param b The right-hand sides, row-major
+         * @throws std::invalid_argument If the matrix is singular
+         */
+        void solve_in_place(Matrix<T> &b) const
+        {
+            if (m_singular)
+                throw std::invalid_argument("Matrix is singular");
+
+            std::size_t n = m_lu.rows();
+            std::size_t m = b.cols();
+            const T *a = m_lu.data();
+            T *x = b.data();
+
+            for (std::size_t i = 0; i < n; ++i)
+                if (m_pivots[i] != i)
+                    std::swap_ranges(x + i * m, x + (i + 1) * m, x + m_pivots[i] * m);
+
+            // Forward substitution with the unit lower triangle
+            for (std::size_t i = 1; i < n; ++i)
+                for (std::size_t k = 0; k < i; ++k)
+                {
+                    T factor = a[i * n + k];
+
+                    for (std::size_t j = 0; j < m; ++j)
+                        x[i * m + j] -= factor * x[k * m + j];
+                }
+
+            // Back substitution with the upper triangle
+            for (std::size_t i = n; i-- > 0;)
+            {
+                for (std::size_t k = i + 1; k < n; ++k)
+                {
+                    T factor = a[i * n + k];
+
+                    for (std::size_t j = 0; j < m; ++j)
+                        x[i * m + j] -= factor * x[k * m + j];
+                }
+
+                T diagonal = a[i * n + i];
+
+                for (std::size_t j = 0; j < m; ++j)
+                    x[i * m + j] /= diagonal;
+            }
+        }
+    };
+
+    /**
+     * @class CholeskyDecomposition
+     * @brief A = L L^T of a symmetric positive definite matrix. About half
+     *        the work of LU and needs no pivoting.
+     * @tparam T Type of the elements
+     */
+    template <class T>
+    class CholeskyDecomposition
+    {
+    public:
+        // Constructors
+        /**
+         * @brief
+         * Factors a symmetric positive definite matrix. Only the lower
+         * triangle is read. Each element of L is a dot product of two rows
+         * of L, which are contiguous in the row-major factor.
+         * @tparam Layout Storage order of the matrix
+         * @param matrix The matrix to factor
+         * @throws std::invalid_argument If the matrix is not square or not
+         * positive definite
+         */
+        template <MatrixLayout Layout>
+        explicit CholeskyDecomposition(const Matrix<T, Layout> &matrix)
+            : m_lower(Detail::to_row_major(matrix))
+        {
+            if (matrix.rows() != matrix.cols())
+                throw std::invalid_argument("Cholesky decomposition needs a square matrix");
+
+            std::size_t n = m_lower.rows();
+            T *l = m_lower.data();
+
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                T *row_i = l + i * n;
+
+                for (std::size_t j = 0; j <= i; ++j)
+                {
+                    const T *row_j = l + j * n;
+                    T sum = row_i[j];
+
+                    for (std::size_t k = 0; k < j; ++k)
+                        sum -= row_i[k] * row_j[k];
+
+                    if (i == j)
+                    {
+                        if (!(sum > T()))
+                            throw std::invalid_argument("Matrix is not positive definite");
+
+                        row_i[i] = std::sqrt(sum);
+                    }
+                    else
+                        row_i[j] = sum / row_j[j];
+                }
+
+                std::fill(row_i + i + 1, row_i + n, T());
+            }
+        }
+
+        // Access Methods
+        /**
+         * @brief
+         * Gets the lower triangular factor
+         * @return const Matrix<T>& L
+         */
+        const Matrix<T> &lower() const
+        {
+            return m_lower;
+        }
+
+        // Methods
+        /**
+         * @brief
+         * Calculates the determinant, the squared product of the diagonal
+         * of L
+         * @return T The determinant
+         */
+        T determinant() const
+        {
+            T result = T(1);
+
+            for (std::size_t i = 0; i < m_lower.rows(); ++i)
+                result *= m_lower.data()[i * m_lower.cols() + i];
+
+            return result * result;
+        }
+
+        /**
+         * @brief
+         * Solves A x = b with a forward and a backward substitution
+         * @param b The right-hand side
+         * @return Vector<T> The solution
+         * @throws std::invalid_argument If the sizes differ
+         */
+        Vector<T> solve(const Vector<T> &b) const
+        {
+            std::size_t n = m_lower.rows();
+
+            if (b.size() != n)
+                throw std::invalid_argument("Right-hand side size does not match");
+
+            const T *l = m_lower.data();
+            Vector<T> x = b;
+
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                T sum = x[i];
+
+                for (std::size_t k = 0; k < i; ++k)
+                    sum -= l[i * n + k] * x[k];
+
+                x[i] = sum / l[i * n + i];
+            }
+
+            // L^T is upper triangular; its rows are the columns of L, so
+            // the update runs down a row of L for each solved element
+            for (std::size_t i = n; i-- > 0;)
+            {
+                x[i] /= l[i * n + i];
+
+                for (std::size_t k = 0; k < i; ++k)
+                    x[k] -= l[i * n + k] * x[i];
+            }
+
+            return x;
+        }
+
+    private:
+        Matrix<T> m_lower;
+    };
+
+    /**
+     * @class QrDecomposition
+     * @brief A = QR of a matrix with at least as many rows as columns, by
+     *        Householder reflections. Solves least squares problems.
+     * @tparam T Type of the elements
+     */
+    template <class T>
+    class QrDecomposition
+    {
+    public:
+        // Constructors
+        /**
+         * @brief
+         * Factors a matrix. The work is done in column-major storage so
+         * that each reflection reads and updates contiguous columns.
+         * @tparam Layout Storage order of the matrix
+         * @param matrix The matrix to factor
+         * @throws std::invalid_argument If it has fewer rows than columns
+         */
+        template <MatrixLayout Layout>
+        explicit QrDecomposition(const Matrix<T, Layout> &matrix)
+            : m_qr(matrix.rows(), matrix.cols()), m_diagonal(matrix.cols())
+        {
+            if (matrix.rows() < matrix.cols())
+                throw std::invalid_argument("QR decomposition needs at least as many rows as columns");
+
+            std::size_t m = matrix.rows();
+            std::size_t n = matrix.cols();
+
+            for (std::size_t i = 0; i < m; ++i)
+                for (std::size_t j = 0; j < n; ++j)
+                    m_qr.data()[m_qr.index_of(i, j)] = matrix.data()[matrix.index_of(i, j)];
+
+            for (std::size_t k = 0; k < n; ++k)
+            {
+                T *v = column(k) + k;
+                T norm = T();
+
+                for (std::size_t i = 0; i < m - k; ++i)
+                    norm += v[i] * v[i];
+
+                norm = std::sqrt(norm);
+
+                // Reflect x onto -sign(x0) |x| e0, the choice that avoids
+                // cancellation in v0 = x0 - alpha
+                T alpha = v[0] > T() ? -norm : norm;
+                m_diagonal[k] = alpha;
+
+                if (norm == T())
+                    continue;
+
+                v[0] -= alpha;
+
+                // H = I - 2 v v^T / (v^T v), with v^T v = 2 norm |v0|
+                T beta = T(1) / (norm * std::abs(v[0]));
+
+                for (std::size_t j = k + 1; j < n; ++j)
+                {
+                    T *c = column(j) + k;
+                    T dot = T();
+
+                    for (std::size_t i = 0; i < m - k; ++i)
+                        dot += v[i] * c[i];
+
+                    dot *= beta;
+
+                    for (std::size_t i = 0; i < m - k; ++i)
+                        c[i] -= dot * v[i];
+                }
+            }
+        }
+
+        // Methods
+        /**
+         * @brief
+         * Checks whether R has a zero on its diagonal
+         * @return true If the columns are linearly independent
+         * @return false Otherwise
+         */
+        bool is_full_rank() const
+        {
+            return std::none_of(m_diagonal.begin(), m_diagonal.end(),
+                                [](const T &value)
+                                { return value == T(); });
+        }
+
+        /**
+         * @brief
+         * Gets the upper triangular factor R
+         * @return Matrix<T> The n x n factor R
+         */
+        Matrix<T> r() const
+        {
+            std::size_t n = m_qr.cols();
+            Matrix<T> result(n, n);
+
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                result.data()[i * n + i] = m_diagonal[i];
+
+                for (std::size_t j = i + 1; j < n; ++j)
+                    result.data()[i * n + j] = m_qr.data()[m_qr.index_of(i, j)];
+            }
+
+            return result;
+        }
+
+        /**
+         * @brief
+         * Forms the orthonormal factor Q by applying the reflections to
+         * the first columns of the identity
+         * @return Matrix<T> The m x n factor Q
+         */
+        Matrix<T> q() const
+        {
+            std::size_t m = m_qr.rows();
+            std::size_t n = m_qr.cols();
+            Matrix<T, MatrixLayout::ColumnMajor> result(m, n);
+
+            for (std::size_t j = 0; j < n; ++j)
+            {
+                T *c = result.data() + j * m;
+                c[j] = T(1);
+
+                for (std::size_t k = n; k-- > 0;)
+                    reflect(k, c);
+            }
+
+            Matrix<T> row_major(m, n);
+
+            for (std::size_t i = 0; i < m; ++i)
+                for (std::size_t j = 0; j < n; ++j)
+                    row_major.data()[i * n + j] = result.data()[j * m + i];
+
+            return row_major;
+        }
+
+        /**
+         * @brief
+         * Finds the x that minimizes |A x - b|, which solves A x = b when
+         * A is square
+         * @param b The right-hand side
+         * @return Vector<T> The least squares solution
+         * @throws std::invalid_argument If the sizes differ or A is rank
+         * deficient
+         */
+        Vector<T> solve(const Vector<T> &b) const
+        {
+            std::size_t m = m_qr.rows();
+            std::size_t n = m_qr.cols();
+
+            if (b.size() != m)
+                throw std::invalid_argument("Right-hand side size does not match");
+
+            if (!is_full_rank())
+                throw std::invalid_argument("Matrix is rank deficient");
+
+            // y = Q^T b, then R x = y
+            std::vector<T> y(m);
+
+            for (std::size_t i = 0; i < m; ++i)
+                y[i] = b[i];
+
+            for (std::size_t k = 0; k < n; ++k)
+                reflect(k, y.data());
+
+            Vector<T> x(n);
+
+            for (std::size_t i = n; i-- > 0;)
+            {
+                T sum = y[i];
+
+                for (std::size_t j = i + 1; j < n; ++j)
+                    sum -= m_qr.data()[m_qr.index_of(i, j)] * x[j];
+
+                x[i] = sum / m_diagonal[i];
+            }
+
+            return x;
+        }
+
+    private:
+        Matrix<T, MatrixLayout::ColumnMajor> m_qr;
+        std::vector<T> m_diagonal;
+
+        // Methods (private)
+        T *column(std::size_t j)
+        {
+            return m_qr.data() + j * m_qr.rows();
+        }
+
+        /**
+         * @brief
+         * Applies the k-th reflection to a vector of m elements
+         * @param k The index of the reflection
+         * @param x The vector, updated in place
+         */
+        void reflect(std::size_t k, T *x) const
+        {
+            std::size_t m = m_qr.rows();
+            const T *v = m_qr.data() + k * m + k;
+            T norm = std::abs(m_diagonal[k]);
+
+            if (norm == T())
+                return;
+
+            T beta = T(1) / (norm * std::abs(v[0]));
+            T dot = T();
+
+            for (std::size_t i = 0; i < m - k; ++i)
+                dot += v[i] * x[k + i];
+
+            dot *= beta;
+
+            for (std::size_t i = 0; i < m - k; ++i)
+                x[k + i] -= dot * v[i];
+        }
+    };
+
+    /**
+     * @brief
+     * Solves A x = b for a square matrix with LU
+     * @tparam T Type of the elements
+     * @tparam Layout Storage order of the matrix
+     * @param a The matrix
+     * @param b The right-hand side
+     * @return Vector<T> The solution
+     * @throws std::invalid_argument If A is not square, the sizes differ or
+     * A is singular
+     */
+    template <class T, MatrixLayout Layout>
+    Vector<T> solve(const Matrix<T, Layout> &a, const Vector<T> &b)
+    {
+        return LuDecomposition<T>(a).solve(b);
+    }
+
+    /**
+     * @brief
+     * Calculates the inverse of a square matrix with LU
+     * @tparam T Type of the elements
+     * @tparam Layout Storage order of the matrix
+     * @param matrix The matrix
+     * @param thread_pool Thread pool for the factorization, or nullptr
+     * @return Matrix<T, Layout> The inverse matrix
+     * @throws std::invalid_argument If the matrix is not square or singular
+     */
+    template <class T, MatrixLayout Layout>
+    Matrix<T, Layout> inverse(const Matrix<T, Layout> &matrix, ThreadPool *thread_pool = nullptr)
+    {
+        return Detail::from_row_major<Layout>(LuDecomposition<T>(matrix, thread_pool).inverse());
+    }
+
+    /**
+     * @brief
+     * Calculates the determinant of a square matrix with LU
+     * @tparam T Type of the elements
+     * @tparam Layout Storage order of the matrix
+     * @param matrix The matrix
+     * @return T The determinant
+     * @throws std::invalid_argument If the matrix is not square
+     */
+    template <class T, MatrixLayout Layout>
+    T determinant(const Matrix<T, Layout> &matrix)
+    {
+        return LuDecomposition<T>(matrix).determinant();
+    }
+
+    /**
+     * @brief
+     * Inverts a 4x4 matrix with the closed-form SIMD block method
+     * @param matrix The matrix
+     * @return Mat4 The inverse matrix
+     * @throws std::invalid_argument If the matrix is singular
+     */
+    inline Mat4 inverse(const Mat4 &matrix)
+    {
+        return Simd::Float4x4(matrix).inverse().to_mat();
+    }
+
+    /**
+     * @brief
+     * Inverts an affine 4x4 matrix, whose last row is (0, 0, 0, 1), such as
+     * a model or view transform
+     * @param matrix The matrix
+     * @return Mat4 The inverse matrix
+     * @throws std::invalid_argument If the 3x3 block is singular
+     */
+    inline Mat4 affine_inverse(const Mat4 &matrix)
+    {
+        return Simd::Float4x4(matrix).affine_inverse().to_mat();
+    }
+}
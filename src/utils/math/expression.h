@@ -0,0 +1,600 @@
+/**
+ * @file expression.h
+ * @author Carlos Salguero
+ * @brief Expression templates for element-wise Vector and Matrix arithmetic
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#pragma once
+
+// C++ Standard Library
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <concepts>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace Math
+{
+    // Arithmetic on vectors and matrices returns lightweight expression
+    // objects instead of results. Nothing is computed until an expression is
+    // assigned to a Vector or Matrix, which then evaluates every element of
+    // the whole expression in a single loop into a single allocation.
+    //
+    // Expressions keep references to the named vectors and matrices they
+    // use, and own their temporaries and sub-expressions, so an expression
+    // stored with auto stays valid as long as the variables it names. It
+    // still reads them when evaluated: eval() takes a snapshot. Members such
+    // as magnitude() or transpose() evaluate the expression and forward to
+    // the result. Elements of an expression are read-only; eval() or an
+    // assignment to a Vector or Matrix gives a copy that can be written.
+
+    /**
+     * @class VectorExpression
+     * @brief Base of every vector expression. Derived classes provide
+     *        size() and operator[].
+     * @tparam Derived The derived expression
+     */
+    template <class Derived>
+    class VectorExpression
+    {
+    public:
+        // Access Methods
+        const Derived &self() const
+        {
+            return static_cast<const Derived &>(*this);
+        }
+
+        std::size_t size() const
+        {
+            return self().size();
+        }
+
+        auto operator[](std::size_t index) const
+        {
+            return self()[index];
+        }
+
+        // Methods
+        /**
+         * @brief
+         * Evaluates the expression into a new vector
+         * @return Vector The result of the expression
+         */
+        auto eval() const
+        {
+            return typename Derived::result_type(self());
+        }
+
+        auto magnitude() const
+        {
+            return eval().magnitude();
+        }
+
+        auto squared_magnitude() const
+        {
+            return eval().squared_magnitude();
+        }
+
+        auto unit_vector() const
+        {
+            return eval().unit_vector();
+        }
+
+        auto normalize() const
+        {
+            return eval().normalize();
+        }
+
+        template <class V>
+        auto dot(const V &other) const
+        {
+            return eval().dot(other);
+        }
+
+        template <class V>
+        auto cross(const V &other) const
+        {
+            return eval().cross(other);
+        }
+
+        template <class V>
+        auto angle(const V &other) const
+        {
+            return eval().angle(other);
+        }
+
+        template <class V, class T>
+        auto lerp(const V &other, const T &t) const
+        {
+            return eval().lerp(other, t);
+        }
+
+        template <class V, class T>
+        auto cubic_interpolation(const V &other, const T &t) const
+        {
+            return eval().cubic_interpolation(other, t);
+        }
+    };
+
+    /**
+     * @class MatrixExpression
+     * @brief Base of every matrix expression. Derived classes provide rows(),
+     *        cols() and element(), which reads an element by its position in
+     *        storage order.
+     * @tparam Derived The derived expression
+     */
+    template <class Derived>
+    class MatrixExpression
+    {
+    public:
+        // Access Methods
+        const Derived &self() const
+        {
+            return static_cast<const Derived &>(*this);
+        }
+
+        std::size_t rows() const
+        {
+            return self().rows();
+        }
+
+        std::size_t cols() const
+        {
+            return self().cols();
+        }
+
+        auto element(std::size_t index) const
+        {
+            return self().element(index);
+        }
+
+        /**
+         * @brief
+         * Computes the element at the specified position
+         * @param row The row of the element
+         * @param col The column of the element
+         * @return value_type The element
+         * @throws std::out_of_range If the position is out of bounds
+         */
+        auto operator()(std::size_t row, std::size_t col) const
+        {
+            return self().element(index_of(row, col));
+        }
+
+        auto at(std::size_t row, std::size_t col) const
+        {
+            return (*this)(row, col);
+        }
+
+        std::size_t size() const
+        {
+            return rows() * cols();
+        }
+
+        /**
+         * @brief
+         * Gets the position of an element in storage order
+         * @param row The row of the element
+         * @param col The column of the element
+         * @return std::size_t The position of the element
+         * @throws std::out_of_range If the position is out of bounds
+         */
+        std::size_t index_of(std::size_t row, std::size_t col) const
+        {
+            using Layout = std::remove_cv_t<decltype(Derived::layout)>;
+
+            if (row >= rows() || col >= cols())
+                throw std::out_of_range("Matrix subscript out of range");
+
+            return Derived::layout == Layout::RowMajor ? row * cols() + col : col * rows() + row;
+        }
+
+        bool empty() const
+        {
+            return size() == 0;
+        }
+
+        // Methods
+        /**
+         * @brief
+         * Evaluates the expression into a new matrix
+         * @return Matrix The result of the expression
+         */
+        auto eval() const
+        {
+            return typename Derived::result_type(self());
+        }
+
+        auto transpose() const
+        {
+            return eval().transpose();
+        }
+
+        template <class M, class... Args>
+        auto multiply(const M &other, Args... args) const
+        {
+            return eval().multiply(other, args...);
+        }
+    };
+
+    namespace Detail
+    {
+        template <class E>
+        concept vector_expression =
+            std::derived_from<std::remove_cvref_t<E>, VectorExpression<std::remove_cvref_t<E>>>;
+
+        template <class E>
+        concept matrix_expression =
+            std::derived_from<std::remove_cvref_t<E>, MatrixExpression<std::remove_cvref_t<E>>>;
+
+        template <class E>
+        using expression_value_t = typename std::remove_cvref_t<E>::value_type;
+
+        /**
+         * @brief
+         * How an expression node holds an operand, from the type its
+         * operator deduced: named vectors and matrices by reference,
+         * temporaries and sub-expressions by value
+         * @tparam E Type of the operand, a reference for lvalues
+         */
+        template <class E>
+        using expression_operand_t =
+            std::conditional_t<std::remove_cvref_t<E>::is_container && std::is_lvalue_reference_v<E>,
+                               const std::remove_cvref_t<E> &, std::remove_cvref_t<E>>;
+
+        /**
+         * @brief
+         * Applies an operation with a scalar on the right: x op scalar
+         * @tparam Op Type of the operation
+         * @tparam T Type of the scalar
+         */
+        template <class Op, class T>
+        struct ScalarRight
+        {
+            T scalar;
+
+            T operator()(const T &value) const
+            {
+                return Op()(value, scalar);
+            }
+        };
+
+        /**
+         * @brief
+         * Applies an operation with a scalar on the left: scalar op x
+         * @tparam Op Type of the operation
+         * @tparam T Type of the scalar
+         */
+        template <class Op, class T>
+        struct ScalarLeft
+        {
+            T scalar;
+
+            T operator()(const T &value) const
+            {
+                return Op()(scalar, value);
+            }
+        };
+    }
+
+    /**
+     * @class VectorBinaryExpression
+     * @brief Element-wise operation between two vector expressions
+     * @tparam L How the left operand is held
+     * @tparam R How the right operand is held
+     * @tparam Op Type of the operation
+     */
+    template <class L, class R, class Op>
+    class VectorBinaryExpression
+        : public VectorExpression<VectorBinaryExpression<L, R, Op>>
+    {
+    public:
+        // Type aliases
+        using value_type = Detail::expression_value_t<L>;
+        using result_type = typename std::remove_cvref_t<L>::result_type;
+        static constexpr bool is_container = false;
+
+        // Constructors
+        /**
+         * @brief
+         * Construct a new Vector Binary Expression object
+         * @param left The left operand
+         * @param right The right operand
+         * @throws std::invalid_argument If the operands differ in size
+         */
+        template <class A, class B>
+        VectorBinaryExpression(A &&left, B &&right)
+            : m_left(std::forward<A>(left)), m_right(std::forward<B>(right))
+        {
+            if (m_left.size() != m_right.size())
+                throw std::invalid_argument("Vectors must be the same size");
+        }
+
+        // Operators
+        value_type operator[](std::size_t index) const
+        {
+            return Op()(m_left[index], m_right[index]);
+        }
+
+        // Access Methods
+        std::size_t size() const
+        {
+            return m_left.size();
+        }
+
+    private:
+        L m_left;
+        R m_right;
+    };
+
+    /**
+     * @class VectorUnaryExpression
+     * @brief Operation applied to every element of a vector expression
+     * @tparam E How the operand is held
+     * @tparam F Type of the function applied to each element
+     */
+    template <class E, class F>
+    class VectorUnaryExpression
+        : public VectorExpression<VectorUnaryExpression<E, F>>
+    {
+    public:
+        // Type aliases
+        using value_type = Detail::expression_value_t<E>;
+        using result_type = typename std::remove_cvref_t<E>::result_type;
+        static constexpr bool is_container = false;
+
+        // Constructors
+        template <class A>
+        VectorUnaryExpression(A &&operand, F function)
+            : m_operand(std::forward<A>(operand)), m_function(function) {}
+
+        // Operators
+        value_type operator[](std::size_t index) const
+        {
+            return m_function(m_operand[index]);
+        }
+
+        // Access Methods
+        std::size_t size() const
+        {
+            return m_operand.size();
+        }
+
+    private:
+        E m_operand;
+        F m_function;
+    };
+
+    /**
+     * @class MatrixBinaryExpression
+     * @brief Element-wise operation between two matrix expressions with the
+     *        same layout
+     * @tparam L How the left operand is held
+     * @tparam R How the right operand is held
+     * @tparam Op Type of the operation
+     */
+    template <class L, class R, class Op>
+    class MatrixBinaryExpression
+        : public MatrixExpression<MatrixBinaryExpression<L, R, Op>>
+    {
+        static_assert(std::remove_cvref_t<L>::layout == std::remove_cvref_t<R>::layout,
+                      "Matrices must have the same layout");
+
+    public:
+        // Type aliases
+        using value_type = Detail::expression_value_t<L>;
+        using result_type = typename std::remove_cvref_t<L>::result_type;
+        static constexpr bool is_container = false;
+        static constexpr auto layout = std::remove_cvref_t<L>::layout;
+
+        // Constructors
+        /**
+         * @brief
+         * Construct a new Matrix Binary Expression object
+         * @param left The left operand
+         * @param right The right operand
+         * @throws std::invalid_argument If the operands differ in size
+         */
+        template <class A, class B>
+        MatrixBinaryExpression(A &&left, B &&right)
+            : m_left(std::forward<A>(left)), m_right(std::forward<B>(right))
+        {
+            if (m_left.rows() != m_right.rows() || m_left.cols() != m_right.cols())
+                throw std::invalid_argument("Matrices must be the same size");
+        }
+
+        // Operators
+        using MatrixExpression<MatrixBinaryExpression>::operator();
+
+        // Access Methods
+        std::size_t rows() const
+        {
+            return m_left.rows();
+        }
+
+        std::size_t cols() const
+        {
+            return m_left.cols();
+        }
+
+        value_type element(std::size_t index) const
+        {
+            return Op()(m_left.element(index), m_right.element(index));
+        }
+
+    private:
+        L m_left;
+        R m_right;
+    };
+
+    /**
+     * @class MatrixUnaryExpression
+     * @brief Operation applied to every element of a matrix expression
+     * @tparam E How the operand is held
+     * @tparam F Type of the function applied to each element
+     */
+    template <class E, class F>
+    class MatrixUnaryExpression
+        : public MatrixExpression<MatrixUnaryExpression<E, F>>
+    {
+    public:
+        // Type aliases
+        using value_type = Detail::expression_value_t<E>;
+        using result_type = typename std::remove_cvref_t<E>::result_type;
+        static constexpr bool is_container = false;
+        static constexpr auto layout = std::remove_cvref_t<E>::layout;
+
+        // Constructors
+        template <class A>
+        MatrixUnaryExpression(A &&operand, F function)
+            : m_operand(std::forward<A>(operand)), m_function(function) {}
+
+        // Operators
+        using MatrixExpression<MatrixUnaryExpression>::operator();
+
+        // Access Methods
+        std::size_t rows() const
+        {
+            return m_operand.rows();
+        }
+
+        std::size_t cols() const
+        {
+            return m_operand.cols();
+        }
+
+        value_type element(std::size_t index) const
+        {
+            return m_function(m_operand.element(index));
+        }
+
+    private:
+        E m_operand;
+        F m_function;
+    };
+
+    // Vector operators
+    template <Detail::vector_expression L, Detail::vector_expression R>
+    VectorBinaryExpression<Detail::expression_operand_t<L>, Detail::expression_operand_t<R>, std::plus<>>
+    operator+(L &&left, R &&right)
+    {
+        return {std::forward<L>(left), std::forward<R>(right)};
+    }
+
+    template <Detail::vector_expression L, Detail::vector_expression R>
+    VectorBinaryExpression<Detail::expression_operand_t<L>, Detail::expression_operand_t<R>, std::minus<>>
+    operator-(L &&left, R &&right)
+    {
+        return {std::forward<L>(left), std::forward<R>(right)};
+    }
+
+    template <Detail::vector_expression L, Detail::vector_expression R>
+    VectorBinaryExpression<Detail::expression_operand_t<L>, Detail::expression_operand_t<R>, std::multiplies<>>
+    operator*(L &&left, R &&right)
+    {
+        return {std::forward<L>(left), std::forward<R>(right)};
+    }
+
+    template <Detail::vector_expression L, Detail::vector_expression R>
+    VectorBinaryExpression<Detail::expression_operand_t<L>, Detail::expression_operand_t<R>, std::divides<>>
+    operator/(L &&left, R &&right)
+    {
+        return {std::forward<L>(left), std::forward<R>(right)};
+    }
+
+    template <Detail::vector_expression E>
+    VectorUnaryExpression<Detail::expression_operand_t<E>, Detail::ScalarRight<std::plus<>, Detail::expression_value_t<E>>>
+    operator+(E &&vector, const Detail::expression_value_t<E> &scalar)
+    {
+        return {std::forward<E>(vector), {scalar}};
+    }
+
+    template <Detail::vector_expression E>
+    VectorUnaryExpression<Detail::expression_operand_t<E>, Detail::ScalarRight<std::minus<>, Detail::expression_value_t<E>>>
+    operator-(E &&vector, const Detail::expression_value_t<E> &scalar)
+    {
+        return {std::forward<E>(vector), {scalar}};
+    }
+
+    template <Detail::vector_expression E>
+    VectorUnaryExpression<Detail::expression_operand_t<E>, Detail::ScalarRight<std::multiplies<>, Detail::expression_value_t<E>>>
+    operator*(E &&vector, const Detail::expression_value_t<E> &scalar)
+    {
+        return {std::forward<E>(vector), {scalar}};
+    }
+
+    template <Detail::vector_expression E>
+    VectorUnaryExpression<Detail::expression_operand_t<E>, Detail::ScalarLeft<std::multiplies<>, Detail::expression_value_t<E>>>
+    operator*(const Detail::expression_value_t<E> &scalar, E &&vector)
+    {
+        return {std::forward<E>(vector), {scalar}};
+    }
+
+    template <Detail::vector_expression E>
+    VectorUnaryExpression<Detail::expression_operand_t<E>, Detail::ScalarRight<std::divides<>, Detail::expression_value_t<E>>>
+    operator/(E &&vector, const Detail::expression_value_t<E> &scalar)
+    {
+        assert(scalar != 0 && "Cannot divide by zero");
+        return {std::forward<E>(vector), {scalar}};
+    }
+
+    template <Detail::vector_expression E>
+    VectorUnaryExpression<Detail::expression_operand_t<E>, std::negate<>>
+    operator-(E &&vector)
+    {
+        return {std::forward<E>(vector), {}};
+    }
+
+    // Matrix operators
+    template <Detail::matrix_expression L, Detail::matrix_expression R>
+    MatrixBinaryExpression<Detail::expression_operand_t<L>, Detail::expression_operand_t<R>, std::plus<>>
+    operator+(L &&left, R &&right)
+    {
+        return {std::forward<L>(left), std::forward<R>(right)};
+    }
+
+    template <Detail::matrix_expression L, Detail::matrix_expression R>
+    MatrixBinaryExpression<Detail::expression_operand_t<L>, Detail::expression_operand_t<R>, std::minus<>>
+    operator-(L &&left, R &&right)
+    {
+        return {std::forward<L>(left), std::forward<R>(right)};
+    }
+
+    template <Detail::matrix_expression E>
+    MatrixUnaryExpression<Detail::expression_operand_t<E>, Detail::ScalarRight<std::multiplies<>, Detail::expression_value_t<E>>>
+    operator*(E &&matrix, const Detail::expression_value_t<E> &scalar)
+    {
+        return {std::forward<E>(matrix), {scalar}};
+    }
+
+    template <Detail::matrix_expression E>
+    MatrixUnaryExpression<Detail::expression_operand_t<E>, Detail::ScalarLeft<std::multiplies<>, Detail::expression_value_t<E>>>
+    operator*(const Detail::expression_value_t<E> &scalar, E &&matrix)
+    {
+        return {std::forward<E>(matrix), {scalar}};
+    }
+
+    template <Detail::matrix_expression E>
+    MatrixUnaryExpression<Detail::expression_operand_t<E>, Detail::ScalarRight<std::divides<>, Detail::expression_value_t<E>>>
+    operator/(E &&matrix, const Detail::expression_value_t<E> &scalar)
+    {
+        if (scalar == 0)
+            throw std::invalid_argument("Matrix division by zero");
+
+        return {std::forward<E>(matrix), {scalar}};
+    }
+
+    template <Detail::matrix_expression E>
+    MatrixUnaryExpression<Detail::expression_operand_t<E>, std::negate<>>
+    operator-(E &&matrix)
+    {
+        return {std::forward<E>(matrix), {}};
+    }
+}
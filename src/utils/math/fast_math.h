@@ -0,0 +1,580 @@
+/**
+ * @file fast_math.h
+ * @author Carlos Salguero
+ * @brief Fast approximations of rsqrt, sin, cos, atan2, exp and log
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+
+// Project files
+#include "float4.h"
+#include "float8.h"
+#include "vec.h"
+
+namespace Math::Fast
+{
+    // Approximations for bulk work such as particles and physics, where
+    // the libm calls behind Math::sine and friends dominate the loop. Every
+    // function exists for float, Simd::Float4 and Simd::Float8 and computes
+    // the same polynomial on each, so scalar tails agree with the vector
+    // body. None of them handle NaN or infinite inputs.
+    //
+    // Maximum errors against double-precision libm, measured over a few
+    // million random inputs:
+    //
+    //   rsqrt    relative 3e-7 with SSE, AVX2 and NEON estimates refined by
+    //            Newton steps, for float too; 5e-6 for the bit trick of
+    //            MATH_SIMD_SCALAR builds
+    //   sin/cos  absolute 2e-7 for |x| <= 8192, growing slowly beyond as
+    //            the argument reduction loses bits
+    //   atan2    absolute 4e-7 radians; signed zeros are not told apart
+    //   exp      relative 1e-7 for x in [-87, 88.7]; smaller results are
+    //            denormals with fewer bits, larger ones overflow to infinity
+    //   log      absolute 1e-7 for normal positive x; zero, negative and
+    //            denormal inputs are not supported
+
+    namespace Detail
+    {
+        // 1.5 * 2^23: adding and subtracting it rounds a float of magnitude
+        // below 2^22 to the nearest integer using only float arithmetic
+        inline constexpr float ROUNDING_BIAS = 12582912.0f;
+
+        // pi and ln 2 split into parts whose products with small integers
+        // are exact (Cody-Waite), so the argument reduction keeps its bits
+        inline constexpr float PI_A = 3.140625f;
+        inline constexpr float PI_B = 0.0009675025939941406f;
+        inline constexpr float PI_C = 1.5099580252808664e-07f;
+        inline constexpr float INVERSE_PI = 0.31830987334251404f;
+        inline constexpr float HALF_PI = 1.5707963705062866f;
+        inline constexpr float LN2_A = 0.693115234375f;
+        inline constexpr float LN2_B = 3.194618329871446e-05f;
+        inline constexpr float LOG2_E = 1.4426950216293335f;
+
+        // Minimax coefficients of sin(x) = x + x^3 P(x^2) on [-pi/2, pi/2]
+        inline constexpr float SIN_COEFFICIENTS[] = {
+            -0.16666657096504653f, 0.008333017291561384f,
+            -0.00019806615201304982f, 2.600054767808503e-06f};
+
+        // Minimax coefficients of atan(t) = t + t^3 P(t^2) on [0, 1]
+        inline constexpr float ATAN_COEFFICIENTS[] = {
+            -0.33331659034217653f, 0.19962703993644704f, -0.13976582187201864f,
+            0.09794234722825491f, -0.05777359196793578f, 0.023040137450954623f,
+            -0.004355406212894601f};
+
+        // Coefficients of exp(r) = 1 + r + r^2 P(r) on [-ln 2 / 2, ln 2 / 2]
+        inline constexpr float EXP_COEFFICIENTS[] = {
+            5.0000001201e-1f, 1.6666665459e-1f, 4.1665795894e-2f,
+            8.3334519073e-3f, 1.3981999507e-3f, 1.9875691500e-4f};
+
+        // Coefficients of log(1 + f) = f - f^2 / 2 + f^3 P(f) on
+        // [sqrt(1/2) - 1, sqrt(2) - 1] (Cephes)
+        inline constexpr float LOG_COEFFICIENTS[] = {
+            3.3333331174e-1f, -2.4999993993e-1f, 2.0000714765e-1f,
+            -1.6668057665e-1f, 1.4249322787e-1f, -1.2420140846e-1f,
+            1.1676998740e-1f, -1.1514610310e-1f, 7.0376836292e-2f};
+
+        // Lane primitives. The polynomials below are written once against
+        // these and the arithmetic operators, and instantiated for each type.
+
+        /**
+         * @brief
+         * Calculates a * b + c, fused exactly when Float4::multiply_add is
+         * on this target, so scalar tails round like the vector lanes
+         */
+        inline float multiply_add(float a, float b, float c)
+        {
+#if (defined(MATH_SIMD_SSE) && defined(__FMA__)) || (defined(MATH_SIMD_NEON) && defined(__aarch64__))
+            return std::fma(a, b, c);
+#else
+            return a * b + c;
+#endif
+        }
+
+        inline float min(float a, float b)
+        {
+            return std::min(a, b);
+        }
+
+        inline float max(float a, float b)
+        {
+            return std::max(a, b);
+        }
+
+        inline bool less(float a, float b)
+        {
+            return a < b;
+        }
+
+        inline float select(bool mask, float a, float b)
+        {
+            return mask ? a : b;
+        }
+
+        /**
+         * @brief
+         * Calculates 2^n for an integral n in [-126, 127] by building the
+         * exponent bits
+         */
+        inline float power_of_two(float n)
+        {
+            auto exponent = static_cast<std::uint32_t>(static_cast<std::int32_t>(n) + 127);
+            return std::bit_cast<float>(exponent << 23);
+        }
+
+        /**
+         * @brief
+         * Splits a normal positive x into m 2^e with m in [1, 2) by
+         * reading the exponent bits. Returns m and writes e.
+         */
+        inline float split_exponent(float x, float &exponent)
+        {
+            auto bits = std::bit_cast<std::uint32_t>(x);
+
+            exponent = static_cast<float>(static_cast<std::int32_t>(bits >> 23) - 127);
+            return std::bit_cast<float>((bits & 0x007fffffu) | 0x3f800000u);
+        }
+
+        /**
+         * @brief
+         * Refines the hardware estimate of 1 / sqrt(x) with the steps of
+         * the Float4 version, so one value gives the same result in a
+         * scalar tail and in a vector lane. Without SIMD, estimates from
+         * the exponent bits and takes two Newton-Raphson steps.
+         */
+        inline float reciprocal_sqrt(float x)
+        {
+#if defined(MATH_SIMD_SSE)
+            float y = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(x)));
+            return y * (1.5f - 0.5f * x * y * y);
+#elif defined(MATH_SIMD_NEON)
+            float32x2_t value = vdup_n_f32(x);
+            float32x2_t y = vrsqrte_f32(value);
+            y = vmul_f32(y, vrsqrts_f32(vmul_f32(value, y), y));
+            return vget_lane_f32(vmul_f32(y, vrsqrts_f32(vmul_f32(value, y), y)), 0);
+#else
+            float y = std::bit_cast<float>(0x5F375A86u - (std::bit_cast<std::uint32_t>(x) >> 1));
+
+            y = y * (1.5f - 0.5f * x * y * y);
+            return y * (1.5f - 0.5f * x * y * y);
+#endif
+        }
+
+        inline Simd::Float4 multiply_add(const Simd::Float4 &a, const Simd::Float4 &b,
+                                         const Simd::Float4 &c)
+        {
+            return Simd::Float4::multiply_add(a, b, c);
+        }
+
+        inline Simd::Float4 min(const Simd::Float4 &a, const Simd::Float4 &b)
+        {
+            return Simd::Float4::min(a, b);
+        }
+
+        inline Simd::Float4 max(const Simd::Float4 &a, const Simd::Float4 &b)
+        {
+            return Simd::Float4::max(a, b);
+        }
+
+        inline Simd::Float4 less(const Simd::Float4 &a, const Simd::Float4 &b)
+        {
+            return Simd::Float4::less(a, b);
+        }
+
+        inline Simd::Float4 select(const Simd::Float4 &mask, const Simd::Float4 &a,
+                                   const Simd::Float4 &b)
+        {
+            return Simd::Float4::select(mask, a, b);
+        }
+
+        inline Simd::Float4 power_of_two(const Simd::Float4 &n)
+        {
+#if defined(MATH_SIMD_SSE)
+            __m128i exponent = _mm_add_epi32(_mm_cvtps_epi32(n.get_register()),
+                                             _mm_set1_epi32(127));
+            return _mm_castsi128_ps(_mm_slli_epi32(exponent, 23));
+#elif defined(MATH_SIMD_NEON)
+            int32x4_t exponent = vaddq_s32(vcvtq_s32_f32(n.get_register()), vdupq_n_s32(127));
+            return vreinterpretq_f32_s32(vshlq_n_s32(exponent, 23));
+#else
+            Simd::Float4::register_type result;
+
+            for (std::size_t i = 0; i < 4; ++i)
+                result.lanes[i] = power_of_two(n.get_register().lanes[i]);
+
+            return result;
+#endif
+        }
+
+        inline Simd::Float4 split_exponent(const Simd::Float4 &x, Simd::Float4 &exponent)
+        {
+#if defined(MATH_SIMD_SSE)
+            __m128i bits = _mm_castps_si128(x.get_register());
+            exponent = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(127)));
+
+            __m128i mantissa = _mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x007fffff)),
+                                            _mm_set1_epi32(0x3f800000));
+            return _mm_castsi128_ps(mantissa);
+#elif defined(MATH_SIMD_NEON)
+            uint32x4_t bits = vreinterpretq_u32_f32(x.get_register());
+            exponent = vcvtq_f32_s32(vsubq_s32(vreinterpretq_s32_u32(vshrq_n_u32(bits, 23)), vdupq_n_s32(127)));
+
+            uint32x4_t mantissa = vorrq_u32(vandq_u32(bits, vdupq_n_u32(0x007fffff)), vdupq_n_u32(0x3f800000));
+            return vreinterpretq_f32_u32(mantissa);
+#else
+            Simd::Float4::register_type result;
+            Simd::Float4::register_type exponents;
+
+            for (std::size_t i = 0; i < 4; ++i)
+                result.lanes[i] = split_exponent(x.get_register().lanes[i], exponents.lanes[i]);
+
+            exponent = exponents;
+            return result;
+#endif
+        }
+
+        /**
+         * @brief
+         * Refines the hardware estimate of 1 / sqrt(x), which is good to
+         * 12 bits on SSE and 8 bits on NEON
+         */
+        inline Simd::Float4 reciprocal_sqrt(const Simd::Float4 &x)
+        {
+#if defined(MATH_SIMD_SSE)
+            Simd::Float4 y = _mm_rsqrt_ps(x.get_register());
+            return y * (Simd::Float4(1.5f) - Simd::Float4(0.5f) * x * y * y);
+#elif defined(MATH_SIMD_NEON)
+            float32x4_t value = x.get_register();
+            float32x4_t y = vrsqrteq_f32(value);
+            y = vmulq_f32(y, vrsqrtsq_f32(vmulq_f32(value, y), y));
+            return vmulq_f32(y, vrsqrtsq_f32(vmulq_f32(value, y), y));
+#else
+            Simd::Float4::register_type result;
+
+            for (std::size_t i = 0; i < 4; ++i)
+                result.lanes[i] = reciprocal_sqrt(x.get_register().lanes[i]);
+
+            return result;
+#endif
+        }
+
+        inline Simd::Float8 multiply_add(const Simd::Float8 &a, const Simd::Float8 &b,
+                                         const Simd::Float8 &c)
+        {
+            return Simd::Float8::multiply_add(a, b, c);
+        }
+
+        inline Simd::Float8 min(const Simd::Float8 &a, const Simd::Float8 &b)
+        {
+            return Simd::Float8::min(a, b);
+        }
+
+        inline Simd::Float8 max(const Simd::Float8 &a, const Simd::Float8 &b)
+        {
+            return Simd::Float8::max(a, b);
+        }
+
+        inline Simd::Float8 less(const Simd::Float8 &a, const Simd::Float8 &b)
+        {
+            return Simd::Float8::less(a, b);
+        }
+
+        inline Simd::Float8 select(const Simd::Float8 &mask, const Simd::Float8 &a,
+                                   const Simd::Float8 &b)
+        {
+            return Simd::Float8::select(mask, a, b);
+        }
+
+        inline Simd::Float8 power_of_two(const Simd::Float8 &n)
+        {
+#if defined(MATH_SIMD_AVX2)
+            __m256i exponent = _mm256_add_epi32(_mm256_cvtps_epi32(n.get_register()),
+                                                _mm256_set1_epi32(127));
+            return _mm256_castsi256_ps(_mm256_slli_epi32(exponent, 23));
+#else
+            return Simd::Float8(power_of_two(n.low()), power_of_two(n.high()));
+#endif
+        }
+
+        inline Simd::Float8 split_exponent(const Simd::Float8 &x, Simd::Float8 &exponent)
+        {
+#if defined(MATH_SIMD_AVX2)
+            __m256i bits = _mm256_castps_si256(x.get_register());
+            exponent = _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(127)));
+
+            __m256i mantissa = _mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi32(0x007fffff)),
+                                               _mm256_set1_epi32(0x3f800000));
+            return _mm256_castsi256_ps(mantissa);
+#else
+            Simd::Float4 low_exponent;
+            Simd::Float4 high_exponent;
+            Simd::Float4 low = split_exponent(x.low(), low_exponent);
+            Simd::Float4 high = split_exponent(x.high(), high_exponent);
+
+            exponent = Simd::Float8(low_exponent, high_exponent);
+            return Simd::Float8(low, high);
+#endif
+        }
+
+        inline Simd::Float8 reciprocal_sqrt(const Simd::Float8 &x)
+        {
+#if defined(MATH_SIMD_AVX2)
+            Simd::Float8 y = _mm256_rsqrt_ps(x.get_register());
+            return y * (Simd::Float8(1.5f) - Simd::Float8(0.5f) * x * y * y);
+#else
+            return Simd::Float8(reciprocal_sqrt(x.low()), reciprocal_sqrt(x.high()));
+#endif
+        }
+
+        /**
+         * @brief
+         * Rounds every lane to the nearest integer, ties to even. Exact for
+         * magnitudes below 2^22.
+         */
+        template <class V>
+        V round(const V &x)
+        {
+            return (x + V(ROUNDING_BIAS)) - V(ROUNDING_BIAS);
+        }
+
+        template <class V>
+        V absolute(const V &x)
+        {
+            return max(x, -x);
+        }
+
+        /**
+         * @brief
+         * Evaluates a polynomial with Horner's rule
+         */
+        template <class V, std::size_t N>
+        V polynomial(const V &x, const float (&coefficients)[N])
+        {
+            V result(coefficients[N - 1]);
+
+            for (std::size_t i = N - 1; i-- > 0;)
+                result = multiply_add(result, x, V(coefficients[i]));
+
+            return result;
+        }
+
+        /**
+         * @brief
+         * Sine of a reduced argument in [-pi/2, pi/2]
+         */
+        template <class V>
+        V sine_reduced(const V &r)
+        {
+            V r2 = r * r;
+            return multiply_add(r * r2, polynomial(r2, SIN_COEFFICIENTS), r);
+        }
+
+        /**
+         * @brief
+         * Calculates x - k pi for an integral k with Cody-Waite reduction
+         */
+        template <class V>
+        V reduce_pi(const V &x, const V &k)
+        {
+            V r = multiply_add(k, V(-PI_A), x);
+            r = multiply_add(k, V(-PI_B), r);
+            return multiply_add(k, V(-PI_C), r);
+        }
+
+        /**
+         * @brief
+         * Calculates (-1)^k for an integral k
+         */
+        template <class V>
+        V alternating_sign(const V &k)
+        {
+            V parity = absolute(k - V(2.0f) * round(k * V(0.5f)));
+            return multiply_add(parity, V(-2.0f), V(1.0f));
+        }
+
+        template <class V>
+        V sin(const V &x)
+        {
+            // sin(x) = (-1)^k sin(x - k pi)
+            V k = round(x * V(INVERSE_PI));
+            return sine_reduced(reduce_pi(x, k)) * alternating_sign(k);
+        }
+
+        template <class V>
+        V cos(const V &x)
+        {
+            // cos(x) = -(-1)^k sin(x - (k + 1/2) pi)
+            V k = round(multiply_add(x, V(INVERSE_PI), V(-0.5f)));
+            return sine_reduced(reduce_pi(x, k + V(0.5f))) * -alternating_sign(k);
+        }
+
+        template <class V>
+        V atan2(const V &y, const V &x)
+        {
+            V abs_x = absolute(x);
+            V abs_y = absolute(y);
+            V t = min(abs_x, abs_y) / max(max(abs_x, abs_y), V(1e-37f));
+            V t2 = t * t;
+
+            // atan on [0, 1], then mirrored into the octant of (x, y)
+            V result = multiply_add(t * t2, polynomial(t2, ATAN_COEFFICIENTS), t);
+            result = select(less(abs_x, abs_y), V(HALF_PI) - result, result);
+            result = select(less(x, V(0.0f)), V(2.0f * HALF_PI) - result, result);
+
+            return select(less(y, V(0.0f)), -result, result);
+        }
+
+        template <class V>
+        V exp(const V &x)
+        {
+            V clamped = min(max(x, V(-104.0f)), V(88.7228394f));
+
+            // exp(x) = 2^k exp(r) with |r| <= ln 2 / 2
+            V k = round(clamped * V(LOG2_E));
+            V r = multiply_add(k, V(-LN2_A), clamped);
+            r = multiply_add(k, V(-LN2_B), r);
+
+            V result = multiply_add(r * r, polynomial(r, EXP_COEFFICIENTS), r) + V(1.0f);
+
+            // 2^k in two halves keeps both exponents in range from the
+            // denormals up to the largest float
+            V k_low = round(k * V(0.5f));
+            return result * power_of_two(k_low) * power_of_two(k - k_low);
+        }
+
+        template <class V>
+        V log(const V &x)
+        {
+            // log(x) = e ln 2 + log(m) with m in [sqrt(1/2), sqrt(2))
+            V e;
+            V m = split_exponent(x, e);
+
+            V large = less(V(1.41421356f), m);
+            m = select(large, m * V(0.5f), m);
+            e = select(large, e + V(1.0f), e);
+
+            V f = m - V(1.0f);
+            V f2 = f * f;
+            V result = multiply_add(f2 * f, polynomial(f, LOG_COEFFICIENTS), multiply_add(f2, V(-0.5f), f));
+
+            result = multiply_add(e, V(LN2_B), result);
+            return multiply_add(e, V(LN2_A), result);
+        }
+    }
+
+    /**
+     * @brief
+     * Approximates 1 / sqrt(x)
+     * @param x A positive number
+     * @return float The reciprocal square root
+     */
+    inline float rsqrt(float x)
+    {
+        return Detail::reciprocal_sqrt(x);
+    }
+
+    /**
+     * @brief
+     * Approximates the sine of an angle
+     * @param x The angle in radians
+     * @return float The sine
+     */
+    inline float sin(float x)
+    {
+        return Detail::sin(x);
+    }
+
+    /**
+     * @brief
+     * Approximates the cosine of an angle
+     * @param x The angle in radians
+     * @return float The cosine
+     */
+    inline float cos(float x)
+    {
+        return Detail::cos(x);
+    }
+
+    /**
+     * @brief
+     * Approximates the angle of the point (x, y)
+     * @param y The y coordinate
+     * @param x The x coordinate
+     * @return float The angle in radians, in [-pi, pi]
+     */
+    inline float atan2(float y, float x)
+    {
+        return Detail::atan2(y, x);
+    }
+
+    /**
+     * @brief
+     * Approximates e^x
+     * @param x The exponent
+     * @return float e raised to x
+     */
+    inline float exp(float x)
+    {
+        return Detail::exp(x);
+    }
+
+    /**
+     * @brief
+     * Approximates the natural logarithm
+     * @param x A normal positive number
+     * @return float The logarithm
+     */
+    inline float log(float x)
+    {
+        return Detail::log(x);
+    }
+
+    inline Simd::Float4 rsqrt(const Simd::Float4 &x) { return Detail::reciprocal_sqrt(x); }
+    inline Simd::Float4 sin(const Simd::Float4 &x) { return Detail::sin(x); }
+    inline Simd::Float4 cos(const Simd::Float4 &x) { return Detail::cos(x); }
+    inline Simd::Float4 atan2(const Simd::Float4 &y, const Simd::Float4 &x) { return Detail::atan2(y, x); }
+    inline Simd::Float4 exp(const Simd::Float4 &x) { return Detail::exp(x); }
+    inline Simd::Float4 log(const Simd::Float4 &x) { return Detail::log(x); }
+
+    inline Simd::Float8 rsqrt(const Simd::Float8 &x) { return Detail::reciprocal_sqrt(x); }
+    inline Simd::Float8 sin(const Simd::Float8 &x) { return Detail::sin(x); }
+    inline Simd::Float8 cos(const Simd::Float8 &x) { return Detail::cos(x); }
+    inline Simd::Float8 atan2(const Simd::Float8 &y, const Simd::Float8 &x) { return Detail::atan2(y, x); }
+    inline Simd::Float8 exp(const Simd::Float8 &x) { return Detail::exp(x); }
+    inline Simd::Float8 log(const Simd::Float8 &x) { return Detail::log(x); }
+
+    /**
+     * @brief
+     * Scales a vector to unit length with rsqrt instead of a square root
+     * and a division
+     * @param vector The vector, which must not be zero
+     * @return Vec3 The normalized vector
+     */
+    inline Vec3 normalize(const Vec3 &vector)
+    {
+        return vector * rsqrt(vector.squared_magnitude());
+    }
+
+    /**
+     * @brief
+     * Scales the first three lanes to unit length with rsqrt. The fourth
+     * lane is kept.
+     * @param vector The vector, whose first three lanes must not all be zero
+     * @return Simd::Float4 The normalized vector
+     */
+    inline Simd::Float4 normalize3(const Simd::Float4 &vector)
+    {
+        Simd::Float4 squared = (vector * vector).with_w(0.0f).horizontal_sum();
+        return (vector * rsqrt(squared)).with_w(vector.w());
+    }
+}
@@ -0,0 +1,432 @@
+/**
+ * @file fixed.h
+ * @author Carlos Salguero
+ * @brief Deterministic fixed-point numbers in the Q16.16 and Q32.32 formats
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#pragma once
+
+// C++ Standard Library
+#include <compare>
+#include <concepts>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+// Project files
+#include "math.h"
+
+namespace Math
+{
+    namespace Detail
+    {
+#if defined(__SIZEOF_INT128__)
+        __extension__ using uint128 = unsigned __int128;
+#endif
+
+        /**
+         * @brief
+         * Negates an unsigned magnitude when the sign is set, wrapping like
+         * two's complement
+         */
+        constexpr std::uint64_t apply_sign(std::uint64_t magnitude, bool negative)
+        {
+            return negative ? ~magnitude + 1 : magnitude;
+        }
+
+        /**
+         * @brief
+         * Gets the magnitude of a signed value, valid for the minimum too
+         */
+        constexpr std::uint64_t magnitude(std::int64_t value)
+        {
+            return value < 0 ? ~static_cast<std::uint64_t>(value) + 1
+                             : static_cast<std::uint64_t>(value);
+        }
+
+        /**
+         * @brief
+         * Multiplies two 64-bit magnitudes and shifts the 128-bit product
+         * right, rounding halves up. Only uses 64-bit arithmetic.
+         * @param a The first factor
+         * @param b The second factor
+         * @param shift Bits to shift, in [1, 63]
+         * @return std::uint64_t The low 64 bits of the rounded result
+         */
+        constexpr std::uint64_t multiply_shift_portable(std::uint64_t a, std::uint64_t b, int shift)
+        {
+            constexpr std::uint64_t mask = 0xffffffffu;
+
+            std::uint64_t low_low = (a & mask) * (b & mask);
+            std::uint64_t high_low = (a >> 32) * (b & mask);
+            std::uint64_t low_high = (a & mask) * (b >> 32);
+            std::uint64_t high_high = (a >> 32) * (b >> 32);
+
+            std::uint64_t middle = (low_low >> 32) + (high_low & mask) + (low_high & mask);
+            std::uint64_t low = (middle << 32) | (low_low & mask);
+            std::uint64_t high = high_high + (high_low >> 32) + (low_high >> 32) + (middle >> 32);
+
+            std::uint64_t rounded = low + (std::uint64_t(1) << (shift - 1));
+            high += rounded < low;
+
+            return (rounded >> shift) | (high << (64 - shift));
+        }
+
+        /**
+         * @brief
+         * Divides a 64-bit magnitude shifted left by a 64-bit magnitude,
+         * rounding halves up, with a restoring long division. Only uses
+         * 64-bit arithmetic.
+         * @param a The dividend, before the shift
+         * @param b The divisor, not zero
+         * @param shift Bits to shift the dividend, in [1, 63]
+         * @return std::uint64_t The low 64 bits of the rounded quotient
+         */
+        constexpr std::uint64_t divide_shift_portable(std::uint64_t a, std::uint64_t b, int shift)
+        {
+            // Numerator (a << shift) as a 128-bit pair, walked from the top
+            std::uint64_t high = a >> (64 - shift);
+            std::uint64_t low = a << shift;
+            std::uint64_t remainder = 0;
+            std::uint64_t quotient = 0;
+
+            for (int bit = 127; bit >= 0; --bit)
+            {
+                std::uint64_t next = bit >= 64 ? (high >> (bit - 64)) & 1 : (low >> bit) & 1;
+                bool carry = remainder >> 63;
+
+                remainder = (remainder << 1) | next;
+                quotient <<= 1;
+
+                if (carry || remainder >= b)
+                {
+                    remainder -= b;
+                    quotient |= 1;
+                }
+            }
+
+            // Round half up: compare twice the remainder against the divisor
+            bool round_up = (remainder >> 63) || remainder * 2 >= b;
+            return quotient + round_up;
+        }
+
+        /**
+         * @brief
+         * Computes round(a * b / 2^shift) with the sign of the product,
+         * rounding halves away from zero
+         * @tparam Storage Signed integer of 32 or 64 bits
+         */
+        template <class Storage>
+        constexpr Storage fixed_multiply(Storage a, Storage b, int shift)
+        {
+            bool negative = (a < 0) != (b < 0);
+            std::uint64_t left = magnitude(a);
+            std::uint64_t right = magnitude(b);
+            std::uint64_t result;
+
+            if constexpr (sizeof(Storage) <= 4)
+                result = (left * right + (std::uint64_t(1) << (shift - 1))) >> shift;
+            else
+            {
+#if defined(__SIZEOF_INT128__)
+                result = static_cast<std::uint64_t>(
+                    (uint128(left) * right + (uint128(1) << (shift - 1))) >> shift);
+#else
+                result = multiply_shift_portable(left, right, shift);
+#endif
+            }
+
+            return static_cast<Storage>(apply_sign(result, negative));
+        }
+
+        /**
+         * @brief
+         * Computes round(a * 2^shift / b) with the sign of the quotient,
+         * rounding halves away from zero
+         * @tparam Storage Signed integer of 32 or 64 bits
+         * @throws std::runtime_error If b is zero
+         */
+        template <class Storage>
+        constexpr Storage fixed_divide(Storage a, Storage b, int shift)
+        {
+            if (b == 0)
+                throw std::runtime_error("Error: Division by zero");
+
+            bool negative = (a < 0) != (b < 0);
+            std::uint64_t left = magnitude(a);
+            std::uint64_t right = magnitude(b);
+            std::uint64_t result;
+
+            if constexpr (sizeof(Storage) <= 4)
+                result = ((left << shift) + right / 2) / right;
+            else
+            {
+#if defined(__SIZEOF_INT128__)
+                result = static_cast<std::uint64_t>(((uint128(left) << shift) + right / 2) / right);
+#else
+                result = divide_shift_portable(left, right, shift);
+#endif
+            }
+
+            return static_cast<Storage>(apply_sign(result, negative));
+        }
+    }
+
+    /**
+     * @class Fixed
+     * @brief Signed fixed-point number with FractionBits fractional bits.
+     *        Every operation is integer arithmetic with a defined result,
+     *        so the same inputs give the same bits on every compiler and
+     *        CPU, which lockstep simulations rely on. Addition and
+     *        subtraction wrap on overflow; products and quotients are
+     *        rounded to nearest, halves away from zero.
+     * @tparam Storage Signed integer of 32 or 64 bits holding the raw value
+     * @tparam FractionBits Number of fractional bits
+     */
+    template <class Storage, int FractionBits>
+    class Fixed
+    {
+        static_assert(std::is_same_v<Storage, std::int32_t> || std::is_same_v<Storage, std::int64_t>,
+                      "Fixed is stored in 32 or 64-bit signed integers");
+        static_assert(FractionBits > 0 && FractionBits < static_cast<int>(8 * sizeof(Storage)) - 1,
+                      "Fixed needs integer and fractional bits");
+
+        using Unsigned = std::make_unsigned_t<Storage>;
+
+    public:
+        // Type aliases
+        using storage_type = Storage;
+        static constexpr int fraction_bits = FractionBits;
+
+        // Constructors
+        constexpr Fixed() : m_raw(0) {}
+
+        /**
+         * @brief
+         * Constructs the number from an integer, exactly as long as it fits
+         * the integer bits. Implicit, so literals such as 0 and 2 mix with
+         * fixed-point values.
+         * @param value The integer
+         */
+        template <std::integral I>
+        constexpr Fixed(I value)
+            : m_raw(static_cast<Storage>(static_cast<Unsigned>(value) << FractionBits)) {}
+
+        /**
+         * @brief
+         * Constructs the nearest number to a floating-point value. Explicit,
+         * since floating-point inputs are where determinism is lost.
+         * @param value The floating-point value, within the range
+         */
+        template <std::floating_point F>
+        explicit constexpr Fixed(F value)
+            : m_raw(static_cast<Storage>(value * static_cast<F>(one_raw) +
+                                         (value < 0 ? F(-0.5) : F(0.5)))) {}
+
+        // Operators
+        constexpr Fixed operator-() const
+        {
+            return from_raw(static_cast<Storage>(Unsigned(0) - static_cast<Unsigned>(m_raw)));
+        }
+
+        constexpr Fixed &operator+=(const Fixed &other)
+        {
+            m_raw = static_cast<Storage>(static_cast<Unsigned>(m_raw) +
+                                         static_cast<Unsigned>(other.m_raw));
+            return *this;
+        }
+
+        constexpr Fixed &operator-=(const Fixed &other)
+        {
+            m_raw = static_cast<Storage>(static_cast<Unsigned>(m_raw) -
+                                         static_cast<Unsigned>(other.m_raw));
+            return *this;
+        }
+
+        constexpr Fixed &operator*=(const Fixed &other)
+        {
+            m_raw = Detail::fixed_multiply(m_raw, other.m_raw, FractionBits);
+            return *this;
+        }
+
+        /**
+         * @brief
+         * Divides the number by another one
+         * @param other The divisor
+         * @return Fixed& This number
+         * @throws std::runtime_error If the divisor is zero
+         */
+        constexpr Fixed &operator/=(const Fixed &other)
+        {
+            m_raw = Detail::fixed_divide(m_raw, other.m_raw, FractionBits);
+            return *this;
+        }
+
+        friend constexpr Fixed operator+(Fixed left, const Fixed &right)
+        {
+            return left += right;
+        }
+
+        friend constexpr Fixed operator-(Fixed left, const Fixed &right)
+        {
+            return left -= right;
+        }
+
+        friend constexpr Fixed operator*(Fixed left, const Fixed &right)
+        {
+            return left *= right;
+        }
+
+        friend constexpr Fixed operator/(Fixed left, const Fixed &right)
+        {
+            return left /= right;
+        }
+
+        friend constexpr bool operator==(const Fixed &, const Fixed &) = default;
+        friend constexpr auto operator<=>(const Fixed &, const Fixed &) = default;
+
+        /**
+         * @brief
+         * Converts the number to the nearest floating-point value
+         * @tparam F Type of the floating-point value
+         */
+        template <std::floating_point F>
+        explicit constexpr operator F() const
+        {
+            return static_cast<F>(m_raw) / static_cast<F>(one_raw);
+        }
+
+        // Access Methods
+        /**
+         * @brief
+         * Gets the raw integer, the number times 2^FractionBits
+         * @return Storage The raw value
+         */
+        constexpr Storage raw() const
+        {
+            return m_raw;
+        }
+
+        // Methods
+        /**
+         * @brief
+         * Rounds the number down to an integer
+         * @return Storage The largest integer not above the number
+         */
+        constexpr Storage floor() const
+        {
+            return m_raw >> FractionBits;
+        }
+
+        /**
+         * @brief
+         * Converts the number to float
+         * @return float The nearest float
+         */
+        constexpr float to_float() const
+        {
+            return static_cast<float>(*this);
+        }
+
+        /**
+         * @brief
+         * Converts the number to double
+         * @return double The nearest double
+         */
+        constexpr double to_double() const
+        {
+            return static_cast<double>(*this);
+        }
+
+        // Static Methods
+        /**
+         * @brief
+         * Builds a number from its raw integer
+         * @param raw The number times 2^FractionBits
+         * @return Fixed The number
+         */
+        static constexpr Fixed from_raw(Storage raw)
+        {
+            Fixed result;
+            result.m_raw = raw;
+            return result;
+        }
+
+        /**
+         * @brief
+         * Gets the smallest positive number, 2^-FractionBits
+         * @return Fixed The resolution of the format
+         */
+        static constexpr Fixed epsilon()
+        {
+            return from_raw(1);
+        }
+
+    private:
+        static constexpr Storage one_raw = Storage(1) << FractionBits;
+
+        Storage m_raw;
+    };
+
+    /**
+     * @brief
+     * Calculates the square root of a fixed-point number with Newton's
+     * method in fixed-point arithmetic, so the result is deterministic
+     * @tparam Storage Type of the raw value
+     * @tparam FractionBits Number of fractional bits
+     * @param a Number
+     * @return Fixed<Storage, FractionBits> Square root of the number
+     * @throws std::runtime_error If the number is negative
+     */
+    template <class Storage, int FractionBits>
+    constexpr Fixed<Storage, FractionBits> square_root(Fixed<Storage, FractionBits> a)
+    {
+        using Number = Fixed<Storage, FractionBits>;
+
+        if (a < Number())
+            throw std::runtime_error("Error: Invalid argument for square root");
+
+        if (a == Number())
+            return a;
+
+        // Started above the root, the iteration decreases until rounding
+        // stops it
+        Number current = a < Number(1) ? Number(1) : a;
+
+        while (true)
+        {
+            // a / current <= current above the root, so the midpoint is
+            // taken from the smaller end and never leaves the range
+            Number quotient = a / current;
+            Number next = quotient + (current - quotient) / Number(2);
+
+            if (next >= current)
+                return current;
+
+            current = next;
+        }
+    }
+
+    /**
+     * @brief
+     * Calculates the absolute value of a fixed-point number
+     * @tparam Storage Type of the raw value
+     * @tparam FractionBits Number of fractional bits
+     * @param a Number
+     * @return Fixed<Storage, FractionBits> Absolute value of the number
+     */
+    template <class Storage, int FractionBits>
+    constexpr Fixed<Storage, FractionBits> absolute(Fixed<Storage, FractionBits> a)
+    {
+        return a < Fixed<Storage, FractionBits>() ? -a : a;
+    }
+
+    // Type aliases
+    using Q16_16 = Fixed<std::int32_t, 16>;
+    using Q32_32 = Fixed<std::int64_t, 32>;
+}
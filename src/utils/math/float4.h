@@ -0,0 +1,648 @@
+/**
+ * @file float4.h
+ * @author Carlos Salguero
+ * @brief Four-wide float vector backed by a SIMD register
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#pragma once
+
+// Instruction set selection. Defining MATH_SIMD_DISABLE forces the scalar
+// implementation, which is also used when no supported instruction set is
+// enabled for the target.
+#if !defined(MATH_SIMD_DISABLE) && (defined(__SSE2__) || defined(_M_X64) || \
+                                    (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define MATH_SIMD_SSE 1
+#if defined(__AVX2__)
+#define MATH_SIMD_AVX2 1
+#endif
+#elif !defined(MATH_SIMD_DISABLE) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#define MATH_SIMD_NEON 1
+#else
+#define MATH_SIMD_SCALAR 1
+#endif
+
+// C++ Standard Library
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+#if defined(MATH_SIMD_AVX2) || (defined(MATH_SIMD_SSE) && defined(__FMA__))
+#include <immintrin.h>
+#elif defined(MATH_SIMD_SSE)
+#include <emmintrin.h>
+#elif defined(MATH_SIMD_NEON)
+#include <arm_neon.h>
+#endif
+
+// Project files
+#include "vec.h"
+
+namespace Math::Simd
+{
+    /**
+     * @class Float4
+     * @brief Four floats held in one SIMD register. Operations work on all
+     *        four lanes at once unless stated otherwise.
+     */
+    class alignas(16) Float4
+    {
+    public:
+#if defined(MATH_SIMD_SSE)
+        using register_type = __m128;
+#elif defined(MATH_SIMD_NEON)
+        using register_type = float32x4_t;
+#else
+        struct register_type
+        {
+            float lanes[4];
+        };
+#endif
+
+        static constexpr std::size_t width = 4;
+
+        // Constructors
+        Float4() : Float4(0.0f) {}
+        Float4(register_type value) : m_value(value) {}
+
+        /**
+         * @brief
+         * Constructs a vector with every lane set to the same value
+         * @param value The value of the lanes
+         */
+        explicit Float4(float value)
+        {
+#if defined(MATH_SIMD_SSE)
+            m_value = _mm_set1_ps(value);
+#elif defined(MATH_SIMD_NEON)
+            m_value = vdupq_n_f32(value);
+#else
+            m_value = {{value, value, value, value}};
+#endif
+        }
+
+        /**
+         * @brief
+         * Constructs a vector from its four lanes
+         * @param x The first lane
+         * @param y The second lane
+         * @param z The third lane
+         * @param w The fourth lane
+         */
+        Float4(float x, float y, float z, float w)
+        {
+#if defined(MATH_SIMD_SSE)
+            m_value = _mm_setr_ps(x, y, z, w);
+#elif defined(MATH_SIMD_NEON)
+            alignas(16) const float lanes[4] = {x, y, z, w};
+            m_value = vld1q_f32(lanes);
+#else
+            m_value = {{x, y, z, w}};
+#endif
+        }
+
+        /**
+         * @brief
+         * Constructs a vector from a fixed-size vector
+         * @param vector The vector to load
+         */
+        explicit Float4(const Vec<4, float> &vector)
+            : Float4(load(vector.data())) {}
+
+        // Operators
+        Float4 operator+(const Float4 &other) const
+        {
+#if defined(MATH_SIMD_SSE)
+            return _mm_add_ps(m_value, other.m_value);
+#elif defined(MATH_SIMD_NEON)
+            return vaddq_f32(m_value, other.m_value);
+#else
+            return lanewise(other, [](float a, float b)
+                            { return a + b; });
+#endif
+        }
+
+        Float4 operator-(const Float4 &other) const
+        {
+#if defined(MATH_SIMD_SSE)
+            return _mm_sub_ps(m_value, other.m_value);
+#elif defined(MATH_SIMD_NEON)
+            return vsubq_f32(m_value, other.m_value);
+#else
+            return lanewise(other, [](float a, float b)
+                            { return a - b; });
+#endif
+        }
+
+        Float4 operator*(const Float4 &other) const
+        {
+#if defined(MATH_SIMD_SSE)
+            return _mm_mul_ps(m_value, other.m_value);
+#elif defined(MATH_SIMD_NEON)
+            return vmulq_f32(m_value, other.m_value);
+#else
+            return lanewise(other, [](float a, float b)
+                            { return a * b; });
+#endif
+        }
+
+        Float4 operator/(const Float4 &other) const
+        {
+#if defined(MATH_SIMD_SSE)
+            return _mm_div_ps(m_value, other.m_value);
+#elif defined(MATH_SIMD_NEON) && defined(__aarch64__)
+            return vdivq_f32(m_value, other.m_value);
+#elif defined(MATH_SIMD_NEON)
+            // ARMv7 has no vector divide, and the reciprocal estimate with
+            // its Newton steps is not correctly rounded
+            alignas(16) float lanes[4];
+            alignas(16) float divisors[4];
+            store(lanes);
+            other.store(divisors);
+
+            return Float4(lanes[0] / divisors[0], lanes[1] / divisors[1],
+                          lanes[2] / divisors[2], lanes[3] / divisors[3]);
+#else
+            return lanewise(other, [](float a, float b)
+                            { return a / b; });
+#endif
+        }
+
+        Float4 operator*(float scalar) const
+        {
+            return *this * Float4(scalar);
+        }
+
+        Float4 operator/(float scalar) const
+        {
+            return *this / Float4(scalar);
+        }
+
+        Float4 operator-() const
+        {
+            return Float4() - *this;
+        }
+
+        Float4 &operator+=(const Float4 &other)
+        {
+            return *this = *this + other;
+        }
+
+        Float4 &operator-=(const Float4 &other)
+        {
+            return *this = *this - other;
+        }
+
+        Float4 &operator*=(const Float4 &other)
+        {
+            return *this = *this * other;
+        }
+
+        Float4 &operator/=(const Float4 &other)
+        {
+            return *this = *this / other;
+        }
+
+        /**
+         * @brief
+         * Reads one lane. Meant for tests and debugging, not for hot loops.
+         * @param index The index of the lane
+         * @return float The value of the lane
+         */
+        float operator[](std::size_t index) const
+        {
+            alignas(16) float lanes[4];
+            store(lanes);
+
+            return lanes[index];
+        }
+
+        // Access Methods
+        /**
+         * @brief
+         * Gets the underlying register
+         * @return register_type The register
+         */
+        register_type get_register() const
+        {
+            return m_value;
+        }
+
+        float x() const { return (*this)[0]; }
+        float y() const { return (*this)[1]; }
+        float z() const { return (*this)[2]; }
+        float w() const { return (*this)[3]; }
+
+        // Methods
+        /**
+         * @brief
+         * Writes the four lanes to memory
+         * @param destination Four floats, with no alignment requirement
+         */
+        void store(float *destination) const
+        {
+#if defined(MATH_SIMD_SSE)
+            _mm_storeu_ps(destination, m_value);
+#elif defined(MATH_SIMD_NEON)
+            vst1q_f32(destination, m_value);
+#else
+            for (std::size_t i = 0; i < 4; ++i)
+                destination[i] = m_value.lanes[i];
+#endif
+        }
+
+        /**
+         * @brief
+         * Converts the vector to a fixed-size vector
+         * @return Vec<4, float> The fixed-size vector
+         */
+        Vec<4, float> to_vec() const
+        {
+            Vec<4, float> result;
+            store(result.data());
+
+            return result;
+        }
+
+        /**
+         * @brief
+         * Gathers the sign bit of every lane, which is set in the lanes of
+         * a comparison that hold
+         * @return int Bit i is the sign of lane i
+         */
+        int mask() const
+        {
+#if defined(MATH_SIMD_SSE)
+            return _mm_movemask_ps(m_value);
+#elif defined(MATH_SIMD_NEON)
+            static const uint32x4_t weights = {1, 2, 4, 8};
+            uint32x4_t signs = vshrq_n_u32(vreinterpretq_u32_f32(m_value), 31);
+            uint32x4_t bits = vmulq_u32(signs, weights);
+
+#if defined(__aarch64__)
+            return static_cast<int>(vaddvq_u32(bits));
+#else
+            // ARMv7 has no across-vector add: two pairwise adds instead
+            uint32x2_t sums = vpadd_u32(vget_low_u32(bits), vget_high_u32(bits));
+            return static_cast<int>(vget_lane_u32(vpadd_u32(sums, sums), 0));
+#endif
+#else
+            int result = 0;
+
+            for (std::size_t i = 0; i < 4; ++i)
+                result |= static_cast<int>(std::bit_cast<std::uint32_t>(m_value.lanes[i]) >> 31) << i;
+
+            return result;
+#endif
+        }
+
+        /**
+         * @brief
+         * Calculates the 4D dot product and broadcasts it to every lane
+         * @param other The other vector
+         * @return Float4 The dot product in every lane
+         */
+        Float4 dot4(const Float4 &other) const
+        {
+            return (*this * other).horizontal_sum();
+        }
+
+        /**
+         * @brief
+         * Calculates the 4D dot product
+         * @param other The other vector
+         * @return float The dot product
+         */
+        float dot(const Float4 &other) const
+        {
+            return dot4(other).first();
+        }
+
+        /**
+         * @brief
+         * Calculates the dot product of the first three lanes
+         * @param other The other vector
+         * @return float The dot product
+         */
+        float dot3(const Float4 &other) const
+        {
+            return (*this * other).with_w(0.0f).horizontal_sum().first();
+        }
+
+        /**
+         * @brief
+         * Calculates the cross product of the first three lanes. The fourth
+         * lane of the result is zero.
+         * @param other The other vector
+         * @return Float4 The cross product
+         */
+        Float4 cross(const Float4 &other) const
+        {
+            // a * b.yzx - a.yzx * b is the cross product in zxy order, which
+            // takes one shuffle less than the textbook form
+            Float4 a_yzx = swizzle<1, 2, 0, 3>(*this);
+            Float4 b_yzx = swizzle<1, 2, 0, 3>(other);
+            Float4 result = *this * b_yzx - a_yzx * other;
+
+            return swizzle<1, 2, 0, 3>(result).with_w(0.0f);
+        }
+
+        /**
+         * @brief
+         * Scales the vector to a 4D length of one
+         * @return Float4 The normalized vector
+         */
+        Float4 normalize() const
+        {
+            return *this / dot4(*this).sqrt();
+        }
+
+        /**
+         * @brief
+         * Scales the first three lanes to a length of one. The fourth lane
+         * is kept.
+         * @return Float4 The normalized vector
+         */
+        Float4 normalize3() const
+        {
+            Float4 length = (*this * *this).with_w(0.0f).horizontal_sum().sqrt();
+
+            return (*this / length).with_w(w());
+        }
+
+        /**
+         * @brief
+         * Calculates the square root of every lane
+         * @return Float4 The square roots
+         */
+        Float4 sqrt() const
+        {
+#if defined(MATH_SIMD_SSE)
+            return _mm_sqrt_ps(m_value);
+#elif defined(MATH_SIMD_NEON) && defined(__aarch64__)
+            return vsqrtq_f32(m_value);
+#else
+            alignas(16) float lanes[4];
+            store(lanes);
+
+            return Float4(std::sqrt(lanes[0]), std::sqrt(lanes[1]),
+                          std::sqrt(lanes[2]), std::sqrt(lanes[3]));
+#endif
+        }
+
+        /**
+         * @brief
+         * Adds the four lanes and broadcasts the sum to every lane
+         * @return Float4 The sum in every lane
+         */
+        Float4 horizontal_sum() const
+        {
+            Float4 sum = *this + swizzle<1, 0, 3, 2>(*this);
+            return sum + swizzle<2, 3, 0, 1>(sum);
+        }
+
+        /**
+         * @brief
+         * Gets the first lane
+         * @return float The first lane
+         */
+        float first() const
+        {
+#if defined(MATH_SIMD_SSE)
+            return _mm_cvtss_f32(m_value);
+#elif defined(MATH_SIMD_NEON)
+            return vgetq_lane_f32(m_value, 0);
+#else
+            return m_value.lanes[0];
+#endif
+        }
+
+        /**
+         * @brief
+         * Replaces the fourth lane
+         * @param value The new value of the fourth lane
+         * @return Float4 The vector with the fourth lane replaced
+         */
+        Float4 with_w(float value) const
+        {
+            // (x, y, value, value) takes z from this and w from the splat
+            Float4 zw = shuffle<2, 2, 0, 0>(*this, Float4(value));
+            return shuffle<0, 1, 0, 2>(*this, zw);
+        }
+
+        // Static Methods
+        /**
+         * @brief
+         * Loads four floats from memory
+         * @param source Four floats, with no alignment requirement
+         * @return Float4 The loaded vector
+         */
+        static Float4 load(const float *source)
+        {
+#if defined(MATH_SIMD_SSE)
+            return _mm_loadu_ps(source);
+#elif defined(MATH_SIMD_NEON)
+            return vld1q_f32(source);
+#else
+            return Float4(source[0], source[1], source[2], source[3]);
+#endif
+        }
+
+        /**
+         * @brief
+         * Picks the smaller value of every pair of lanes
+         * @param a The first vector
+         * @param b The second vector
+         * @return Float4 The lane-wise minimum
+         */
+        static Float4 min(const Float4 &a, const Float4 &b)
+        {
+#if defined(MATH_SIMD_SSE)
+            return _mm_min_ps(a.m_value, b.m_value);
+#elif defined(MATH_SIMD_NEON)
+            return vminq_f32(a.m_value, b.m_value);
+#else
+            return a.lanewise(b, [](float x, float y)
+                              { return y < x ? y : x; });
+#endif
+        }
+
+        /**
+         * @brief
+         * Picks the larger value of every pair of lanes
+         * @param a The first vector
+         * @param b The second vector
+         * @return Float4 The lane-wise maximum
+         */
+        static Float4 max(const Float4 &a, const Float4 &b)
+        {
+#if defined(MATH_SIMD_SSE)
+            return _mm_max_ps(a.m_value, b.m_value);
+#elif defined(MATH_SIMD_NEON)
+            return vmaxq_f32(a.m_value, b.m_value);
+#else
+            return a.lanewise(b, [](float x, float y)
+                              { return x < y ? y : x; });
+#endif
+        }
+
+        /**
+         * @brief
+         * Compares every pair of lanes
+         * @param a The first vector
+         * @param b The second vector
+         * @return Float4 All bits set in the lanes where a < b, zero in the
+         * others
+         */
+        static Float4 less(const Float4 &a, const Float4 &b)
+        {
+#if defined(MATH_SIMD_SSE)
+            return _mm_cmplt_ps(a.m_value, b.m_value);
+#elif defined(MATH_SIMD_NEON)
+            return vreinterpretq_f32_u32(vcltq_f32(a.m_value, b.m_value));
+#else
+            return a.lanewise(b, [](float x, float y)
+                              { return std::bit_cast<float>(x < y ? ~0u : 0u); });
+#endif
+        }
+
+        /**
+         * @brief
+         * Picks the lanes of a where the mask is set and of b elsewhere
+         * @param mask The result of a comparison
+         * @param a The lanes to pick where the mask is set
+         * @param b The lanes to pick elsewhere
+         * @return Float4 The blended vector
+         */
+        static Float4 select(const Float4 &mask, const Float4 &a, const Float4 &b)
+        {
+#if defined(MATH_SIMD_SSE)
+            return _mm_or_ps(_mm_and_ps(mask.m_value, a.m_value),
+                             _mm_andnot_ps(mask.m_value, b.m_value));
+#elif defined(MATH_SIMD_NEON)
+            return vbslq_f32(vreinterpretq_u32_f32(mask.m_value), a.m_value, b.m_value);
+#else
+            register_type result;
+
+            for (std::size_t i = 0; i < 4; ++i)
+                result.lanes[i] = std::bit_cast<std::uint32_t>(mask.m_value.lanes[i])
+                                      ? a.m_value.lanes[i]
+                                      : b.m_value.lanes[i];
+
+            return result;
+#endif
+        }
+
+        /**
+         * @brief
+         * Multiplies two vectors and adds a third one, fused when the
+         * target supports it
+         * @param a The first factor
+         * @param b The second factor
+         * @param c The addend
+         * @return Float4 a * b + c
+         */
+        static Float4 multiply_add(const Float4 &a, const Float4 &b, const Float4 &c)
+        {
+#if defined(MATH_SIMD_SSE) && defined(__FMA__)
+            return _mm_fmadd_ps(a.m_value, b.m_value, c.m_value);
+#elif defined(MATH_SIMD_NEON) && defined(__aarch64__)
+            return vfmaq_f32(c.m_value, a.m_value, b.m_value);
+#else
+            return a * b + c;
+#endif
+        }
+
+        /**
+         * @brief
+         * Picks two lanes of a and two lanes of b, in the order of
+         * _mm_shuffle_ps: (a[A], a[B], b[C], b[D])
+         * @tparam A Lane of a for the first lane
+         * @tparam B Lane of a for the second lane
+         * @tparam C Lane of b for the third lane
+         * @tparam D Lane of b for the fourth lane
+         * @param a The first vector
+         * @param b The second vector
+         * @return Float4 The shuffled vector
+         */
+        template <int A, int B, int C, int D>
+        static Float4 shuffle(const Float4 &a, const Float4 &b)
+        {
+            static_assert(A >= 0 && A < 4 && B >= 0 && B < 4 &&
+                              C >= 0 && C < 4 && D >= 0 && D < 4,
+                          "Shuffle lanes must be between 0 and 3");
+
+#if defined(MATH_SIMD_SSE)
+            return _mm_shuffle_ps(a.m_value, b.m_value, _MM_SHUFFLE(D, C, B, A));
+#elif defined(MATH_SIMD_NEON) && (defined(__clang__) || __GNUC__ >= 12)
+            return __builtin_shufflevector(a.m_value, b.m_value, A, B, C + 4, D + 4);
+#else
+            alignas(16) float lanes_a[4];
+            alignas(16) float lanes_b[4];
+            a.store(lanes_a);
+            b.store(lanes_b);
+
+            return Float4(lanes_a[A], lanes_a[B], lanes_b[C], lanes_b[D]);
+#endif
+        }
+
+        /**
+         * @brief
+         * Reorders the lanes of a vector
+         * @tparam A Source lane of the first lane
+         * @tparam B Source lane of the second lane
+         * @tparam C Source lane of the third lane
+         * @tparam D Source lane of the fourth lane
+         * @param value The vector
+         * @return Float4 The reordered vector
+         */
+        template <int A, int B, int C, int D>
+        static Float4 swizzle(const Float4 &value)
+        {
+            return shuffle<A, B, C, D>(value, value);
+        }
+
+        /**
+         * @brief
+         * Broadcasts one lane to every lane
+         * @tparam Lane The lane to broadcast
+         * @param value The vector
+         * @return Float4 The broadcast lane
+         */
+        template <int Lane>
+        static Float4 splat(const Float4 &value)
+        {
+            return shuffle<Lane, Lane, Lane, Lane>(value, value);
+        }
+
+    private:
+        register_type m_value;
+
+#if defined(MATH_SIMD_SCALAR)
+        /**
+         * @brief
+         * Applies a binary operation to every pair of lanes
+         * @tparam Operation Type of the operation
+         * @param other The right-hand operand
+         * @param operation The operation
+         * @return Float4 The result
+         */
+        template <class Operation>
+        Float4 lanewise(const Float4 &other, Operation operation) const
+        {
+            register_type result;
+
+            for (std::size_t i = 0; i < 4; ++i)
+                result.lanes[i] = operation(m_value.lanes[i], other.m_value.lanes[i]);
+
+            return result;
+        }
+#endif
+    };
+}
@@ -0,0 +1,328 @@
+/**
+ * @file float8.h
+ * @author Carlos Salguero
+ * @brief Eight-wide float vector for batch kernels
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#pragma once
+
+// C++ Standard Library
+#include <cstddef>
+
+// Project files
+#include "float4.h"
+
+namespace Math::Simd
+{
+    /**
+     * @class Float8
+     * @brief Eight floats. With AVX2 they live in one 256-bit register;
+     *        otherwise in two Float4, so batch kernels written against
+     *        Float8 run on every target.
+     */
+    class alignas(32) Float8
+    {
+    public:
+        static constexpr std::size_t width = 8;
+
+        // Constructors
+        Float8() : Float8(0.0f) {}
+
+#if defined(MATH_SIMD_AVX2)
+        Float8(__m256 value) : m_value(value) {}
+
+        explicit Float8(float value) : m_value(_mm256_set1_ps(value)) {}
+
+        Float8(const Float4 &low, const Float4 &high)
+            : m_value(_mm256_set_m128(high.get_register(), low.get_register())) {}
+#else
+        explicit Float8(float value) : m_low(value), m_high(value) {}
+
+        Float8(const Float4 &low, const Float4 &high) : m_low(low), m_high(high) {}
+#endif
+
+        // Operators
+        Float8 operator+(const Float8 &other) const
+        {
+#if defined(MATH_SIMD_AVX2)
+            return _mm256_add_ps(m_value, other.m_value);
+#else
+            return Float8(m_low + other.m_low, m_high + other.m_high);
+#endif
+        }
+
+        Float8 operator-(const Float8 &other) const
+        {
+#if defined(MATH_SIMD_AVX2)
+            return _mm256_sub_ps(m_value, other.m_value);
+#else
+            return Float8(m_low - other.m_low, m_high - other.m_high);
+#endif
+        }
+
+        Float8 operator*(const Float8 &other) const
+        {
+#if defined(MATH_SIMD_AVX2)
+            return _mm256_mul_ps(m_value, other.m_value);
+#else
+            return Float8(m_low * other.m_low, m_high * other.m_high);
+#endif
+        }
+
+        Float8 operator/(const Float8 &other) const
+        {
+#if defined(MATH_SIMD_AVX2)
+            return _mm256_div_ps(m_value, other.m_value);
+#else
+            return Float8(m_low / other.m_low, m_high / other.m_high);
+#endif
+        }
+
+        Float8 operator-() const
+        {
+            return Float8() - *this;
+        }
+
+        Float8 &operator+=(const Float8 &other)
+        {
+            return *this = *this + other;
+        }
+
+        Float8 &operator-=(const Float8 &other)
+        {
+            return *this = *this - other;
+        }
+
+        Float8 &operator*=(const Float8 &other)
+        {
+            return *this = *this * other;
+        }
+
+        // Access Methods
+#if defined(MATH_SIMD_AVX2)
+        __m256 get_register() const
+        {
+            return m_value;
+        }
+#endif
+
+        /**
+         * @brief
+         * Gets the first four lanes
+         * @return Float4 The lower half
+         */
+        Float4 low() const
+        {
+#if defined(MATH_SIMD_AVX2)
+            return _mm256_castps256_ps128(m_value);
+#else
+            return m_low;
+#endif
+        }
+
+        /**
+         * @brief
+         * Gets the last four lanes
+         * @return Float4 The upper half
+         */
+        Float4 high() const
+        {
+#if defined(MATH_SIMD_AVX2)
+            return _mm256_extractf128_ps(m_value, 1);
+#else
+            return m_high;
+#endif
+        }
+
+        // Methods
+        /**
+         * @brief
+         * Writes the eight lanes to memory
+         * @param destination Eight floats, with no alignment requirement
+         */
+        void store(float *destination) const
+        {
+#if defined(MATH_SIMD_AVX2)
+            _mm256_storeu_ps(destination, m_value);
+#else
+            m_low.store(destination);
+            m_high.store(destination + 4);
+#endif
+        }
+
+        /**
+         * @brief
+         * Gathers the sign bit of every lane, which is set in the lanes of
+         * a comparison that hold
+         * @return int Bit i is the sign of lane i
+         */
+        int mask() const
+        {
+#if defined(MATH_SIMD_AVX2)
+            return _mm256_movemask_ps(m_value);
+#else
+            return m_low.mask() | (m_high.mask() << 4);
+#endif
+        }
+
+        /**
+         * @brief
+         * Calculates the square root of every lane
+         * @return Float8 The square roots
+         */
+        Float8 sqrt() const
+        {
+#if defined(MATH_SIMD_AVX2)
+            return _mm256_sqrt_ps(m_value);
+#else
+            return Float8(m_low.sqrt(), m_high.sqrt());
+#endif
+        }
+
+        // Static Methods
+        /**
+         * @brief
+         * Loads eight floats from memory
+         * @param source Eight floats, with no alignment requirement
+         * @return Float8 The loaded vector
+         */
+        static Float8 load(const float *source)
+        {
+#if defined(MATH_SIMD_AVX2)
+            return _mm256_loadu_ps(source);
+#else
+            return Float8(Float4::load(source), Float4::load(source + 4));
+#endif
+        }
+
+        /**
+         * @brief
+         * Multiplies two vectors and adds a third one, fused when the
+         * target supports it
+         * @param a The first factor
+         * @param b The second factor
+         * @param c The addend
+         * @return Float8 a * b + c
+         */
+        static Float8 multiply_add(const Float8 &a, const Float8 &b, const Float8 &c)
+        {
+#if defined(MATH_SIMD_AVX2) && defined(__FMA__)
+            return _mm256_fmadd_ps(a.m_value, b.m_value, c.m_value);
+#elif defined(MATH_SIMD_AVX2)
+            return _mm256_add_ps(_mm256_mul_ps(a.m_value, b.m_value), c.m_value);
+#else
+            return Float8(Float4::multiply_add(a.m_low, b.m_low, c.m_low),
+                          Float4::multiply_add(a.m_high, b.m_high, c.m_high));
+#endif
+        }
+
+        /**
+         * @brief
+         * Picks the smaller value of every pair of lanes
+         * @param a The first vector
+         * @param b The second vector
+         * @return Float8 The lane-wise minimum
+         */
+        static Float8 min(const Float8 &a, const Float8 &b)
+        {
+#if defined(MATH_SIMD_AVX2)
+            return _mm256_min_ps(a.m_value, b.m_value);
+#else
+            return Float8(Float4::min(a.m_low, b.m_low), Float4::min(a.m_high, b.m_high));
+#endif
+        }
+
+        /**
+         * @brief
+         * Picks the larger value of every pair of lanes
+         * @param a The first vector
+         * @param b The second vector
+         * @return Float8 The lane-wise maximum
+         */
+        static Float8 max(const Float8 &a, const Float8 &b)
+        {
+#if defined(MATH_SIMD_AVX2)
+            return _mm256_max_ps(a.m_value, b.m_value);
+#else
+            return Float8(Float4::max(a.m_low, b.m_low), Float4::max(a.m_high, b.m_high));
+#endif
+        }
+
+        /**
+         * @brief
+         * Compares every pair of lanes
+         * @param a The first vector
+         * @param b The second vector
+         * @return Float8 All bits set in the lanes where a < b, zero in the
+         * others
+         */
+        static Float8 less(const Float8 &a, const Float8 &b)
+        {
+#if defined(MATH_SIMD_AVX2)
+            return _mm256_cmp_ps(a.m_value, b.m_value, _CMP_LT_OQ);
+#else
+            return Float8(Float4::less(a.m_low, b.m_low), Float4::less(a.m_high, b.m_high));
+#endif
+        }
+
+        /**
+         * @brief
+         * Picks the lanes of a where the mask is set and of b elsewhere
+         * @param mask The result of a comparison
+         * @param a The lanes to pick where the mask is set
+         * @param b The lanes to pick elsewhere
+         * @return Float8 The blended vector
+         */
+        static Float8 select(const Float8 &mask, const Float8 &a, const Float8 &b)
+        {
+#if defined(MATH_SIMD_AVX2)
+            return _mm256_blendv_ps(b.m_value, a.m_value, mask.m_value);
+#else
+            return Float8(Float4::select(mask.m_low, a.m_low, b.m_low),
+                          Float4::select(mask.m_high, a.m_high, b.m_high));
+#endif
+        }
+
+        /**
+         * @brief
+         * Broadcasts one lane of each half to every lane of that half, as
+         * Float4::splat on both halves. With two RGBA pixels per vector,
+         * splat_halves<3> gives the alpha of each pixel.
+         * @tparam Lane The lane of each half to broadcast
+         * @param value The vector
+         * @return Float8 The broadcast lanes
+         */
+        template <int Lane>
+        static Float8 splat_halves(const Float8 &value)
+        {
+            static_assert(Lane >= 0 && Lane < 4, "Splat lane must be between 0 and 3");
+
+#if defined(MATH_SIMD_AVX2)
+            return _mm256_permute_ps(value.m_value, _MM_SHUFFLE(Lane, Lane, Lane, Lane));
+#else
+            return Float8(Float4::splat<Lane>(value.m_low), Float4::splat<Lane>(value.m_high));
+#endif
+        }
+
+    private:
+#if defined(MATH_SIMD_AVX2)
+        __m256 m_value;
+#else
+        Float4 m_low;
+        Float4 m_high;
+#endif
+    };
+
+    // Widest float vector of the target: batch kernels step through their
+    // arrays this many lanes at a time
+#if defined(MATH_SIMD_AVX2)
+    using WideFloat = Float8;
+#else
+    using WideFloat = Float4;
+#endif
+}
@@ -0,0 +1,298 @@
+/**
+ * @file gemm.h
+ * @author Carlos Salguero
+ * @brief Cache-blocked general matrix multiplication
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+// Project files
+#include "aligned_allocator.h"
+#include "float4.h"
+#include "../../threads/thread_pool.h"
+
+namespace Math
+{
+    namespace Detail
+    {
+        // Register block: the micro-kernel keeps an MR x NR tile of C in
+        // registers, eight accumulators of 128 or 256 bits for float
+        inline constexpr std::size_t GEMM_MR = 4;
+#if defined(MATH_SIMD_AVX2)
+        inline constexpr std::size_t GEMM_NR = 16;
+#else
+        inline constexpr std::size_t GEMM_NR = 8;
+#endif
+
+        // Cache blocks: a packed KC x NR panel of B stays in L1, a packed
+        // MC x KC block of A in L2 and a KC x NC panel of B in L3
+        inline constexpr std::size_t GEMM_MC = 128;
+        inline constexpr std::size_t GEMM_KC = 256;
+        inline constexpr std::size_t GEMM_NC = 2048;
+
+        static_assert(GEMM_MC % GEMM_MR == 0, "A packed block of A holds whole register blocks");
+
+        // Products with at most this many multiply-adds skip the packing
+        inline constexpr std::size_t GEMM_SMALL_SIZE = 48 * 48 * 48;
+
+        template <class T>
+        using GemmBuffer = std::vector<T, AlignedAllocator<T>>;
+
+        /**
+         * @brief
+         * Multiplies small matrices with a row-major loop order, unrolled
+         * by four along the columns of C
+         * @tparam T Type of the elements
+         */
+        template <class T>
+        void gemm_small(std::size_t m, std::size_t n, std::size_t k,
+                        const T *a, std::size_t lda, const T *b, std::size_t ldb,
+                        T *c, std::size_t ldc)
+        {
+            for (std::size_t i = 0; i < m; ++i)
+            {
+                T *c_row = c + i * ldc;
+                std::fill(c_row, c_row + n, T());
+
+                for (std::size_t p = 0; p < k; ++p)
+                {
+                    const T a_value = a[i * lda + p];
+                    const T *b_row = b + p * ldb;
+                    std::size_t j = 0;
+
+                    for (; j + 4 <= n; j += 4)
+                    {
+                        c_row[j] += a_value * b_row[j];
+                        c_row[j + 1] += a_value * b_row[j + 1];
+                        c_row[j + 2] += a_value * b_row[j + 2];
+                        c_row[j + 3] += a_value * b_row[j + 3];
+                    }
+
+                    for (; j < n; ++j)
+                        c_row[j] += a_value * b_row[j];
+                }
+            }
+        }
+
+        /**
+         * @brief
+         * Copies a block of A into MR-row panels, each stored column by
+         * column. Rows past the edge are padded with zeros.
+         * @tparam T Type of the elements
+         */
+        template <class T>
+        void pack_a(std::size_t mc, std::size_t kc, const T *a, std::size_t lda, T *buffer)
+        {
+            for (std::size_t i0 = 0; i0 < mc; i0 += GEMM_MR)
+                for (std::size_t p = 0; p < kc; ++p)
+                    for (std::size_t i = 0; i < GEMM_MR; ++i)
+                        *buffer++ = i0 + i < mc ? a[(i0 + i) * lda + p] : T();
+        }
+
+        /**
+         * @brief
+         * Copies a panel of B into NR-column slivers, each stored row by
+         * row. Columns past the edge are padded with zeros.
+         * @tparam T Type of the elements
+         */
+        template <class T>
+        void pack_b(std::size_t kc, std::size_t nc, const T *b, std::size_t ldb, T *buffer)
+        {
+            for (std::size_t j0 = 0; j0 < nc; j0 += GEMM_NR)
+                for (std::size_t p = 0; p < kc; ++p)
+                    for (std::size_t j = 0; j < GEMM_NR; ++j)
+                        *buffer++ = j0 + j < nc ? b[p * ldb + j0 + j] : T();
+        }
+
+        /**
+         * @brief
+         * Multiplies a packed MR x KC panel of A by a packed KC x NR sliver
+         * of B and adds the tile to C. Only the valid rows and columns of the
+         * tile are written.
+         * @tparam T Type of the elements
+         */
+        template <class T>
+        void micro_kernel(std::size_t kc, const T *a, const T *b, T *c,
+                          std::size_t ldc, std::size_t rows, std::size_t cols)
+        {
+            T tile[GEMM_MR][GEMM_NR] = {};
+
+#if defined(MATH_SIMD_AVX2)
+            if constexpr (std::is_same_v<T, float>)
+            {
+                __m256 sum[GEMM_MR][2] = {};
+
+                for (std::size_t p = 0; p < kc; ++p, a += GEMM_MR, b += GEMM_NR)
+                {
+                    __m256 b0 = _mm256_loadu_ps(b);
+                    __m256 b1 = _mm256_loadu_ps(b + 8);
+
+                    for (std::size_t i = 0; i < GEMM_MR; ++i)
+                    {
+                        __m256 a_value = _mm256_broadcast_ss(a + i);
+#if defined(__FMA__)
+                        sum[i][0] = _mm256_fmadd_ps(a_value, b0, sum[i][0]);
+                        sum[i][1] = _mm256_fmadd_ps(a_value, b1, sum[i][1]);
+#else
+                        sum[i][0] = _mm256_add_ps(_mm256_mul_ps(a_value, b0), sum[i][0]);
+                        sum[i][1] = _mm256_add_ps(_mm256_mul_ps(a_value, b1), sum[i][1]);
+#endif
+                    }
+                }
+
+                for (std::size_t i = 0; i < GEMM_MR; ++i)
+                {
+                    _mm256_storeu_ps(tile[i], sum[i][0]);
+                    _mm256_storeu_ps(tile[i] + 8, sum[i][1]);
+                }
+            }
+#else
+            if constexpr (std::is_same_v<T, float>)
+            {
+                Simd::Float4 sum[GEMM_MR][2];
+
+                for (std::size_t p = 0; p < kc; ++p, a += GEMM_MR, b += GEMM_NR)
+                {
+                    Simd::Float4 b0 = Simd::Float4::load(b);
+                    Simd::Float4 b1 = Simd::Float4::load(b + 4);
+
+                    for (std::size_t i = 0; i < GEMM_MR; ++i)
+                    {
+                        Simd::Float4 a_value(a[i]);
+                        sum[i][0] = Simd::Float4::multiply_add(a_value, b0, sum[i][0]);
+                        sum[i][1] = Simd::Float4::multiply_add(a_value, b1, sum[i][1]);
+                    }
+                }
+
+                for (std::size_t i = 0; i < GEMM_MR; ++i)
+                {
+                    sum[i][0].store(tile[i]);
+                    sum[i][1].store(tile[i] + 4);
+                }
+            }
+#endif
+            else
+            {
+                for (std::size_t p = 0; p < kc; ++p, a += GEMM_MR, b += GEMM_NR)
+                    for (std::size_t i = 0; i < GEMM_MR; ++i)
+                        for (std::size_t j = 0; j < GEMM_NR; ++j)
+                            tile[i][j] += a[i] * b[j];
+            }
+
+            for (std::size_t i = 0; i < rows; ++i)
+                for (std::size_t j = 0; j < cols; ++j)
+                    c[i * ldc + j] += tile[i][j];
+        }
+
+        /**
+         * @brief
+         * Multiplies a band of rows of A by a packed panel of B and adds the
+         * result to the matching band of C
+         * @tparam T Type of the elements
+         */
+        template <class T>
+        void gemm_band(std::size_t mc, std::size_t nc, std::size_t kc,
+                       const T *a, std::size_t lda, const T *packed_b,
+                       T *c, std::size_t ldc)
+        {
+            // One block of A per thread, allocated on its first band
+            thread_local GemmBuffer<T> packed_a(GEMM_MC * GEMM_KC);
+            pack_a(mc, kc, a, lda, packed_a.data());
+
+            for (std::size_t j0 = 0; j0 < nc; j0 += GEMM_NR)
+                for (std::size_t i0 = 0; i0 < mc; i0 += GEMM_MR)
+                    micro_kernel(kc, packed_a.data() + i0 * kc,
+                                 packed_b + j0 * kc, c + i0 * ldc + j0, ldc,
+                                 std::min(GEMM_MR, mc - i0),
+                                 std::min(GEMM_NR, nc - j0));
+        }
+    }
+
+    /**
+     * @brief
+     * Computes C = A * B for row-major matrices given as pointers and
+     * leading dimensions. Large products are split into cache blocks, with
+     * the bands of rows of each block spread over the thread pool when one
+     * is given. Small products go to an unrolled loop without packing. The
+     * function must not be called from a task of the same thread pool.
+     * @tparam T Type of the elements
+     * @param m Rows of A and C
+     * @param n Columns of B and C
+     * @param k Columns of A and rows of B
+     * @param a First element of A
+     * @param lda Distance between two rows of A
+     * @param b First element of B
+     * @param ldb Distance between two rows of B
+     * @param c First element of C, which must not overlap A or B
+     * @param ldc Distance between two rows of C
+     * @param thread_pool Thread pool to run on, or nullptr
+     */
+    template <class T>
+    void gemm(std::size_t m, std::size_t n, std::size_t k,
+              const T *a, std::size_t lda, const T *b, std::size_t ldb,
+              T *c, std::size_t ldc, ThreadPool *thread_pool = nullptr)
+    {
+        if (m == 0 || n == 0)
+            return;
+
+        if (m * n * k <= Detail::GEMM_SMALL_SIZE)
+        {
+            Detail::gemm_small(m, n, k, a, lda, b, ldb, c, ldc);
+            return;
+        }
+
+        for (std::size_t i = 0; i < m; ++i)
+            std::fill(c + i * ldc, c + i * ldc + n, T());
+
+        Detail::GemmBuffer<T> packed_b;
+
+        for (std::size_t j0 = 0; j0 < n; j0 += Detail::GEMM_NC)
+        {
+            std::size_t nc = std::min(Detail::GEMM_NC, n - j0);
+
+            for (std::size_t p0 = 0; p0 < k; p0 += Detail::GEMM_KC)
+            {
+                std::size_t kc = std::min(Detail::GEMM_KC, k - p0);
+
+                packed_b.resize(((nc + Detail::GEMM_NR - 1) / Detail::GEMM_NR) *
+                                Detail::GEMM_NR * kc);
+                Detail::pack_b(kc, nc, b + p0 * ldb + j0, ldb, packed_b.data());
+
+                auto band = [&, j0, p0, nc, kc](std::size_t i0)
+                {
+                    Detail::gemm_band(std::min(Detail::GEMM_MC, m - i0), nc, kc,
+                                      a + i0 * lda + p0, lda, packed_b.data(),
+                                      c + i0 * ldc + j0, ldc);
+                };
+
+                if (thread_pool == nullptr || m <= Detail::GEMM_MC)
+                {
+                    for (std::size_t i0 = 0; i0 < m; i0 += Detail::GEMM_MC)
+                        band(i0);
+
+                    continue;
+                }
+
+                // The bands read packed_b: the group outlives none of them
+                TaskGroup tasks(*thread_pool);
+
+                for (std::size_t i0 = Detail::GEMM_MC; i0 < m; i0 += Detail::GEMM_MC)
+                    tasks.run(band, i0);
+
+                band(0);
+                tasks.wait();
+            }
+        }
+    }
+}
@@ -0,0 +1,973 @@
+/**
+ * @file geometry.h
+ * @author Carlos Salguero
+ * @brief Geometric primitives and their intersection tests, one at a time
+ *        and in SIMD batches for culling and broadphase
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+// Project files
+#include "batch_transform.h"
+#include "float8.h"
+#include "mat.h"
+#include "quaternion.h"
+#include "vec.h"
+
+namespace Math
+{
+    namespace Detail
+    {
+        /**
+         * @brief
+         * Inverts a ray direction for the slab test. Components too small
+         * to invert are replaced by a tiny value of the same sign, so a ray
+         * lying on a face plane gives 0 instead of the NaN of 0 * infinity.
+         * @param direction A component of the direction
+         * @return float Its reciprocal, finite
+         */
+        inline float slab_inverse(float direction)
+        {
+            constexpr float tiny = 1e-30f;
+
+            return 1.0f / (std::abs(direction) < tiny ? std::copysign(tiny, direction) : direction);
+        }
+    }
+
+    /**
+     * @struct Aabb
+     * @brief Axis-aligned bounding box. The default box is empty: its
+     *        minimum is above its maximum, so merging anything into it
+     *        gives that thing's bounds.
+     */
+    struct Aabb
+    {
+        Vec3 min = Vec3(std::numeric_limits<float>::infinity());
+        Vec3 max = Vec3(-std::numeric_limits<float>::infinity());
+
+        // Constructors
+        Aabb() = default;
+
+        /**
+         * @brief
+         * Constructs a box from its corners
+         * @param min The corner with the smallest coordinates
+         * @param max The corner with the largest coordinates
+         */
+        Aabb(const Vec3 &min, const Vec3 &max) : min(min), max(max) {}
+
+        // Methods
+        /**
+         * @brief
+         * Checks whether the box holds no point
+         * @return true If some minimum is above its maximum
+         * @return false Otherwise
+         */
+        bool empty() const
+        {
+            return min.x() > max.x() || min.y() > max.y() || min.z() > max.z();
+        }
+
+        /**
+         * @brief
+         * Gets the center of the box
+         * @return Vec3 The center
+         */
+        Vec3 center() const
+        {
+            return (min + max) * 0.5f;
+        }
+
+        /**
+         * @brief
+         * Gets half the size of the box along each axis
+         * @return Vec3 The half extents
+         */
+        Vec3 extents() const
+        {
+            return (max - min) * 0.5f;
+        }
+
+        /**
+         * @brief
+         * Calculates the surface area, the cost used to build bounding
+         * volume hierarchies
+         * @return float The surface area
+         */
+        float surface_area() const
+        {
+            Vec3 size = max - min;
+            return 2.0f * (size.x() * size.y() + size.y() * size.z() + size.z() * size.x());
+        }
+
+        /**
+         * @brief
+         * Checks whether a point is inside the box or on its boundary
+         * @param point The point
+         * @return true If the point is inside
+         * @return false Otherwise
+         */
+        bool contains(const Vec3 &point) const
+        {
+            return point.x() >= min.x() && point.x() <= max.x() &&
+                   point.y() >= min.y() && point.y() <= max.y() &&
+                   point.z() >= min.z() && point.z() <= max.z();
+        }
+
+        /**
+         * @brief
+         * Checks whether two boxes overlap. Touching boxes overlap.
+         * @param other The other box
+         * @return true If they overlap
+         * @return false Otherwise
+         */
+        bool intersects(const Aabb &other) const
+        {
+            return min.x() <= other.max.x() && other.min.x() <= max.x() &&
+                   min.y() <= other.max.y() && other.min.y() <= max.y() &&
+                   min.z() <= other.max.z() && other.min.z() <= max.z();
+        }
+
+        /**
+         * @brief
+         * Grows the box to hold a point
+         * @param point The point
+         * @return Aabb The grown box
+         */
+        Aabb merge(const Vec3 &point) const
+        {
+            return Aabb(Vec3(std::min(min.x(), point.x()), std::min(min.y(), point.y()),
+                             std::min(min.z(), point.z())),
+                        Vec3(std::max(max.x(), point.x()), std::max(max.y(), point.y()),
+                             std::max(max.z(), point.z())));
+        }
+
+        /**
+         * @brief
+         * Grows the box to hold another one
+         * @param other The other box
+         * @return Aabb The union of both boxes
+         */
+        Aabb merge(const Aabb &other) const
+        {
+            return merge(other.min).merge(other.max);
+        }
+
+        /**
+         * @brief
+         * Calculates the bounds of the transformed box. The center is
+         * transformed and the extents are projected on the absolute value
+         * of the 3x3 block, which is exact for an affine matrix.
+         * @param matrix The affine transform
+         * @return Aabb The bounds of the transformed box
+         */
+        Aabb transform(const Mat4 &matrix) const
+        {
+            Vec3 c = center();
+            Vec3 e = extents();
+            Vec3 new_center;
+            Vec3 new_extents;
+
+            for (std::size_t i = 0; i < 3; ++i)
+            {
+                new_center[i] = matrix(i, 3);
+
+                for (std::size_t j = 0; j < 3; ++j)
+                {
+                    new_center[i] += matrix(i, j) * c[j];
+                    new_extents[i] += std::abs(matrix(i, j)) * e[j];
+                }
+            }
+
+            return Aabb(new_center - new_extents, new_center + new_extents);
+        }
+
+        // Static Methods
+        /**
+         * @brief
+         * Calculates the bounds of a set of points
+         * @param points The points
+         * @return Aabb The smallest box holding them, empty if there are none
+         */
+        static Aabb from_points(std::span<const Vec3> points)
+        {
+            Aabb result;
+
+            for (const Vec3 &point : points)
+                result = result.merge(point);
+
+            return result;
+        }
+    };
+
+    /**
+     * @struct Sphere
+     * @brief Sphere given by its center and radius
+     */
+    struct Sphere
+    {
+        Vec3 center;
+        float radius = 0.0f;
+
+        // Constructors
+        Sphere() = default;
+        Sphere(const Vec3 &center, float radius) : center(center), radius(radius) {}
+
+        // Methods
+        /**
+         * @brief
+         * Checks whether a point is inside the sphere or on its surface
+         * @param point The point
+         * @return true If the point is inside
+         * @return false Otherwise
+         */
+        bool contains(const Vec3 &point) const
+        {
+            return (point - center).squared_magnitude() <= radius * radius;
+        }
+
+        /**
+         * @brief
+         * Checks whether two spheres overlap
+         * @param other The other sphere
+         * @return true If they overlap
+         * @return false Otherwise
+         */
+        bool intersects(const Sphere &other) const
+        {
+            float sum = radius + other.radius;
+            return (other.center - center).squared_magnitude() <= sum * sum;
+        }
+
+        /**
+         * @brief
+         * Checks whether the sphere overlaps a box, through the point of
+         * the box closest to the center
+         * @param box The box
+         * @return true If they overlap
+         * @return false Otherwise
+         */
+        bool intersects(const Aabb &box) const
+        {
+            Vec3 closest(std::clamp(center.x(), box.min.x(), box.max.x()),
+                         std::clamp(center.y(), box.min.y(), box.max.y()),
+                         std::clamp(center.z(), box.min.z(), box.max.z()));
+
+            return contains(closest);
+        }
+
+        /**
+         * @brief
+         * Gets the bounds of the sphere
+         * @return Aabb The bounding box
+         */
+        Aabb bounds() const
+        {
+            return Aabb(center - Vec3(radius), center + Vec3(radius));
+        }
+    };
+
+    /**
+     * @struct Plane
+     * @brief Plane of the points p with dot(normal, p) + distance = 0. The
+     *        side the normal points to is the front.
+     */
+    struct Plane
+    {
+        Vec3 normal = Vec3(0.0f, 1.0f, 0.0f);
+        float distance = 0.0f;
+
+        // Constructors
+        Plane() = default;
+        Plane(const Vec3 &normal, float distance) : normal(normal), distance(distance) {}
+
+        // Methods
+        /**
+         * @brief
+         * Calculates the distance from the plane to a point, scaled by the
+         * length of the normal. Positive in front of the plane.
+         * @param point The point
+         * @return float The signed distance
+         */
+        float signed_distance(const Vec3 &point) const
+        {
+            return normal.dot(point) + distance;
+        }
+
+        /**
+         * @brief
+         * Scales the plane so its normal has unit length
+         * @return Plane The normalized plane
+         * @throws std::invalid_argument If the normal is zero
+         */
+        Plane normalize() const
+        {
+            float length = normal.magnitude();
+
+            if (length == 0.0f)
+                throw std::invalid_argument("Plane normal is zero");
+
+            return Plane(normal / length, distance / length);
+        }
+
+        // Static Methods
+        /**
+         * @brief
+         * Constructs the plane through a point
+         * @param point A point of the plane
+         * @param normal The normal, which need not have unit length
+         * @return Plane The plane
+         */
+        static Plane from_point_normal(const Vec3 &point, const Vec3 &normal)
+        {
+            return Plane(normal, -normal.dot(point));
+        }
+
+        /**
+         * @brief
+         * Constructs the plane through three points. Seen from the front,
+         * they run counterclockwise.
+         * @param a The first point
+         * @param b The second point
+         * @param c The third point
+         * @return Plane The normalized plane
+         * @throws std::invalid_argument If the points are collinear
+         */
+        static Plane from_points(const Vec3 &a, const Vec3 &b, const Vec3 &c)
+        {
+            return from_point_normal(a, (b - a).cross(c - a)).normalize();
+        }
+    };
+
+    /**
+     * @struct Ray
+     * @brief Half-line from an origin along a direction
+     */
+    struct Ray
+    {
+        Vec3 origin;
+        Vec3 direction = Vec3(0.0f, 0.0f, 1.0f);
+
+        // Constructors
+        Ray() = default;
+        Ray(const Vec3 &origin, const Vec3 &direction) : origin(origin), direction(direction) {}
+
+        // Methods
+        /**
+         * @brief
+         * Gets the point at a distance along the ray, in units of the
+         * direction's length
+         * @param t The distance
+         * @return Vec3 origin + t * direction
+         */
+        Vec3 at(float t) const
+        {
+            return origin + direction * t;
+        }
+
+        /**
+         * @brief
+         * Intersects the ray with a box by clipping it against the three
+         * slabs of the box
+         * @param box The box
+         * @return std::optional<float> The distance to the entry point, zero
+         * when the origin is inside, or nothing on a miss
+         */
+        std::optional<float> intersect(const Aabb &box) const
+        {
+            if (box.empty())
+                return std::nullopt;
+
+            float near = 0.0f;
+            float far = std::numeric_limits<float>::infinity();
+
+            for (std::size_t i = 0; i < 3; ++i)
+            {
+                float inverse = Detail::slab_inverse(direction[i]);
+                float t1 = (box.min[i] - origin[i]) * inverse;
+                float t2 = (box.max[i] - origin[i]) * inverse;
+
+                near = std::max(near, std::min(t1, t2));
+                far = std::min(far, std::max(t1, t2));
+            }
+
+            if (near > far)
+                return std::nullopt;
+
+            return near;
+        }
+
+        /**
+         * @brief
+         * Intersects the ray with a sphere
+         * @param sphere The sphere
+         * @return std::optional<float> The distance to the first point of
+         * the sphere along the ray, zero when the origin is inside, or
+         * nothing on a miss
+         */
+        std::optional<float> intersect(const Sphere &sphere) const
+        {
+            Vec3 offset = origin - sphere.center;
+            float a = direction.squared_magnitude();
+            float b = offset.dot(direction);
+            float c = offset.squared_magnitude() - sphere.radius * sphere.radius;
+            float discriminant = b * b - a * c;
+
+            if (discriminant < 0.0f || a == 0.0f)
+                return std::nullopt;
+
+            float root = std::sqrt(discriminant);
+            float far = (-b + root) / a;
+
+            if (far < 0.0f)
+                return std::nullopt;
+
+            return std::max((-b - root) / a, 0.0f);
+        }
+
+        /**
+         * @brief
+         * Intersects the ray with a plane
+         * @param plane The plane
+         * @return std::optional<float> The distance to the plane, or nothing
+         * if the ray is parallel to it or points away
+         */
+        std::optional<float> intersect(const Plane &plane) const
+        {
+            float speed = plane.normal.dot(direction);
+
+            if (speed == 0.0f)
+                return std::nullopt;
+
+            float t = -plane.signed_distance(origin) / speed;
+
+            if (t < 0.0f)
+                return std::nullopt;
+
+            return t;
+        }
+    };
+
+    /**
+     * @struct Obb
+     * @brief Oriented bounding box: a box with half extents along the axes
+     *        of a rotation, around a center
+     */
+    struct Obb
+    {
+        Vec3 center;
+        Vec3 half_extents;
+        Quaternion<float> orientation;
+
+        // Constructors
+        Obb() = default;
+        Obb(const Vec3 &center, const Vec3 &half_extents, const Quaternion<float> &orientation)
+            : center(center), half_extents(half_extents), orientation(orientation) {}
+
+        // Methods
+        /**
+         * @brief
+         * Gets the axes of the box, the columns of its rotation
+         * @return std::array<Vec3, 3> The unit axes
+         */
+        std::array<Vec3, 3> axes() const
+        {
+            Mat3 rotation = orientation.to_mat3();
+
+            return {Vec3(rotation(0, 0), rotation(1, 0), rotation(2, 0)),
+                    Vec3(rotation(0, 1), rotation(1, 1), rotation(2, 1)),
+                    Vec3(rotation(0, 2), rotation(1, 2), rotation(2, 2))};
+        }
+
+        /**
+         * @brief
+         * Checks whether a point is inside the box or on its boundary
+         * @param point The point
+         * @return true If the point is inside
+         * @return false Otherwise
+         */
+        bool contains(const Vec3 &point) const
+        {
+            Vec3 local = orientation.conjugate().rotate(point - center);
+
+            return std::abs(local.x()) <= half_extents.x() &&
+                   std::abs(local.y()) <= half_extents.y() &&
+                   std::abs(local.z()) <= half_extents.z();
+        }
+
+        /**
+         * @brief
+         * Gets the bounds of the box
+         * @return Aabb The smallest axis-aligned box holding it
+         */
+        Aabb bounds() const
+        {
+            return Aabb(-half_extents, half_extents)
+                .transform(Mat4::translation(center) * orientation.to_mat4());
+        }
+
+        /**
+         * @brief
+         * Checks whether two boxes overlap with the separating axis test:
+         * the three face normals of each box and the nine cross products
+         * of their edges
+         * @param other The other box
+         * @return true If they overlap
+         * @return false Otherwise
+         */
+        bool intersects(const Obb &other) const
+        {
+            constexpr float epsilon = 1e-6f;
+            std::array<Vec3, 3> a = axes();
+            std::array<Vec3, 3> b = other.axes();
+            float rotation[3][3];
+            float absolute[3][3];
+
+            // Rotation of the other box in this box's frame. The epsilon
+            // keeps near-parallel edges from producing a zero axis.
+            for (std::size_t i = 0; i < 3; ++i)
+                for (std::size_t j = 0; j < 3; ++j)
+                {
+                    rotation[i][j] = a[i].dot(b[j]);
+                    absolute[i][j] = std::abs(rotation[i][j]) + epsilon;
+                }
+
+            Vec3 offset = other.center - center;
+            float t[3] = {offset.dot(a[0]), offset.dot(a[1]), offset.dot(a[2])};
+            const Vec3 &ea = half_extents;
+            const Vec3 &eb = other.half_extents;
+
+            for (std::size_t i = 0; i < 3; ++i)
+            {
+                float ra = ea[i];
+                float rb = eb[0] * absolute[i][0] + eb[1] * absolute[i][1] + eb[2] * absolute[i][2];
+
+                if (std::abs(t[i]) > ra + rb)
+                    return false;
+            }
+
+            for (std::size_t j = 0; j < 3; ++j)
+            {
+                float ra = ea[0] * absolute[0][j] + ea[1] * absolute[1][j] + ea[2] * absolute[2][j];
+                float rb = eb[j];
+                float distance = t[0] * rotation[0][j] + t[1] * rotation[1][j] + t[2] * rotation[2][j];
+
+                if (std::abs(distance) > ra + rb)
+                    return false;
+            }
+
+            for (std::size_t i = 0; i < 3; ++i)
+            {
+                std::size_t i1 = (i + 1) % 3;
+                std::size_t i2 = (i + 2) % 3;
+
+                for (std::size_t j = 0; j < 3; ++j)
+                {
+                    std::size_t j1 = (j + 1) % 3;
+                    std::size_t j2 = (j + 2) % 3;
+
+                    float ra = ea[i1] * absolute[i2][j] + ea[i2] * absolute[i1][j];
+                    float rb = eb[j1] * absolute[i][j2] + eb[j2] * absolute[i][j1];
+                    float distance = t[i2] * rotation[i1][j] - t[i1] * rotation[i2][j];
+
+                    if (std::abs(distance) > ra + rb)
+                        return false;
+                }
+            }
+
+            return true;
+        }
+    };
+
+    /**
+     * @struct Frustum
+     * @brief Six planes facing inwards: left, right, bottom, top, near, far
+     */
+    struct Frustum
+    {
+        std::array<Plane, 6> planes;
+
+        // Methods
+        /**
+         * @brief
+         * Checks whether a point is inside the frustum
+         * @param point The point
+         * @return true If the point is inside
+         * @return false Otherwise
+         */
+        bool contains(const Vec3 &point) const
+        {
+            return std::all_of(planes.begin(), planes.end(), [&](const Plane &plane)
+                               { return plane.signed_distance(point) >= 0.0f; });
+        }
+
+        /**
+         * @brief
+         * Checks whether a sphere may be visible
+         * @param sphere The sphere
+         * @return true If the sphere is not fully behind any plane
+         * @return false Otherwise
+         */
+        bool intersects(const Sphere &sphere) const
+        {
+            return std::all_of(planes.begin(), planes.end(), [&](const Plane &plane)
+                               { return plane.signed_distance(sphere.center) >= -sphere.radius; });
+        }
+
+        /**
+         * @brief
+         * Checks whether a box may be visible. Like every plane-by-plane
+         * test it keeps some boxes near the corners that are outside.
+         * @param box The box
+         * @return true If the box is not fully behind any plane
+         * @return false Otherwise
+         */
+        bool intersects(const Aabb &box) const
+        {
+            Vec3 center = box.center();
+            Vec3 extents = box.extents();
+
+            return std::all_of(planes.begin(), planes.end(), [&](const Plane &plane)
+                               {
+                                   float radius = std::abs(plane.normal.x()) * extents.x() +
+                                                  std::abs(plane.normal.y()) * extents.y() +
+                                                  std::abs(plane.normal.z()) * extents.z();
+                                   return plane.signed_distance(center) >= -radius; });
+        }
+
+        // Static Methods
+        /**
+         * @brief
+         * Extracts the planes of a view-projection matrix with the
+         * Gribb-Hartmann method, for OpenGL clip space (-w <= z <= w)
+         * @param view_projection The matrix that maps world to clip space
+         * @return Frustum The frustum, with normalized planes
+         */
+        static Frustum from_matrix(const Mat4 &view_projection)
+        {
+            auto row = [&](std::size_t i)
+            {
+                return Vec4(view_projection(i, 0), view_projection(i, 1),
+                            view_projection(i, 2), view_projection(i, 3));
+            };
+
+            auto plane = [](const Vec4 &coefficients)
+            {
+                return Plane(Vec3(coefficients.x(), coefficients.y(), coefficients.z()),
+                             coefficients.w())
+                    .normalize();
+            };
+
+            Vec4 w = row(3);
+            Frustum result;
+
+            for (std::size_t i = 0; i < 3; ++i)
+            {
+                result.planes[2 * i] = plane(w + row(i));
+                result.planes[2 * i + 1] = plane(w - row(i));
+            }
+
+            return result;
+        }
+    };
+
+    /**
+     * @struct Aabb8
+     * @brief Up to eight boxes with each coordinate in one register, so one
+     *        test runs on all of them at once. Lanes past the count never
+     *        report a hit.
+     */
+    struct Aabb8
+    {
+        Simd::Float8 min_x, min_y, min_z;
+        Simd::Float8 max_x, max_y, max_z;
+        std::size_t count = 0;
+
+        // Methods
+        /**
+         * @brief
+         * Intersects a ray with the boxes using the slab test
+         * @param ray The ray
+         * @param max_distance Hits farther than this are ignored
+         * @param distances Receives the entry distance of every lane, or
+         * nullptr; meaningful only for the lanes that hit
+         * @return int Bit i is set if the ray hits box i
+         */
+        int intersect(const Ray &ray, float max_distance, float *distances = nullptr) const
+        {
+            using Simd::Float8;
+
+            Float8 near(0.0f);
+            Float8 far(max_distance);
+
+            auto slab = [&](const Float8 &low, const Float8 &high, float origin, float direction)
+            {
+                Float8 start(origin);
+                Float8 inverse(Detail::slab_inverse(direction));
+                Float8 t1 = (low - start) * inverse;
+                Float8 t2 = (high - start) * inverse;
+
+                near = Float8::max(near, Float8::min(t1, t2));
+                far = Float8::min(far, Float8::max(t1, t2));
+            };
+
+            slab(min_x, max_x, ray.origin.x(), ray.direction.x());
+            slab(min_y, max_y, ray.origin.y(), ray.direction.y());
+            slab(min_z, max_z, ray.origin.z(), ray.direction.z());
+
+            if (distances != nullptr)
+                near.store(distances);
+
+            // Empty boxes give near = 0 and far = max_distance, which
+            // passes the test above, so they are masked out here
+            int empty = Float8::less(max_x, min_x).mask() | Float8::less(max_y, min_y).mask() |
+                        Float8::less(max_z, min_z).mask();
+
+            return ~(Float8::less(far, near).mask() | empty) & lanes();
+        }
+
+        /**
+         * @brief
+         * Checks which boxes overlap another one
+         * @param box The box to test against
+         * @return int Bit i is set if box i overlaps it
+         */
+        int intersects(const Aabb &box) const
+        {
+            using Simd::Float8;
+
+            // A separating axis on any side rules the pair out
+            int separated = Float8::less(Float8(box.max.x()), min_x).mask() |
+                            Float8::less(max_x, Float8(box.min.x())).mask() |
+                            Float8::less(Float8(box.max.y()), min_y).mask() |
+                            Float8::less(max_y, Float8(box.min.y())).mask() |
+                            Float8::less(Float8(box.max.z()), min_z).mask() |
+                            Float8::less(max_z, Float8(box.min.z())).mask();
+
+            return ~separated & lanes();
+        }
+
+        /**
+         * @brief
+         * Gets the mask of the lanes that hold a box
+         * @return int One bit per box
+         */
+        int lanes() const
+        {
+            return static_cast<int>((1u << count) - 1u);
+        }
+
+        // Static Methods
+        /**
+         * @brief
+         * Packs up to eight boxes
+         * @param boxes The boxes
+         * @return Aabb8 The packed boxes
+         * @throws std::invalid_argument If there are more than eight
+         */
+        static Aabb8 load(std::span<const Aabb> boxes)
+        {
+            if (boxes.size() > Simd::Float8::width)
+                throw std::invalid_argument("Aabb8 holds at most eight boxes");
+
+            alignas(32) float values[6][8] = {};
+
+            for (std::size_t i = 0; i < boxes.size(); ++i)
+                for (std::size_t axis = 0; axis < 3; ++axis)
+                {
+                    values[axis][i] = boxes[i].min[axis];
+                    values[axis + 3][i] = boxes[i].max[axis];
+                }
+
+            Aabb8 result;
+            result.min_x = Simd::Float8::load(values[0]);
+            result.min_y = Simd::Float8::load(values[1]);
+            result.min_z = Simd::Float8::load(values[2]);
+            result.max_x = Simd::Float8::load(values[3]);
+            result.max_y = Simd::Float8::load(values[4]);
+            result.max_z = Simd::Float8::load(values[5]);
+            result.count = boxes.size();
+
+            return result;
+        }
+    };
+
+    namespace Detail
+    {
+        /**
+         * @brief
+         * Runs a per-plane test over arrays of objects, a register of
+         * objects at a time, and writes 1 for the ones that pass every
+         * plane. The test returns the signed distance and the radius of an
+         * object, which passes while distance >= -radius.
+         * @tparam V Float type of the loop: float, Float4 or Float8
+         * @tparam Test Type of the test
+         * @param frustum The frustum
+         * @param begin Index of the first object to test
+         * @param end One past the index of the last object to test
+         * @param visible One flag per object
+         * @param test Called with the plane and the index of the first
+         * object of the register
+         * @return std::size_t Objects that passed in this loop
+         */
+        template <class V, class Test>
+        std::size_t cull(const Frustum &frustum, std::size_t begin, std::size_t end,
+                         std::span<std::uint8_t> visible, Test test)
+        {
+            constexpr std::size_t width = []
+            {
+                if constexpr (std::is_same_v<V, float>)
+                    return std::size_t(1);
+                else
+                    return V::width;
+            }();
+            std::size_t result = 0;
+
+            for (std::size_t i = begin; i + width <= end; i += width)
+            {
+                int outside = 0;
+
+                for (const Plane &plane : frustum.planes)
+                {
+                    auto [distance, radius] = test(plane, i);
+
+                    if constexpr (width == 1)
+                        outside |= distance < -radius;
+                    else
+                        outside |= V::less(distance, -radius).mask();
+                }
+
+                for (std::size_t lane = 0; lane < width; ++lane)
+                {
+                    bool inside = ((outside >> lane) & 1) == 0;
+                    visible[i + lane] = inside;
+                    result += inside;
+                }
+            }
+
+            return result;
+        }
+    }
+
+    /**
+     * @brief
+     * Tests arrays of spheres against a frustum, a SIMD register of
+     * spheres at a time
+     * @param frustum The frustum
+     * @param centers The centers, one array per coordinate
+     * @param radii The radii
+     * @param visible Receives 1 for the spheres that may be visible and 0
+     * for the others
+     * @return std::size_t The number of spheres that may be visible
+     * @throws std::invalid_argument If the arrays differ in size
+     */
+    inline std::size_t cull_spheres(const Frustum &frustum, ConstSoaView centers,
+                                    std::span<const float> radii, std::span<std::uint8_t> visible)
+    {
+        std::size_t count = centers.size();
+
+        if (radii.size() != count || visible.size() != count)
+            throw std::invalid_argument("Arrays must be the same size");
+
+        auto wide = [&](const Plane &plane, std::size_t i)
+        {
+            using Simd::WideFloat;
+
+            WideFloat distance = WideFloat::multiply_add(
+                WideFloat(plane.normal.x()), WideFloat::load(&centers.x[i]),
+                WideFloat::multiply_add(
+                    WideFloat(plane.normal.y()), WideFloat::load(&centers.y[i]),
+                    WideFloat::multiply_add(WideFloat(plane.normal.z()),
+                                            WideFloat::load(&centers.z[i]),
+                                            WideFloat(plane.distance))));
+
+            return std::pair(distance, WideFloat::load(&radii[i]));
+        };
+
+        auto scalar = [&](const Plane &plane, std::size_t i)
+        {
+            return std::pair(plane.signed_distance(Vec3(centers.x[i], centers.y[i], centers.z[i])),
+                             radii[i]);
+        };
+
+        std::size_t vectorized = count - count % Simd::WideFloat::width;
+
+        return Detail::cull<Simd::WideFloat>(frustum, 0, vectorized, visible, wide) +
+               Detail::cull<float>(frustum, vectorized, count, visible, scalar);
+    }
+
+    /**
+     * @brief
+     * Tests arrays of boxes against a frustum, a SIMD register of boxes at
+     * a time. Each box is projected on the normal of each plane, so the
+     * test matches Frustum::intersects(const Aabb &).
+     * @param frustum The frustum
+     * @param centers The centers of the boxes, one array per coordinate
+     * @param extents The half sizes of the boxes, one array per coordinate
+     * @param visible Receives 1 for the boxes that may be visible and 0 for
+     * the others
+     * @return std::size_t The number of boxes that may be visible
+     * @throws std::invalid_argument If the arrays differ in size
+     */
+    inline std::size_t cull_boxes(const Frustum &frustum, ConstSoaView centers,
+                                  ConstSoaView extents, std::span<std::uint8_t> visible)
+    {
+        std::size_t count = centers.size();
+
+        if (extents.size() != count || visible.size() != count)
+            throw std::invalid_argument("Arrays must be the same size");
+
+        auto wide = [&](const Plane &plane, std::size_t i)
+        {
+            using Simd::WideFloat;
+
+            WideFloat distance = WideFloat::multiply_add(
+                WideFloat(plane.normal.x()), WideFloat::load(&centers.x[i]),
+                WideFloat::multiply_add(
+                    WideFloat(plane.normal.y()), WideFloat::load(&centers.y[i]),
+                    WideFloat::multiply_add(WideFloat(plane.normal.z()),
+                                            WideFloat::load(&centers.z[i]),
+                                            WideFloat(plane.distance))));
+            WideFloat radius = WideFloat::multiply_add(
+                WideFloat(std::abs(plane.normal.x())), WideFloat::load(&extents.x[i]),
+                WideFloat::multiply_add(
+                    WideFloat(std::abs(plane.normal.y())), WideFloat::load(&extents.y[i]),
+                    WideFloat(std::abs(plane.normal.z())) * WideFloat::load(&extents.z[i])));
+
+            return std::pair(distance, radius);
+        };
+
+        auto scalar = [&](const Plane &plane, std::size_t i)
+        {
+            float radius = std::abs(plane.normal.x()) * extents.x[i] +
+                           std::abs(plane.normal.y()) * extents.y[i] +
+                           std::abs(plane.normal.z()) * extents.z[i];
+
+            return std::pair(plane.signed_distance(Vec3(centers.x[i], centers.y[i], centers.z[i])),
+                             radius);
+        };
+
+        std::size_t vectorized = count - count % Simd::WideFloat::width;
+
+        return Detail::cull<Simd::WideFloat>(frustum, 0, vectorized, visible, wide) +
+               Detail::cull<float>(frustum, vectorized, count, visible, scalar);
+    }
+}
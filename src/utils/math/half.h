@@ -0,0 +1,319 @@
+/**
+ * @file half.h
+ * @author Carlos Salguero
+ * @brief IEEE 754 half-precision float for compact storage
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#pragma once
+
+// C++ Standard Library
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+
+// Project files
+#include "float4.h"
+#include "math.h"
+
+#if defined(__F16C__) && (defined(MATH_SIMD_SSE) || defined(MATH_SIMD_AVX2))
+#include <immintrin.h>
+#define MATH_HALF_F16C 1
+#elif defined(MATH_SIMD_NEON) && defined(__aarch64__)
+#define MATH_HALF_NEON 1
+#endif
+
+namespace Math
+{
+    /**
+     * @class Half
+     * @brief 16-bit IEEE 754 binary16 float: 1 sign, 5 exponent and 10
+     *        mantissa bits, with subnormals, infinities and NaN. It is a
+     *        storage format: arithmetic converts to float, computes there
+     *        and rounds the result back to nearest even.
+     */
+    class Half
+    {
+    public:
+        // Constructors
+        constexpr Half() : m_bits(0) {}
+
+        /**
+         * @brief
+         * Constructs the half nearest to a float, ties to even. Values
+         * past the largest half, 65504, become infinity.
+         * @param value The float
+         */
+        explicit constexpr Half(float value) : m_bits(from_float(value)) {}
+
+        // Operators
+        /**
+         * @brief
+         * Converts the half to float, which is always exact
+         * @return float The value
+         */
+        constexpr operator float() const
+        {
+            return to_float(m_bits);
+        }
+
+        constexpr Half operator-() const
+        {
+            return from_bits(static_cast<std::uint16_t>(m_bits ^ 0x8000u));
+        }
+
+        constexpr Half &operator+=(const Half &other)
+        {
+            return *this = Half(float(*this) + float(other));
+        }
+
+        constexpr Half &operator-=(const Half &other)
+        {
+            return *this = Half(float(*this) - float(other));
+        }
+
+        constexpr Half &operator*=(const Half &other)
+        {
+            return *this = Half(float(*this) * float(other));
+        }
+
+        constexpr Half &operator/=(const Half &other)
+        {
+            return *this = Half(float(*this) / float(other));
+        }
+
+        friend constexpr Half operator+(Half left, const Half &right)
+        {
+            return left += right;
+        }
+
+        friend constexpr Half operator-(Half left, const Half &right)
+        {
+            return left -= right;
+        }
+
+        friend constexpr Half operator*(Half left, const Half &right)
+        {
+            return left *= right;
+        }
+
+        friend constexpr Half operator/(Half left, const Half &right)
+        {
+            return left /= right;
+        }
+
+        friend constexpr bool operator==(const Half &left, const Half &right)
+        {
+            return float(left) == float(right);
+        }
+
+        friend constexpr std::partial_ordering operator<=>(const Half &left, const Half &right)
+        {
+            return float(left) <=> float(right);
+        }
+
+        // Access Methods
+        /**
+         * @brief
+         * Gets the binary16 encoding
+         * @return std::uint16_t The bits
+         */
+        constexpr std::uint16_t bits() const
+        {
+            return m_bits;
+        }
+
+        // Static Methods
+        /**
+         * @brief
+         * Builds a half from its binary16 encoding
+         * @param bits The bits
+         * @return Half The half
+         */
+        static constexpr Half from_bits(std::uint16_t bits)
+        {
+            Half result;
+            result.m_bits = bits;
+            return result;
+        }
+
+        /**
+         * @brief
+         * Encodes a float as binary16, rounding to nearest even
+         * @param value The float
+         * @return std::uint16_t The bits
+         */
+        static constexpr std::uint16_t from_float(float value)
+        {
+            std::uint32_t bits = std::bit_cast<std::uint32_t>(value);
+            std::uint32_t sign = (bits >> 16) & 0x8000u;
+            std::uint32_t magnitude = bits & 0x7fffffffu;
+            std::uint32_t result;
+
+            if (magnitude >= 0x7f800000u)
+                // Infinity, or NaN keeping the top of its payload, made quiet
+                result = 0x7c00u | (magnitude > 0x7f800000u ? 0x200u | ((magnitude >> 13) & 0x3ffu) : 0u);
+            else if (magnitude >= 0x477ff000u)
+                // 65520 and above round past the largest half
+                result = 0x7c00u;
+            else if (magnitude < 0x38800000u)
+            {
+                // Below 2^-14 the half is subnormal, in units of 2^-24
+                if (magnitude < 0x33000000u)
+                    return static_cast<std::uint16_t>(sign);
+
+                std::uint32_t exponent = magnitude >> 23;
+                std::uint32_t mantissa = (magnitude & 0x7fffffu) | 0x800000u;
+                std::uint32_t shift = 126 - exponent;
+                std::uint32_t halfway = 1u << (shift - 1);
+                std::uint32_t remainder = mantissa & ((1u << shift) - 1);
+
+                result = mantissa >> shift;
+
+                if (remainder > halfway || (remainder == halfway && (result & 1u)))
+                    ++result;
+            }
+            else
+            {
+                // Rebias the exponent from 127 to 15 and round off 13 bits;
+                // a carry out of the mantissa correctly bumps the exponent
+                std::uint32_t remainder = magnitude & 0x1fffu;
+
+                result = (magnitude - 0x38000000u) >> 13;
+
+                if (remainder > 0x1000u || (remainder == 0x1000u && (result & 1u)))
+                    ++result;
+            }
+
+            return static_cast<std::uint16_t>(sign | result);
+        }
+
+        /**
+         * @brief
+         * Decodes a binary16 value to float, which is always exact
+         * @param bits The bits
+         * @return float The value
+         */
+        static constexpr float to_float(std::uint16_t bits)
+        {
+            std::uint32_t sign = static_cast<std::uint32_t>(bits & 0x8000u) << 16;
+            std::uint32_t exponent = (bits >> 10) & 0x1fu;
+            std::uint32_t mantissa = bits & 0x3ffu;
+
+            if (exponent == 0x1fu)
+                return std::bit_cast<float>(sign | 0x7f800000u | (mantissa << 13));
+
+            if (exponent == 0)
+            {
+                if (mantissa == 0)
+                    return std::bit_cast<float>(sign);
+
+                // Normalize the subnormal: one exponent step per shift
+                std::uint32_t biased = 113;
+
+                while (!(mantissa & 0x400u))
+                {
+                    mantissa <<= 1;
+                    --biased;
+                }
+
+                return std::bit_cast<float>(sign | (biased << 23) | ((mantissa & 0x3ffu) << 13));
+            }
+
+            return std::bit_cast<float>(sign | ((exponent + 112) << 23) | (mantissa << 13));
+        }
+
+    private:
+        std::uint16_t m_bits;
+    };
+
+    // The array conversions read and write halves as their encodings
+    static_assert(sizeof(Half) == sizeof(std::uint16_t));
+
+    /**
+     * @brief
+     * Calculates the square root of a half
+     * @param a Number
+     * @return Half Square root of the number
+     * @throws std::runtime_error If the number is negative
+     */
+    inline Half square_root(Half a)
+    {
+        return Half(square_root(float(a)));
+    }
+
+    /**
+     * @brief
+     * Converts an array of halves to floats, eight or four at a time with
+     * F16C on x86 and NEON on AArch64
+     * @param source The halves
+     * @param destination The floats, at least as many as the halves
+     * @throws std::invalid_argument If the destination is too short
+     */
+    inline void unpack_halves(std::span<const Half> source, std::span<float> destination)
+    {
+        if (destination.size() < source.size())
+            throw std::invalid_argument("Destination is smaller than the source");
+
+        std::size_t i = 0;
+        auto bits = reinterpret_cast<const std::uint16_t *>(source.data());
+
+#if defined(MATH_HALF_F16C) && defined(__AVX__)
+        for (; i + 8 <= source.size(); i += 8)
+            _mm256_storeu_ps(destination.data() + i,
+                             _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i *>(bits + i))));
+#elif defined(MATH_HALF_F16C)
+        for (; i + 4 <= source.size(); i += 4)
+            _mm_storeu_ps(destination.data() + i,
+                          _mm_cvtph_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(bits + i))));
+#elif defined(MATH_HALF_NEON)
+        for (; i + 4 <= source.size(); i += 4)
+            vst1q_f32(destination.data() + i, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(bits + i))));
+#endif
+
+        for (; i < source.size(); ++i)
+            destination[i] = Half::to_float(bits[i]);
+    }
+
+    /**
+     * @brief
+     * Converts an array of floats to halves, rounding to nearest even,
+     * eight or four at a time with F16C on x86 and NEON on AArch64
+     * @param source The floats
+     * @param destination The halves, at least as many as the floats
+     * @throws std::invalid_argument If the destination is too short
+     */
+    inline void pack_halves(std::span<const float> source, std::span<Half> destination)
+    {
+        if (destination.size() < source.size())
+            throw std::invalid_argument("Destination is smaller than the source");
+
+        std::size_t i = 0;
+        auto bits = reinterpret_cast<std::uint16_t *>(destination.data());
+
+#if defined(MATH_HALF_F16C) && defined(__AVX__)
+        for (; i + 8 <= source.size(); i += 8)
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(bits + i),
+                             _mm256_cvtps_ph(_mm256_loadu_ps(source.data() + i),
+                                             _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+#elif defined(MATH_HALF_F16C)
+        for (; i + 4 <= source.size(); i += 4)
+            _mm_storel_epi64(reinterpret_cast<__m128i *>(bits + i),
+                             _mm_cvtps_ph(_mm_loadu_ps(source.data() + i),
+                                          _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+#elif defined(MATH_HALF_NEON)
+        for (; i + 4 <= source.size(); i += 4)
+            vst1_u16(bits + i, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(source.data() + i))));
+#endif
+
+        for (; i < source.size(); ++i)
+            bits[i] = Half::from_float(source[i]);
+    }
+}
@@ -0,0 +1,474 @@
+/**
+ * @file mat.h
+ * @author Carlos Salguero
+ * @brief Fixed-size matrix with inline storage and constexpr operations
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#pragma once
+
+// C++ Standard Library
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+
+// Project files
+#include "matrix.h"
+#include "vec.h"
+
+namespace Math
+{
+    /**
+     * @class Mat
+     * @brief R x C matrix stored inline in row-major order. Transforms are
+     *        applied to column vectors, so M * v transforms v by M.
+     * @tparam R Number of rows
+     * @tparam C Number of columns
+     * @tparam T Type of the elements
+     */
+    template <std::size_t R, std::size_t C, class T>
+    class Mat
+    {
+        static_assert(R > 0 && C > 0, "Mat needs at least one element");
+
+    public:
+        // Type aliases
+        using value_type = T;
+        using row_type = Vec<C, T>;
+        using column_type = Vec<R, T>;
+
+        // Constructors
+        constexpr Mat() : m_rows{} {}
+
+        /**
+         * @brief
+         * Constructs a matrix from its rows
+         * @param rows The rows of the matrix
+         */
+        template <class... Rows>
+            requires(sizeof...(Rows) == R && R > 1)
+        constexpr Mat(const Rows &...rows) : m_rows{row_type(rows)...} {}
+
+        /**
+         * @brief
+         * Constructs a single-row matrix
+         * @param row The row of the matrix
+         */
+        explicit constexpr Mat(const row_type &row)
+            requires(R == 1)
+            : m_rows{row} {}
+
+        // Operators
+        /**
+         * @brief
+         * Accesses the element at the given position
+         * @param row The row of the element
+         * @param col The column of the element
+         * @return T& The element at the given position
+         */
+        constexpr T &operator()(std::size_t row, std::size_t col)
+        {
+            return m_rows[row][col];
+        }
+
+        /**
+         * @brief
+         * Accesses the element at the given position
+         * @param row The row of the element
+         * @param col The column of the element
+         * @return const T& The element at the given position
+         */
+        constexpr const T &operator()(std::size_t row, std::size_t col) const
+        {
+            return m_rows[row][col];
+        }
+
+        /**
+         * @brief
+         * Accesses a row of the matrix
+         * @param row The index of the row
+         * @return row_type& The row
+         */
+        constexpr row_type &operator[](std::size_t row)
+        {
+            return m_rows[row];
+        }
+
+        /**
+         * @brief
+         * Accesses a row of the matrix
+         * @param row The index of the row
+         * @return const row_type& The row
+         */
+        constexpr const row_type &operator[](std::size_t row) const
+        {
+            return m_rows[row];
+        }
+
+        /**
+         * @brief
+         * Compares two matrices element by element
+         * @param other The matrix to compare with
+         * @return true If every element is equal
+         * @return false Otherwise
+         */
+        constexpr bool operator==(const Mat &other) const
+        {
+            return m_rows == other.m_rows;
+        }
+
+        /**
+         * @brief
+         * Adds two matrices
+         * @param other The matrix to add
+         * @return Mat The sum of both matrices
+         */
+        constexpr Mat operator+(const Mat &other) const
+        {
+            Mat result = *this;
+            return result += other;
+        }
+
+        /**
+         * @brief
+         * Subtracts two matrices
+         * @param other The matrix to subtract
+         * @return Mat The difference of both matrices
+         */
+        constexpr Mat operator-(const Mat &other) const
+        {
+            Mat result = *this;
+            return result -= other;
+        }
+
+        /**
+         * @brief
+         * Multiplies every element by a scalar
+         * @param scalar The scalar to multiply by
+         * @return Mat The scaled matrix
+         */
+        constexpr Mat operator*(const T &scalar) const
+        {
+            Mat result = *this;
+            return result *= scalar;
+        }
+
+        /**
+         * @brief
+         * Multiplies two matrices
+         * @tparam K Number of columns of the other matrix
+         * @param other The matrix to multiply by
+         * @return Mat<R, K, T> The product of both matrices
+         */
+        template <std::size_t K>
+        constexpr Mat<R, K, T> operator*(const Mat<C, K, T> &other) const
+        {
+            Mat<R, K, T> result;
+
+            for (std::size_t i = 0; i < R; ++i)
+                for (std::size_t k = 0; k < C; ++k)
+                    result[i] += other[k] * m_rows[i][k];
+
+            return result;
+        }
+
+        /**
+         * @brief
+         * Transforms a column vector by the matrix
+         * @param vector The vector to transform
+         * @return column_type The transformed vector
+         */
+        constexpr column_type operator*(const row_type &vector) const
+        {
+            column_type result;
+
+            for (std::size_t i = 0; i < R; ++i)
+                result[i] = m_rows[i].dot(vector);
+
+            return result;
+        }
+
+        /**
+         * @brief
+         * Adds another matrix to this matrix
+         * @param other The matrix to add
+         * @return Mat& This matrix
+         */
+        constexpr Mat &operator+=(const Mat &other)
+        {
+            for (std::size_t i = 0; i < R; ++i)
+                m_rows[i] += other.m_rows[i];
+
+            return *this;
+        }
+
+        /**
+         * @brief
+         * Subtracts another matrix from this matrix
+         * @param other The matrix to subtract
+         * @return Mat& This matrix
+         */
+        constexpr Mat &operator-=(const Mat &other)
+        {
+            for (std::size_t i = 0; i < R; ++i)
+                m_rows[i] -= other.m_rows[i];
+
+            return *this;
+        }
+
+        /**
+         * @brief
+         * Multiplies every element by a scalar
+         * @param scalar The scalar to multiply by
+         * @return Mat& This matrix
+         */
+        constexpr Mat &operator*=(const T &scalar)
+        {
+            for (auto &row : m_rows)
+                row *= scalar;
+
+            return *this;
+        }
+
+        /**
+         * @brief
+         * Multiplies this matrix by a square matrix
+         * @param other The matrix to multiply by
+         * @return Mat& This matrix
+         */
+        constexpr Mat &operator*=(const Mat<C, C, T> &other)
+        {
+            return *this = *this * other;
+        }
+
+        // Access Methods
+        /**
+         * @brief
+         * Gets a column of the matrix
+         * @param col The index of the column
+         * @return column_type The column
+         */
+        constexpr column_type column(std::size_t col) const
+        {
+            column_type result;
+
+            for (std::size_t i = 0; i < R; ++i)
+                result[i] = m_rows[i][col];
+
+            return result;
+        }
+
+        // Methods
+        /**
+         * @brief
+         * Gets the rows of the matrix
+         * @return std::size_t The rows of the matrix
+         */
+        static constexpr std::size_t rows()
+        {
+            return R;
+        }
+
+        /**
+         * @brief
+         * Gets the columns of the matrix
+         * @return std::size_t The columns of the matrix
+         */
+        static constexpr std::size_t cols()
+        {
+            return C;
+        }
+
+        /**
+         * @brief
+         * Transposes the matrix
+         * @return Mat<C, R, T> The transposed matrix
+         */
+        constexpr Mat<C, R, T> transpose() const
+        {
+            Mat<C, R, T> result;
+
+            for (std::size_t i = 0; i < R; ++i)
+                for (std::size_t j = 0; j < C; ++j)
+                    result(j, i) = m_rows[i][j];
+
+            return result;
+        }
+
+        /**
+         * @brief
+         * Calculates the determinant of a square matrix of up to four rows
+         * @return T The determinant
+         */
+        constexpr T determinant() const
+            requires(R == C && R <= 4)
+        {
+            if constexpr (R == 1)
+                return m_rows[0][0];
+            else if constexpr (R == 2)
+                return m_rows[0][0] * m_rows[1][1] - m_rows[0][1] * m_rows[1][0];
+            else
+            {
+                T result = T();
+                T sign = T(1);
+
+                for (std::size_t j = 0; j < C; ++j)
+                {
+                    result += sign * m_rows[0][j] * minor(0, j).determinant();
+                    sign = -sign;
+                }
+
+                return result;
+            }
+        }
+
+        /**
+         * @brief
+         * Removes a row and a column of the matrix
+         * @param row The row to remove
+         * @param col The column to remove
+         * @return Mat<R - 1, C - 1, T> The remaining matrix
+         */
+        constexpr Mat<R - 1, C - 1, T> minor(std::size_t row, std::size_t col) const
+            requires(R > 1 && C > 1)
+        {
+            Mat<R - 1, C - 1, T> result;
+
+            for (std::size_t i = 0, r = 0; i < R; ++i)
+            {
+                if (i == row)
+                    continue;
+
+                for (std::size_t j = 0, c = 0; j < C; ++j)
+                    if (j != col)
+                        result(r, c++) = m_rows[i][j];
+
+                ++r;
+            }
+
+            return result;
+        }
+
+        /**
+         * @brief
+         * Copies the matrix into a dynamic matrix
+         * @tparam Layout Storage order of the dynamic matrix
+         * @return Matrix<T, Layout> The dynamic matrix
+         */
+        template <MatrixLayout Layout = MatrixLayout::RowMajor>
+        Matrix<T, Layout> to_matrix() const
+        {
+            Matrix<T, Layout> result(R, C);
+
+            for (std::size_t i = 0; i < R; ++i)
+                for (std::size_t j = 0; j < C; ++j)
+                    result.data()[result.index_of(i, j)] = m_rows[i][j];
+
+            return result;
+        }
+
+        // Static Methods
+        /**
+         * @brief
+         * Creates the identity matrix
+         * @return Mat The identity matrix
+         */
+        static constexpr Mat identity()
+            requires(R == C)
+        {
+            Mat result;
+
+            for (std::size_t i = 0; i < R; ++i)
+                result(i, i) = T(1);
+
+            return result;
+        }
+
+        /**
+         * @brief
+         * Creates a matrix that translates points in homogeneous coordinates
+         * @param offset The translation
+         * @return Mat The translation matrix
+         */
+        static constexpr Mat translation(const Vec<R - 1, T> &offset)
+            requires(R == C && R > 1)
+        {
+            Mat result = identity();
+
+            for (std::size_t i = 0; i < R - 1; ++i)
+                result(i, C - 1) = offset[i];
+
+            return result;
+        }
+
+        /**
+         * @brief
+         * Creates a matrix that scales each axis. Homogeneous matrices keep
+         * their last diagonal element at one.
+         * @param factors The scale of each axis
+         * @return Mat The scale matrix
+         */
+        template <std::size_t N>
+            requires(R == C && (N == R || N + 1 == R))
+        static constexpr Mat scaling(const Vec<N, T> &factors)
+        {
+            Mat result = identity();
+
+            for (std::size_t i = 0; i < N; ++i)
+                result(i, i) = factors[i];
+
+            return result;
+        }
+
+        /**
+         * @brief
+         * Copies a dynamic matrix into a fixed-size one
+         * @tparam Layout Storage order of the dynamic matrix
+         * @param matrix The dynamic matrix
+         * @return Mat The fixed-size matrix
+         * @throws std::invalid_argument If the matrix is not R x C
+         */
+        template <MatrixLayout Layout>
+        static Mat from_matrix(const Matrix<T, Layout> &matrix)
+        {
+            if (matrix.rows() != R || matrix.cols() != C)
+                throw std::invalid_argument("Matrix size does not match");
+
+            Mat result;
+
+            for (std::size_t i = 0; i < R; ++i)
+                for (std::size_t j = 0; j < C; ++j)
+                    result(i, j) = matrix.data()[matrix.index_of(i, j)];
+
+            return result;
+        }
+
+    private:
+        std::array<row_type, R> m_rows;
+    };
+
+    /**
+     * @brief
+     * Multiplies every element of a matrix by a scalar
+     * @tparam R Number of rows
+     * @tparam C Number of columns
+     * @tparam T Type of the elements
+     * @param scalar The scalar to multiply by
+     * @param matrix The matrix
+     * @return Mat<R, C, T> The scaled matrix
+     */
+    template <std::size_t R, std::size_t C, class T>
+    constexpr Mat<R, C, T> operator*(const T &scalar, const Mat<R, C, T> &matrix)
+    {
+        return matrix * scalar;
+    }
+
+    // Type aliases
+    using Mat2 = Mat<2, 2, float>;
+    using Mat3 = Mat<3, 3, float>;
+    using Mat4 = Mat<4, 4, float>;
+}
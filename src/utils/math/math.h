@@ -13,6 +13,9 @@
 
 // C++ Standard Library
 #include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
 
 namespace Math
 {
@@ -77,20 +80,6 @@ namespace Math
             throw std::runtime_error("Error: Division by zero");
     }
 
-    /**
-     * @brief
-     * Calculates the remainder of the division of two numbers
-     * @tparam T Type of the numbers
-     * @param a First number
-     * @param b Second number
-     * @return T Result of the remainder
-     */
-    template <typename T>
-    inline T remainder(T a, T b)
-    {
-        return a % b;
-    }
-
     /**
      * @brief
      * Calculates the power of a number with a non-negative integer exponent
@@ -110,19 +99,6 @@ namespace Math
         return result;
     }
 
-    /**
-     * @brief
-     * Calculates the square root of a number
-     * @tparam T Type of the number
-     * @param a Number
-     * @return T Result of the square root
-     */
-    template <typename T>
-    inline T square_root(T a)
-    {
-        return std::sqrt(a);
-    }
-
     // Mathematical constants
     /**
      * @brief
@@ -136,6 +112,14 @@ namespace Math
      */
     const double E = 2.71828182845904523536;
 
+    /**
+     * @brief
+     * The mathematical constant PI in the precision of a given type
+     * @tparam T Type of the constant
+     */
+    template <typename T>
+    constexpr T pi = static_cast<T>(3.14159265358979323846);
+
     // Trigonometric functions
 
     /**
@@ -177,6 +161,19 @@ namespace Math
         return std::tan(angle);
     }
 
+    /**
+     * @brief
+     * Calculates the arc cosine of a value
+     * @tparam T Type of the value
+     * @param value Cosine of the angle, in [-1, 1]
+     * @return T Angle in radians
+     */
+    template <typename T>
+    inline T arc_cosine(T value)
+    {
+        return std::acos(value);
+    }
+
     // Other functions
     /**
      * @brief
@@ -386,13 +383,36 @@ namespace Math
      * @return T Square root of the number
      */
     template <typename T>
-    inline T square_root(T a)
+    constexpr T square_root(T a)
     {
-        if (a >= 0)
-            return std::sqrt(a);
-
-        else
+        if (!(a >= 0))
             throw std::runtime_error("Error: Invalid argument for square root");
+
+        // std::sqrt is not constexpr, so constant evaluation runs Newton's
+        // method instead. Started above the root, it decreases monotonically
+        // until rounding stops it.
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            if (std::is_constant_evaluated())
+            {
+                if (a == 0 || a == std::numeric_limits<T>::infinity())
+                    return a;
+
+                T current = a < 1 ? T(1) : a;
+
+                while (true)
+                {
+                    T next = (current + a / current) / 2;
+
+                    if (next >= current)
+                        return current;
+
+                    current = next;
+                }
+            }
+        }
+
+        return std::sqrt(a);
     }
 
     /**
@@ -12,28 +12,77 @@
 #pragma once
 
 // C++ Standard Library
-#include <unordered_map>
-#include <utility>
+#include <algorithm>
 #include <stdexcept>
+#include <utility>
+#include <vector>
+
+// Project files
+#include "aligned_allocator.h"
+#include "expression.h"
+#include "gemm.h"
 
 namespace Math
 {
-    template <class T>
-    class Matrix
+    /**
+     * @brief
+     * Order in which the elements of a matrix are stored
+     */
+    enum class MatrixLayout
+    {
+        RowMajor,
+        ColumnMajor
+    };
+
+    /**
+     * @class Matrix
+     * @brief Dense matrix stored in one contiguous, cache-line aligned buffer
+     * @tparam T Type of the elements
+     * @tparam Layout Storage order of the elements, row-major by default
+     */
+    template <class T, MatrixLayout Layout = MatrixLayout::RowMajor>
+    class Matrix : public MatrixExpression<Matrix<T, Layout>>
     {
     public:
+        // Type aliases
+        using value_type = T;
+        using storage_type = std::vector<T, AlignedAllocator<T>>;
+        using iterator = typename storage_type::iterator;
+        using const_iterator = typename storage_type::const_iterator;
+        using result_type = Matrix;
+
+        static constexpr MatrixLayout layout = Layout;
+        static constexpr bool is_container = true;
+
         // Constructors
         Matrix() = default;
         Matrix(std::size_t rows, std::size_t cols)
-            : m_rows(rows), m_cols(cols) {}
-        Matrix(const Matrix &other)
-            : m_rows(other.m_rows), m_cols(other.m_cols),
-              m_elements(other.m_elements) {}
+            : m_rows(rows), m_cols(cols), m_elements(rows * cols) {}
+        Matrix(std::size_t rows, std::size_t cols, const T &value)
+            : m_rows(rows), m_cols(cols), m_elements(rows * cols, value) {}
+        Matrix(const Matrix &other) = default;
         Matrix(Matrix &&other) noexcept
-            : m_rows(std::move(other.m_rows)),
-              m_cols(std::move(other.m_cols)),
+            : m_rows(std::exchange(other.m_rows, 0)),
+              m_cols(std::exchange(other.m_cols, 0)),
               m_elements(std::move(other.m_elements)) {}
 
+        /**
+         * @brief
+         * Evaluates a matrix expression into a new matrix, in one loop
+         * @tparam E Type of the expression
+         * @param expression The expression to evaluate
+         */
+        template <class E>
+        Matrix(const MatrixExpression<E> &expression)
+            : m_rows(expression.rows()), m_cols(expression.cols()),
+              m_elements(m_rows * m_cols)
+        {
+            static_assert(E::layout == Layout, "Matrices must have the same layout");
+
+            for (std::size_t i = 0; i < m_elements.size(); ++i)
+                m_elements[i] = expression.element(i);
+        }
+
         // Operators
         /**
          * @brief Accesses the element at the specified position.
@@ -47,7 +96,7 @@ namespace Math
             if (row >= m_rows || col >= m_cols)
                 throw std::out_of_range("Matrix subscript out of range");
 
-            return m_elements[std::make_pair(row, col)];
+            return m_elements[index_of(row, col)];
         }
 
         /**
@@ -62,48 +111,53 @@ namespace Math
             if (row >= m_rows || col >= m_cols)
                 throw std::out_of_range("Matrix subscript out of range");
 
-            return m_elements.at(std::make_pair(row, col));
+            return m_elements[index_of(row, col)];
         }
 
         /**
-         * @brief Accesses the element at the specified position.
-         * @param row The row of the element.
-         * @param col The column of the element.
-         * @return T& The element at the specified position.
-         * @throws std::out_of_range If the position is out of bounds.
+         * @brief Assigns the contents of another matrix to this matrix.
+         * @param other The matrix to assign.
+         * @return Matrix& The assigned matrix.
          */
-        T &operator()(std::size_t row, std::size_t col) const
-        {
-            if (row >= m_rows || col >= m_cols)
-                throw std::out_of_range("Matrix subscript out of range");
-
-            return m_elements.at(std::make_pair(row, col));
-        }
+        Matrix &operator=(const Matrix &other) = default;
 
         /**
          * @brief Assigns the contents of another matrix to this matrix.
          * @param other The matrix to assign.
-         * @return Matrix<T>& The assigned matrix.
+         * @return Matrix& The assigned matrix.
          */
-        Matrix<T> &operator=(const Matrix<T> &other)
+        Matrix &operator=(Matrix &&other) noexcept
         {
-            m_rows = other.m_rows;
-            m_cols = other.m_cols;
-            m_elements = other.m_elements;
+            m_rows = std::exchange(other.m_rows, 0);
+            m_cols = std::exchange(other.m_cols, 0);
+            m_elements = std::move(other.m_elements);
 
             return *this;
         }
 
         /**
-         * @brief Assigns the contents of another matrix to this matrix.
-         * @param other The matrix to assign.
-         * @return Matrix<T>& The assigned matrix.
+         * @brief Evaluates a matrix expression into this matrix, in one
+         *        loop. The expression may use this matrix.
+         * @tparam E Type of the expression.
+         * @param expression The expression to evaluate.
+         * @return Matrix& The assigned matrix.
          */
-        Matrix<T> &operator=(Matrix<T> &&other) noexcept
+        template <class E>
+        Matrix &operator=(const MatrixExpression<E> &expression)
         {
-            m_rows = std::move(other.m_rows);
-            m_cols = std::move(other.m_cols);
-            m_elements = std::move(other.m_elements);
+            static_assert(E::layout == Layout, "Matrices must have the same layout");
+
+            std::size_t rows = expression.rows();
+            std::size_t cols = expression.cols();
+
+            if (rows * cols != m_elements.size())
+                return *this = Matrix(expression);
+
+            for (std::size_t i = 0; i < m_elements.size(); ++i)
+                m_elements[i] = expression.element(i);
+
+            m_rows = rows;
+            m_cols = cols;
 
             return *this;
         }
@@ -111,12 +165,12 @@ namespace Math
         /**
          * @brief Multiplies this matrix by a scalar value.
          * @param scalar The scalar value to multiply by.
-         * @return Matrix<T>& Reference to this matrix after multiplication.
+         * @return Matrix& Reference to this matrix after multiplication.
          */
-        Matrix<T> &operator*=(const T &scalar)
+        Matrix &operator*=(const T &scalar)
         {
             for (auto &element : m_elements)
-                element.second *= scalar;
+                element *= scalar;
 
             return *this;
         }
@@ -124,73 +178,58 @@ namespace Math
         /**
          * @brief Divides this matrix by a scalar value.
          * @param scalar The scalar value to divide by.
-         * @return Matrix<T>& Reference to this matrix after division.
+         * @return Matrix& Reference to this matrix after division.
          * @throws std::invalid_argument If the scalar value is zero.
          */
-        Matrix<T> &operator/=(const T &scalar)
+        Matrix &operator/=(const T &scalar)
         {
             if (scalar == 0)
                 throw std::invalid_argument("Matrix division by zero");
 
             for (auto &element : m_elements)
-                element.second /= scalar;
+                element /= scalar;
 
             return *this;
         }
 
         /**
          * @brief Adds another matrix to this matrix.
+         * @tparam E Type of the matrix expression.
          * @param other The matrix to add.
-         * @return Matrix<T>& Reference to this matrix after addition.
+         * @return Matrix& Reference to this matrix after addition.
          * @throws std::invalid_argument If the matrices are not the same size.
          */
-        Matrix<T> &operator+=(const Matrix<T> &other)
+        template <class E>
+        Matrix &operator+=(const MatrixExpression<E> &other)
         {
-            if (m_rows != other.m_rows || m_cols != other.m_cols)
+            static_assert(E::layout == Layout, "Matrices must have the same layout");
+
+            if (m_rows != other.rows() || m_cols != other.cols())
                 throw std::invalid_argument("Matrix addition of different sizes");
 
-            for (auto &element : other.m_elements)
-                m_elements[element.first] += element.second;
+            for (std::size_t i = 0; i < m_elements.size(); ++i)
+                m_elements[i] += other.element(i);
 
             return *this;
         }
 
         /**
          * @brief Subtracts another matrix from this matrix.
+         * @tparam E Type of the matrix expression.
          * @param other The matrix to subtract.
-         * @return Matrix<T>& Reference to this matrix after subtraction.
+         * @return Matrix& Reference to this matrix after subtraction.
          * @throws std::invalid_argument If the matrices are not the same size.
          */
-        Matrix<T> &operator-=(const Matrix<T> &other)
+        template <class E>
+        Matrix &operator-=(const MatrixExpression<E> &other)
         {
-            if (m_rows != other.m_rows || m_cols != other.m_cols)
-                throw std::invalid_argument("Matrix subtraction of different sizes");
-
-            for (auto &element : other.m_elements)
-                m_elements[element.first] -= element.second;
-
-            return *this;
-        }
+            static_assert(E::layout == Layout, "Matrices must have the same layout");
 
-        /**
-         * @brief Multiplies this matrix by another matrix.
-         * @param other The matrix to multiply by.
-         * @return Matrix<T>& Reference to this matrix after multiplication.
-         * @throws std::invalid_argument If the matrices are not compatible.
-         */
-        Matrix<T> &operator*=(const Matrix<T> &other)
-        {
-            if (m_cols != other.m_rows)
-                throw std::invalid_argument("Matrix multiplication of incompatible sizes");
-
-            Matrix<T> result(m_rows, other.m_cols);
-
-            for (std::size_t i = 0; i < m_rows; ++i)
-                for (std::size_t j = 0; j < other.m_cols; ++j)
-                    for (std::size_t k = 0; k < m_cols; ++k)
-                        result(i, j) += (*this)(i, k) * other(k, j);
+            if (m_rows != other.rows() || m_cols != other.cols())
+                throw std::invalid_argument("Matrix subtraction of different sizes");
 
-            *this = std::move(result);
+            for (std::size_t i = 0; i < m_elements.size(); ++i)
+                m_elements[i] -= other.element(i);
 
             return *this;
         }
@@ -198,32 +237,22 @@ namespace Math
         /**
          * @brief Multiplies this matrix by another matrix.
          * @param other The matrix to multiply by.
-         * @return Matrix<T>& Reference to this matrix after multiplication.
+         * @return Matrix& Reference to this matrix after multiplication.
          * @throws std::invalid_argument If the matrices are not compatible.
          */
-        Matrix<T> &operator*=(Matrix<T> &&other)
+        Matrix &operator*=(const Matrix &other)
         {
-            if (m_cols != other.m_rows)
-                throw std::invalid_argument("Matrix multiplication of incompatible sizes");
-
-            Matrix<T> result(m_rows, other.m_cols);
-
-            for (std::size_t i = 0; i < m_rows; ++i)
-                for (std::size_t j = 0; j < other.m_cols; ++j)
-                    for (std::size_t k = 0; k < m_cols; ++k)
-                        result(i, j) += (*this)(i, k) * other(k, j);
-
-            *this = std::move(result);
-            return *this;
+            return *this = multiply(other);
         }
 
         // Iterators
         /**
          * @brief
-         * Gets the begin iterator of the matrix
-         * @return auto The begin iterator of the matrix
+         * Gets the begin iterator of the matrix. Elements are visited in
+         * storage order.
+         * @return iterator The begin iterator of the matrix
          */
-        auto begin()
+        iterator begin()
         {
             return m_elements.begin();
         }
@@ -231,19 +260,20 @@ namespace Math
         /**
          * @brief
          * Gets the end iterator of the matrix
-         * @return auto The end iterator of the matrix
+         * @return iterator The end iterator of the matrix
          */
-        auto end()
+        iterator end()
         {
             return m_elements.end();
         }
 
         /**
          * @brief
-         * Gets the begin iterator of the matrix
-         * @return auto The begin iterator of the matrix
+         * Gets the begin iterator of the matrix. Elements are visited in
+         * storage order.
+         * @return const_iterator The begin iterator of the matrix
          */
-        auto begin() const
+        const_iterator begin() const
         {
             return m_elements.begin();
         }
@@ -251,9 +281,9 @@ namespace Math
         /**
          * @brief
          * Gets the end iterator of the matrix
-         * @return auto The end iterator of the matrix
+         * @return const_iterator The end iterator of the matrix
          */
-        auto end() const
+        const_iterator end() const
         {
             return m_elements.end();
         }
@@ -264,13 +294,24 @@ namespace Math
          * @param row The row of the element
          * @param col The column of the element
          * @return T& The element at the specified position
+         * @throws std::out_of_range If the position is out of bounds.
          */
         T &at(std::size_t row, std::size_t col)
         {
-            if (row >= m_rows || col >= m_cols)
-                throw std::out_of_range("Matrix subscript out of range");
+            return (*this)(row, col);
+        }
 
-            return m_elements.at(std::make_pair(row, col));
+        /**
+         * @brief
+         * Gets the element at the specified position
+         * @param row The row of the element
+         * @param col The column of the element
+         * @return const T& The element at the specified position
+         * @throws std::out_of_range If the position is out of bounds.
+         */
+        const T &at(std::size_t row, std::size_t col) const
+        {
+            return (*this)(row, col);
         }
 
         // Methods
@@ -296,8 +337,8 @@ namespace Math
 
         /**
          * @brief
-         * Gets the size of the matrix
-         * @return std::size_t The size of the matrix
+         * Gets the number of elements of the matrix
+         * @return std::size_t The number of elements of the matrix
          */
         std::size_t size() const
         {
@@ -306,15 +347,116 @@ namespace Math
 
         /**
          * @brief
-         * Resizes the matrix
+         * Gets the distance between the first elements of two consecutive
+         * rows (row-major) or columns (column-major)
+         * @return std::size_t The leading dimension of the storage
+         */
+        std::size_t stride() const
+        {
+            return Layout == MatrixLayout::RowMajor ? m_cols : m_rows;
+        }
+
+        /**
+         * @brief
+         * Gets the position of an element in the storage, without checking
+         * the bounds
+         * @param row The row of the element
+         * @param col The column of the element
+         * @return std::size_t The index of the element in data()
+         */
+        std::size_t index_of(std::size_t row, std::size_t col) const
+        {
+            if constexpr (Layout == MatrixLayout::RowMajor)
+                return row * m_cols + col;
+            else
+                return col * m_rows + row;
+        }
+
+        /**
+         * @brief
+         * Reads an element by its position in the storage, without checking
+         * the bounds
+         * @param index The position of the element in data()
+         * @return const T& The element
+         */
+        const T &element(std::size_t index) const
+        {
+            return m_elements[index];
+        }
+
+        /**
+         * @brief
+         * Gets the contiguous storage of the matrix. The buffer is aligned
+         * to DEFAULT_ALIGNMENT bytes.
+         * @return T* The first element of the storage
+         */
+        T *data()
+        {
+            return m_elements.data();
+        }
+
+        /**
+         * @brief
+         * Gets the contiguous storage of the matrix. The buffer is aligned
+         * to DEFAULT_ALIGNMENT bytes.
+         * @return const T* The first element of the storage
+         */
+        const T *data() const
+        {
+            return m_elements.data();
+        }
+
+        /**
+         * @brief
+         * Multiplies this matrix by another matrix with the blocked GEMM,
+         * optionally spread over a thread pool
+         * @param other The matrix to multiply by
+         * @param thread_pool Thread pool to run on, or nullptr
+         * @return Matrix The product of both matrices
+         * @throws std::invalid_argument If the matrices are not compatible.
+         */
+        Matrix multiply(const Matrix &other, ThreadPool *thread_pool = nullptr) const
+        {
+            if (m_cols != other.m_rows)
+                throw std::invalid_argument("Matrix multiplication of incompatible sizes");
+
+            Matrix result(m_rows, other.m_cols);
+
+            // A column-major matrix is the row-major storage of its
+            // transpose, so C = A * B is computed as C^T = B^T * A^T
+            if constexpr (Layout == MatrixLayout::RowMajor)
+                gemm(m_rows, other.m_cols, m_cols, data(), m_cols,
+                     other.data(), other.m_cols, result.data(), other.m_cols,
+                     thread_pool);
+            else
+                gemm(other.m_cols, m_rows, m_cols, other.data(), other.m_rows,
+                     data(), m_rows, result.data(), m_rows, thread_pool);
+
+            return result;
+        }
+
+        /**
+         * @brief
+         * Resizes the matrix. Elements inside both the old and the new
+         * bounds keep their value; new elements are value-initialized.
          * @param rows The new rows of the matrix
          * @param cols The new columns of the matrix
          */
         void resize(std::size_t rows, std::size_t cols)
         {
-            m_rows = rows;
-            m_cols = cols;
-            m_elements.resize(rows * cols);
+            if (rows == m_rows && cols == m_cols)
+                return;
+
+            Matrix result(rows, cols);
+            std::size_t common_rows = std::min(rows, m_rows);
+            std::size_t common_cols = std::min(cols, m_cols);
+
+            for (std::size_t i = 0; i < common_rows; ++i)
+                for (std::size_t j = 0; j < common_cols; ++j)
+                    result.m_elements[result.index_of(i, j)] =
+                        std::move(m_elements[index_of(i, j)]);
+
+            *this = std::move(result);
         }
 
         /**
@@ -344,29 +486,70 @@ namespace Math
          */
         void fill(const T &value)
         {
-            for (auto &element : m_elements)
-                element.second = value;
+            std::fill(m_elements.begin(), m_elements.end(), value);
         }
 
         /**
          * @brief
-         * Transposes the matrix
-         * @return Matrix<T> The transposed matrix
+         * Transposes the matrix. The copy is done in square tiles so both
+         * the reads and the writes stay within a few cache lines.
+         * @return Matrix The transposed matrix
          */
-        Matrix<T> transpose() const
+        Matrix transpose() const
         {
-            Matrix<T> result(m_cols, m_rows);
+            constexpr std::size_t tile = 32;
 
-            for (auto &element : m_elements)
-                result(element.first.second,
-                       element.first.first) = element.second;
+            Matrix result(m_cols, m_rows);
+
+            for (std::size_t i0 = 0; i0 < m_rows; i0 += tile)
+                for (std::size_t j0 = 0; j0 < m_cols; j0 += tile)
+                {
+                    std::size_t i1 = std::min(i0 + tile, m_rows);
+                    std::size_t j1 = std::min(j0 + tile, m_cols);
+
+                    for (std::size_t i = i0; i < i1; ++i)
+                        for (std::size_t j = j0; j < j1; ++j)
+                            result.m_elements[result.index_of(j, i)] =
+                                m_elements[index_of(i, j)];
+                }
 
             return result;
         }
 
     private:
-        std::size_t m_rows;
-        std::size_t m_cols;
-        std::unordered_map<std::pair<std::size_t, std::size_t>, T> m_elements;
+        std::size_t m_rows = 0;
+        std::size_t m_cols = 0;
+        storage_type m_elements;
     };
-}
\ No newline at end of file
+
+    /**
+     * @brief
+     * Multiplies two matrices. Expression operands are evaluated first,
+     * since every element of a product reads a whole row and column.
+     * @tparam L Type of the left operand
+     * @tparam R Type of the right operand
+     * @param left The left operand
+     * @param right The right operand
+     * @return Matrix The product of both matrices
+     * @throws std::invalid_argument If the matrices are not compatible.
+     */
+    template <class L, class R>
+    Matrix<typename L::value_type, L::layout>
+    operator*(const MatrixExpression<L> &left, const MatrixExpression<R> &right)
+    {
+        using Result = Matrix<typename L::value_type, L::layout>;
+
+        auto evaluate = []<class E>(const MatrixExpression<E> &operand) -> decltype(auto)
+        {
+            if constexpr (E::is_container)
+                return (operand.self());
+            else
+                return Result(operand);
+        };
+
+        const Result &lhs = evaluate(left);
+        const Result &rhs = evaluate(right);
+
+        return lhs.multiply(rhs);
+    }
+}
@@ -0,0 +1,437 @@
+/**
+ * @file quaternion.h
+ * @author Carlos Salguero
+ * @brief Quaternion for rotations and orientations
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#pragma once
+
+// C++ Standard Library
+#include <cstddef>
+#include <type_traits>
+
+// Project files
+#include "float4.h"
+#include "mat.h"
+#include "math.h"
+#include "vec.h"
+
+namespace Math
+{
+    /**
+     * @class Quaternion
+     * @brief Quaternion x i + y j + z k + w stored as (x, y, z, w), the lane
+     *        order of Float4. Unit quaternions represent rotations; like Mat,
+     *        a product a * b applies b first and then a.
+     * @tparam T Type of the components
+     */
+    template <class T>
+    class alignas(4 * sizeof(T)) Quaternion
+    {
+    public:
+        // Type aliases
+        using value_type = T;
+
+        // Constructors
+        /**
+         * @brief
+         * Constructs the identity rotation
+         */
+        constexpr Quaternion() : m_elements(T(), T(), T(), T(1)) {}
+
+        /**
+         * @brief
+         * Constructs a quaternion from its components
+         * @param x The i component
+         * @param y The j component
+         * @param z The k component
+         * @param w The real component
+         */
+        constexpr Quaternion(const T &x, const T &y, const T &z, const T &w)
+            : m_elements(x, y, z, w) {}
+
+        /**
+         * @brief
+         * Constructs a quaternion from a vector holding (x, y, z, w)
+         * @param vector The components
+         */
+        explicit constexpr Quaternion(const Vec<4, T> &vector) : m_elements(vector) {}
+
+        // Operators
+        /**
+         * @brief
+         * Compares two quaternions component by component. q and -q are the
+         * same rotation but do not compare equal.
+         * @param other The quaternion to compare with
+         * @return true If every component is equal
+         * @return false Otherwise
+         */
+        constexpr bool operator==(const Quaternion &other) const
+        {
+            return m_elements == other.m_elements;
+        }
+
+        /**
+         * @brief
+         * Multiplies two quaternions (Hamilton product)
+         * @param other The quaternion to multiply by
+         * @return Quaternion The rotation that applies other and then this
+         */
+        Quaternion operator*(const Quaternion &other) const
+        {
+            if constexpr (std::is_same_v<T, float>)
+            {
+                // Each component of a contributes b with its lanes reordered
+                // and signs flipped
+                using Simd::Float4;
+
+                Float4 a(m_elements);
+                Float4 b(other.m_elements);
+
+                Float4 result = Float4::splat<3>(a) * b;
+                result = Float4::multiply_add(
+                    Float4::splat<0>(a) * Float4(1.0f, -1.0f, 1.0f, -1.0f),
+                    Float4::swizzle<3, 2, 1, 0>(b), result);
+                result = Float4::multiply_add(
+                    Float4::splat<1>(a) * Float4(1.0f, 1.0f, -1.0f, -1.0f),
+                    Float4::swizzle<2, 3, 0, 1>(b), result);
+                result = Float4::multiply_add(
+                    Float4::splat<2>(a) * Float4(-1.0f, 1.0f, 1.0f, -1.0f),
+                    Float4::swizzle<1, 0, 3, 2>(b), result);
+
+                return Quaternion(result.to_vec());
+            }
+            else
+            {
+                const T &ax = x(), &ay = y(), &az = z(), &aw = w();
+                const T &bx = other.x(), &by = other.y(), &bz = other.z(), &bw = other.w();
+
+                return Quaternion(aw * bx + ax * bw + ay * bz - az * by,
+                                  aw * by - ax * bz + ay * bw + az * bx,
+                                  aw * bz + ax * by - ay * bx + az * bw,
+                                  aw * bw - ax * bx - ay * by - az * bz);
+            }
+        }
+
+        /**
+         * @brief
+         * Rotates a vector by the quaternion, which must be of unit length
+         * @param vector The vector to rotate
+         * @return Vec<3, T> The rotated vector
+         */
+        constexpr Vec<3, T> operator*(const Vec<3, T> &vector) const
+        {
+            return rotate(vector);
+        }
+
+        constexpr Quaternion operator+(const Quaternion &other) const
+        {
+            return Quaternion(m_elements + other.m_elements);
+        }
+
+        constexpr Quaternion operator-(const Quaternion &other) const
+        {
+            return Quaternion(m_elements - other.m_elements);
+        }
+
+        constexpr Quaternion operator*(const T &scalar) const
+        {
+            return Quaternion(m_elements * scalar);
+        }
+
+        constexpr Quaternion operator-() const
+        {
+            return Quaternion(-m_elements);
+        }
+
+        Quaternion &operator*=(const Quaternion &other)
+        {
+            return *this = *this * other;
+        }
+
+        // Access Methods
+        constexpr T &x() { return m_elements[0]; }
+        constexpr T &y() { return m_elements[1]; }
+        constexpr T &z() { return m_elements[2]; }
+        constexpr T &w() { return m_elements[3]; }
+        constexpr const T &x() const { return m_elements[0]; }
+        constexpr const T &y() const { return m_elements[1]; }
+        constexpr const T &z() const { return m_elements[2]; }
+        constexpr const T &w() const { return m_elements[3]; }
+
+        /**
+         * @brief
+         * Gets the vector part (x, y, z)
+         * @return Vec<3, T> The vector part
+         */
+        constexpr Vec<3, T> vector_part() const
+        {
+            return Vec<3, T>(x(), y(), z());
+        }
+
+        /**
+         * @brief
+         * Gets the components as (x, y, z, w)
+         * @return const Vec<4, T>& The components
+         */
+        constexpr const Vec<4, T> &to_vec() const
+        {
+            return m_elements;
+        }
+
+        // Methods
+        /**
+         * @brief
+         * Calculates the dot product of two quaternions
+         * @param other The other quaternion
+         * @return T The dot product
+         */
+        constexpr T dot(const Quaternion &other) const
+        {
+            return m_elements.dot(other.m_elements);
+        }
+
+        /**
+         * @brief
+         * Calculates the squared magnitude of the quaternion
+         * @return T The squared magnitude
+         */
+        constexpr T squared_magnitude() const
+        {
+            return m_elements.squared_magnitude();
+        }
+
+        /**
+         * @brief
+         * Calculates the magnitude of the quaternion
+         * @return T The magnitude
+         */
+        T magnitude() const
+        {
+            return m_elements.magnitude();
+        }
+
+        /**
+         * @brief
+         * Scales the quaternion to unit length. The zero quaternion is
+         * returned unchanged.
+         * @return Quaternion The normalized quaternion
+         */
+        Quaternion normalize() const
+        {
+            return Quaternion(m_elements.normalize());
+        }
+
+        /**
+         * @brief
+         * Calculates the conjugate, which is the inverse of a unit quaternion
+         * @return Quaternion The conjugate
+         */
+        constexpr Quaternion conjugate() const
+        {
+            return Quaternion(-x(), -y(), -z(), w());
+        }
+
+        /**
+         * @brief
+         * Calculates the inverse of any non-zero quaternion
+         * @return Quaternion The inverse
+         * @throws std::invalid_argument If the quaternion is zero
+         */
+        constexpr Quaternion inverse() const
+        {
+            T length = squared_magnitude();
+
+            if (length == T())
+                throw std::invalid_argument("Cannot invert a zero quaternion");
+
+            return conjugate() * (T(1) / length);
+        }
+
+        /**
+         * @brief
+         * Rotates a vector by the quaternion, which must be of unit length.
+         * Uses v' = v + w t + q x t with t = 2 (q x v), which needs fewer
+         * operations than q v q*.
+         * @param vector The vector to rotate
+         * @return Vec<3, T> The rotated vector
+         */
+        constexpr Vec<3, T> rotate(const Vec<3, T> &vector) const
+        {
+            Vec<3, T> axis = vector_part();
+            Vec<3, T> t = axis.cross(vector) * T(2);
+
+            return vector + t * w() + axis.cross(t);
+        }
+
+        /**
+         * @brief
+         * Converts the rotation to a 3x3 matrix. The quaternion must be of
+         * unit length.
+         * @return Mat<3, 3, T> The rotation matrix
+         */
+        constexpr Mat<3, 3, T> to_mat3() const
+        {
+            T xx = x() * x(), yy = y() * y(), zz = z() * z();
+            T xy = x() * y(), xz = x() * z(), yz = y() * z();
+            T wx = w() * x(), wy = w() * y(), wz = w() * z();
+            T one(1), two(2);
+
+            return Mat<3, 3, T>(
+                Vec<3, T>(one - two * (yy + zz), two * (xy - wz), two * (xz + wy)),
+                Vec<3, T>(two * (xy + wz), one - two * (xx + zz), two * (yz - wx)),
+                Vec<3, T>(two * (xz - wy), two * (yz + wx), one - two * (xx + yy)));
+        }
+
+        /**
+         * @brief
+         * Converts the rotation to a 4x4 homogeneous matrix. The quaternion
+         * must be of unit length.
+         * @return Mat<4, 4, T> The rotation matrix
+         */
+        constexpr Mat<4, 4, T> to_mat4() const
+        {
+            Mat<3, 3, T> rotation = to_mat3();
+            Mat<4, 4, T> result = Mat<4, 4, T>::identity();
+
+            for (std::size_t i = 0; i < 3; ++i)
+                for (std::size_t j = 0; j < 3; ++j)
+                    result(i, j) = rotation(i, j);
+
+            return result;
+        }
+
+        // Static Methods
+        /**
+         * @brief
+         * Creates the identity rotation
+         * @return Quaternion The identity rotation
+         */
+        static constexpr Quaternion identity()
+        {
+            return Quaternion();
+        }
+
+        /**
+         * @brief
+         * Creates a rotation around an axis
+         * @param axis The axis of rotation, of unit length
+         * @param angle The angle in radians, counter-clockwise around the axis
+         * @return Quaternion The rotation
+         */
+        static Quaternion from_axis_angle(const Vec<3, T> &axis, const T &angle)
+        {
+            T half = angle / T(2);
+            T s = sine(half);
+
+            return Quaternion(axis.x() * s, axis.y() * s, axis.z() * s, cosine(half));
+        }
+
+        /**
+         * @brief
+         * Creates the rotation of a rotation matrix with Shepperd's method,
+         * which divides by the largest of the four candidate components to
+         * stay accurate for every angle
+         * @param matrix An orthonormal rotation matrix
+         * @return Quaternion The rotation, with w >= 0 where possible
+         */
+        static Quaternion from_mat3(const Mat<3, 3, T> &matrix)
+        {
+            const Mat<3, 3, T> &m = matrix;
+            T trace = m(0, 0) + m(1, 1) + m(2, 2);
+
+            if (trace > T())
+            {
+                T s = square_root(trace + T(1)) * T(2);
+                return Quaternion((m(2, 1) - m(1, 2)) / s, (m(0, 2) - m(2, 0)) / s,
+                                  (m(1, 0) - m(0, 1)) / s, s / T(4));
+            }
+
+            if (m(0, 0) > m(1, 1) && m(0, 0) > m(2, 2))
+            {
+                T s = square_root(T(1) + m(0, 0) - m(1, 1) - m(2, 2)) * T(2);
+                return Quaternion(s / T(4), (m(0, 1) + m(1, 0)) / s,
+                                  (m(0, 2) + m(2, 0)) / s, (m(2, 1) - m(1, 2)) / s);
+            }
+
+            if (m(1, 1) > m(2, 2))
+            {
+                T s = square_root(T(1) + m(1, 1) - m(0, 0) - m(2, 2)) * T(2);
+                return Quaternion((m(0, 1) + m(1, 0)) / s, s / T(4),
+                                  (m(1, 2) + m(2, 1)) / s, (m(0, 2) - m(2, 0)) / s);
+            }
+
+            T s = square_root(T(1) + m(2, 2) - m(0, 0) - m(1, 1)) * T(2);
+            return Quaternion((m(0, 2) + m(2, 0)) / s, (m(1, 2) + m(2, 1)) / s,
+                              s / T(4), (m(1, 0) - m(0, 1)) / s);
+        }
+
+        /**
+         * @brief
+         * Creates the rotation of the upper 3x3 block of a homogeneous matrix
+         * @param matrix A matrix whose upper 3x3 block is a rotation
+         * @return Quaternion The rotation
+         */
+        static Quaternion from_mat4(const Mat<4, 4, T> &matrix)
+        {
+            return from_mat3(matrix.minor(3, 3));
+        }
+
+        /**
+         * @brief
+         * Interpolates linearly and renormalizes, along the shorter arc.
+         * Cheaper than slerp and commutative; the angular speed is not
+         * constant but the error is small for the close keyframes of
+         * animations.
+         * @param from The rotation at t = 0
+         * @param to The rotation at t = 1
+         * @param t The interpolation factor
+         * @return Quaternion The interpolated rotation
+         */
+        static Quaternion nlerp(const Quaternion &from, const Quaternion &to, const T &t)
+        {
+            Quaternion target = from.dot(to) < T() ? -to : to;
+
+            return Quaternion(from.m_elements.lerp(target.m_elements, t)).normalize();
+        }
+
+        /**
+         * @brief
+         * Interpolates along the shorter great arc at constant angular speed.
+         * Nearly parallel rotations fall back to nlerp, where the sine of the
+         * angle would lose precision.
+         * @param from The rotation at t = 0
+         * @param to The rotation at t = 1
+         * @param t The interpolation factor
+         * @return Quaternion The interpolated rotation
+         */
+        static Quaternion slerp(const Quaternion &from, const Quaternion &to, const T &t)
+        {
+            T cos_theta = from.dot(to);
+            Quaternion target = to;
+
+            if (cos_theta < T())
+            {
+                cos_theta = -cos_theta;
+                target = -to;
+            }
+
+            if (cos_theta > T(0.9995))
+                return nlerp(from, target, t);
+
+            T theta = arc_cosine(cos_theta);
+            T inverse_sin = T(1) / sine(theta);
+
+            return from * (sine((T(1) - t) * theta) * inverse_sin) +
+                   target * (sine(t * theta) * inverse_sin);
+        }
+
+    private:
+        Vec<4, T> m_elements;
+    };
+}
@@ -0,0 +1,332 @@
+/**
+ * @file simd.h
+ * @author Carlos Salguero
+ * @brief Four-wide float vector and 4x4 matrix backed by SIMD registers
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#pragma once
+
+// C++ Standard Library
+#include <cstddef>
+#include <stdexcept>
+
+// Project files
+#include "float4.h"
+#include "mat.h"
+
+namespace Math::Simd
+{
+    /**
+     * @class Float4x4
+     * @brief 4x4 float matrix held in four SIMD registers. Each register is
+     *        a column, so transforming a vector and multiplying matrices
+     *        only need lane broadcasts. Like Mat4, it transforms column
+     *        vectors.
+     */
+    class Float4x4
+    {
+    public:
+        // Constructors
+        Float4x4() = default;
+
+        /**
+         * @brief
+         * Constructs a matrix from its columns
+         * @param c0 The first column
+         * @param c1 The second column
+         * @param c2 The third column
+         * @param c3 The fourth column
+         */
+        Float4x4(const Float4 &c0, const Float4 &c1, const Float4 &c2, const Float4 &c3)
+            : m_columns{c0, c1, c2, c3} {}
+
+        /**
+         * @brief
+         * Constructs a matrix from a fixed-size matrix
+         * @param matrix The matrix to load
+         */
+        explicit Float4x4(const Mat<4, 4, float> &matrix)
+            : Float4x4(Float4x4(Float4(matrix[0]), Float4(matrix[1]),
+                                Float4(matrix[2]), Float4(matrix[3]))
+                           .transpose()) {}
+
+        // Operators
+        /**
+         * @brief
+         * Multiplies two matrices
+         * @param other The matrix to multiply by
+         * @return Float4x4 The product of both matrices
+         */
+        Float4x4 operator*(const Float4x4 &other) const
+        {
+            Float4x4 result;
+
+#if defined(MATH_SIMD_AVX2)
+            // Two columns of the result per iteration: each 128-bit half of
+            // the 256-bit registers holds one column
+            __m128 a0 = m_columns[0].get_register();
+            __m128 a1 = m_columns[1].get_register();
+            __m128 a2 = m_columns[2].get_register();
+            __m128 a3 = m_columns[3].get_register();
+            __m256 c0 = _mm256_set_m128(a0, a0);
+            __m256 c1 = _mm256_set_m128(a1, a1);
+            __m256 c2 = _mm256_set_m128(a2, a2);
+            __m256 c3 = _mm256_set_m128(a3, a3);
+
+            for (std::size_t j = 0; j < 4; j += 2)
+            {
+                __m256 b = _mm256_set_m128(other.m_columns[j + 1].get_register(),
+                                           other.m_columns[j].get_register());
+                __m256 sum = _mm256_mul_ps(c0, _mm256_permute_ps(b, 0x00));
+#if defined(__FMA__)
+                sum = _mm256_fmadd_ps(c1, _mm256_permute_ps(b, 0x55), sum);
+                sum = _mm256_fmadd_ps(c2, _mm256_permute_ps(b, 0xAA), sum);
+                sum = _mm256_fmadd_ps(c3, _mm256_permute_ps(b, 0xFF), sum);
+#else
+                sum = _mm256_add_ps(sum, _mm256_mul_ps(c1, _mm256_permute_ps(b, 0x55)));
+                sum = _mm256_add_ps(sum, _mm256_mul_ps(c2, _mm256_permute_ps(b, 0xAA)));
+                sum = _mm256_add_ps(sum, _mm256_mul_ps(c3, _mm256_permute_ps(b, 0xFF)));
+#endif
+                result.m_columns[j] = _mm256_castps256_ps128(sum);
+                result.m_columns[j + 1] = _mm256_extractf128_ps(sum, 1);
+            }
+#else
+            for (std::size_t j = 0; j < 4; ++j)
+                result.m_columns[j] = (*this) * other.m_columns[j];
+#endif
+
+            return result;
+        }
+
+        /**
+         * @brief
+         * Transforms a column vector by the matrix
+         * @param vector The vector to transform
+         * @return Float4 The transformed vector
+         */
+        Float4 operator*(const Float4 &vector) const
+        {
+            Float4 result = m_columns[0] * Float4::splat<0>(vector);
+            result = Float4::multiply_add(m_columns[1], Float4::splat<1>(vector), result);
+            result = Float4::multiply_add(m_columns[2], Float4::splat<2>(vector), result);
+
+            return Float4::multiply_add(m_columns[3], Float4::splat<3>(vector), result);
+        }
+
+        // Access Methods
+        /**
+         * @brief
+         * Gets a column of the matrix
+         * @param col The index of the column
+         * @return const Float4& The column
+         */
+        const Float4 &column(std::size_t col) const
+        {
+            return m_columns[col];
+        }
+
+        /**
+         * @brief
+         * Reads one element. Meant for tests and debugging, not for hot
+         * loops.
+         * @param row The row of the element
+         * @param col The column of the element
+         * @return float The element
+         */
+        float operator()(std::size_t row, std::size_t col) const
+        {
+            return m_columns[col][row];
+        }
+
+        // Methods
+        /**
+         * @brief
+         * Converts the matrix to a fixed-size matrix
+         * @return Mat<4, 4, float> The fixed-size matrix
+         */
+        Mat<4, 4, float> to_mat() const
+        {
+            Float4x4 rows = transpose();
+            Mat<4, 4, float> result;
+
+            for (std::size_t i = 0; i < 4; ++i)
+                rows.m_columns[i].store(result[i].data());
+
+            return result;
+        }
+
+        /**
+         * @brief
+         * Transposes the matrix
+         * @return Float4x4 The transposed matrix
+         */
+        Float4x4 transpose() const
+        {
+            Float4 t0 = Float4::shuffle<0, 1, 0, 1>(m_columns[0], m_columns[1]);
+            Float4 t1 = Float4::shuffle<2, 3, 2, 3>(m_columns[0], m_columns[1]);
+            Float4 t2 = Float4::shuffle<0, 1, 0, 1>(m_columns[2], m_columns[3]);
+            Float4 t3 = Float4::shuffle<2, 3, 2, 3>(m_columns[2], m_columns[3]);
+
+            return Float4x4(Float4::shuffle<0, 2, 0, 2>(t0, t2),
+                            Float4::shuffle<1, 3, 1, 3>(t0, t2),
+                            Float4::shuffle<0, 2, 0, 2>(t1, t3),
+                            Float4::shuffle<1, 3, 1, 3>(t1, t3));
+        }
+
+        /**
+         * @brief
+         * Calculates the inverse of the matrix with the 2x2 block method:
+         * the four 2x2 blocks are inverted through their adjugates, which
+         * needs a single division.
+         * @return Float4x4 The inverse matrix
+         * @throws std::invalid_argument If the matrix is singular
+         */
+        Float4x4 inverse() const
+        {
+            // The algorithm is written for rows. Running it on the columns
+            // inverts the transpose, whose rows are the columns of the
+            // inverse, so the layouts line up without extra transposes.
+            const Float4 &r0 = m_columns[0];
+            const Float4 &r1 = m_columns[1];
+            const Float4 &r2 = m_columns[2];
+            const Float4 &r3 = m_columns[3];
+
+            // 2x2 blocks, each stored as (m00, m01, m10, m11)
+            Float4 a = Float4::shuffle<0, 1, 0, 1>(r0, r1);
+            Float4 b = Float4::shuffle<2, 3, 2, 3>(r0, r1);
+            Float4 c = Float4::shuffle<0, 1, 0, 1>(r2, r3);
+            Float4 d = Float4::shuffle<2, 3, 2, 3>(r2, r3);
+
+            // (|A|, |B|, |C|, |D|)
+            Float4 determinants =
+                Float4::shuffle<0, 2, 0, 2>(r0, r2) * Float4::shuffle<1, 3, 1, 3>(r1, r3) -
+                Float4::shuffle<1, 3, 1, 3>(r0, r2) * Float4::shuffle<0, 2, 0, 2>(r1, r3);
+
+            Float4 det_a = Float4::splat<0>(determinants);
+            Float4 det_b = Float4::splat<1>(determinants);
+            Float4 det_c = Float4::splat<2>(determinants);
+            Float4 det_d = Float4::splat<3>(determinants);
+
+            Float4 d_c = adjugate_multiply(d, c);
+            Float4 a_b = adjugate_multiply(a, b);
+
+            Float4 x = det_d * a - multiply(b, d_c);
+            Float4 w = det_a * d - multiply(c, a_b);
+            Float4 y = det_b * c - multiply_adjugate(d, a_b);
+            Float4 z = det_c * b - multiply_adjugate(a, d_c);
+
+            // |M| = |A||D| + |B||C| - tr((A#B)(D#C))
+            Float4 trace = (a_b * Float4::swizzle<0, 2, 1, 3>(d_c)).horizontal_sum();
+            Float4 det_m = det_a * det_d + det_b * det_c - trace;
+
+            if (det_m.first() == 0.0f)
+                throw std::invalid_argument("Matrix is singular");
+
+            Float4 reciprocal = Float4(1.0f, -1.0f, -1.0f, 1.0f) / det_m;
+
+            x *= reciprocal;
+            y *= reciprocal;
+            z *= reciprocal;
+            w *= reciprocal;
+
+            return Float4x4(Float4::shuffle<3, 1, 3, 1>(x, y),
+                            Float4::shuffle<2, 0, 2, 0>(x, y),
+                            Float4::shuffle<3, 1, 3, 1>(z, w),
+                            Float4::shuffle<2, 0, 2, 0>(z, w));
+        }
+
+        /**
+         * @brief
+         * Calculates the inverse of an affine matrix, whose last row is
+         * (0, 0, 0, 1). The rows of the inverse of the 3x3 block are the
+         * cross products of its columns divided by the determinant, and the
+         * translation is the inverted block applied to minus the original
+         * one. About half the work of inverse().
+         * @return Float4x4 The inverse matrix
+         * @throws std::invalid_argument If the 3x3 block is singular
+         */
+        Float4x4 affine_inverse() const
+        {
+            const Float4 &c0 = m_columns[0];
+            const Float4 &c1 = m_columns[1];
+            const Float4 &c2 = m_columns[2];
+            const Float4 &translation = m_columns[3];
+
+            Float4 r0 = c1.cross(c2);
+            Float4 r1 = c2.cross(c0);
+            Float4 r2 = c0.cross(c1);
+            float determinant = c0.dot3(r0);
+
+            if (determinant == 0.0f)
+                throw std::invalid_argument("Matrix is singular");
+
+            Float4 reciprocal(1.0f / determinant);
+
+            r0 = r0.with_w(-r0.dot3(translation)) * reciprocal;
+            r1 = r1.with_w(-r1.dot3(translation)) * reciprocal;
+            r2 = r2.with_w(-r2.dot3(translation)) * reciprocal;
+
+            return Float4x4(r0, r1, r2, Float4(0.0f, 0.0f, 0.0f, 1.0f)).transpose();
+        }
+
+        // Static Methods
+        /**
+         * @brief
+         * Creates the identity matrix
+         * @return Float4x4 The identity matrix
+         */
+        static Float4x4 identity()
+        {
+            return Float4x4(Float4(1.0f, 0.0f, 0.0f, 0.0f), Float4(0.0f, 1.0f, 0.0f, 0.0f),
+                            Float4(0.0f, 0.0f, 1.0f, 0.0f), Float4(0.0f, 0.0f, 0.0f, 1.0f));
+        }
+
+    private:
+        Float4 m_columns[4];
+
+        // Methods (private)
+        /**
+         * @brief
+         * Multiplies two 2x2 matrices stored as (m00, m01, m10, m11)
+         * @param a The left matrix
+         * @param b The right matrix
+         * @return Float4 A * B
+         */
+        static Float4 multiply(const Float4 &a, const Float4 &b)
+        {
+            return a * Float4::swizzle<0, 3, 0, 3>(b) +
+                   Float4::swizzle<1, 0, 3, 2>(a) * Float4::swizzle<2, 1, 2, 1>(b);
+        }
+
+        /**
+         * @brief
+         * Multiplies the adjugate of a 2x2 matrix by another one
+         * @param a The left matrix
+         * @param b The right matrix
+         * @return Float4 adj(A) * B
+         */
+        static Float4 adjugate_multiply(const Float4 &a, const Float4 &b)
+        {
+            return Float4::swizzle<3, 3, 0, 0>(a) * b -
+                   Float4::swizzle<1, 1, 2, 2>(a) * Float4::swizzle<2, 3, 0, 1>(b);
+        }
+
+        /**
+         * @brief
+         * Multiplies a 2x2 matrix by the adjugate of another one
+         * @param a The left matrix
+         * @param b The right matrix
+         * @return Float4 A * adj(B)
+         */
+        static Float4 multiply_adjugate(const Float4 &a, const Float4 &b)
+        {
+            return a * Float4::swizzle<3, 0, 3, 0>(b) -
+                   Float4::swizzle<1, 0, 3, 2>(a) * Float4::swizzle<2, 1, 2, 1>(b);
+        }
+    };
+}
@@ -0,0 +1,1042 @@
+/**
+ * @file sparse.h
+ * @author Carlos Salguero
+ * @brief Compressed sparse row matrices, plain and blocked, with their
+ *        products and iterative solvers
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+// Project files
+#include "matrix.h"
+#include "vector.h"
+#include "../../threads/thread_pool.h"
+
+namespace Math
+{
+    namespace Detail
+    {
+        // Non-zeros per task of a parallel product. Smaller bands cost more
+        // in scheduling than they save.
+        inline constexpr std::size_t SPARSE_BAND = 1 << 14;
+
+        /**
+         * @brief
+         * Runs body(begin, end) over bands of rows holding about the same
+         * number of non-zeros, on the thread pool when there is one
+         * @tparam F Type of the body
+         * @param row_offsets Offset of the first entry of every row, plus
+         * the total
+         * @param thread_pool Thread pool to run on, or nullptr
+         * @param body Function called with each band of rows
+         */
+        template <class F>
+        void for_each_row_band(std::span<const std::size_t> row_offsets,
+                               ThreadPool *thread_pool, F &&body)
+        {
+            std::size_t rows = row_offsets.size() - 1;
+            std::size_t total = row_offsets.back();
+
+            if (thread_pool == nullptr || total <= SPARSE_BAND)
+            {
+                body(std::size_t(0), rows);
+                return;
+            }
+
+            // The bodies write the caller's buffers: the group outlives none
+            // of them
+            TaskGroup tasks(*thread_pool);
+            std::size_t begin = 0;
+
+            while (begin < rows)
+            {
+                // First row past the next SPARSE_BAND non-zeros
+                auto next = std::upper_bound(row_offsets.begin() + begin + 1, row_offsets.end() - 1,
+                                             row_offsets[begin] + SPARSE_BAND);
+                std::size_t end = static_cast<std::size_t>(next - row_offsets.begin());
+
+                if (end == rows)
+                    body(begin, end);
+                else
+                    tasks.run(body, begin, end);
+
+                begin = end;
+            }
+
+            tasks.wait();
+        }
+    }
+
+    /**
+     * @struct SparseEntry
+     * @brief One element of a sparse matrix, used to build it
+     * @tparam T Type of the element
+     */
+    template <class T>
+    struct SparseEntry
+    {
+        std::size_t row;
+        std::size_t col;
+        T value;
+    };
+
+    /**
+     * @class SparseMatrix
+     * @brief Sparse matrix in compressed sparse row (CSR) form: the
+     *        non-zeros of each row are stored together, sorted by column
+     * @tparam T Type of the elements
+     */
+    template <class T>
+    class SparseMatrix
+    {
+    public:
+        // Type aliases
+        using value_type = T;
+
+        // Constructors
+        SparseMatrix() : m_row_offsets(1) {}
+
+        /**
+         * @brief
+         * Constructs a matrix with no non-zeros
+         * @param rows Number of rows
+         * @param cols Number of columns
+         */
+        SparseMatrix(std::size_t rows, std::size_t cols)
+            : m_rows(rows), m_cols(cols), m_row_offsets(rows + 1) {}
+
+        /**
+         * @brief
+         * Constructs a matrix from its CSR arrays
+         * @param rows Number of rows
+         * @param cols Number of columns
+         * @param row_offsets Offset of the first entry of every row, plus
+         * the number of entries
+         * @param columns Column of every entry, increasing within a row
+         * @param values Value of every entry
+         * @throws std::invalid_argument If the arrays are inconsistent
+         */
+        SparseMatrix(std::size_t rows, std::size_t cols, std::vector<std::size_t> row_offsets,
+                     std::vector<std::size_t> columns, std::vector<T> values)
+            : m_rows(rows), m_cols(cols), m_row_offsets(std::move(row_offsets)),
+              m_columns(std::move(columns)), m_values(std::move(values))
+        {
+            if (m_row_offsets.size() != rows + 1 || m_row_offsets.front() != 0 ||
+                m_row_offsets.back() != m_columns.size() || m_values.size() != m_columns.size())
+                throw std::invalid_argument("Inconsistent CSR arrays");
+
+            for (std::size_t i = 0; i < rows; ++i)
+            {
+                if (m_row_offsets[i] > m_row_offsets[i + 1])
+                    throw std::invalid_argument("Inconsistent CSR arrays");
+
+                for (std::size_t k = m_row_offsets[i]; k < m_row_offsets[i + 1]; ++k)
+                    if (m_columns[k] >= cols ||
+                        (k > m_row_offsets[i] && m_columns[k] <= m_columns[k - 1]))
+                        throw std::invalid_argument("Inconsistent CSR arrays");
+            }
+        }
+
+        // Operators
+        /**
+         * @brief
+         * Looks up an element with a binary search in its row
+         * @param row The row of the element
+         * @param col The column of the element
+         * @return T The element, zero when it is not stored
+         * @throws std::out_of_range If the position is out of bounds
+         */
+        T operator()(std::size_t row, std::size_t col) const
+        {
+            if (row >= m_rows || col >= m_cols)
+                throw std::out_of_range("Matrix subscript out of range");
+
+            auto first = m_columns.begin() + m_row_offsets[row];
+            auto last = m_columns.begin() + m_row_offsets[row + 1];
+            auto found = std::lower_bound(first, last, col);
+
+            return found != last && *found == col ? m_values[found - m_columns.begin()] : T();
+        }
+
+        /**
+         * @brief
+         * Multiplies the matrix by a vector
+         * @param vector The vector to multiply by
+         * @return Vector<T> The product
+         * @throws std::invalid_argument If the sizes differ
+         */
+        Vector<T> operator*(const Vector<T> &vector) const
+        {
+            return multiply(vector);
+        }
+
+        // Access Methods
+        /**
+         * @brief
+         * Gets the rows of the matrix
+         * @return std::size_t The rows of the matrix
+         */
+        std::size_t rows() const
+        {
+            return m_rows;
+        }
+
+        /**
+         * @brief
+         * Gets the columns of the matrix
+         * @return std::size_t The columns of the matrix
+         */
+        std::size_t cols() const
+        {
+            return m_cols;
+        }
+
+        /**
+         * @brief
+         * Gets the number of stored elements
+         * @return std::size_t The number of stored elements
+         */
+        std::size_t non_zeros() const
+        {
+            return m_values.size();
+        }
+
+        /**
+         * @brief
+         * Gets the offset of the first entry of every row, plus the number of
+         * entries
+         * @return std::span<const std::size_t> The row offsets
+         */
+        std::span<const std::size_t> row_offsets() const
+        {
+            return m_row_offsets;
+        }
+
+        /**
+         * @brief
+         * Gets the column of every entry
+         * @return std::span<const std::size_t> The columns
+         */
+        std::span<const std::size_t> columns() const
+        {
+            return m_columns;
+        }
+
+        /**
+         * @brief
+         * Gets the value of every entry
+         * @return std::span<const T> The values
+         */
+        std::span<const T> values() const
+        {
+            return m_values;
+        }
+
+        /**
+         * @brief
+         * Gets the value of every entry, which may be changed in place
+         * @return std::span<T> The values
+         */
+        std::span<T> values()
+        {
+            return m_values;
+        }
+
+        // Methods
+        /**
+         * @brief
+         * Computes y = A x, splitting the rows across the thread pool
+         * @param x The vector to multiply, of cols() elements
+         * @param y The product, of rows() elements
+         * @param thread_pool Thread pool to run on, or nullptr
+         * @throws std::invalid_argument If the sizes differ
+         */
+        void multiply(std::span<const T> x, std::span<T> y, ThreadPool *thread_pool = nullptr) const
+        {
+            if (x.size() != m_cols || y.size() != m_rows)
+                throw std::invalid_argument("Vector size does not match the matrix");
+
+            const std::size_t *offsets = m_row_offsets.data();
+            const std::size_t *columns = m_columns.data();
+            const T *values = m_values.data();
+
+            Detail::for_each_row_band(m_row_offsets, thread_pool,
+                                      [=](std::size_t begin, std::size_t end)
+                                      {
+                                          for (std::size_t i = begin; i < end; ++i)
+                                          {
+                                              T sum = T();
+
+                                              for (std::size_t k = offsets[i]; k < offsets[i + 1]; ++k)
+                                                  sum += values[k] * x[columns[k]];
+
+                                              y[i] = sum;
+                                          }
+                                      });
+        }
+
+        /**
+         * @brief
+         * Multiplies the matrix by a vector
+         * @param vector The vector to multiply by
+         * @param thread_pool Thread pool to run on, or nullptr
+         * @return Vector<T> The product
+         * @throws std::invalid_argument If the sizes differ
+         */
+        Vector<T> multiply(const Vector<T> &vector, ThreadPool *thread_pool = nullptr) const
+        {
+            if (vector.size() != m_cols)
+                throw std::invalid_argument("Vector size does not match the matrix");
+
+            std::vector<T> x(m_cols);
+            std::vector<T> y(m_rows);
+
+            for (std::size_t i = 0; i < m_cols; ++i)
+                x[i] = vector[i];
+
+            multiply(x, y, thread_pool);
+
+            Vector<T> result(m_rows);
+
+            for (std::size_t i = 0; i < m_rows; ++i)
+                result[i] = y[i];
+
+            return result;
+        }
+
+        /**
+         * @brief
+         * Gets the main diagonal, with zeros where nothing is stored
+         * @return std::vector<T> The diagonal
+         */
+        std::vector<T> diagonal() const
+        {
+            std::vector<T> result(std::min(m_rows, m_cols));
+
+            for (std::size_t i = 0; i < result.size(); ++i)
+                result[i] = (*this)(i, i);
+
+            return result;
+        }
+
+        /**
+         * @brief
+         * Transposes the matrix, which converts between CSR and CSC
+         * @return SparseMatrix The transposed matrix
+         */
+        SparseMatrix transpose() const
+        {
+            std::vector<std::size_t> offsets(m_cols + 1);
+
+            for (std::size_t col : m_columns)
+                ++offsets[col + 1];
+
+            for (std::size_t j = 0; j < m_cols; ++j)
+                offsets[j + 1] += offsets[j];
+
+            std::vector<std::size_t> columns(non_zeros());
+            std::vector<T> values(non_zeros());
+            std::vector<std::size_t> next(offsets.begin(), offsets.end() - 1);
+
+            // Walking the rows in order keeps every new row sorted
+            for (std::size_t i = 0; i < m_rows; ++i)
+                for (std::size_t k = m_row_offsets[i]; k < m_row_offsets[i + 1]; ++k)
+                {
+                    std::size_t position = next[m_columns[k]]++;
+                    columns[position] = i;
+                    values[position] = m_values[k];
+                }
+
+            return SparseMatrix(m_cols, m_rows, std::move(offsets), std::move(columns),
+                                std::move(values));
+        }
+
+        /**
+         * @brief
+         * Expands the matrix into a dense one
+         * @tparam Layout Storage order of the dense matrix
+         * @return Matrix<T, Layout> The dense matrix
+         */
+        template <MatrixLayout Layout = MatrixLayout::RowMajor>
+        Matrix<T, Layout> to_dense() const
+        {
+            Matrix<T, Layout> result(m_rows, m_cols);
+
+            for (std::size_t i = 0; i < m_rows; ++i)
+                for (std::size_t k = m_row_offsets[i]; k < m_row_offsets[i + 1]; ++k)
+                    result.data()[result.index_of(i, m_columns[k])] = m_values[k];
+
+            return result;
+        }
+
+        // Static Methods
+        /**
+         * @brief
+         * Builds a matrix from entries in any order. Entries at the same
+         * position are added together, as when assembling finite elements.
+         * @param rows Number of rows
+         * @param cols Number of columns
+         * @param entries The entries
+         * @return SparseMatrix The matrix
+         * @throws std::out_of_range If an entry is out of bounds
+         */
+        static SparseMatrix from_entries(std::size_t rows, std::size_t cols,
+                                         std::vector<SparseEntry<T>> entries)
+        {
+            for (const auto &entry : entries)
+                if (entry.row >= rows || entry.col >= cols)
+                    throw std::out_of_range("Matrix subscript out of range");
+
+            std::sort(entries.begin(), entries.end(),
+                      [](const SparseEntry<T> &a, const SparseEntry<T> &b)
+                      { return a.row != b.row ? a.row < b.row : a.col < b.col; });
+
+            SparseMatrix result(rows, cols);
+
+            for (std::size_t k = 0; k < entries.size(); ++k)
+            {
+                const auto &entry = entries[k];
+
+                if (k > 0 && entries[k - 1].row == entry.row && entries[k - 1].col == entry.col)
+                {
+                    result.m_values.back() += entry.value;
+                    continue;
+                }
+
+                result.m_columns.push_back(entry.col);
+                result.m_values.push_back(entry.value);
+                ++result.m_row_offsets[entry.row + 1];
+            }
+
+            for (std::size_t i = 0; i < rows; ++i)
+                result.m_row_offsets[i + 1] += result.m_row_offsets[i];
+
+            return result;
+        }
+
+        /**
+         * @brief
+         * Builds a matrix from the elements of a dense one
+         * @tparam Layout Storage order of the dense matrix
+         * @param matrix The dense matrix
+         * @param tolerance Elements of at most this magnitude are dropped
+         * @return SparseMatrix The matrix
+         */
+        template <MatrixLayout Layout>
+        static SparseMatrix from_dense(const Matrix<T, Layout> &matrix, T tolerance = T())
+        {
+            SparseMatrix result(matrix.rows(), matrix.cols());
+
+            for (std::size_t i = 0; i < matrix.rows(); ++i)
+            {
+                for (std::size_t j = 0; j < matrix.cols(); ++j)
+                {
+                    const T &value = matrix.data()[matrix.index_of(i, j)];
+
+                    if (std::abs(value) > tolerance)
+                    {
+                        result.m_columns.push_back(j);
+                        result.m_values.push_back(value);
+                    }
+                }
+
+                result.m_row_offsets[i + 1] = result.m_columns.size();
+            }
+
+            return result;
+        }
+
+        /**
+         * @brief
+         * Creates the identity matrix
+         * @param size Rows and columns of the matrix
+         * @return SparseMatrix The identity matrix
+         */
+        static SparseMatrix identity(std::size_t size)
+        {
+            SparseMatrix result(size, size);
+
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                result.m_columns.push_back(i);
+                result.m_values.push_back(T(1));
+                result.m_row_offsets[i + 1] = i + 1;
+            }
+
+            return result;
+        }
+
+    private:
+        std::size_t m_rows = 0;
+        std::size_t m_cols = 0;
+        std::vector<std::size_t> m_row_offsets;
+        std::vector<std::size_t> m_columns;
+        std::vector<T> m_values;
+    };
+
+    /**
+     * @class BlockSparseMatrix
+     * @brief Sparse matrix in block compressed sparse row (BSR) form: dense
+     *        Block x Block tiles stored like the entries of a CSR matrix.
+     *        Systems with several unknowns per node, such as 3D particles,
+     *        fill whole tiles, and the product runs over each tile with a
+     *        fixed-size loop and one column index per tile.
+     * @tparam T Type of the elements
+     * @tparam Block Rows and columns of a tile
+     */
+    template <class T, std::size_t Block>
+    class BlockSparseMatrix
+    {
+    public:
+        static_assert(Block > 0, "Blocks need at least one element");
+
+        // Type aliases
+        using value_type = T;
+
+        static constexpr std::size_t block_size = Block;
+
+        // Constructors
+        BlockSparseMatrix() : m_row_offsets(1) {}
+
+        /**
+         * @brief
+         * Converts a CSR matrix, storing every tile that holds a non-zero
+         * @param matrix The CSR matrix
+         * @throws std::invalid_argument If its size is not a multiple of
+         * the block size
+         */
+        explicit BlockSparseMatrix(const SparseMatrix<T> &matrix)
+            : m_block_rows(matrix.rows() / Block), m_block_cols(matrix.cols() / Block),
+              m_row_offsets(m_block_rows + 1)
+        {
+            if (matrix.rows() % Block != 0 || matrix.cols() % Block != 0)
+                throw std::invalid_argument("Matrix size must be a multiple of the block size");
+
+            auto offsets = matrix.row_offsets();
+            auto columns = matrix.columns();
+            auto values = matrix.values();
+            std::vector<std::size_t> slot(m_block_cols, NONE);
+
+            for (std::size_t bi = 0; bi < m_block_rows; ++bi)
+            {
+                std::size_t first = m_columns.size();
+
+                // Tile columns of the block row, in order
+                for (std::size_t r = 0; r < Block; ++r)
+                {
+                    std::size_t i = bi * Block + r;
+
+                    for (std::size_t k = offsets[i]; k < offsets[i + 1]; ++k)
+                        if (slot[columns[k] / Block] == NONE)
+                        {
+                            slot[columns[k] / Block] = 0;
+                            m_columns.push_back(columns[k] / Block);
+                        }
+                }
+
+                std::sort(m_columns.begin() + first, m_columns.end());
+                m_values.resize(m_columns.size() * Block * Block);
+
+                for (std::size_t k = first; k < m_columns.size(); ++k)
+                    slot[m_columns[k]] = k;
+
+                for (std::size_t r = 0; r < Block; ++r)
+                {
+                    std::size_t i = bi * Block + r;
+
+                    for (std::size_t k = offsets[i]; k < offsets[i + 1]; ++k)
+                    {
+                        std::size_t tile = slot[columns[k] / Block];
+                        m_values[tile * Block * Block + r * Block + columns[k] % Block] = values[k];
+                    }
+                }
+
+                for (std::size_t k = first; k < m_columns.size(); ++k)
+                    slot[m_columns[k]] = NONE;
+
+                m_row_offsets[bi + 1] = m_columns.size();
+            }
+        }
+
+        // Operators
+        /**
+         * @brief
+         * Multiplies the matrix by a vector
+         * @param vector The vector to multiply by
+         * @return Vector<T> The product
+         * @throws std::invalid_argument If the sizes differ
+         */
+        Vector<T> operator*(const Vector<T> &vector) const
+        {
+            if (vector.size() != cols())
+                throw std::invalid_argument("Vector size does not match the matrix");
+
+            std::vector<T> x(cols());
+            std::vector<T> y(rows());
+
+            for (std::size_t i = 0; i < x.size(); ++i)
+                x[i] = vector[i];
+
+            multiply(x, y);
+
+            Vector<T> result(rows());
+
+            for (std::size_t i = 0; i < y.size(); ++i)
+                result[i] = y[i];
+
+            return result;
+        }
+
+        // Access Methods
+        /**
+         * @brief
+         * Gets the rows of the matrix
+         * @return std::size_t The rows of the matrix
+         */
+        std::size_t rows() const
+        {
+            return m_block_rows * Block;
+        }
+
+        /**
+         * @brief
+         * Gets the columns of the matrix
+         * @return std::size_t The columns of the matrix
+         */
+        std::size_t cols() const
+        {
+            return m_block_cols * Block;
+        }
+
+        /**
+         * @brief
+         * Gets the number of stored tiles
+         * @return std::size_t The number of stored tiles
+         */
+        std::size_t blocks() const
+        {
+            return m_columns.size();
+        }
+
+        // Methods
+        /**
+         * @brief
+         * Computes y = A x, splitting the block rows across the thread pool
+         * @param x The vector to multiply, of cols() elements
+         * @param y The product, of rows() elements
+         * @param thread_pool Thread pool to run on, or nullptr
+         * @throws std::invalid_argument If the sizes differ
+         */
+        void multiply(std::span<const T> x, std::span<T> y, ThreadPool *thread_pool = nullptr) const
+        {
+            if (x.size() != cols() || y.size() != rows())
+                throw std::invalid_argument("Vector size does not match the matrix");
+
+            const std::size_t *offsets = m_row_offsets.data();
+            const std::size_t *columns = m_columns.data();
+            const T *values = m_values.data();
+
+            Detail::for_each_row_band(m_row_offsets, thread_pool,
+                                      [=](std::size_t begin, std::size_t end)
+                                      {
+                                          for (std::size_t bi = begin; bi < end; ++bi)
+                                          {
+                                              T sum[Block] = {};
+
+                                              for (std::size_t k = offsets[bi]; k < offsets[bi + 1]; ++k)
+                                              {
+                                                  const T *tile = values + k * Block * Block;
+                                                  const T *input = x.data() + columns[k] * Block;
+
+                                                  for (std::size_t r = 0; r < Block; ++r)
+                                                      for (std::size_t c = 0; c < Block; ++c)
+                                                          sum[r] += tile[r * Block + c] * input[c];
+                                              }
+
+                                              std::copy(sum, sum + Block, y.data() + bi * Block);
+                                          }
+                                      });
+        }
+
+        /**
+         * @brief
+         * Gets the main diagonal, with zeros where nothing is stored
+         * @return std::vector<T> The diagonal
+         */
+        std::vector<T> diagonal() const
+        {
+            std::vector<T> result(std::min(rows(), cols()));
+
+            for (std::size_t bi = 0; bi < std::min(m_block_rows, m_block_cols); ++bi)
+            {
+                auto first = m_columns.begin() + m_row_offsets[bi];
+                auto last = m_columns.begin() + m_row_offsets[bi + 1];
+                auto found = std::lower_bound(first, last, bi);
+
+                if (found == last || *found != bi)
+                    continue;
+
+                const T *tile = m_values.data() + (found - m_columns.begin()) * Block * Block;
+
+                for (std::size_t r = 0; r < Block; ++r)
+                    result[bi * Block + r] = tile[r * Block + r];
+            }
+
+            return result;
+        }
+
+        /**
+         * @brief
+         * Expands the matrix into a dense one
+         * @tparam Layout Storage order of the dense matrix
+         * @return Matrix<T, Layout> The dense matrix
+         */
+        template <MatrixLayout Layout = MatrixLayout::RowMajor>
+        Matrix<T, Layout> to_dense() const
+        {
+            Matrix<T, Layout> result(rows(), cols());
+
+            for (std::size_t bi = 0; bi < m_block_rows; ++bi)
+                for (std::size_t k = m_row_offsets[bi]; k < m_row_offsets[bi + 1]; ++k)
+                    for (std::size_t r = 0; r < Block; ++r)
+                        for (std::size_t c = 0; c < Block; ++c)
+                            result.data()[result.index_of(bi * Block + r, m_columns[k] * Block + c)] =
+                                m_values[k * Block * Block + r * Block + c];
+
+            return result;
+        }
+
+        // Static Methods
+        /**
+         * @brief
+         * Builds a matrix from the elements of a dense one
+         * @tparam Layout Storage order of the dense matrix
+         * @param matrix The dense matrix
+         * @param tolerance Elements of at most this magnitude are dropped
+         * @return BlockSparseMatrix The matrix
+         * @throws std::invalid_argument If its size is not a multiple of
+         * the block size
+         */
+        template <MatrixLayout Layout>
+        static BlockSparseMatrix from_dense(const Matrix<T, Layout> &matrix, T tolerance = T())
+        {
+            return BlockSparseMatrix(SparseMatrix<T>::from_dense(matrix, tolerance));
+        }
+
+    private:
+        static constexpr std::size_t NONE = static_cast<std::size_t>(-1);
+
+        std::size_t m_block_rows = 0;
+        std::size_t m_block_cols = 0;
+        std::vector<std::size_t> m_row_offsets;
+        std::vector<std::size_t> m_columns;
+        std::vector<T> m_values;
+    };
+
+    /**
+     * @brief
+     * Preconditioner applied by the conjugate gradient solver
+     */
+    enum class Preconditioner
+    {
+        None,
+        Jacobi,
+        SymmetricGaussSeidel
+    };
+
+    /**
+     * @struct SolverOptions
+     * @brief Stopping criteria and settings of the iterative solvers
+     * @tparam T Type of the elements
+     */
+    template <class T>
+    struct SolverOptions
+    {
+        std::size_t max_iterations = 1000;
+        T tolerance = T(1e-6);
+        Preconditioner preconditioner = Preconditioner::Jacobi;
+        ThreadPool *thread_pool = nullptr;
+    };
+
+    /**
+     * @struct SolverResult
+     * @brief Outcome of an iterative solve
+     * @tparam T Type of the elements
+     */
+    template <class T>
+    struct SolverResult
+    {
+        std::size_t iterations = 0;
+        T residual = T();
+        bool converged = false;
+    };
+
+    namespace Detail
+    {
+        /**
+         * @brief
+         * Calculates the dot product of two arrays of the same size
+         */
+        template <class T>
+        T dot(const std::vector<T> &a, const std::vector<T> &b)
+        {
+            T result = T();
+
+            for (std::size_t i = 0; i < a.size(); ++i)
+                result += a[i] * b[i];
+
+            return result;
+        }
+
+        /**
+         * @brief
+         * Copies a vector into contiguous storage for the kernels
+         */
+        template <class T>
+        std::vector<T> to_std_vector(const Vector<T> &vector)
+        {
+            std::vector<T> result(vector.size());
+
+            for (std::size_t i = 0; i < result.size(); ++i)
+                result[i] = vector[i];
+
+            return result;
+        }
+
+        /**
+         * @brief
+         * One forward sweep of Gauss-Seidel for A x = b, or a backward one
+         * @param a The matrix
+         * @param b The right-hand side
+         * @param x The current solution, updated in place
+         * @param backward Whether to visit the rows in reverse
+         */
+        template <class T>
+        void gauss_seidel_sweep(const SparseMatrix<T> &a, const std::vector<T> &b,
+                                std::vector<T> &x, bool backward)
+        {
+            auto offsets = a.row_offsets();
+            auto columns = a.columns();
+            auto values = a.values();
+            std::size_t n = a.rows();
+
+            for (std::size_t step = 0; step < n; ++step)
+            {
+                std::size_t i = backward ? n - 1 - step : step;
+                T sum = b[i];
+                T diagonal = T();
+
+                for (std::size_t k = offsets[i]; k < offsets[i + 1]; ++k)
+                {
+                    if (columns[k] == i)
+                        diagonal = values[k];
+                    else
+                        sum -= values[k] * x[columns[k]];
+                }
+
+                x[i] = sum / diagonal;
+            }
+        }
+
+        /**
+         * @brief
+         * Checks the system and returns its diagonal
+         * @throws std::invalid_argument If the matrix is not square, the
+         * sizes differ or the diagonal has a zero
+         */
+        template <class M, class T>
+        std::vector<T> check_system(const M &a, const Vector<T> &b, const Vector<T> &x)
+        {
+            if (a.rows() != a.cols())
+                throw std::invalid_argument("Iterative solvers need a square matrix");
+
+            if (b.size() != a.rows() || x.size() != a.rows())
+                throw std::invalid_argument("Vector size does not match the matrix");
+
+            std::vector<T> diagonal = a.diagonal();
+
+            if (std::find(diagonal.begin(), diagonal.end(), T()) != diagonal.end())
+                throw std::invalid_argument("Matrix has a zero on its diagonal");
+
+            return diagonal;
+        }
+    }
+
+    /**
+     * @brief
+     * Solves A x = b for a symmetric positive definite A with the
+     * preconditioned conjugate gradient method. Stops when |b - A x| is at
+     * most tolerance |b|.
+     * @tparam M SparseMatrix<T> or BlockSparseMatrix<T, Block>
+     * @tparam T Type of the elements
+     * @param a The matrix
+     * @param b The right-hand side
+     * @param x The initial guess, replaced by the solution
+     * @param options Stopping criteria, preconditioner and thread pool. The
+     * symmetric Gauss-Seidel preconditioner needs a SparseMatrix.
+     * @return SolverResult<T> Iterations run and final relative residual
+     * @throws std::invalid_argument If the matrix is not square, the sizes
+     * differ, the diagonal has a zero or the preconditioner is unsupported
+     */
+    template <class M, class T>
+    SolverResult<T> conjugate_gradient(const M &a, const Vector<T> &b, Vector<T> &x,
+                                       const SolverOptions<T> &options = {})
+    {
+        std::vector<T> diagonal = Detail::check_system(a, b, x);
+        constexpr bool is_csr = std::is_same_v<M, SparseMatrix<T>>;
+
+        if (!is_csr && options.preconditioner == Preconditioner::SymmetricGaussSeidel)
+            throw std::invalid_argument("Symmetric Gauss-Seidel needs a SparseMatrix");
+
+        std::size_t n = a.rows();
+        std::vector<T> rhs = Detail::to_std_vector(b);
+        std::vector<T> solution = Detail::to_std_vector(x);
+        std::vector<T> residual(n);
+        std::vector<T> preconditioned(n);
+        std::vector<T> direction(n);
+        std::vector<T> product(n);
+
+        auto precondition = [&]()
+        {
+            switch (options.preconditioner)
+            {
+            case Preconditioner::None:
+                preconditioned = residual;
+                break;
+
+            case Preconditioner::Jacobi:
+                for (std::size_t i = 0; i < n; ++i)
+                    preconditioned[i] = residual[i] / diagonal[i];
+                break;
+
+            case Preconditioner::SymmetricGaussSeidel:
+                // One forward and one backward sweep from zero apply
+                // (D + U)^-1 D (D + L)^-1, which is symmetric
+                if constexpr (is_csr)
+                {
+                    std::fill(preconditioned.begin(), preconditioned.end(), T());
+                    Detail::gauss_seidel_sweep(a, residual, preconditioned, false);
+                    Detail::gauss_seidel_sweep(a, residual, preconditioned, true);
+                }
+                break;
+            }
+        };
+
+        a.multiply(solution, product, options.thread_pool);
+
+        for (std::size_t i = 0; i < n; ++i)
+            residual[i] = rhs[i] - product[i];
+
+        T rhs_norm = std::sqrt(Detail::dot(rhs, rhs));
+        T threshold = options.tolerance * (rhs_norm > T() ? rhs_norm : T(1));
+        SolverResult<T> result;
+        result.residual = std::sqrt(Detail::dot(residual, residual));
+
+        precondition();
+        direction = preconditioned;
+        T rho = Detail::dot(residual, preconditioned);
+
+        while (result.residual > threshold && result.iterations < options.max_iterations)
+        {
+            a.multiply(direction, product, options.thread_pool);
+            T alpha = rho / Detail::dot(direction, product);
+
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                solution[i] += alpha * direction[i];
+                residual[i] -= alpha * product[i];
+            }
+
+            ++result.iterations;
+            result.residual = std::sqrt(Detail::dot(residual, residual));
+
+            precondition();
+            T next_rho = Detail::dot(residual, preconditioned);
+            T beta = next_rho / rho;
+            rho = next_rho;
+
+            for (std::size_t i = 0; i < n; ++i)
+                direction[i] = preconditioned[i] + beta * direction[i];
+        }
+
+        for (std::size_t i = 0; i < n; ++i)
+            x[i] = solution[i];
+
+        result.converged = result.residual <= threshold;
+        result.residual /= rhs_norm > T() ? rhs_norm : T(1);
+
+        return result;
+    }
+
+    /**
+     * @brief
+     * Solves A x = b with symmetric Gauss-Seidel iterations: a forward and
+     * a backward sweep each. Converges for symmetric positive definite and
+     * for diagonally dominant matrices. Stops when |b - A x| is at most
+     * tolerance |b|. The preconditioner option is ignored.
+     * @tparam T Type of the elements
+     * @param a The matrix
+     * @param b The right-hand side
+     * @param x The initial guess, replaced by the solution
+     * @param options Stopping criteria and thread pool for the residuals
+     * @return SolverResult<T> Iterations run and final relative residual
+     * @throws std::invalid_argument If the matrix is not square, the sizes
+     * differ or the diagonal has a zero
+     */
+    template <class T>
+    SolverResult<T> gauss_seidel(const SparseMatrix<T> &a, const Vector<T> &b, Vector<T> &x,
+                                 const SolverOptions<T> &options = {})
+    {
+        Detail::check_system(a, b, x);
+
+        std::size_t n = a.rows();
+        std::vector<T> rhs = Detail::to_std_vector(b);
+        std::vector<T> solution = Detail::to_std_vector(x);
+        std::vector<T> product(n);
+
+        T rhs_norm = std::sqrt(Detail::dot(rhs, rhs));
+        T scale = rhs_norm > T() ? rhs_norm : T(1);
+        SolverResult<T> result;
+
+        auto update_residual = [&]()
+        {
+            a.multiply(solution, product, options.thread_pool);
+            T sum = T();
+
+            for (std::size_t i = 0; i < n; ++i)
+                sum += (rhs[i] - product[i]) * (rhs[i] - product[i]);
+
+            result.residual = std::sqrt(sum) / scale;
+        };
+
+        update_residual();
+
+        while (result.residual > options.tolerance && result.iterations < options.max_iterations)
+        {
+            Detail::gauss_seidel_sweep(a, rhs, solution, false);
+            Detail::gauss_seidel_sweep(a, rhs, solution, true);
+            ++result.iterations;
+            update_residual();
+        }
+
+        for (std::size_t i = 0; i < n; ++i)
+            x[i] = solution[i];
+
+        result.converged = result.residual <= options.tolerance;
+        return result;
+    }
+}
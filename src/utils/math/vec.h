@@ -0,0 +1,496 @@
+/**
+ * @file vec.h
+ * @author Carlos Salguero
+ * @brief Fixed-size vector with inline storage and constexpr operations
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#pragma once
+
+// C++ Standard Library
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+// Project files
+#include "math.h"
+#include "vector.h"
+
+namespace Math
+{
+    /**
+     * @class Vec
+     * @brief Vector of N elements stored inline. Unlike Vector it never
+     *        allocates, and everything except angle() can be evaluated at
+     *        compile time.
+     * @tparam N Number of elements
+     * @tparam T Type of the elements
+     */
+    template <std::size_t N, class T>
+    class Vec
+    {
+        static_assert(N > 0, "Vec needs at least one element");
+
+    public:
+        // Type aliases
+        using value_type = T;
+
+        // Constructors
+        constexpr Vec() : m_elements{} {}
+
+        /**
+         * @brief
+         * Constructs a vector with every element set to the same value
+         * @param value The value of the elements
+         */
+        explicit constexpr Vec(const T &value) : m_elements{}
+        {
+            for (std::size_t i = 0; i < N; ++i)
+                m_elements[i] = value;
+        }
+
+        /**
+         * @brief
+         * Constructs a vector from one value per element
+         * @param values The values of the elements
+         */
+        template <class... Args>
+            requires(sizeof...(Args) == N && N > 1 &&
+                     (std::is_convertible_v<Args, T> && ...))
+        constexpr Vec(const Args &...values)
+            : m_elements{static_cast<T>(values)...} {}
+
+        // Operators
+        /**
+         * @brief
+         * Accesses the element at the given index
+         * @param index The index of the element
+         * @return T& The element at the given index
+         */
+        constexpr T &operator[](std::size_t index)
+        {
+            return m_elements[index];
+        }
+
+        /**
+         * @brief
+         * Accesses the element at the given index
+         * @param index The index of the element
+         * @return const T& The element at the given index
+         */
+        constexpr const T &operator[](std::size_t index) const
+        {
+            return m_elements[index];
+        }
+
+        /**
+         * @brief
+         * Compares two vectors element by element
+         * @param other The vector to compare with
+         * @return true If every element is equal
+         * @return false Otherwise
+         */
+        constexpr bool operator==(const Vec &other) const
+        {
+            return m_elements == other.m_elements;
+        }
+
+        /**
+         * @brief
+         * Negates every element
+         * @return Vec The negated vector
+         */
+        constexpr Vec operator-() const
+        {
+            Vec result;
+
+            for (std::size_t i = 0; i < N; ++i)
+                result[i] = -m_elements[i];
+
+            return result;
+        }
+
+        /**
+         * @brief
+         * Adds two vectors element by element
+         * @param other The vector to add
+         * @return Vec The sum of both vectors
+         */
+        constexpr Vec operator+(const Vec &other) const
+        {
+            Vec result = *this;
+            return result += other;
+        }
+
+        /**
+         * @brief
+         * Subtracts two vectors element by element
+         * @param other The vector to subtract
+         * @return Vec The difference of both vectors
+         */
+        constexpr Vec operator-(const Vec &other) const
+        {
+            Vec result = *this;
+            return result -= other;
+        }
+
+        /**
+         * @brief
+         * Multiplies two vectors element by element
+         * @param other The vector to multiply by
+         * @return Vec The product of both vectors
+         */
+        constexpr Vec operator*(const Vec &other) const
+        {
+            Vec result = *this;
+            return result *= other;
+        }
+
+        /**
+         * @brief
+         * Divides two vectors element by element
+         * @param other The vector to divide by
+         * @return Vec The quotient of both vectors
+         */
+        constexpr Vec operator/(const Vec &other) const
+        {
+            Vec result = *this;
+            return result /= other;
+        }
+
+        /**
+         * @brief
+         * Multiplies every element by a scalar
+         * @param scalar The scalar to multiply by
+         * @return Vec The scaled vector
+         */
+        constexpr Vec operator*(const T &scalar) const
+        {
+            Vec result = *this;
+            return result *= scalar;
+        }
+
+        /**
+         * @brief
+         * Divides every element by a scalar
+         * @param scalar The scalar to divide by
+         * @return Vec The scaled vector
+         */
+        constexpr Vec operator/(const T &scalar) const
+        {
+            Vec result = *this;
+            return result /= scalar;
+        }
+
+        /**
+         * @brief
+         * Adds another vector to this vector
+         * @param other The vector to add
+         * @return Vec& This vector
+         */
+        constexpr Vec &operator+=(const Vec &other)
+        {
+            for (std::size_t i = 0; i < N; ++i)
+                m_elements[i] += other.m_elements[i];
+
+            return *this;
+        }
+
+        /**
+         * @brief
+         * Subtracts another vector from this vector
+         * @param other The vector to subtract
+         * @return Vec& This vector
+         */
+        constexpr Vec &operator-=(const Vec &other)
+        {
+            for (std::size_t i = 0; i < N; ++i)
+                m_elements[i] -= other.m_elements[i];
+
+            return *this;
+        }
+
+        /**
+         * @brief
+         * Multiplies this vector by another one element by element
+         * @param other The vector to multiply by
+         * @return Vec& This vector
+         */
+        constexpr Vec &operator*=(const Vec &other)
+        {
+            for (std::size_t i = 0; i < N; ++i)
+                m_elements[i] *= other.m_elements[i];
+
+            return *this;
+        }
+
+        /**
+         * @brief
+         * Divides this vector by another one element by element
+         * @param other The vector to divide by
+         * @return Vec& This vector
+         */
+        constexpr Vec &operator/=(const Vec &other)
+        {
+            for (std::size_t i = 0; i < N; ++i)
+                m_elements[i] /= other.m_elements[i];
+
+            return *this;
+        }
+
+        /**
+         * @brief
+         * Multiplies every element by a scalar
+         * @param scalar The scalar to multiply by
+         * @return Vec& This vector
+         */
+        constexpr Vec &operator*=(const T &scalar)
+        {
+            for (auto &element : m_elements)
+                element *= scalar;
+
+            return *this;
+        }
+
+        /**
+         * @brief
+         * Divides every element by a scalar
+         * @param scalar The scalar to divide by
+         * @return Vec& This vector
+         */
+        constexpr Vec &operator/=(const T &scalar)
+        {
+            for (auto &element : m_elements)
+                element /= scalar;
+
+            return *this;
+        }
+
+        // Access Methods
+        constexpr T &x() requires(N >= 1) { return m_elements[0]; }
+        constexpr T &y() requires(N >= 2) { return m_elements[1]; }
+        constexpr T &z() requires(N >= 3) { return m_elements[2]; }
+        constexpr T &w() requires(N >= 4) { return m_elements[3]; }
+        constexpr const T &x() const requires(N >= 1) { return m_elements[0]; }
+        constexpr const T &y() const requires(N >= 2) { return m_elements[1]; }
+        constexpr const T &z() const requires(N >= 3) { return m_elements[2]; }
+        constexpr const T &w() const requires(N >= 4) { return m_elements[3]; }
+
+        /**
+         * @brief
+         * Gets the storage of the vector
+         * @return T* The first element
+         */
+        constexpr T *data()
+        {
+            return m_elements.data();
+        }
+
+        /**
+         * @brief
+         * Gets the storage of the vector
+         * @return const T* The first element
+         */
+        constexpr const T *data() const
+        {
+            return m_elements.data();
+        }
+
+        // Methods
+        /**
+         * @brief
+         * Gets the number of elements of the vector
+         * @return std::size_t The number of elements
+         */
+        static constexpr std::size_t size()
+        {
+            return N;
+        }
+
+        /**
+         * @brief
+         * Calculates the dot product of two vectors
+         * @param other The other vector
+         * @return T The dot product
+         */
+        constexpr T dot(const Vec &other) const
+        {
+            T result = T();
+
+            for (std::size_t i = 0; i < N; ++i)
+                result += m_elements[i] * other.m_elements[i];
+
+            return result;
+        }
+
+        /**
+         * @brief
+         * Calculates the cross product of two 3D vectors
+         * @param other The other vector
+         * @return Vec The cross product
+         */
+        constexpr Vec cross(const Vec &other) const
+            requires(N == 3)
+        {
+            return Vec(m_elements[1] * other.m_elements[2] - m_elements[2] * other.m_elements[1],
+                       m_elements[2] * other.m_elements[0] - m_elements[0] * other.m_elements[2],
+                       m_elements[0] * other.m_elements[1] - m_elements[1] * other.m_elements[0]);
+        }
+
+        /**
+         * @brief
+         * Calculates the squared magnitude of the vector
+         * @return T The squared magnitude
+         */
+        constexpr T squared_magnitude() const
+        {
+            return dot(*this);
+        }
+
+        /**
+         * @brief
+         * Calculates the magnitude of the vector
+         * @return T The magnitude
+         */
+        constexpr T magnitude() const
+        {
+            return square_root(squared_magnitude());
+        }
+
+        /**
+         * @brief
+         * Calculates the vector with the same direction and a magnitude of
+         * one. The zero vector is returned unchanged.
+         * @return Vec The normalized vector
+         */
+        constexpr Vec normalize() const
+        {
+            T length = magnitude();
+
+            if (length == T())
+                return *this;
+
+            return *this / length;
+        }
+
+        /**
+         * @brief
+         * Calculates the unit vector of the vector, the same as normalize()
+         * @return Vec The unit vector
+         */
+        constexpr Vec unit_vector() const
+        {
+            return normalize();
+        }
+
+        /**
+         * @brief
+         * Calculates the angle between two vectors
+         * @param other The other vector
+         * @return T The angle in radians
+         */
+        T angle(const Vec &other) const
+        {
+            return arc_cosine(dot(other) / (magnitude() * other.magnitude()));
+        }
+
+        /**
+         * @brief
+         * Interpolates linearly between two vectors
+         * @param other The vector at t = 1
+         * @param t The interpolation factor
+         * @return Vec The interpolated vector
+         */
+        constexpr Vec lerp(const Vec &other, const T &t) const
+        {
+            Vec result;
+
+            for (std::size_t i = 0; i < N; ++i)
+                result[i] = m_elements[i] + (other.m_elements[i] - m_elements[i]) * t;
+
+            return result;
+        }
+
+        /**
+         * @brief
+         * Interpolates between two vectors with the cubic Hermite basis and
+         * zero end tangents
+         * @param other The vector at t = 1
+         * @param t The interpolation factor
+         * @return Vec The interpolated vector
+         */
+        constexpr Vec cubic_interpolation(const Vec &other, const T &t) const
+        {
+            T t2 = t * t;
+            T t3 = t2 * t;
+
+            return *this * (2 * t3 - 3 * t2 + 1) +
+                   other * (3 * t2 - 2 * t3) +
+                   (*this - other) * (t3 - 2 * t2 + t);
+        }
+
+        /**
+         * @brief
+         * Copies the vector into a dynamic vector
+         * @return Vector<T> The dynamic vector
+         */
+        Vector<T> to_vector() const
+        {
+            Vector<T> result(N);
+
+            for (std::size_t i = 0; i < N; ++i)
+                result[i] = m_elements[i];
+
+            return result;
+        }
+
+        // Static Methods
+        /**
+         * @brief
+         * Copies a dynamic vector into a fixed-size one
+         * @param vector The dynamic vector
+         * @return Vec The fixed-size vector
+         * @throws std::invalid_argument If the vector does not have N elements
+         */
+        static Vec from_vector(const Vector<T> &vector)
+        {
+            if (vector.size() != N)
+                throw std::invalid_argument("Vector size does not match");
+
+            Vec result;
+
+            for (std::size_t i = 0; i < N; ++i)
+                result[i] = vector[i];
+
+            return result;
+        }
+
+    private:
+        std::array<T, N> m_elements;
+    };
+
+    /**
+     * @brief
+     * Multiplies every element of a vector by a scalar
+     * @tparam N Number of elements
+     * @tparam T Type of the elements
+     * @param scalar The scalar to multiply by
+     * @param vector The vector
+     * @return Vec<N, T> The scaled vector
+     */
+    template <std::size_t N, class T>
+    constexpr Vec<N, T> operator*(const T &scalar, const Vec<N, T> &vector)
+    {
+        return vector * scalar;
+    }
+
+    // Type aliases
+    using Vec2 = Vec<2, float>;
+    using Vec3 = Vec<3, float>;
+    using Vec4 = Vec<4, float>;
+}
@@ -17,19 +17,26 @@
 #include <cassert>
 
 // Project files
+#include "expression.h"
 #include "math.h"
 
 // Class
 /**
  * @class Vector
- * @brief Custom vector class for the game engine
+ * @brief Custom vector class for the game engine. Vec<N, T> is the fixed-size
+ *        counterpart, with sizes checked at compile time.
  */
 namespace Math
 {
     template <class T>
-    class Vector
+    class Vector : public VectorExpression<Vector<T>>
     {
     public:
+        // Type aliases
+        using value_type = T;
+        using result_type = Vector<T>;
+        static constexpr bool is_container = true;
+
         // Constructors
         Vector() = default;
         Vector(std::initializer_list<T> init) : m_elements(init) {}
@@ -37,6 +44,20 @@ namespace Math
         Vector(const Vector<T> &other) : m_elements(other.m_elements) {}
         Vector(Vector<T> &&other) : m_elements(std::move(other.m_elements)) {}
 
+        /**
+         * @brief
+         * Evaluates a vector expression into a new vector, in one loop
+         * @tparam E Type of the expression
+         * @param expression The expression to evaluate
+         */
+        template <class E>
+        Vector(const VectorExpression<E> &expression)
+            : m_elements(expression.size())
+        {
+            for (std::size_t i = 0; i < m_elements.size(); i++)
+                m_elements[i] = expression[i];
+        }
+
         // Operators
         /**
          * @brief
@@ -90,6 +111,37 @@ namespace Math
             return *this;
         }
 
+        /**
+         * @brief
+         * Evaluates a vector expression into this vector, in one loop. The
+         * expression may use this vector, since every element only depends
+         * on the elements at the same index.
+         * @tparam E Type of the expression
+         * @param expression The expression to evaluate
+         * @return Vector<T>& This vector
+         */
+        template <class E>
+        Vector<T> &operator=(const VectorExpression<E> &expression)
+        {
+            std::size_t count = expression.size();
+
+            if (m_elements.size() != count)
+            {
+                std::vector<T> elements(count);
+
+                for (std::size_t i = 0; i < count; i++)
+                    elements[i] = expression[i];
+
+                m_elements = std::move(elements);
+                return *this;
+            }
+
+            for (std::size_t i = 0; i < count; i++)
+                m_elements[i] = expression[i];
+
+            return *this;
+        }
+
         /**
          * @brief
          * Overloads the comparison operator to compare two vectors
@@ -117,100 +169,22 @@ namespace Math
             return m_elements != other.m_elements;
         }
 
-        /**
-         * @brief
-         * Overloads the + operator to add two vectors
-         * @param other The vector to add to this vector
-         * @return Vector<T> The sum of the two vectors
-         */
-        Vector<T> operator+(const Vector<T> &other) const
-        {
-            assert(m_elements.size() == other.m_elements.size() &&
-                   "Vectors must be the same size to add them");
-
-            Vector<T> result(size());
-
-            for (std::size_t i = 0; i < m_elements.size(); i++)
-                result[i] = m_elements[i] + other[i];
-
-            return result;
-        }
-
-        /**
-         * @brief
-         * Overloads the - operator to subtract two vectors
-         * @param other The vector to subtract from this vector
-         * @return Vector<T> The difference of the two vectors
-         */
-        Vector<T> operator-(const Vector<T> &other) const
-        {
-            assert(m_elements.size() == other.m_elements.size() &&
-                   "Vectors must be the same size to subtract them");
-
-            Vector<T> result(size());
-
-            for (std::size_t i = 0; i < m_elements.size(); i++)
-                result[i] = m_elements[i] - other[i];
-
-            return result;
-        }
-
-        /**
-         * @brief
-         * Overloads the * operator to multiply two vectors
-         * @param other The vector to multiply with this vector
-         * @return Vector<T> The product of the two vectors
-         */
-        Vector<T> operator*(const Vector<T> &other) const
-        {
-            if (m_elements.size() != other.m_elements.size())
-                throw std::invalid_argument(
-                    "Vectors must be the same size to multiply them");
-
-            Vector<T> result(size());
-
-            for (std::size_t i = 0; i < m_elements.size(); i++)
-                result.m_elements.push_back(
-                    m_elements[i] * other.m_elements[i]);
-
-            return result;
-        }
-
-        /**
-         * @brief
-         * Overloads the / operator to divide two vectors
-         * @param other The vector to divide this vector by
-         * @return Vector<T> The quotient of the two vectors
-         */
-        Vector<T> operator/(const Vector<T> &other) const
-        {
-            if (m_elements.size() != other.m_elements.size())
-                throw std::invalid_argument(
-                    "Vectors must be the same size to divide them");
-
-            Vector<T> result;
-
-            for (std::size_t i = 0; i < m_elements.size(); i++)
-                result.m_elements.push_back(
-                    m_elements[i] / other.m_elements[i]);
-
-            return result;
-        }
-
         /**
          * @brief
          * Overloads the += operator to add two vectors
+         * @tparam E Type of the expression
          * @param other The vector to add to this vector
          * @return Vector<T>& The sum of the two vectors
          */
-        Vector<T> &operator+=(const Vector<T> &other)
+        template <class E>
+        Vector<T> &operator+=(const VectorExpression<E> &other)
         {
-            if (m_elements.size() != other.m_elements.size())
+            if (m_elements.size() != other.size())
                 throw std::invalid_argument(
                     "Vectors must be the same size to add them");
 
             for (std::size_t i = 0; i < m_elements.size(); i++)
-                m_elements[i] += other.m_elements[i];
+                m_elements[i] += other[i];
 
             return *this;
         }
@@ -218,17 +192,19 @@ namespace Math
         /**
          * @brief
          * Overloads the -= operator to subtract two vectors
+         * @tparam E Type of the expression
          * @param other The vector to subtract from this vector
          * @return Vector<T>& The difference of the two vectors
          */
-        Vector<T> &operator-=(const Vector<T> &other)
+        template <class E>
+        Vector<T> &operator-=(const VectorExpression<E> &other)
         {
-            if (m_elements.size() != other.m_elements.size())
+            if (m_elements.size() != other.size())
                 throw std::invalid_argument(
                     "Vectors must be the same size to subtract them");
 
             for (std::size_t i = 0; i < m_elements.size(); i++)
-                m_elements[i] -= other.m_elements[i];
+                m_elements[i] -= other[i];
 
             return *this;
         }
@@ -236,17 +212,19 @@ namespace Math
         /**
          * @brief
          * Overloads the *= operator to multiply two vectors
+         * @tparam E Type of the expression
          * @param other The vector to multiply with this vector
          * @return Vector<T>& The product of the two vectors
          */
-        Vector<T> &operator*=(const Vector<T> &other)
+        template <class E>
+        Vector<T> &operator*=(const VectorExpression<E> &other)
         {
-            if (m_elements.size() != other.m_elements.size())
+            if (m_elements.size() != other.size())
                 throw std::invalid_argument(
                     "Vectors must be the same size to multiply them");
 
             for (std::size_t i = 0; i < m_elements.size(); i++)
-                m_elements[i] *= other.m_elements[i];
+                m_elements[i] *= other[i];
 
             return *this;
         }
@@ -254,86 +232,23 @@ namespace Math
         /**
          * @brief
          * Overloads the /= operator to divide two vectors
+         * @tparam E Type of the expression
          * @param other The vector to divide this vector by
          * @return Vector<T>& The quotient of the two vectors
          */
-        Vector<T> &operator/=(const Vector<T> &other)
+        template <class E>
+        Vector<T> &operator/=(const VectorExpression<E> &other)
         {
-            if (m_elements.size() != other.m_elements.size())
+            if (m_elements.size() != other.size())
                 throw std::invalid_argument(
                     "Vectors must be the same size to divide them");
 
             for (std::size_t i = 0; i < m_elements.size(); i++)
-                m_elements[i] /= other.m_elements[i];
+                m_elements[i] /= other[i];
 
             return *this;
         }
 
-        /**
-         * @brief
-         * Overloads the + operator to add a scalar to a vector
-         * @param scalar The scalar to add to the vector
-         * @return Vector<T> The sum of the vector and the scalar
-         */
-        Vector<T> operator+(const T &scalar) const
-        {
-            Vector<T> result;
-
-            for (std::size_t i = 0; i < m_elements.size(); i++)
-                result.m_elements.push_back(m_elements[i] + scalar);
-
-            return result;
-        }
-
-        /**
-         * @brief
-         * Overloads the - operator to subtract a scalar from a vector
-         * @param scalar The scalar to subtract from the vector
-         * @return Vector<T> The difference of the vector and the scalar
-         */
-        Vector<T> operator-(const T &scalar) const
-        {
-            Vector<T> result;
-
-            for (std::size_t i = 0; i < m_elements.size(); i++)
-                result.m_elements.push_back(m_elements[i] - scalar);
-
-            return result;
-        }
-
-        /**
-         * @brief
-         * Overloads the * operator to multiply a scalar with a vector
-         * @param scalar The scalar to multiply with the vector
-         * @return Vector<T> The product of the vector and the scalar
-         */
-        Vector<T> operator*(const T &scalar) const
-        {
-            Vector<T> result(size());
-
-            for (std::size_t i = 0; i < m_elements.size(); i++)
-                result[i] = m_elements[i] * scalar;
-
-            return result;
-        }
-
-        /**
-         * @brief
-         * Overloads the / operator to divide a vector by a scalar
-         * @param scalar The scalar to divide the vector by
-         * @return Vector<T> The quotient of the vector and the scalar
-         */
-        Vector<T> operator/(const T &scalar) const
-        {
-            assert(scalar != 0 && "Cannot divide by zero");
-            Vector<T> result(size());
-
-            for (std::size_t i = 0; i < m_elements.size(); i++)
-                result[i] = m_elements[i] / scalar;
-
-            return result;
-        }
-
         /**
          * @brief
          * Overloads the += operator to add a scalar to a vector
@@ -410,7 +325,7 @@ namespace Math
          */
         T magnitude() const
         {
-            T sum = 0;
+            T sum = T();
 
             for (std::size_t i = 0; i < m_elements.size(); i++)
                 sum += m_elements[i] * m_elements[i];
@@ -437,7 +352,7 @@ namespace Math
          */
         T squared_magnitude() const
         {
-            T sum = 0;
+            T sum = T();
 
             for (std::size_t i = 0; i < m_elements.size(); i++)
                 sum += m_elements[i] * m_elements[i];
@@ -456,7 +371,7 @@ namespace Math
             assert(m_elements.size() == other.m_elements.size() &&
                    "Vectors must be the same size to dot them");
 
-            T sum = 0;
+            T sum = T();
 
             for (std::size_t i = 0; i < m_elements.size(); i++)
                 sum += m_elements[i] * other.m_elements[i];
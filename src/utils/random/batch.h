@@ -0,0 +1,304 @@
+/**
+ * @file batch.h
+ * @author Carlos Salguero
+ * @brief Batch generation of uniform, normal and direction samples into
+ *        whole arrays
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#pragma once
+
+// C++ Standard Libraries
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <numbers>
+#include <span>
+
+// Project files
+#include "../math/batch_transform.h"
+#include "../math/fast_math.h"
+#include "../math/float8.h"
+#include "distributions.h"
+
+namespace Math
+{
+    // The fill functions draw the bits of a chunk from the generator first,
+    // two floats per 64-bit word, and then turn them into samples across the
+    // full SIMD width with the Math::Fast approximations. Uniform values are
+    // word_to_unit_float of the low and then the high half of every word, on
+    // every target; normal samples and directions may differ in the last
+    // bits between targets, as the Fast functions do.
+
+    namespace Detail
+    {
+        // Floats per chunk, so the bits are converted while still in L1.
+        // Even, and a multiple of twice the widest register.
+        inline constexpr std::size_t RANDOM_CHUNK = 1024;
+
+        /**
+         * @brief
+         * Fills an array with uniform floats in [0, 1), multiples of 2^-24,
+         * made from the top 24 bits of the low and then the high half of
+         * each word
+         * @tparam Generator Type of the generator, with 64-bit outputs
+         * @param values The array to fill
+         * @param generator The generator
+         */
+        template <std::uniform_random_bit_generator Generator>
+        void fill_units(std::span<float> values, Generator &generator)
+        {
+            std::size_t count = values.size();
+            float *data = values.data();
+
+            // The raw bits go through the array itself
+            auto store_bits = [data](std::size_t i, std::uint32_t bits)
+            {
+                std::memcpy(data + i, &bits, sizeof(bits));
+            };
+
+            std::size_t i = 0;
+
+            for (; i + 2 <= count; i += 2)
+            {
+                std::uint64_t word = next_word(generator);
+                store_bits(i, static_cast<std::uint32_t>(word));
+                store_bits(i + 1, static_cast<std::uint32_t>(word >> 32));
+            }
+
+            if (i < count)
+                store_bits(i, static_cast<std::uint32_t>(next_word(generator)));
+
+            i = 0;
+
+#if defined(MATH_SIMD_AVX2)
+            const __m256 scale = _mm256_set1_ps(0x1p-24f);
+
+            for (; i + 8 <= count; i += 8)
+            {
+                __m256i bits = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i));
+                _mm256_storeu_ps(data + i, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(bits, 8)), scale));
+            }
+#elif defined(MATH_SIMD_SSE)
+            const __m128 scale = _mm_set1_ps(0x1p-24f);
+
+            for (; i + 4 <= count; i += 4)
+            {
+                __m128i bits = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+                _mm_storeu_ps(data + i, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(bits, 8)), scale));
+            }
+#elif defined(MATH_SIMD_NEON)
+            const float32x4_t scale = vdupq_n_f32(0x1p-24f);
+
+            for (; i + 4 <= count; i += 4)
+            {
+                uint32x4_t bits = vld1q_u32(reinterpret_cast<const std::uint32_t *>(data + i));
+                vst1q_f32(data + i, vmulq_f32(vcvtq_f32_u32(vshrq_n_u32(bits, 8)), scale));
+            }
+#endif
+
+            for (; i < count; ++i)
+            {
+                std::uint32_t bits;
+                std::memcpy(&bits, data + i, sizeof(bits));
+                data[i] = static_cast<float>(bits >> 8) * 0x1p-24f;
+            }
+        }
+
+        inline float square_root(float x)
+        {
+            return std::sqrt(x);
+        }
+
+        inline Simd::WideFloat square_root(const Simd::WideFloat &x)
+        {
+            return x.sqrt();
+        }
+
+        /**
+         * @brief
+         * Turns two uniforms in [0, 1) into two standard normal samples
+         * with the Box-Muller transform. The logarithm of 1 - u never sees
+         * zero, which caps the samples at about 5.8 standard deviations.
+         * @tparam V Type of the lanes, float or Simd::WideFloat
+         * @param u The first uniform, replaced by the first sample
+         * @param v The second uniform, replaced by the second sample
+         */
+        template <class V>
+        void box_muller(V &u, V &v)
+        {
+            constexpr float pi = std::numbers::pi_v<float>;
+
+            V radius = square_root(Fast::log(V(1.0f) - u) * V(-2.0f));
+
+            // Angles in [-pi, pi) keep the argument reduction short
+            V angle = Fast::Detail::multiply_add(v, V(2.0f * pi), V(-pi));
+
+            u = radius * Fast::cos(angle);
+            v = radius * Fast::sin(angle);
+        }
+
+        /**
+         * @brief
+         * Turns two uniforms in [0, 1) into a direction uniformly
+         * distributed over the unit sphere: z is uniform in [-1, 1) and the
+         * angle around it in [-pi, pi) (Archimedes' hat-box theorem)
+         * @tparam V Type of the lanes, float or Simd::WideFloat
+         * @param u Uniform for z, replaced by x
+         * @param v Uniform for the angle, replaced by y
+         * @return V The z coordinate
+         */
+        template <class V>
+        V sphere_point(V &u, V &v)
+        {
+            constexpr float pi = std::numbers::pi_v<float>;
+
+            V z = Fast::Detail::multiply_add(u, V(-2.0f), V(1.0f));
+            V radius = square_root(Fast::Detail::max(V(1.0f) - z * z, V(0.0f)));
+            V angle = Fast::Detail::multiply_add(v, V(2.0f * pi), V(-pi));
+
+            u = radius * Fast::cos(angle);
+            v = radius * Fast::sin(angle);
+
+            return z;
+        }
+    }
+
+    /**
+     * @brief
+     * Fills an array with uniform floats in [min, max)
+     * @tparam Generator Type of the generator, with 64-bit outputs
+     * @param values The array to fill
+     * @param min Smallest value
+     * @param max Bound of the values, not included
+     * @param generator The generator
+     */
+    template <std::uniform_random_bit_generator Generator>
+    void fill_uniform(std::span<float> values, float min, float max, Generator &generator)
+    {
+        using Simd::WideFloat;
+
+        constexpr std::size_t width = WideFloat::width;
+        const float range = max - min;
+
+        for (std::size_t begin = 0; begin < values.size(); begin += Detail::RANDOM_CHUNK)
+        {
+            std::span<float> chunk = values.subspan(begin, std::min(Detail::RANDOM_CHUNK, values.size() - begin));
+            Detail::fill_units(chunk, generator);
+
+            std::size_t i = 0;
+
+            for (; i + width <= chunk.size(); i += width)
+                WideFloat::multiply_add(WideFloat::load(chunk.data() + i), WideFloat(range), WideFloat(min))
+                    .store(chunk.data() + i);
+
+            for (; i < chunk.size(); ++i)
+                chunk[i] = Fast::Detail::multiply_add(chunk[i], range, min);
+        }
+    }
+
+    /**
+     * @brief
+     * Fills an array with normally distributed floats, in pairs from the
+     * Box-Muller transform
+     * @tparam Generator Type of the generator, with 64-bit outputs
+     * @param values The array to fill
+     * @param mean Mean of the values
+     * @param deviation Standard deviation of the values
+     * @param generator The generator
+     */
+    template <std::uniform_random_bit_generator Generator>
+    void fill_normal(std::span<float> values, float mean, float deviation, Generator &generator)
+    {
+        using Simd::WideFloat;
+
+        constexpr std::size_t width = WideFloat::width;
+
+        for (std::size_t begin = 0; begin < values.size(); begin += Detail::RANDOM_CHUNK)
+        {
+            std::span<float> chunk = values.subspan(begin, std::min(Detail::RANDOM_CHUNK, values.size() - begin));
+            Detail::fill_units(chunk, generator);
+
+            std::size_t i = 0;
+
+            for (; i + 2 * width <= chunk.size(); i += 2 * width)
+            {
+                WideFloat u = WideFloat::load(chunk.data() + i);
+                WideFloat v = WideFloat::load(chunk.data() + i + width);
+
+                Detail::box_muller(u, v);
+
+                WideFloat::multiply_add(u, WideFloat(deviation), WideFloat(mean)).store(chunk.data() + i);
+                WideFloat::multiply_add(v, WideFloat(deviation), WideFloat(mean)).store(chunk.data() + i + width);
+            }
+
+            for (; i + 2 <= chunk.size(); i += 2)
+            {
+                Detail::box_muller(chunk[i], chunk[i + 1]);
+
+                chunk[i] = Fast::Detail::multiply_add(chunk[i], deviation, mean);
+                chunk[i + 1] = Fast::Detail::multiply_add(chunk[i + 1], deviation, mean);
+            }
+
+            // An odd count leaves one value, which draws its own pair
+            if (i < chunk.size())
+            {
+                float pair[2];
+                Detail::fill_units(pair, generator);
+                Detail::box_muller(pair[0], pair[1]);
+
+                chunk[i] = Fast::Detail::multiply_add(pair[0], deviation, mean);
+            }
+        }
+    }
+
+    /**
+     * @brief
+     * Fills arrays of coordinates with directions uniformly distributed
+     * over the unit sphere, such as the velocities of a particle burst
+     * @tparam Generator Type of the generator, with 64-bit outputs
+     * @param directions Where the directions are written
+     * @param generator The generator
+     * @throws std::invalid_argument If the arrays differ in size
+     */
+    template <std::uniform_random_bit_generator Generator>
+    void fill_unit_vectors3(const SoaView &directions, Generator &generator)
+    {
+        using Simd::WideFloat;
+
+        constexpr std::size_t width = WideFloat::width;
+        std::size_t count = directions.size();
+
+        for (std::size_t begin = 0; begin < count; begin += Detail::RANDOM_CHUNK)
+        {
+            std::size_t size = std::min(Detail::RANDOM_CHUNK, count - begin);
+            float *x = directions.x.data() + begin;
+            float *y = directions.y.data() + begin;
+            float *z = directions.z.data() + begin;
+
+            Detail::fill_units(std::span<float>(x, size), generator);
+            Detail::fill_units(std::span<float>(y, size), generator);
+
+            std::size_t i = 0;
+
+            for (; i + width <= size; i += width)
+            {
+                WideFloat u = WideFloat::load(x + i);
+                WideFloat v = WideFloat::load(y + i);
+
+                Detail::sphere_point(u, v).store(z + i);
+                u.store(x + i);
+                v.store(y + i);
+            }
+
+            for (; i < size; ++i)
+                z[i] = Detail::sphere_point(x[i], y[i]);
+        }
+    }
+}
@@ -0,0 +1,311 @@
+/**
+ * @file distributions.h
+ * @author Carlos Salguero
+ * @brief Random distributions with the same results on every platform
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#pragma once
+
+// C++ Standard Libraries
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <type_traits>
+
+// Project files
+#include "generators.h"
+
+namespace Math
+{
+    // The standard distributions leave their algorithms to the library, so
+    // the same seed gives different values with libstdc++, libc++ and MSVC.
+    // These ones only use integer operations, IEEE 754 basic arithmetic and
+    // square roots, which are exactly rounded everywhere, and consume 64-bit
+    // words from the generator in a fixed order.
+    //
+    // That holds only if the compiler keeps every product rounded on its
+    // own: GCC fuses a * b + c into an FMA by default when the target has
+    // one, and AArch64 always does. Code that relies on identical values
+    // must be built with -ffp-contract=off, as the CMake targets are.
+
+    namespace Detail
+    {
+        /**
+         * @brief
+         * Draws a 64-bit word from a generator
+         * @tparam Generator Type of the generator, with 64-bit outputs
+         * @param generator The generator
+         * @return std::uint64_t The word
+         */
+        template <std::uniform_random_bit_generator Generator>
+        std::uint64_t next_word(Generator &generator)
+        {
+            static_assert(Generator::min() == 0 && Generator::max() == std::numeric_limits<std::uint64_t>::max(),
+                          "The portable distributions need a full 64-bit generator");
+
+            return static_cast<std::uint64_t>(generator());
+        }
+
+        /**
+         * @brief
+         * Calculates the natural logarithm of a positive finite number with
+         * basic arithmetic only, so it rounds the same on every platform.
+         * The mantissa is reduced to [sqrt(1/2), sqrt(2)) and the series of
+         * 2 * atanh((m - 1) / (m + 1)) is accurate to two ulps there.
+         * @param value The number
+         * @return double The logarithm
+         */
+        inline double portable_log(double value)
+        {
+            constexpr double ln2_high = 0x1.62e42fee00000p-1;
+            constexpr double ln2_low = 0x1.a39ef35793c76p-33;
+
+            std::uint64_t bits = std::bit_cast<std::uint64_t>(value);
+            int exponent = static_cast<int>(bits >> 52) - 1023;
+
+            // Subnormals: scale into the normal range first
+            if (exponent == -1023)
+            {
+                bits = std::bit_cast<std::uint64_t>(value * 0x1p54);
+                exponent = static_cast<int>(bits >> 52) - 1023 - 54;
+            }
+
+            double mantissa = std::bit_cast<double>((bits & 0x000fffffffffffffu) | 0x3ff0000000000000u);
+
+            if (mantissa > 1.4142135623730951)
+            {
+                mantissa *= 0.5;
+                ++exponent;
+            }
+
+            double s = (mantissa - 1.0) / (mantissa + 1.0);
+            double s2 = s * s;
+
+            // 2s (1 + s^2/3 + s^4/5 + ... + s^20/21), |s| < 0.172
+            double series = 1.0 / 21.0;
+
+            for (int k = 19; k >= 1; k -= 2)
+                series = series * s2 + 1.0 / k;
+
+            double scale = static_cast<double>(exponent);
+            return scale * ln2_high + (2.0 * s * series + scale * ln2_low);
+        }
+    }
+
+    /**
+     * @brief
+     * Converts a 64-bit word to a float in [0, 1) from its top 24 bits
+     * @param word The word
+     * @return float The number, a multiple of 2^-24
+     */
+    constexpr float word_to_unit_float(std::uint64_t word)
+    {
+        return static_cast<float>(word >> 40) * 0x1p-24f;
+    }
+
+    /**
+     * @brief
+     * Converts a 64-bit word to a double in [0, 1) from its top 53 bits
+     * @param word The word
+     * @return double The number, a multiple of 2^-53
+     */
+    constexpr double word_to_unit_double(std::uint64_t word)
+    {
+        return static_cast<double>(word >> 11) * 0x1p-53;
+    }
+
+    /**
+     * @class UniformRealDistribution
+     * @brief Uniform floating point numbers in [min, max), as min + (max -
+     *        min) * u with u a multiple of 2^-24 for float and 2^-53 for
+     *        double
+     * @tparam T Type of the numbers
+     */
+    template <std::floating_point T>
+    class UniformRealDistribution
+    {
+    public:
+        using result_type = T;
+
+        // Constructors
+        UniformRealDistribution() : UniformRealDistribution(T(0), T(1)) {}
+
+        /**
+         * @brief
+         * Construct a new Uniform Real Distribution object
+         * @param min Smallest value
+         * @param max Bound of the values, not included
+         */
+        UniformRealDistribution(T min, T max) : m_min(min), m_range(max - min) {}
+
+        // Operators
+        template <std::uniform_random_bit_generator Generator>
+        T operator()(Generator &generator) const
+        {
+            std::uint64_t word = Detail::next_word(generator);
+
+            if constexpr (std::is_same_v<T, float>)
+                return m_min + m_range * word_to_unit_float(word);
+            else
+                return m_min + m_range * static_cast<T>(word_to_unit_double(word));
+        }
+
+        // Access Methods
+        T min() const
+        {
+            return m_min;
+        }
+
+        T max() const
+        {
+            return m_min + m_range;
+        }
+
+    private:
+        T m_min;
+        T m_range;
+    };
+
+    /**
+     * @class UniformIntDistribution
+     * @brief Uniform integers in [min, max], without bias, with Lemire's
+     *        multiply and reject method
+     * @tparam T Type of the integers
+     */
+    template <std::integral T>
+    class UniformIntDistribution
+    {
+    public:
+        using result_type = T;
+
+        // Constructors
+        UniformIntDistribution() : UniformIntDistribution(T(0), std::numeric_limits<T>::max()) {}
+
+        /**
+         * @brief
+         * Construct a new Uniform Int Distribution object
+         * @param min Smallest value
+         * @param max Largest value, included
+         */
+        UniformIntDistribution(T min, T max)
+            : m_min(min), m_range(static_cast<std::uint64_t>(max) - static_cast<std::uint64_t>(min) + 1) {}
+
+        // Operators
+        template <std::uniform_random_bit_generator Generator>
+        T operator()(Generator &generator) const
+        {
+            std::uint64_t word = Detail::next_word(generator);
+
+            // The whole 64-bit range
+            if (m_range == 0)
+                return static_cast<T>(word);
+
+            // The high word of word * range is uniform once the low words
+            // that would favor some results are rejected
+            Detail::UInt128 product = Detail::multiply_wide(word, m_range);
+
+            if (product.low < m_range)
+            {
+                std::uint64_t threshold = (0 - m_range) % m_range;
+
+                while (product.low < threshold)
+                    product = Detail::multiply_wide(Detail::next_word(generator), m_range);
+            }
+
+            return static_cast<T>(static_cast<std::uint64_t>(m_min) + product.high);
+        }
+
+        // Access Methods
+        T min() const
+        {
+            return m_min;
+        }
+
+        T max() const
+        {
+            return static_cast<T>(static_cast<std::uint64_t>(m_min) + m_range - 1);
+        }
+
+    private:
+        T m_min;
+        std::uint64_t m_range;
+    };
+
+    /**
+     * @class NormalDistribution
+     * @brief Normally distributed numbers with Marsaglia's polar method,
+     *        computed in double. Values come in pairs, so every other call
+     *        does not touch the generator.
+     * @tparam T Type of the numbers
+     */
+    template <std::floating_point T>
+    class NormalDistribution
+    {
+    public:
+        using result_type = T;
+
+        // Constructors
+        NormalDistribution() : NormalDistribution(T(0), T(1)) {}
+
+        /**
+         * @brief
+         * Construct a new Normal Distribution object
+         * @param mean Mean of the values
+         * @param deviation Standard deviation of the values
+         */
+        NormalDistribution(T mean, T deviation) : m_mean(mean), m_deviation(deviation) {}
+
+        // Operators
+        template <std::uniform_random_bit_generator Generator>
+        T operator()(Generator &generator)
+        {
+            if (m_has_spare)
+            {
+                m_has_spare = false;
+                return m_mean + m_deviation * static_cast<T>(m_spare);
+            }
+
+            double u;
+            double v;
+            double s;
+
+            do
+            {
+                u = 2.0 * word_to_unit_double(Detail::next_word(generator)) - 1.0;
+                v = 2.0 * word_to_unit_double(Detail::next_word(generator)) - 1.0;
+                s = u * u + v * v;
+            } while (s >= 1.0 || s == 0.0);
+
+            double factor = std::sqrt(-2.0 * Detail::portable_log(s) / s);
+
+            m_spare = v * factor;
+            m_has_spare = true;
+
+            return m_mean + m_deviation * static_cast<T>(u * factor);
+        }
+
+        // Methods
+        /**
+         * @brief
+         * Forgets the cached second value of the last pair
+         */
+        void reset()
+        {
+            m_has_spare = false;
+        }
+
+    private:
+        T m_mean;
+        T m_deviation;
+        double m_spare = 0.0;
+        bool m_has_spare = false;
+    };
+}
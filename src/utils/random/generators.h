@@ -0,0 +1,401 @@
+/**
+ * @file generators.h
+ * @author Carlos Salguero
+ * @brief Small-state pseudorandom generators with jumps for parallel streams
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#pragma once
+
+// C++ Standard Libraries
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <limits>
+
+namespace Math
+{
+    // The generators satisfy std::uniform_random_bit_generator, so they work
+    // with the standard algorithms and distributions, and produce the same
+    // sequence for the same seed on every platform. jump() moves a generator
+    // far ahead in its sequence; split() returns a generator for the current
+    // position and jumps this one, so each thread can own a stream that will
+    // not overlap the others.
+
+    namespace Detail
+    {
+#if defined(__SIZEOF_INT128__)
+        __extension__ using uint128_t = unsigned __int128;
+#endif
+
+        /**
+         * @struct UInt128
+         * @brief Portable unsigned 128-bit integer for the PCG state
+         */
+        struct UInt128
+        {
+            std::uint64_t high;
+            std::uint64_t low;
+
+            friend constexpr bool operator==(const UInt128 &, const UInt128 &) = default;
+        };
+
+        /**
+         * @brief
+         * Multiplies two 64-bit integers into a 128-bit product
+         * @param a The first factor
+         * @param b The second factor
+         * @return UInt128 The product
+         */
+        constexpr UInt128 multiply_wide(std::uint64_t a, std::uint64_t b)
+        {
+#if defined(__SIZEOF_INT128__)
+            uint128_t product = uint128_t(a) * b;
+            return {static_cast<std::uint64_t>(product >> 64), static_cast<std::uint64_t>(product)};
+#else
+            constexpr std::uint64_t mask = 0xffffffffu;
+
+            std::uint64_t low_low = (a & mask) * (b & mask);
+            std::uint64_t high_low = (a >> 32) * (b & mask);
+            std::uint64_t low_high = (a & mask) * (b >> 32);
+            std::uint64_t high_high = (a >> 32) * (b >> 32);
+
+            std::uint64_t middle = (low_low >> 32) + (high_low & mask) + (low_high & mask);
+
+            return {high_high + (high_low >> 32) + (low_high >> 32) + (middle >> 32),
+                    (middle << 32) | (low_low & mask)};
+#endif
+        }
+
+        constexpr UInt128 operator+(const UInt128 &a, const UInt128 &b)
+        {
+            std::uint64_t low = a.low + b.low;
+            return {a.high + b.high + (low < a.low), low};
+        }
+
+        constexpr UInt128 operator*(const UInt128 &a, const UInt128 &b)
+        {
+            UInt128 product = multiply_wide(a.low, b.low);
+            product.high += a.high * b.low + a.low * b.high;
+
+            return product;
+        }
+    }
+
+    /**
+     * @class SplitMix64
+     * @brief Weyl sequence with a 64-bit output mix (Steele, Lea and Flood).
+     *        One word of state and a period of 2^64; mostly used to expand
+     *        a single seed into the state of the other generators.
+     */
+    class SplitMix64
+    {
+    public:
+        using result_type = std::uint64_t;
+
+        // Constructors
+        explicit constexpr SplitMix64(std::uint64_t seed = 0) : m_state(seed) {}
+
+        // Operators
+        constexpr result_type operator()()
+        {
+            std::uint64_t z = (m_state += increment);
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9u;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebu;
+
+            return z ^ (z >> 31);
+        }
+
+        friend constexpr bool operator==(const SplitMix64 &, const SplitMix64 &) = default;
+
+        // Methods
+        /**
+         * @brief
+         * Skips values of the sequence in constant time
+         * @param steps Number of values to skip
+         */
+        constexpr void advance(std::uint64_t steps)
+        {
+            m_state += steps * increment;
+        }
+
+        /**
+         * @brief
+         * Skips 2^32 values, giving 2^32 non-overlapping streams
+         */
+        constexpr void jump()
+        {
+            advance(std::uint64_t(1) << 32);
+        }
+
+        /**
+         * @brief
+         * Returns a generator at the current position and jumps this one
+         * @return SplitMix64 The generator of the current stream
+         */
+        constexpr SplitMix64 split()
+        {
+            SplitMix64 stream = *this;
+            jump();
+            return stream;
+        }
+
+        // Static Methods
+        static constexpr result_type min()
+        {
+            return 0;
+        }
+
+        static constexpr result_type max()
+        {
+            return std::numeric_limits<result_type>::max();
+        }
+
+    private:
+        static constexpr std::uint64_t increment = 0x9e3779b97f4a7c15u;
+
+        std::uint64_t m_state;
+    };
+
+    /**
+     * @class Xoshiro256StarStar
+     * @brief xoshiro256** (Blackman and Vigna): 32 bytes of state, a period
+     *        of 2^256 - 1 and four cycles per value. The default generator
+     *        of RandomEngine.
+     */
+    class Xoshiro256StarStar
+    {
+    public:
+        using result_type = std::uint64_t;
+
+        // Constructors
+        /**
+         * @brief
+         * Construct a new generator, expanding the seed with SplitMix64 so
+         * that the state is never all zeros
+         * @param seed The seed
+         */
+        explicit constexpr Xoshiro256StarStar(std::uint64_t seed = 0) : m_state{}
+        {
+            SplitMix64 seeder(seed);
+
+            for (auto &word : m_state)
+                word = seeder();
+        }
+
+        /**
+         * @brief
+         * Construct a new generator from a raw state, which must not be all
+         * zeros
+         * @param state The state words
+         */
+        explicit constexpr Xoshiro256StarStar(const std::array<std::uint64_t, 4> &state) : m_state(state) {}
+
+        // Operators
+        constexpr result_type operator()()
+        {
+            std::uint64_t result = std::rotl(m_state[1] * 5, 7) * 9;
+            std::uint64_t t = m_state[1] << 17;
+
+            m_state[2] ^= m_state[0];
+            m_state[3] ^= m_state[1];
+            m_state[1] ^= m_state[2];
+            m_state[0] ^= m_state[3];
+            m_state[2] ^= t;
+            m_state[3] = std::rotl(m_state[3], 45);
+
+            return result;
+        }
+
+        friend constexpr bool operator==(const Xoshiro256StarStar &, const Xoshiro256StarStar &) = default;
+
+        // Methods
+        /**
+         * @brief
+         * Advances the generator by 2^128 values, giving 2^128
+         * non-overlapping streams
+         */
+        constexpr void jump()
+        {
+            apply_jump({0x180ec6d33cfd0abau, 0xd5a61266f0c9392cu, 0xa9582618e03fc9aau, 0x39abdc4529b1661cu});
+        }
+
+        /**
+         * @brief
+         * Advances the generator by 2^192 values, to separate groups of
+         * streams made with jump()
+         */
+        constexpr void long_jump()
+        {
+            apply_jump({0x76e15d3efefdcbbfu, 0xc5004e441c522fb3u, 0x77710069854ee241u, 0x39109bb02acbe635u});
+        }
+
+        /**
+         * @brief
+         * Returns a generator at the current position and jumps this one
+         * @return Xoshiro256StarStar The generator of the current stream
+         */
+        constexpr Xoshiro256StarStar split()
+        {
+            Xoshiro256StarStar stream = *this;
+            jump();
+            return stream;
+        }
+
+        // Static Methods
+        static constexpr result_type min()
+        {
+            return 0;
+        }
+
+        static constexpr result_type max()
+        {
+            return std::numeric_limits<result_type>::max();
+        }
+
+    private:
+        std::array<std::uint64_t, 4> m_state;
+
+        /**
+         * @brief
+         * Multiplies the state by a power of the transition matrix, given
+         * as its characteristic polynomial
+         * @param polynomial The jump polynomial
+         */
+        constexpr void apply_jump(const std::array<std::uint64_t, 4> &polynomial)
+        {
+            std::array<std::uint64_t, 4> state{};
+
+            for (std::uint64_t word : polynomial)
+            {
+                for (int bit = 0; bit < 64; ++bit)
+                {
+                    if (word & (std::uint64_t(1) << bit))
+                        for (std::size_t i = 0; i < 4; ++i)
+                            state[i] ^= m_state[i];
+
+                    (*this)();
+                }
+            }
+
+            m_state = state;
+        }
+    };
+
+    /**
+     * @class Pcg64
+     * @brief PCG XSL RR 128/64 (O'Neill): a 128-bit linear congruential
+     *        generator with a permuted 64-bit output, the pcg64 of the
+     *        reference library. Every odd increment selects a different
+     *        stream of period 2^128.
+     */
+    class Pcg64
+    {
+    public:
+        using result_type = std::uint64_t;
+
+        // Constructors
+        /**
+         * @brief
+         * Construct a new generator, seeded like pcg64_srandom_r
+         * @param seed The initial state
+         * @param stream Selects one of 2^127 streams
+         */
+        explicit constexpr Pcg64(std::uint64_t seed = 0, std::uint64_t stream = 0xda3e39cb94b95bdbu)
+            : m_state{0, 0}, m_increment{stream >> 63, (stream << 1) | 1u}
+        {
+            step();
+            m_state = m_state + Detail::UInt128{0, seed};
+            step();
+        }
+
+        // Operators
+        constexpr result_type operator()()
+        {
+            step();
+
+            // XSL RR: xor the halves, rotate by the top six bits
+            return std::rotr(m_state.high ^ m_state.low, static_cast<int>(m_state.high >> 58));
+        }
+
+        friend constexpr bool operator==(const Pcg64 &, const Pcg64 &) = default;
+
+        // Methods
+        /**
+         * @brief
+         * Skips values of the sequence in O(log steps) (Brown, "Random
+         * number generation with arbitrary strides")
+         * @param steps Number of values to skip
+         */
+        constexpr void advance(Detail::UInt128 steps)
+        {
+            Detail::UInt128 multiplier = m_multiplier;
+            Detail::UInt128 increment = m_increment;
+            Detail::UInt128 total_multiplier{0, 1};
+            Detail::UInt128 total_increment{0, 0};
+
+            while (steps.high || steps.low)
+            {
+                if (steps.low & 1u)
+                {
+                    total_multiplier = total_multiplier * multiplier;
+                    total_increment = total_increment * multiplier + increment;
+                }
+
+                increment = (multiplier + Detail::UInt128{0, 1}) * increment;
+                multiplier = multiplier * multiplier;
+                steps = {steps.high >> 1, (steps.low >> 1) | (steps.high << 63)};
+            }
+
+            m_state = total_multiplier * m_state + total_increment;
+        }
+
+        /**
+         * @brief
+         * Advances the generator by 2^64 values, giving 2^64
+         * non-overlapping streams
+         */
+        constexpr void jump()
+        {
+            advance({1, 0});
+        }
+
+        /**
+         * @brief
+         * Returns a generator at the current position and jumps this one
+         * @return Pcg64 The generator of the current stream
+         */
+        constexpr Pcg64 split()
+        {
+            Pcg64 stream = *this;
+            jump();
+            return stream;
+        }
+
+        // Static Methods
+        static constexpr result_type min()
+        {
+            return 0;
+        }
+
+        static constexpr result_type max()
+        {
+            return std::numeric_limits<result_type>::max();
+        }
+
+    private:
+        static constexpr Detail::UInt128 m_multiplier{0x2360ed051fc65da4u, 0x4385df649fccf645u};
+
+        Detail::UInt128 m_state;
+        Detail::UInt128 m_increment;
+
+        constexpr void step()
+        {
+            m_state = m_state * m_multiplier + m_increment;
+        }
+    };
+}
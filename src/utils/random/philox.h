@@ -0,0 +1,230 @@
+/**
+ * @file philox.h
+ * @author Carlos Salguero
+ * @brief Counter-based Philox generator and deterministic parallel
+ *        generation on the thread pool
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#pragma once
+
+// C++ Standard Libraries
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+// Project files
+#include "../../threads/thread_pool.h"
+
+namespace Math
+{
+    // A counter-based generator has no state to carry from one value to
+    // the next: value i is a keyed bijection of the counter i. Any value
+    // can be computed directly, so work split across threads draws exactly
+    // the same numbers however it is split.
+
+    namespace Detail
+    {
+        // Elements per task of parallel_generate
+        inline constexpr std::size_t RANDOM_BAND = 1 << 12;
+
+        /**
+         * @brief
+         * Encrypts a counter with Philox4x32-10 (Salmon, Moraes, Dror and
+         * Shaw, "Parallel random numbers: as easy as 1, 2, 3")
+         * @param counter The four counter words
+         * @param key The two key words
+         * @return std::array<std::uint32_t, 4> The four random words
+         */
+        constexpr std::array<std::uint32_t, 4> philox(std::array<std::uint32_t, 4> counter,
+                                                      std::array<std::uint32_t, 2> key)
+        {
+            for (int round = 0; round < 10; ++round)
+            {
+                std::uint64_t first = std::uint64_t(0xd2511f53u) * counter[0];
+                std::uint64_t second = std::uint64_t(0xcd9e8d57u) * counter[2];
+
+                counter = {static_cast<std::uint32_t>(second >> 32) ^ counter[1] ^ key[0],
+                           static_cast<std::uint32_t>(second),
+                           static_cast<std::uint32_t>(first >> 32) ^ counter[3] ^ key[1],
+                           static_cast<std::uint32_t>(first)};
+
+                // Weyl sequence of the key: the golden ratio and sqrt(3) - 1
+                key[0] += 0x9e3779b9u;
+                key[1] += 0xbb67ae85u;
+            }
+
+            return counter;
+        }
+    }
+
+    /**
+     * @class Philox4x32
+     * @brief Philox4x32-10 counter-based generator. The seed is the key,
+     *        and the 128-bit counter holds the stream and the position of
+     *        the value inside it, so there are 2^64 streams of 2^64 values
+     *        that can be read in any order. Each block gives two values.
+     */
+    class Philox4x32
+    {
+    public:
+        using result_type = std::uint64_t;
+
+        // Constructors
+        /**
+         * @brief
+         * Construct a new generator at the start of a stream
+         * @param seed The key
+         * @param stream Selects one of 2^64 streams
+         */
+        explicit constexpr Philox4x32(std::uint64_t seed = 0, std::uint64_t stream = 0)
+            : m_key{static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32)},
+              m_stream(stream) {}
+
+        // Operators
+        constexpr result_type operator()()
+        {
+            std::uint64_t index = m_position++;
+
+            if (index & 1u)
+                return m_spare;
+
+            auto words = block(index >> 1);
+            m_spare = combine(words[2], words[3]);
+
+            return combine(words[0], words[1]);
+        }
+
+        friend constexpr bool operator==(const Philox4x32 &left, const Philox4x32 &right)
+        {
+            return left.m_key == right.m_key && left.m_stream == right.m_stream &&
+                   left.m_position == right.m_position;
+        }
+
+        // Access Methods
+        /**
+         * @brief
+         * Gets a value of the stream without moving the generator
+         * @param index Position of the value
+         * @return result_type The value
+         */
+        constexpr result_type at(std::uint64_t index) const
+        {
+            auto words = block(index >> 1);
+
+            return index & 1u ? combine(words[2], words[3]) : combine(words[0], words[1]);
+        }
+
+        constexpr std::uint64_t get_stream() const
+        {
+            return m_stream;
+        }
+
+        constexpr std::uint64_t get_position() const
+        {
+            return m_position;
+        }
+
+        // Methods
+        /**
+         * @brief
+         * Moves the generator to a value of its stream in constant time
+         * @param position Position of the next value
+         */
+        constexpr void seek(std::uint64_t position)
+        {
+            m_position = position;
+
+            // The second value of a block reads the spare
+            if (position & 1u)
+                m_spare = at(position);
+        }
+
+        /**
+         * @brief
+         * Skips values of the stream in constant time
+         * @param steps Number of values to skip
+         */
+        constexpr void discard(std::uint64_t steps)
+        {
+            seek(m_position + steps);
+        }
+
+        // Static Methods
+        static constexpr result_type min()
+        {
+            return 0;
+        }
+
+        static constexpr result_type max()
+        {
+            return std::numeric_limits<result_type>::max();
+        }
+
+    private:
+        std::array<std::uint32_t, 2> m_key;
+        std::uint64_t m_stream;
+        std::uint64_t m_position = 0;
+        std::uint64_t m_spare = 0;
+
+        constexpr std::array<std::uint32_t, 4> block(std::uint64_t index) const
+        {
+            return Detail::philox({static_cast<std::uint32_t>(index), static_cast<std::uint32_t>(index >> 32),
+                                   static_cast<std::uint32_t>(m_stream), static_cast<std::uint32_t>(m_stream >> 32)},
+                                  m_key);
+        }
+
+        static constexpr std::uint64_t combine(std::uint32_t low, std::uint32_t high)
+        {
+            return static_cast<std::uint64_t>(high) << 32 | low;
+        }
+    };
+
+    /**
+     * @brief
+     * Calls body(i, generator) for every i in [0, count), where generator
+     * is Philox4x32(seed, i). Every element owns a stream, so the results
+     * only depend on the seed, not on the number of threads or the order
+     * of the bands, and an element can draw any number of values.
+     * @tparam F Type of the body
+     * @param count Number of elements
+     * @param seed The key shared by every stream
+     * @param body Function called with each index and its generator
+     * @param thread_pool Thread pool to run on, or nullptr
+     * @throws Any exception thrown by body, once every band has stopped
+     */
+    template <class F>
+    void parallel_generate(std::size_t count, std::uint64_t seed, F &&body, ThreadPool *thread_pool = nullptr)
+    {
+        auto band = [&body, seed](std::size_t begin, std::size_t end)
+        {
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                Philox4x32 generator(seed, i);
+                body(i, generator);
+            }
+        };
+
+        if (thread_pool == nullptr || count <= Detail::RANDOM_BAND)
+        {
+            band(std::size_t(0), count);
+            return;
+        }
+
+        // The bands hold body by reference: when a band throws, the others
+        // must finish before the exception leaves this frame
+        TaskGroup tasks(*thread_pool);
+        std::size_t begin = 0;
+
+        for (; begin + Detail::RANDOM_BAND < count; begin += Detail::RANDOM_BAND)
+            tasks.run(band, begin, begin + Detail::RANDOM_BAND);
+
+        band(begin, count);
+        tasks.wait();
+    }
+}
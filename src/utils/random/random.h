@@ -12,20 +12,33 @@
 #pragma once
 
 // C++ Standard Libraries
-#include <random>
 #include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <numbers>
+#include <random>
+#include <span>
 
 // Project files
+#include "../math/quaternion.h"
 #include "../math/vector.h"
 #include "../color/color.h"
+#include "batch.h"
+#include "distributions.h"
+#include "generators.h"
+#include "philox.h"
 
 namespace Math
 {
     /**
      * @class RandomEngine
-     * @brief Template class for the random engine
+     * @brief Template class for the random engine. Numbers come from the
+     *        portable distributions, so a seeded engine gives the same
+     *        sequence on every platform.
+     * @tparam T Type of the random number
+     * @tparam Generator Source of random bits, with 64-bit outputs
      */
-    template <class T>
+    template <class T, class Generator = Xoshiro256StarStar>
     class RandomEngine
     {
     public:
@@ -40,15 +53,22 @@ namespace Math
          * @param max Maximum value of the random number
          */
         RandomEngine(const T &min, const T &max)
-        {
-            auto seed =
-                std::chrono::high_resolution_clock::now()
-                    .time_since_epoch()
-                    .count();
-            m_engine.seed(seed);
+            : RandomEngine(min, max,
+                           static_cast<std::uint64_t>(std::chrono::high_resolution_clock::now()
+                                                          .time_since_epoch()
+                                                          .count())) {}
 
-            m_distribution = std::uniform_real_distribution<T>(min, max);
-        }
+        /**
+         * @brief
+         * Construct a new Random Engine object with a fixed seed, which
+         * makes the sequence reproducible
+         * @tparam T Type of the random number
+         * @param min Minimum value of the random number
+         * @param max Maximum value of the random number
+         * @param seed Seed of the generator
+         */
+        RandomEngine(const T &min, const T &max, std::uint64_t seed)
+            : m_engine(seed), m_distribution(min, max) {}
 
         /**
          * @brief
@@ -101,11 +121,34 @@ namespace Math
          */
         T get_random_number(const T &min, const T &max)
         {
-            m_distribution = std::uniform_real_distribution<T>(min, max);
+            m_distribution = UniformRealDistribution<T>(min, max);
             return m_distribution(m_engine);
         }
 
+        /**
+         * @brief
+         * Gets the generator, to use with other distributions
+         * @return Generator& The generator
+         */
+        Generator &get_generator()
+        {
+            return m_engine;
+        }
+
         // Methods
+        /**
+         * @brief
+         * Creates an engine for an independent stream with the same range,
+         * for example one per thread, and jumps this engine past it
+         * @return RandomEngine The engine of the new stream
+         */
+        RandomEngine split()
+        {
+            RandomEngine stream(*this);
+            stream.m_engine = m_engine.split();
+            return stream;
+        }
+
         /**
          * @brief
          * Gets a random integer number
@@ -127,7 +170,7 @@ namespace Math
          */
         int get_random_int(const int &min, const int &max)
         {
-            m_distribution = std::uniform_real_distribution<T>(min, max);
+            m_distribution = UniformRealDistribution<T>(min, max);
             return static_cast<int>(m_distribution(m_engine));
         }
 
@@ -152,7 +195,7 @@ namespace Math
          */
         float get_random_float(const float &min, const float &max)
         {
-            m_distribution = std::uniform_real_distribution<T>(min, max);
+            m_distribution = UniformRealDistribution<T>(min, max);
             return static_cast<float>(m_distribution(m_engine));
         }
 
@@ -177,7 +220,7 @@ namespace Math
          */
         bool get_random_bool(const bool &min, const bool &max)
         {
-            m_distribution = std::uniform_real_distribution<T>(min, max);
+            m_distribution = UniformRealDistribution<T>(min, max);
             return static_cast<bool>(m_distribution(m_engine));
         }
 
@@ -191,10 +234,10 @@ namespace Math
          */
         Math::Vector<T> get_random_vector2D(const T &min, const T &max)
         {
-            m_distribution = std::uniform_real_distribution<T>(min, max);
-            return Math::Vector<T>(
+            m_distribution = UniformRealDistribution<T>(min, max);
+            return Math::Vector<T>{
                 m_distribution(m_engine),
-                m_distribution(m_engine));
+                m_distribution(m_engine)};
         }
 
         /**
@@ -207,11 +250,11 @@ namespace Math
          */
         Math::Vector<T> get_random_vector3D(const T &min, const T &max)
         {
-            m_distribution = std::uniform_real_distribution<T>(min, max);
-            return Math::Vector<T>(
+            m_distribution = UniformRealDistribution<T>(min, max);
+            return Math::Vector<T>{
                 m_distribution(m_engine),
                 m_distribution(m_engine),
-                m_distribution(m_engine));
+                m_distribution(m_engine)};
         }
 
         /**
@@ -222,9 +265,9 @@ namespace Math
          */
         Math::Vector<T> get_random_direction_vector2D()
         {
-            return Math::Vector<T>(
+            return Math::Vector<T>{
                        m_distribution(m_engine),
-                       m_distribution(m_engine))
+                       m_distribution(m_engine)}
                 .normalize();
         }
 
@@ -236,10 +279,10 @@ namespace Math
          */
         Math::Vector<T> get_random_direction_vector3D()
         {
-            return Math::Vector<T>(
+            return Math::Vector<T>{
                        m_distribution(m_engine),
                        m_distribution(m_engine),
-                       m_distribution(m_engine))
+                       m_distribution(m_engine)}
                 .normalize();
         }
 
@@ -280,34 +323,77 @@ namespace Math
          * @tparam T Type of the random number
          * @return A random color value
          */
-        template <class T>
         Color<T> get_random_color()
         {
-            return Math::Color<T>(
-                m_distribution(m_engine),
-                m_distribution(m_engine),
-                m_distribution(m_engine),
-                m_distribution(m_engine));
+            T red = m_distribution(m_engine);
+            T green = m_distribution(m_engine);
+            T blue = m_distribution(m_engine);
+            T alpha = m_distribution(m_engine);
+
+            return Color<T>(red, green, blue, alpha);
         }
 
         /**
          * @brief
-         * Generates a random rotation value
+         * Generates a random rotation, uniformly distributed over all
+         * orientations (Shoemake's method). Independent of the range of the
+         * engine.
          * @tparam T Type of the random number
-         * @return A random rotation value
+         * @return A random unit quaternion
          */
-        template <class T>
         Math::Quaternion<T> get_random_rotation()
         {
-            return Math::Quaternion<T>(
-                m_distribution(m_engine),
-                m_distribution(m_engine),
-                m_distribution(m_engine),
-                m_distribution(m_engine));
+            UniformRealDistribution<T> unit(T(0), T(1));
+            const T two_pi = T(2) * std::numbers::pi_v<T>;
+
+            T u1 = unit(m_engine);
+            T u2 = unit(m_engine) * two_pi;
+            T u3 = unit(m_engine) * two_pi;
+            T a = std::sqrt(T(1) - u1);
+            T b = std::sqrt(u1);
+
+            return Math::Quaternion<T>(a * std::sin(u2), a * std::cos(u2),
+                                       b * std::sin(u3), b * std::cos(u3));
+        }
+
+        /**
+         * @brief
+         * Fills an array with uniform numbers in [min, max), a chunk of
+         * SIMD registers at a time instead of one call per value
+         * @param values The array to fill
+         * @param min Smallest value
+         * @param max Bound of the values, not included
+         */
+        void fill_uniform(std::span<float> values, float min, float max)
+        {
+            Math::fill_uniform(values, min, max, m_engine);
+        }
+
+        /**
+         * @brief
+         * Fills an array with normally distributed numbers
+         * @param values The array to fill
+         * @param mean Mean of the values
+         * @param deviation Standard deviation of the values
+         */
+        void fill_normal(std::span<float> values, float mean, float deviation)
+        {
+            Math::fill_normal(values, mean, deviation, m_engine);
+        }
+
+        /**
+         * @brief
+         * Fills arrays of coordinates with random directions of length 1
+         * @param directions Where the directions are written
+         * @throws std::invalid_argument If the arrays differ in size
+         */
+        void fill_unit_vectors3(const SoaView &directions)
+        {
+            Math::fill_unit_vectors3(directions, m_engine);
         }
 
     private:
-        std::mt19937_64 m_engine;
-        std::uniform_real_distribution<T> m_distribution;
+        Generator m_engine;
+        UniformRealDistribution<T> m_distribution;
     };
 } // namespace Math
\ No newline at end of file
@@ -0,0 +1,237 @@
+/**
+ * @file batch_transform.test.h
+ * @author Carlos Salguero
+ * @brief Test class for the batch transform kernels
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef BATCH_TRANSFORM_TEST_H
+#define BATCH_TRANSFORM_TEST_H
+
+// C++ Standard Library
+#include <numbers>
+#include <random>
+#include <vector>
+
+// Google Test Library
+#include <gtest/gtest.h>
+
+// Project headers
+#include "src/utils/math/batch_transform.h"
+
+using namespace Math;
+
+namespace
+{
+    /**
+     * @brief
+     * Points stored as one vector per coordinate
+     */
+    struct SoaPoints
+    {
+        std::vector<float> x, y, z;
+
+        explicit SoaPoints(std::size_t count) : x(count), y(count), z(count) {}
+
+        SoaView view()
+        {
+            return {x, y, z};
+        }
+    };
+
+    /**
+     * @brief
+     * Creates points with random coordinates in [-10, 10]
+     * @param generator The random generator
+     * @param count The number of points
+     * @return SoaPoints The random points
+     */
+    SoaPoints random_soa_points(std::mt19937 &generator, std::size_t count)
+    {
+        std::uniform_real_distribution<float> distribution(-10.0f, 10.0f);
+        SoaPoints result(count);
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            result.x[i] = distribution(generator);
+            result.y[i] = distribution(generator);
+            result.z[i] = distribution(generator);
+        }
+
+        return result;
+    }
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestBatchTransform class
+ * @param TestMatrixTransforms method
+ */
+TEST(TestBatchTransform, TestMatrixTransforms)
+{
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<float> distribution(-2.0f, 2.0f);
+
+    // Sizes around the SIMD width cover the vector loop and the scalar tail
+    for (std::size_t count : {0u, 1u, 3u, 4u, 7u, 8u, 9u, 17u, 100u})
+    {
+        Mat4 matrix;
+
+        for (std::size_t i = 0; i < 4; ++i)
+            for (std::size_t j = 0; j < 4; ++j)
+                matrix(i, j) = distribution(generator);
+
+        SoaPoints input = random_soa_points(generator, count);
+        SoaPoints points(count), directions(count), projected(count);
+        std::vector<float> w(count);
+
+        transform_points(matrix, input.view(), points.view());
+        transform_directions(matrix, input.view(), directions.view());
+        transform_points_homogeneous(matrix, input.view(), projected.view(), w);
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            Vec4 point = matrix * Vec4(input.x[i], input.y[i], input.z[i], 1.0f);
+            Vec4 direction = matrix * Vec4(input.x[i], input.y[i], input.z[i], 0.0f);
+
+            EXPECT_NEAR(points.x[i], point.x(), 1e-4f);
+            EXPECT_NEAR(points.y[i], point.y(), 1e-4f);
+            EXPECT_NEAR(points.z[i], point.z(), 1e-4f);
+            EXPECT_NEAR(directions.x[i], direction.x(), 1e-4f);
+            EXPECT_NEAR(directions.y[i], direction.y(), 1e-4f);
+            EXPECT_NEAR(directions.z[i], direction.z(), 1e-4f);
+            EXPECT_NEAR(projected.x[i], point.x(), 1e-4f);
+            EXPECT_NEAR(w[i], point.w(), 1e-4f);
+        }
+
+        // In place
+        transform_points(matrix, input.view(), input.view());
+
+        for (std::size_t i = 0; i < count; ++i)
+            EXPECT_EQ(input.x[i], points.x[i]);
+    }
+
+    SoaPoints a(4), b(5);
+    EXPECT_THROW(transform_points(Mat4::identity(), a.view(), b.view()), std::invalid_argument);
+
+    b.y.pop_back();
+    EXPECT_THROW(transform_points(Mat4::identity(), b.view(), b.view()), std::invalid_argument);
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestBatchTransform class
+ * @param TestRotateTranslate method
+ */
+TEST(TestBatchTransform, TestRotateTranslate)
+{
+    std::mt19937 generator(11);
+    const std::size_t count = 37;
+
+    // Quarter turn around z: (x, y, z) -> (-y, x, z)
+    Quaternion<float> rotation = Quaternion<float>::from_axis_angle(
+        Vec3(0.0f, 0.0f, 1.0f), std::numbers::pi_v<float> / 2.0f);
+    Vec3 translation(1.0f, 2.0f, 3.0f);
+
+    SoaPoints input = random_soa_points(generator, count);
+    SoaPoints output(count);
+
+    rotate_translate_points(rotation, translation, input.view(), output.view());
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        EXPECT_NEAR(output.x[i], -input.y[i] + 1.0f, 1e-4f);
+        EXPECT_NEAR(output.y[i], input.x[i] + 2.0f, 1e-4f);
+        EXPECT_NEAR(output.z[i], input.z[i] + 3.0f, 1e-4f);
+    }
+
+    rotate_points(rotation, input.view(), output.view());
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        EXPECT_NEAR(output.x[i], -input.y[i], 1e-4f);
+        EXPECT_NEAR(output.y[i], input.x[i], 1e-4f);
+    }
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestBatchTransform class
+ * @param TestNormalizeDirections method
+ */
+TEST(TestBatchTransform, TestNormalizeDirections)
+{
+    std::mt19937 generator(17);
+    SoaPoints directions = random_soa_points(generator, 21);
+
+    normalize_directions(directions.view(), directions.view());
+
+    for (std::size_t i = 0; i < 21; ++i)
+    {
+        Vec3 direction(directions.x[i], directions.y[i], directions.z[i]);
+        EXPECT_NEAR(direction.magnitude(), 1.0f, 1e-5f);
+    }
+
+    // The scalar tail scales exactly like the vector body
+    constexpr std::size_t count = 2 * Simd::WideFloat::width + 3;
+    SoaPoints same(count);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        same.x[i] = 0.3f;
+        same.y[i] = -1.7f;
+        same.z[i] = 2.9f;
+    }
+
+    normalize_directions(same.view(), same.view());
+
+    for (std::size_t i = 1; i < count; ++i)
+    {
+        EXPECT_EQ(same.x[i], same.x[0]);
+        EXPECT_EQ(same.y[i], same.y[0]);
+        EXPECT_EQ(same.z[i], same.z[0]);
+    }
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestBatchTransform class
+ * @param TestLayoutConversion method
+ */
+TEST(TestBatchTransform, TestLayoutConversion)
+{
+    std::vector<Vec3> points = {Vec3(1.0f, 2.0f, 3.0f), Vec3(4.0f, 5.0f, 6.0f),
+                                Vec3(7.0f, 8.0f, 9.0f)};
+    SoaPoints soa(points.size());
+
+    aos_to_soa(points, soa.view());
+    EXPECT_EQ(soa.y, std::vector<float>({2.0f, 5.0f, 8.0f}));
+
+    std::vector<Vec3> round_trip(points.size());
+    soa_to_aos(soa.view(), round_trip);
+    EXPECT_EQ(round_trip, points);
+
+    // Position at offset 1 of five-float records
+    std::vector<float> records = {0, 1, 2, 3, 0, 0, 4, 5, 6, 0, 0, 7, 8, 9, 0};
+    SoaPoints gathered(3);
+
+    aos_to_soa(records, 5, 1, gathered.view());
+    EXPECT_EQ(gathered.x, std::vector<float>({1.0f, 4.0f, 7.0f}));
+    EXPECT_EQ(gathered.z, std::vector<float>({3.0f, 6.0f, 9.0f}));
+
+    std::vector<float> scattered(records.size(), 0.0f);
+    soa_to_aos(gathered.view(), scattered, 5, 1);
+    EXPECT_EQ(scattered, records);
+
+    EXPECT_THROW(aos_to_soa(records, 3, 1, gathered.view()), std::invalid_argument);
+}
+
+#endif //! BATCH_TRANSFORM_TEST_H
@@ -0,0 +1,192 @@
+/**
+ * @file binary_format.test.h
+ * @author Carlos Salguero
+ * @brief Test class for the zero-copy binary format
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef BINARY_FORMAT_TEST_H
+#define BINARY_FORMAT_TEST_H
+
+// C++ Standard Library
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Google Test Library
+#include <gtest/gtest.h>
+
+// Project headers
+#include "src/serialization/binary_format.h"
+#include "src/serialization/engine_types.h"
+#include "src/serialization/mapped_file.h"
+
+namespace
+{
+    struct StoredLevel
+    {
+        Serialization::RelativeString name;
+        Serialization::stored_t<Color<float>> tint;
+        Serialization::stored_t<Math::Vector<float>> heights;
+        Serialization::stored_t<std::vector<std::string>> tags;
+        std::uint32_t seed;
+    };
+
+    struct StoredSave
+    {
+        std::uint32_t slot;
+        std::uint32_t score;
+    };
+
+    /**
+     * @brief
+     * Writes a level with every kind of stored member
+     * @return std::string Binary file of the level
+     */
+    std::string write_level()
+    {
+        using namespace Serialization;
+
+        BinaryWriter writer;
+        auto root = writer.write(StoredLevel{});
+
+        store_field(writer, root, &StoredLevel::name, std::string("Cavern"));
+        store_field(writer, root, &StoredLevel::tint, Color<float>(0.25f, 0.5f, 0.75f, 1.0f));
+        store_field(writer, root, &StoredLevel::heights, Math::Vector<float>{1.5f, -2.0f, 8.0f});
+        store_field(writer, root, &StoredLevel::tags, std::vector<std::string>{"dark", "", "wet"});
+        writer.get(root).seed = 42;
+
+        return writer.finish(root);
+    }
+
+    /**
+     * @brief
+     * Overwrites a 32-bit integer of the header
+     * @param data Binary file
+     * @param offset Offset of the integer
+     * @param value Value to write
+     */
+    void write_header_field(std::string &data, std::size_t offset, std::uint32_t value)
+    {
+        std::memcpy(data.data() + offset, &value, sizeof(value));
+    }
+}
+
+SERIALIZATION_SCHEMA(StoredLevel, 1);
+SERIALIZATION_SCHEMA(StoredSave, 1);
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestBinaryFormat class
+ * @param TestRoundTrip method
+ */
+TEST(TestBinaryFormat, TestRoundTrip)
+{
+    using namespace Serialization;
+
+    auto data = write_level();
+    EXPECT_EQ(data.size() % MAX_ALIGNMENT, 0u);
+
+    auto file = MappedFile::from_bytes(data);
+    const auto *level = file.root<StoredLevel>();
+
+    EXPECT_EQ(level->name.view(), "Cavern");
+    EXPECT_STREQ(level->name.c_str(), "Cavern");
+    EXPECT_EQ(level->seed, 42u);
+    EXPECT_FLOAT_EQ(level->tint.blue, 0.75f);
+
+    ASSERT_EQ(level->heights.size(), 3u);
+    EXPECT_FLOAT_EQ(level->heights[1], -2.0f);
+
+    auto tags = Serializer<std::vector<std::string>>::load(level->tags);
+    EXPECT_EQ(tags, (std::vector<std::string>{"dark", "", "wet"}));
+
+    auto heights = Serializer<Math::Vector<float>>::load(level->heights);
+    ASSERT_EQ(heights.size(), 3u);
+    EXPECT_FLOAT_EQ(heights[2], 8.0f);
+    EXPECT_FLOAT_EQ(Serializer<Color<float>>::load(level->tint).get_green(), 0.5f);
+
+    // The relative pointers hold wherever the file is loaded
+    auto path = (std::filesystem::temp_directory_path() /
+                 ("binary_format_test_" + std::to_string(::testing::UnitTest::GetInstance()->random_seed()) + ".bin"))
+                    .string();
+
+    {
+        std::ofstream output(path, std::ios::binary | std::ios::trunc);
+        output.write(data.data(), static_cast<std::streamsize>(data.size()));
+    }
+
+    {
+        MappedFile mapped(path);
+        ASSERT_EQ(mapped.size(), data.size());
+        EXPECT_EQ(mapped.root<StoredLevel>()->name.view(), "Cavern");
+        EXPECT_EQ(mapped.root<StoredLevel>()->tags[2].view(), "wet");
+    }
+
+    std::filesystem::remove(path);
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestBinaryFormat class
+ * @param TestRejectedFiles method
+ */
+TEST(TestBinaryFormat, TestRejectedFiles)
+{
+    using namespace Serialization;
+
+    auto data = write_level();
+    auto file = MappedFile::from_bytes(data);
+
+    // A root of another schema, and the same name at another version
+    EXPECT_THROW(file.root<StoredSave>(), std::runtime_error);
+    EXPECT_NE(schema_hash("StoredLevel", 1, sizeof(StoredLevel)),
+              schema_hash("StoredLevel", 2, sizeof(StoredLevel)));
+    EXPECT_NE(schema_hash("StoredLevel", 1, sizeof(StoredLevel)),
+              schema_hash("StoredLevel", 1, sizeof(StoredLevel) + 4));
+
+    auto expect_rejected = [](const std::string &corrupted)
+    {
+        auto copy = MappedFile::from_bytes(corrupted);
+        EXPECT_THROW(copy.root<StoredLevel>(), std::runtime_error);
+    };
+
+    std::string corrupted = data;
+    corrupted[0] = 'X';
+    expect_rejected(corrupted);
+
+    corrupted = data;
+    write_header_field(corrupted, offsetof(BinaryHeader, version), FORMAT_VERSION + 1);
+    expect_rejected(corrupted);
+
+    corrupted = data;
+    write_header_field(corrupted, offsetof(BinaryHeader, schema), SchemaInfo<StoredSave>::hash);
+    expect_rejected(corrupted);
+
+    corrupted = data;
+    write_header_field(corrupted, offsetof(BinaryHeader, root), static_cast<std::uint32_t>(data.size()));
+    expect_rejected(corrupted);
+
+    corrupted = data;
+    write_header_field(corrupted, offsetof(BinaryHeader, root), HEADER_SIZE + 1);
+    expect_rejected(corrupted);
+
+    expect_rejected(data.substr(0, data.size() - MAX_ALIGNMENT));
+    expect_rejected(data.substr(0, HEADER_SIZE - 1));
+
+    EXPECT_THROW(get_root<StoredLevel>(file.data() + 1, file.size() - 1), std::runtime_error);
+    EXPECT_NO_THROW(get_root<StoredLevel>(file.data(), file.size()));
+}
+
+#endif //! BINARY_FORMAT_TEST_H
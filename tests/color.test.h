@@ -0,0 +1,620 @@
+/**
+ * @file color.test.h
+ * @author Carlos Salguero
+ * @brief Test class for the packed colors, the color spaces and the color
+ *        buffer and compositing kernels
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef COLOR_TEST_H
+#define COLOR_TEST_H
+
+// C++ Standard Library
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+// Google Test Library
+#include <gtest/gtest.h>
+
+// Project headers
+#include "src/utils/color/color.h"
+#include "src/utils/color/color32.h"
+#include "src/utils/color/color_kernels.h"
+#include "src/utils/color/color_space.h"
+#include "src/utils/color/composite.h"
+
+using namespace Math;
+
+namespace
+{
+    /**
+     * @brief
+     * Creates float channels in [-0.25, 1.25], so the clamps are exercised
+     * @param count Number of channels
+     * @param seed Seed of the generator
+     * @return std::vector<float> The channels
+     */
+    std::vector<float> make_float_channels(std::size_t count, unsigned seed)
+    {
+        std::mt19937 generator(seed);
+        std::uniform_real_distribution<float> distribution(-0.25f, 1.25f);
+        std::vector<float> channels(count);
+
+        for (auto &channel : channels)
+            channel = distribution(generator);
+
+        return channels;
+    }
+
+    /**
+     * @brief
+     * Creates random 8-bit channels
+     * @param count Number of channels
+     * @param seed Seed of the generator
+     * @return std::vector<std::uint8_t> The channels
+     */
+    std::vector<std::uint8_t> make_byte_channels(std::size_t count, unsigned seed)
+    {
+        std::mt19937 generator(seed);
+        std::vector<std::uint8_t> channels(count);
+
+        for (auto &channel : channels)
+            channel = static_cast<std::uint8_t>(generator());
+
+        return channels;
+    }
+
+    /**
+     * @brief
+     * Blends two premultiplied colors with the Color operators
+     * @param mode The blend mode
+     * @param s The source color
+     * @param d The destination color
+     * @return Color<float> The blended color
+     */
+    Color<float> blend_colors(BlendMode mode, const Color<float> &s, const Color<float> &d)
+    {
+        Color<float> one(1.0f, 1.0f, 1.0f, 1.0f);
+        Color<float> sa(s.get_alpha(), s.get_alpha(), s.get_alpha(), s.get_alpha());
+        Color<float> da(d.get_alpha(), d.get_alpha(), d.get_alpha(), d.get_alpha());
+
+        switch (mode)
+        {
+        case BlendMode::SourceOver:
+            return s + d * (one - sa);
+        case BlendMode::Additive:
+            return s + d;
+        case BlendMode::Multiply:
+            return s * d + s * (one - da) + d * (one - sa);
+        default:
+            return s + d - s * d;
+        }
+    }
+
+    /**
+     * @brief
+     * Creates premultiplied float pixels: random straight colors multiplied
+     * by their alpha
+     * @param count Number of pixels
+     * @param seed Seed of the generator
+     * @return std::vector<float> The pixels
+     */
+    std::vector<float> make_premultiplied(std::size_t count, unsigned seed)
+    {
+        std::mt19937 generator(seed);
+        std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+        std::vector<float> pixels(count * 4);
+
+        for (std::size_t i = 0; i < pixels.size(); i += 4)
+        {
+            float alpha = distribution(generator);
+
+            for (std::size_t c = 0; c < 3; ++c)
+                pixels[i + c] = distribution(generator) * alpha;
+
+            pixels[i + 3] = alpha;
+        }
+
+        return pixels;
+    }
+
+    /**
+     * @brief
+     * Converts one RGB color to HSV with the textbook branches
+     * @param r Red channel
+     * @param g Green channel
+     * @param b Blue channel
+     * @return std::array<float, 3> Hue in turns, saturation and value
+     */
+    std::array<float, 3> reference_hsv(float r, float g, float b)
+    {
+        float max = std::max({r, g, b});
+        float chroma = max - std::min({r, g, b});
+        float hue = 0.0f;
+
+        if (chroma > 0.0f)
+        {
+            if (max == r)
+                hue = std::fmod((g - b) / chroma + 6.0f, 6.0f);
+            else if (max == g)
+                hue = (b - r) / chroma + 2.0f;
+            else
+                hue = (r - g) / chroma + 4.0f;
+        }
+
+        return {hue / 6.0f, max > 0.0f ? chroma / max : 0.0f, max};
+    }
+
+    const std::array<BlendMode, 4> blend_modes = {BlendMode::SourceOver, BlendMode::Additive,
+                                                  BlendMode::Multiply, BlendMode::Screen};
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestColorKernels class
+ * @param TestUnorm8 method
+ */
+TEST(TestColorKernels, TestUnorm8)
+{
+    std::vector<std::uint8_t> bytes(256);
+
+    for (std::size_t i = 0; i < bytes.size(); ++i)
+        bytes[i] = static_cast<std::uint8_t>(i);
+
+    std::vector<float> floats(bytes.size());
+    std::vector<std::uint8_t> round_trip(bytes.size());
+
+    unorm8_to_float(bytes, floats);
+    float_to_unorm8(floats, round_trip);
+
+    EXPECT_EQ(round_trip, bytes);
+    EXPECT_FLOAT_EQ(floats[255], 1.0f);
+    EXPECT_FLOAT_EQ(floats[51], 0.2f);
+
+    // An odd length runs both the SIMD loop and the scalar tail
+    auto channels = make_float_channels(1003, 5);
+    channels[0] = std::numeric_limits<float>::quiet_NaN();
+    channels[1] = 0.5f / 255.0f;
+
+    std::vector<std::uint8_t> packed(channels.size());
+    float_to_unorm8(channels, packed);
+
+    for (std::size_t i = 0; i < channels.size(); ++i)
+    {
+        float clamped = std::isnan(channels[i]) ? 0.0f : std::fmin(std::fmax(channels[i], 0.0f), 1.0f);
+        ASSERT_EQ(packed[i], static_cast<std::uint8_t>(clamped * 255.0f + 0.5f)) << channels[i];
+    }
+
+    std::vector<float> short_destination(3);
+    EXPECT_THROW(unorm8_to_float(bytes, short_destination), std::invalid_argument);
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestColorKernels class
+ * @param TestSrgb method
+ */
+TEST(TestColorKernels, TestSrgb)
+{
+    auto encoded = make_byte_channels(4 * 251, 7);
+    std::vector<float> linear(encoded.size());
+
+    srgb8_to_linear(encoded, linear);
+
+    for (std::size_t i = 0; i < encoded.size(); ++i)
+    {
+        float expected = i % 4 == 3 ? encoded[i] * (1.0f / 255.0f) : srgb8_to_linear(encoded[i]);
+        ASSERT_EQ(linear[i], expected) << i;
+    }
+
+    // Every 8-bit value survives the trip through linear
+    std::vector<std::uint8_t> round_trip(encoded.size());
+    linear_to_srgb8(linear, round_trip);
+
+    EXPECT_EQ(round_trip, encoded);
+
+    // NaN encodes as black in every color channel, never past the table
+    float nan = std::numeric_limits<float>::quiet_NaN();
+    EXPECT_EQ(linear_to_srgb8(nan), 0);
+    EXPECT_EQ(linear_to_srgb8(-nan), 0);
+
+    auto channels = make_float_channels(4 * 251, 11);
+    channels[0] = nan;
+    channels[5] = -nan;
+    std::vector<std::uint8_t> result(channels.size());
+
+    linear_to_srgb8(channels, result);
+    EXPECT_EQ(result[0], 0);
+    EXPECT_EQ(result[5], 0);
+
+    for (std::size_t i = 0; i < channels.size(); ++i)
+    {
+        std::uint8_t expected = i % 4 == 3 ? Detail::to_unorm8(channels[i]) : linear_to_srgb8(channels[i]);
+        ASSERT_EQ(result[i], expected) << channels[i];
+    }
+
+    std::vector<float> partial_pixel(6);
+    std::vector<std::uint8_t> partial_result(6);
+    EXPECT_THROW(linear_to_srgb8(partial_pixel, partial_result), std::invalid_argument);
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestColorKernels class
+ * @param TestPremultiply method
+ */
+TEST(TestColorKernels, TestPremultiply)
+{
+    auto pixels = make_float_channels(4 * 37, 13);
+
+    for (std::size_t i = 3; i < pixels.size(); i += 4)
+        pixels[i] = std::fabs(pixels[i]);
+
+    pixels[3] = 0.0f;
+
+    auto premultiplied = pixels;
+    premultiply_alpha(std::span<float>(premultiplied));
+
+    for (std::size_t i = 0; i < pixels.size(); ++i)
+    {
+        float alpha = pixels[i - i % 4 + 3];
+        ASSERT_EQ(premultiplied[i], i % 4 == 3 ? alpha : pixels[i] * alpha);
+    }
+
+    auto restored = premultiplied;
+    unpremultiply_alpha(std::span<float>(restored));
+
+    for (std::size_t i = 4; i < pixels.size(); ++i)
+        ASSERT_NEAR(restored[i], pixels[i], 1e-5f);
+
+    EXPECT_EQ(restored[0], 0.0f);
+    EXPECT_EQ(restored[3], 0.0f);
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestColorKernels class
+ * @param TestPremultiplyBytes method
+ */
+TEST(TestColorKernels, TestPremultiplyBytes)
+{
+    // Every pair of channel and alpha, plus one pixel for the scalar tail
+    std::vector<std::uint8_t> pixels;
+
+    for (std::uint32_t alpha = 0; alpha < 256; ++alpha)
+        for (std::uint32_t value = 0; value < 256; value += 3)
+            pixels.insert(pixels.end(), {static_cast<std::uint8_t>(value), static_cast<std::uint8_t>(value + 1),
+                                         static_cast<std::uint8_t>(value + 2), static_cast<std::uint8_t>(alpha)});
+
+    pixels.insert(pixels.end(), {200, 100, 50, 128});
+
+    auto premultiplied = pixels;
+    premultiply_alpha(std::span<std::uint8_t>(premultiplied));
+
+    for (std::size_t i = 0; i < pixels.size(); ++i)
+    {
+        std::uint32_t alpha = pixels[i - i % 4 + 3];
+        auto expected = i % 4 == 3 ? alpha : static_cast<std::uint32_t>(std::lround(pixels[i] * alpha / 255.0));
+        ASSERT_EQ(premultiplied[i], expected) << int(pixels[i]) << " " << alpha;
+    }
+
+    // Opaque pixels are unchanged both ways, transparent ones become zero
+    unpremultiply_alpha(std::span<std::uint8_t>(premultiplied));
+
+    for (std::size_t i = 0; i < pixels.size(); i += 4)
+    {
+        if (pixels[i + 3] == 255)
+        {
+            ASSERT_EQ(premultiplied[i], pixels[i]);
+        }
+        else if (pixels[i + 3] == 0)
+        {
+            ASSERT_EQ(premultiplied[i], 0);
+        }
+        else
+        {
+            ASSERT_NEAR(premultiplied[i], pixels[i], 255.0 / pixels[i + 3]);
+        }
+    }
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestColorKernels class
+ * @param TestSwizzle method
+ */
+TEST(TestColorKernels, TestSwizzle)
+{
+    auto rgba = make_byte_channels(4 * 19, 17);
+    std::vector<std::uint8_t> bgra(rgba.size());
+
+    swizzle_channels<2, 1, 0, 3>(rgba, bgra);
+
+    for (std::size_t i = 0; i < rgba.size(); i += 4)
+    {
+        ASSERT_EQ(bgra[i], rgba[i + 2]);
+        ASSERT_EQ(bgra[i + 1], rgba[i + 1]);
+        ASSERT_EQ(bgra[i + 2], rgba[i]);
+        ASSERT_EQ(bgra[i + 3], rgba[i + 3]);
+    }
+
+    // In place, back to RGBA
+    swizzle_channels<2, 1, 0, 3>(bgra, bgra);
+    EXPECT_EQ(bgra, rgba);
+
+    // Broadcasting alpha to every channel
+    swizzle_channels<3, 3, 3, 3>(rgba, bgra);
+    EXPECT_EQ(bgra[4 * 18], rgba[4 * 18 + 3]);
+    EXPECT_EQ(bgra[4 * 18 + 2], rgba[4 * 18 + 3]);
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestColorKernels class
+ * @param TestComposite method
+ */
+TEST(TestColorKernels, TestComposite)
+{
+    auto source = make_premultiplied(29, 19);
+    auto background = make_premultiplied(29, 23);
+
+    for (auto mode : blend_modes)
+    {
+        auto destination = background;
+        composite(mode, source, destination);
+
+        for (std::size_t i = 0; i < source.size(); i += 4)
+        {
+            Color<float> s(source[i], source[i + 1], source[i + 2], source[i + 3]);
+            Color<float> d(background[i], background[i + 1], background[i + 2], background[i + 3]);
+            Color<float> expected = blend_colors(mode, s, d);
+
+            ASSERT_FLOAT_EQ(destination[i], expected.get_red());
+            ASSERT_FLOAT_EQ(destination[i + 1], expected.get_green());
+            ASSERT_FLOAT_EQ(destination[i + 2], expected.get_blue());
+            ASSERT_FLOAT_EQ(destination[i + 3], expected.get_alpha());
+        }
+    }
+
+    // An opaque source hides the destination, a transparent one keeps it
+    std::vector<float> opaque = {0.25f, 0.5f, 0.75f, 1.0f};
+    std::vector<float> clear = {0.0f, 0.0f, 0.0f, 0.0f};
+    std::vector<float> pixel = {0.1f, 0.2f, 0.3f, 0.4f};
+
+    composite(BlendMode::SourceOver, clear, pixel);
+    EXPECT_EQ(pixel, (std::vector<float>{0.1f, 0.2f, 0.3f, 0.4f}));
+
+    composite(BlendMode::SourceOver, opaque, pixel);
+    EXPECT_EQ(pixel, opaque);
+
+    std::vector<float> partial_pixel(6);
+    EXPECT_THROW(composite(BlendMode::Screen, partial_pixel, partial_pixel), std::invalid_argument);
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestColorKernels class
+ * @param TestCompositeBytes method
+ */
+TEST(TestColorKernels, TestCompositeBytes)
+{
+    auto source_floats = make_premultiplied(37, 29);
+    auto background_floats = make_premultiplied(37, 31);
+
+    std::vector<std::uint8_t> source(source_floats.size());
+    std::vector<std::uint8_t> background(background_floats.size());
+
+    float_to_unorm8(source_floats, source);
+    float_to_unorm8(background_floats, background);
+
+    for (auto mode : blend_modes)
+    {
+        auto destination = background;
+        composite(mode, source, destination);
+
+        // Each rounded product is off by at most half a unit
+        int tolerance = mode == BlendMode::Multiply ? 2 : 1;
+
+        for (std::size_t i = 0; i < source.size(); i += 4)
+        {
+            Color<float> s(source[i] / 255.0f, source[i + 1] / 255.0f, source[i + 2] / 255.0f,
+                           source[i + 3] / 255.0f);
+            Color<float> d(background[i] / 255.0f, background[i + 1] / 255.0f,
+                           background[i + 2] / 255.0f, background[i + 3] / 255.0f);
+            Color<float> expected = blend_colors(mode, s, d);
+
+            ASSERT_NEAR(destination[i], Detail::to_unorm8(expected.get_red()), tolerance);
+            ASSERT_NEAR(destination[i + 1], Detail::to_unorm8(expected.get_green()), tolerance);
+            ASSERT_NEAR(destination[i + 2], Detail::to_unorm8(expected.get_blue()), tolerance);
+            ASSERT_NEAR(destination[i + 3], Detail::to_unorm8(expected.get_alpha()), tolerance);
+
+            // The SIMD loop agrees with the scalar one on the same pixel
+            std::vector<std::uint8_t> single(background.begin() + i, background.begin() + i + 4);
+            composite(mode, std::span<const std::uint8_t>(source).subspan(i, 4), single);
+
+            ASSERT_TRUE(std::equal(single.begin(), single.end(), destination.begin() + i));
+        }
+    }
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestColor32 class
+ * @param TestPacking method
+ */
+TEST(TestColor32, TestPacking)
+{
+    constexpr Color32 orange(255, 128, 0, 200);
+
+    static_assert(orange.to_argb() == 0xc8ff8000u);
+    static_assert(orange.to_rgba() == 0xff8000c8u);
+    static_assert(Color32::from_argb(0xc8ff8000u) == orange);
+    static_assert(Color32::from_rgba(0xff8000c8u) == orange);
+    static_assert(Color32(1, 2, 3).get_alpha() == 255);
+
+    // The bytes in memory are in R, G, B, A order
+    auto bytes = std::bit_cast<std::array<std::uint8_t, 4>>(orange);
+    EXPECT_EQ(bytes, (std::array<std::uint8_t, 4>{255, 128, 0, 200}));
+    EXPECT_EQ(Color32::from_packed(orange.packed()), orange);
+
+    Color32 color = orange;
+    color.set_green(7);
+    color.set_alpha(255);
+    EXPECT_EQ(color, Color32(255, 7, 0));
+
+    Color<float> wide(1.5f, 0.5f, -1.0f, 0.2f);
+    EXPECT_EQ(Color32(wide), Color32(255, 128, 0, 51));
+    EXPECT_FLOAT_EQ(Color32(wide).to_color().get_alpha(), 0.2f);
+
+    std::vector<Color<float>> colors;
+
+    for (int i = 0; i < 21; ++i)
+        colors.emplace_back(i / 20.0f, 1.0f - i / 20.0f, 0.5f, 1.0f);
+
+    std::vector<Color32> packed(colors.size());
+    std::vector<Color<float>> unpacked(colors.size());
+
+    pack_colors(colors, packed);
+    unpack_colors(packed, unpacked);
+
+    for (std::size_t i = 0; i < colors.size(); ++i)
+    {
+        ASSERT_EQ(packed[i], Color32(colors[i]));
+        ASSERT_EQ(unpacked[i], packed[i].to_color());
+        ASSERT_NEAR(unpacked[i].get_red(), colors[i].get_red(), 0.501f / 255.0f);
+    }
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestColorSpaces class
+ * @param TestHsv method
+ */
+TEST(TestColorSpaces, TestHsv)
+{
+    std::vector<float> primaries = {1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f, 0.5f,
+                                    0.0f, 0.0f, 0.5f, 0.0f, 0.5f, 0.5f, 0.5f, 1.0f,
+                                    1.0f, 0.0f, 1.0f, 1.0f};
+    std::vector<float> hsv(primaries.size());
+
+    rgb_to_hsv(primaries, hsv);
+
+    EXPECT_EQ(hsv, (std::vector<float>{0.0f, 1.0f, 1.0f, 1.0f, 1.0f / 3.0f, 1.0f, 1.0f, 0.5f,
+                                       2.0f / 3.0f, 1.0f, 0.5f, 0.0f, 0.0f, 0.0f, 0.5f, 1.0f,
+                                       5.0f / 6.0f, 1.0f, 1.0f, 1.0f}));
+
+    auto pixels = make_float_channels(4 * 103, 37);
+
+    for (auto &channel : pixels)
+        channel = std::fabs(channel) / 1.25f;
+
+    rgb_to_hsv(pixels, hsv = std::vector<float>(pixels.size()));
+
+    std::vector<float> rgb(pixels.size());
+    hsv_to_rgb(hsv, rgb);
+
+    for (std::size_t i = 0; i < pixels.size(); i += 4)
+    {
+        auto expected = reference_hsv(pixels[i], pixels[i + 1], pixels[i + 2]);
+
+        ASSERT_NEAR(hsv[i], expected[0], 1e-6f);
+        ASSERT_NEAR(hsv[i + 1], expected[1], 1e-6f);
+        ASSERT_EQ(hsv[i + 2], expected[2]);
+        ASSERT_EQ(hsv[i + 3], pixels[i + 3]);
+
+        for (std::size_t c = 0; c < 4; ++c)
+            ASSERT_NEAR(rgb[i + c], pixels[i + c], 1e-5f);
+    }
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestColorSpaces class
+ * @param TestHsl method
+ */
+TEST(TestColorSpaces, TestHsl)
+{
+    std::vector<float> colors = {1.0f, 0.0f, 0.0f, 1.0f, 0.5f, 1.0f, 0.5f, 1.0f,
+                                 0.25f, 0.25f, 0.25f, 0.0f};
+    std::vector<float> hsl(colors.size());
+
+    rgb_to_hsl(colors, hsl);
+
+    EXPECT_EQ(hsl, (std::vector<float>{0.0f, 1.0f, 0.5f, 1.0f, 1.0f / 3.0f, 1.0f, 0.75f, 1.0f,
+                                       0.0f, 0.0f, 0.25f, 0.0f}));
+
+    auto pixels = make_float_channels(4 * 103, 41);
+
+    for (auto &channel : pixels)
+        channel = std::fabs(channel) / 1.25f;
+
+    hsl.resize(pixels.size());
+    rgb_to_hsl(pixels, hsl);
+
+    std::vector<float> rgb(pixels.size());
+    hsl_to_rgb(hsl, rgb);
+
+    for (std::size_t i = 0; i < pixels.size(); i += 4)
+    {
+        // HSL and HSV share the hue
+        auto hsv = reference_hsv(pixels[i], pixels[i + 1], pixels[i + 2]);
+        ASSERT_NEAR(hsl[i], hsv[0], 1e-6f);
+
+        for (std::size_t c = 0; c < 4; ++c)
+            ASSERT_NEAR(rgb[i + c], pixels[i + c], 1e-5f);
+    }
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestColorSpaces class
+ * @param TestYCoCg method
+ */
+TEST(TestColorSpaces, TestYCoCg)
+{
+    std::vector<float> colors = {1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 0.0f, 0.0f, 0.5f,
+                                 0.0f, 1.0f, 0.0f, 0.25f};
+    std::vector<float> ycocg(colors.size());
+
+    rgb_to_ycocg(colors, ycocg);
+
+    EXPECT_EQ(ycocg, (std::vector<float>{1.0f, 0.0f, 0.0f, 1.0f, 0.25f, 0.5f, -0.25f, 0.5f,
+                                         0.5f, 0.0f, 0.5f, 0.25f}));
+
+    auto pixels = make_float_channels(4 * 103, 43);
+
+    ycocg.resize(pixels.size());
+    rgb_to_ycocg(pixels, ycocg);
+
+    std::vector<float> rgb(pixels.size());
+    ycocg_to_rgb(ycocg, rgb);
+
+    for (std::size_t i = 0; i < pixels.size(); ++i)
+        ASSERT_NEAR(rgb[i], pixels[i], 1e-6f);
+
+    std::vector<float> partial_pixel(5);
+    EXPECT_THROW(ycocg_to_rgb(partial_pixel, partial_pixel), std::invalid_argument);
+}
+
+#endif //! COLOR_TEST_H
@@ -0,0 +1,346 @@
+/**
+ * @file decomposition.test.h
+ * @author Carlos Salguero
+ * @brief Test class for the matrix decompositions and solvers
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef DECOMPOSITION_TEST_H
+#define DECOMPOSITION_TEST_H
+
+// C++ Standard Library
+#include <cmath>
+#include <random>
+
+// Google Test Library
+#include <gtest/gtest.h>
+
+// Project headers
+#include "src/utils/math/decomposition.h"
+#include "src/utils/math/quaternion.h"
+
+using namespace Math;
+
+namespace
+{
+    /**
+     * @brief
+     * Creates a matrix with uniformly distributed elements in [-1, 1]
+     * @tparam Layout Storage order of the matrix
+     * @param rows Number of rows
+     * @param cols Number of columns
+     * @param generator The random generator
+     * @return Matrix<double, Layout> The random matrix
+     */
+    template <MatrixLayout Layout = MatrixLayout::RowMajor>
+    Matrix<double, Layout> random_dense_matrix(std::size_t rows, std::size_t cols,
+                                               std::mt19937 &generator)
+    {
+        std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+        Matrix<double, Layout> result(rows, cols);
+
+        for (std::size_t i = 0; i < rows; ++i)
+            for (std::size_t j = 0; j < cols; ++j)
+                result(i, j) = distribution(generator);
+
+        return result;
+    }
+
+    /**
+     * @brief
+     * Creates a random symmetric positive definite matrix, A^T A + n I
+     */
+    Matrix<double> random_spd_matrix(std::size_t size, std::mt19937 &generator)
+    {
+        Matrix<double> a = random_dense_matrix(size, size, generator);
+        Matrix<double> result(size, size);
+
+        for (std::size_t i = 0; i < size; ++i)
+            for (std::size_t j = 0; j < size; ++j)
+            {
+                double sum = i == j ? double(size) : 0.0;
+
+                for (std::size_t k = 0; k < size; ++k)
+                    sum += a(k, i) * a(k, j);
+
+                result(i, j) = sum;
+            }
+
+        return result;
+    }
+
+    /**
+     * @brief
+     * Creates a random vector with elements in [-1, 1]
+     */
+    Vector<double> random_dense_vector(std::size_t size, std::mt19937 &generator)
+    {
+        std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+        Vector<double> result(size);
+
+        for (std::size_t i = 0; i < size; ++i)
+            result[i] = distribution(generator);
+
+        return result;
+    }
+
+    /**
+     * @brief
+     * Calculates the largest element of |A x - b|
+     */
+    template <MatrixLayout Layout>
+    double residual(const Matrix<double, Layout> &a, const Vector<double> &x,
+                    const Vector<double> &b)
+    {
+        double result = 0.0;
+
+        for (std::size_t i = 0; i < a.rows(); ++i)
+        {
+            double sum = -b[i];
+
+            for (std::size_t j = 0; j < a.cols(); ++j)
+                sum += a(i, j) * x[j];
+
+            result = std::max(result, std::abs(sum));
+        }
+
+        return result;
+    }
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestDecomposition class
+ * @param TestLuSolve method
+ */
+TEST(TestDecomposition, TestLuSolve)
+{
+    std::mt19937 generator(11);
+
+    // Sizes around the panel width exercise the blocked update and the tail
+    for (std::size_t size : {1u, 3u, 17u, 64u, 100u, 150u})
+    {
+        Matrix<double> a = random_dense_matrix(size, size, generator);
+        Vector<double> b = random_dense_vector(size, generator);
+        LuDecomposition<double> lu(a);
+
+        ASSERT_FALSE(lu.is_singular());
+        EXPECT_LT(residual(a, lu.solve(b), b), 1e-9);
+
+        Matrix<double> identity = a * lu.inverse();
+
+        for (std::size_t i = 0; i < size; ++i)
+            for (std::size_t j = 0; j < size; ++j)
+                EXPECT_NEAR(identity(i, j), i == j ? 1.0 : 0.0, 1e-9);
+    }
+
+    // A column-major matrix and several right-hand sides
+    auto a = random_dense_matrix<MatrixLayout::ColumnMajor>(70, 70, generator);
+    auto b = random_dense_matrix<MatrixLayout::ColumnMajor>(70, 5, generator);
+    auto x = LuDecomposition<double>(a).solve(b);
+    Matrix<double, MatrixLayout::ColumnMajor> product = a * x;
+
+    for (std::size_t i = 0; i < 70; ++i)
+        for (std::size_t j = 0; j < 5; ++j)
+            EXPECT_NEAR(product(i, j), b(i, j), 1e-9);
+
+    EXPECT_THROW(LuDecomposition<double>(Matrix<double>(2, 3)), std::invalid_argument);
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestDecomposition class
+ * @param TestLuDeterminant method
+ */
+TEST(TestDecomposition, TestLuDeterminant)
+{
+    std::mt19937 generator(12);
+    Matrix<double> a = random_dense_matrix(4, 4, generator);
+    Mat<4, 4, double> fixed = Mat<4, 4, double>::from_matrix(a);
+
+    EXPECT_NEAR(determinant(a), fixed.determinant(), 1e-12);
+
+    // Swapping two rows flips the sign
+    Matrix<double> swapped = a;
+
+    for (std::size_t j = 0; j < 4; ++j)
+        std::swap(swapped(0, j), swapped(2, j));
+
+    EXPECT_NEAR(determinant(swapped), -fixed.determinant(), 1e-12);
+
+    // A repeated row makes the matrix singular
+    Matrix<double> singular = a;
+
+    for (std::size_t j = 0; j < 4; ++j)
+        singular(3, j) = singular(1, j);
+
+    LuDecomposition<double> lu(singular);
+
+    EXPECT_TRUE(lu.is_singular());
+    EXPECT_EQ(lu.determinant(), 0.0);
+    EXPECT_THROW(lu.solve(Vector<double>(4)), std::invalid_argument);
+    EXPECT_THROW(lu.inverse(), std::invalid_argument);
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestDecomposition class
+ * @param TestCholesky method
+ */
+TEST(TestDecomposition, TestCholesky)
+{
+    std::mt19937 generator(13);
+
+    for (std::size_t size : {1u, 5u, 40u})
+    {
+        Matrix<double> a = random_spd_matrix(size, generator);
+        Vector<double> b = random_dense_vector(size, generator);
+        CholeskyDecomposition<double> cholesky(a);
+
+        EXPECT_LT(residual(a, cholesky.solve(b), b), 1e-10);
+        EXPECT_NEAR(cholesky.determinant() / determinant(a), 1.0, 1e-10);
+
+        // L L^T rebuilds A and L is lower triangular
+        const Matrix<double> &l = cholesky.lower();
+
+        for (std::size_t i = 0; i < size; ++i)
+            for (std::size_t j = 0; j < size; ++j)
+            {
+                double sum = 0.0;
+
+                for (std::size_t k = 0; k < size; ++k)
+                    sum += l(i, k) * l(j, k);
+
+                EXPECT_NEAR(sum, a(i, j), 1e-10);
+
+                if (j > i)
+                {
+                    EXPECT_EQ(l(i, j), 0.0);
+                }
+            }
+    }
+
+    Matrix<double> indefinite(2, 2);
+    indefinite(0, 0) = 1.0;
+    indefinite(1, 1) = -1.0;
+
+    EXPECT_THROW(CholeskyDecomposition<double>{indefinite}, std::invalid_argument);
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestDecomposition class
+ * @param TestQr method
+ */
+TEST(TestDecomposition, TestQr)
+{
+    std::mt19937 generator(14);
+    Matrix<double> a = random_dense_matrix(30, 8, generator);
+    QrDecomposition<double> qr(a);
+    Matrix<double> q = qr.q();
+    Matrix<double> r = qr.r();
+
+    ASSERT_TRUE(qr.is_full_rank());
+
+    for (std::size_t i = 0; i < 30; ++i)
+        for (std::size_t j = 0; j < 8; ++j)
+        {
+            double sum = 0.0;
+
+            for (std::size_t k = 0; k <= j; ++k)
+                sum += q(i, k) * r(k, j);
+
+            EXPECT_NEAR(sum, a(i, j), 1e-12);
+        }
+
+    // Q has orthonormal columns
+    for (std::size_t i = 0; i < 8; ++i)
+        for (std::size_t j = 0; j < 8; ++j)
+        {
+            double sum = 0.0;
+
+            for (std::size_t k = 0; k < 30; ++k)
+                sum += q(k, i) * q(k, j);
+
+            EXPECT_NEAR(sum, i == j ? 1.0 : 0.0, 1e-12);
+        }
+
+    // The least squares residual is orthogonal to the columns of A
+    Vector<double> b = random_dense_vector(30, generator);
+    Vector<double> x = qr.solve(b);
+
+    for (std::size_t j = 0; j < 8; ++j)
+    {
+        double sum = 0.0;
+
+        for (std::size_t i = 0; i < 30; ++i)
+        {
+            double error = -b[i];
+
+            for (std::size_t k = 0; k < 8; ++k)
+                error += a(i, k) * x[k];
+
+            sum += a(i, j) * error;
+        }
+
+        EXPECT_NEAR(sum, 0.0, 1e-12);
+    }
+
+    // Square systems are solved exactly
+    auto square = random_dense_matrix<MatrixLayout::ColumnMajor>(12, 12, generator);
+    Vector<double> c = random_dense_vector(12, generator);
+
+    EXPECT_LT(residual(square, QrDecomposition<double>(square).solve(c), c), 1e-12);
+    EXPECT_THROW(QrDecomposition<double>(Matrix<double>(2, 3)), std::invalid_argument);
+
+    Matrix<double> deficient(3, 2);
+    EXPECT_THROW(QrDecomposition<double>(deficient).solve(Vector<double>(3)), std::invalid_argument);
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestDecomposition class
+ * @param TestMat4Inverse method
+ */
+TEST(TestDecomposition, TestMat4Inverse)
+{
+    std::mt19937 generator(15);
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+
+    for (int iteration = 0; iteration < 100; ++iteration)
+    {
+        Quaternion<float> rotation =
+            Quaternion<float>(distribution(generator), distribution(generator),
+                              distribution(generator), distribution(generator))
+                .normalize();
+        Vec3 scale(1.0f + distribution(generator) * 0.5f, 1.0f + distribution(generator) * 0.5f,
+                   1.0f + distribution(generator) * 0.5f);
+        Vec3 offset(distribution(generator) * 10.0f, distribution(generator) * 10.0f,
+                    distribution(generator) * 10.0f);
+
+        Mat4 model = Mat4::translation(offset) * rotation.to_mat4() * Mat4::scaling(scale);
+        Mat4 general = inverse(model);
+        Mat4 affine = affine_inverse(model);
+        Mat4 identity = model * affine;
+
+        for (std::size_t i = 0; i < 4; ++i)
+            for (std::size_t j = 0; j < 4; ++j)
+            {
+                EXPECT_NEAR(affine(i, j), general(i, j), 1e-4f);
+                EXPECT_NEAR(identity(i, j), i == j ? 1.0f : 0.0f, 1e-5f);
+            }
+    }
+
+    EXPECT_THROW(affine_inverse(Mat4::scaling(Vec3(1.0f, 0.0f, 1.0f))), std::invalid_argument);
+}
+
+#endif //! DECOMPOSITION_TEST_H
@@ -0,0 +1,164 @@
+/**
+ * @file fast_math.test.h
+ * @author Carlos Salguero
+ * @brief Test class for the fast approximations
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef FAST_MATH_TEST_H
+#define FAST_MATH_TEST_H
+
+// C++ Standard Library
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <random>
+#include <type_traits>
+
+// Google Test Library
+#include <gtest/gtest.h>
+
+// Project headers
+#include "src/utils/math/fast_math.h"
+
+using namespace Math;
+
+namespace
+{
+    /**
+     * @brief
+     * Applies a function to every lane of a wide vector built from one value
+     * and returns the largest deviation of any lane from the scalar result
+     * @tparam V Type of the wide vector
+     * @tparam F Type of the function
+     * @param function The function, overloaded for float and V
+     * @param value The argument
+     * @return float The largest difference between lanes and scalar
+     */
+    template <class V, class F>
+    float lane_mismatch(F function, float value)
+    {
+        float lanes[V::width];
+        function(V(value)).store(lanes);
+
+        float scalar = function(value);
+        float result = 0.0f;
+
+        for (float lane : lanes)
+            result = std::max(result, std::abs(lane - scalar));
+
+        return result;
+    }
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestFastMath class
+ * @param TestErrorBounds method
+ */
+TEST(TestFastMath, TestErrorBounds)
+{
+    std::mt19937 generator(13);
+    std::uniform_real_distribution<float> exponent(-40.0f, 40.0f);
+    std::uniform_real_distribution<float> angle(-8192.0f, 8192.0f);
+    std::uniform_real_distribution<float> coordinate(-10.0f, 10.0f);
+    std::uniform_real_distribution<float> power(-87.0f, 88.7f);
+
+#if defined(MATH_SIMD_SCALAR)
+    const double rsqrt_bound = 5e-6;
+#else
+    const double rsqrt_bound = 3e-7;
+#endif
+
+    for (int i = 0; i < 100000; ++i)
+    {
+        float x = std::exp(exponent(generator));
+        double expected = 1.0 / std::sqrt(static_cast<double>(x));
+        EXPECT_LE(std::abs(Fast::rsqrt(Simd::Float4(x)).first() - expected) / expected,
+                  rsqrt_bound);
+        EXPECT_LE(std::abs(Fast::rsqrt(x) - expected) / expected, rsqrt_bound);
+
+        float a = angle(generator);
+        EXPECT_LE(std::abs(Fast::sin(a) - std::sin(static_cast<double>(a))), 2e-7);
+        EXPECT_LE(std::abs(Fast::cos(a) - std::cos(static_cast<double>(a))), 2e-7);
+
+        float y = coordinate(generator), c = coordinate(generator);
+        EXPECT_LE(std::abs(Fast::atan2(y, c) - std::atan2(static_cast<double>(y), c)), 4e-7);
+
+        float e = power(generator);
+        double exp_expected = std::exp(static_cast<double>(e));
+        EXPECT_LE(std::abs(Fast::exp(e) - exp_expected) / exp_expected, 1e-7);
+
+        float l = std::exp(power(generator));
+        EXPECT_LE(std::abs(Fast::log(l) - std::log(static_cast<double>(l))), 1e-7);
+    }
+
+    // Axes, quadrants and limits
+    EXPECT_EQ(Fast::atan2(0.0f, 0.0f), 0.0f);
+    EXPECT_NEAR(Fast::atan2(0.0f, -1.0f), std::numbers::pi_v<float>, 1e-6f);
+    EXPECT_NEAR(Fast::atan2(-1.0f, 0.0f), -std::numbers::pi_v<float> / 2, 1e-6f);
+    EXPECT_NEAR(Fast::atan2(-1.0f, -1.0f), -3 * std::numbers::pi_v<float> / 4, 1e-6f);
+    EXPECT_EQ(Fast::exp(0.0f), 1.0f);
+    EXPECT_EQ(Fast::exp(-200.0f), 0.0f);
+    EXPECT_TRUE(std::isfinite(Fast::exp(88.7f)));
+    EXPECT_EQ(Fast::log(1.0f), 0.0f);
+    EXPECT_NEAR(Fast::log(0x1p-126f), -126 * std::numbers::ln2_v<float>, 1e-5f);
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestFastMath class
+ * @param TestSimdMatchesScalar method
+ */
+TEST(TestFastMath, TestSimdMatchesScalar)
+{
+    auto sin = [](const auto &x) { return Fast::sin(x); };
+    auto cos = [](const auto &x) { return Fast::cos(x); };
+    auto exp = [](const auto &x) { return Fast::exp(x); };
+    auto atan2 = [](const auto &x) { return Fast::atan2(x, x * x - x); };
+    auto log = [](const auto &x)
+    {
+        using V = std::decay_t<decltype(x)>;
+        return Fast::log(x * x + V(0.5f));
+    };
+
+    for (float value : {-1000.5f, -3.0f, -0.25f, 0.0f, 0.7f, 2.5f, 40.0f})
+    {
+        // Without FMA contraction the lanes match the scalar path exactly;
+        // with it they may differ in the last bit
+        EXPECT_LE(lane_mismatch<Simd::Float4>(sin, value), 1e-7f);
+        EXPECT_LE(lane_mismatch<Simd::Float8>(cos, value), 1e-7f);
+        EXPECT_LE(lane_mismatch<Simd::Float8>(exp, value), 1e-7f * std::exp(value));
+        EXPECT_LE(lane_mismatch<Simd::Float4>(atan2, value), 1e-7f);
+        EXPECT_LE(lane_mismatch<Simd::Float8>(log, value), 1e-7f);
+    }
+
+    // Scalar rsqrt uses the same estimate and Newton steps as the lanes
+    auto rsqrt = [](const auto &x) { return Fast::rsqrt(x); };
+
+    for (float value : {1e-30f, 0.003f, 0.5f, 1.0f, 2.0f, 169.0f, 7.5e12f})
+    {
+        EXPECT_EQ(lane_mismatch<Simd::Float4>(rsqrt, value), 0.0f);
+        EXPECT_EQ(lane_mismatch<Simd::Float8>(rsqrt, value), 0.0f);
+    }
+
+    Vec3 direction(3.0f, -4.0f, 12.0f);
+    Vec3 normalized = Fast::normalize(direction);
+    Simd::Float4 simd_normalized = Fast::normalize3(Simd::Float4(3.0f, -4.0f, 12.0f, 5.0f));
+
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        EXPECT_NEAR(normalized[i], direction[i] / 13.0f, 1e-5f);
+        EXPECT_NEAR(simd_normalized[i], direction[i] / 13.0f, 1e-5f);
+    }
+
+    EXPECT_EQ(simd_normalized.w(), 5.0f);
+}
+
+#endif //! FAST_MATH_TEST_H
@@ -0,0 +1,149 @@
+/**
+ * @file fixed.test.h
+ * @author Carlos Salguero
+ * @brief Test class for the fixed-point numbers
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef FIXED_TEST_H
+#define FIXED_TEST_H
+
+// C++ Standard Library
+#include <cmath>
+#include <cstdint>
+#include <random>
+
+// Google Test Library
+#include <gtest/gtest.h>
+
+// Project headers
+#include "src/utils/math/fixed.h"
+#include "src/utils/math/matrix.h"
+#include "src/utils/math/vec.h"
+#include "src/utils/math/vector.h"
+
+using namespace Math;
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestFixed class
+ * @param TestArithmetic method
+ */
+TEST(TestFixed, TestArithmetic)
+{
+    static_assert(Q16_16(3) * Q16_16(0.5) == Q16_16(1.5));
+    static_assert(Q16_16(1) / Q16_16(4) == Q16_16(0.25));
+    static_assert(Q16_16(-7) / Q16_16(2) == Q16_16(-3.5));
+    static_assert((Q16_16(2) - Q16_16(5)).floor() == -3);
+    static_assert(Q16_16(-2.5).floor() == -3);
+    static_assert(Q16_16(1) / Q16_16(3) == Q16_16::from_raw(21845));
+    static_assert(Q16_16(-1) / Q16_16(3) == Q16_16::from_raw(-21845));
+    static_assert(Q32_32(40000) * Q32_32(40000) == Q32_32(1600000000));
+    static_assert(Q32_32(0.75) < Q32_32(1) && -Q32_32(1) < Q32_32());
+
+    // Rounded to nearest: 2^-16 * 0.5 rounds away from zero
+    EXPECT_EQ(Q16_16::epsilon() * Q16_16(0.5), Q16_16::epsilon());
+    EXPECT_EQ(-Q16_16::epsilon() * Q16_16(0.5), -Q16_16::epsilon());
+
+    EXPECT_FLOAT_EQ((Q16_16(1.25) + Q16_16(2)).to_float(), 3.25f);
+    EXPECT_DOUBLE_EQ((Q32_32(10) / Q32_32(8)).to_double(), 1.25);
+    EXPECT_THROW(Q16_16(1) / Q16_16(), std::runtime_error);
+
+    // Overflow wraps like the two's complement raw value
+    EXPECT_EQ(Q16_16::from_raw(INT32_MAX) + Q16_16::epsilon(), Q16_16::from_raw(INT32_MIN));
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestFixed class
+ * @param TestPortableArithmetic method
+ */
+TEST(TestFixed, TestPortableArithmetic)
+{
+    std::mt19937_64 generator(17);
+
+    for (int i = 0; i < 10000; ++i)
+    {
+        std::uint64_t a = generator() >> (generator() % 40);
+        std::uint64_t b = (generator() >> (generator() % 40)) | 1;
+
+        // The 64-bit-only fallbacks agree with a wide reference
+        std::uint64_t a_low = a & 0xffffffffu;
+        std::uint64_t b_low = b & 0x7fffffffu;
+
+        EXPECT_EQ(Detail::multiply_shift_portable(a_low, b_low, 16),
+                  (a_low * b_low + (1u << 15)) >> 16);
+        EXPECT_EQ(Detail::divide_shift_portable(a_low, b, 16), ((a_low << 16) + b / 2) / b);
+
+#if defined(__SIZEOF_INT128__)
+        EXPECT_EQ(Detail::multiply_shift_portable(a, b, 32),
+                  static_cast<std::uint64_t>((Detail::uint128(a) * b + (Detail::uint128(1) << 31)) >> 32));
+        EXPECT_EQ(Detail::divide_shift_portable(a, b, 32),
+                  static_cast<std::uint64_t>(((Detail::uint128(a) << 32) + b / 2) / b));
+#endif
+    }
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestFixed class
+ * @param TestSquareRoot method
+ */
+TEST(TestFixed, TestSquareRoot)
+{
+    static_assert(square_root(Q16_16(16)) == Q16_16(4));
+    static_assert(square_root(Q16_16(0.25)) == Q16_16(0.5));
+
+    EXPECT_NEAR(square_root(Q16_16(2)).to_double(), 1.41421356, 1.0 / 65536);
+    EXPECT_NEAR(square_root(Q32_32(1000000)).to_double(), 1000.0, 1e-9);
+    EXPECT_NEAR(square_root(Q32_32::epsilon()).to_double(), 1.0 / 65536, 1e-9);
+    EXPECT_THROW(square_root(-Q16_16(1)), std::runtime_error);
+
+    // The top of the range, where current + a / current would overflow
+    static_assert(square_root(Q16_16(32767)) > Q16_16(181));
+    EXPECT_NEAR(square_root(Q16_16(32767)).to_double(), std::sqrt(32767.0), 1.0 / 65536);
+    EXPECT_NEAR(square_root(Q16_16::from_raw(INT32_MAX)).to_double(), std::sqrt(INT32_MAX / 65536.0), 1.0 / 65536);
+    EXPECT_NEAR(square_root(Q32_32::from_raw(INT64_MAX)).to_double(), std::sqrt(INT64_MAX / 4294967296.0), 1e-9);
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestFixed class
+ * @param TestContainers method
+ */
+TEST(TestFixed, TestContainers)
+{
+    Vector<Q16_16> a{Q16_16(1), Q16_16(2), Q16_16(2)};
+    Vector<Q16_16> b{Q16_16(3), Q16_16(0.5), Q16_16(-1)};
+
+    EXPECT_EQ(a.dot(b), Q16_16(2));
+    EXPECT_EQ(a.magnitude(), Q16_16(3));
+    EXPECT_EQ(a.lerp(b, Q16_16(0.5)), (Vector<Q16_16>{Q16_16(2), Q16_16(1.25), Q16_16(0.5)}));
+    EXPECT_EQ(Math::lerp(Q32_32(2), Q32_32(4), Q32_32(0.25)), Q32_32(2.5));
+
+    constexpr Vec<3, Q16_16> c(Q16_16(1), Q16_16(0), Q16_16(0));
+    static_assert(c.cross(Vec<3, Q16_16>(0, 1, 0)) == Vec<3, Q16_16>(0, 0, 1));
+
+    Matrix<Q32_32> m(2, 2);
+    m(0, 0) = Q32_32(1.5);
+    m(0, 1) = Q32_32(-2);
+    m(1, 0) = Q32_32(0.25);
+    m(1, 1) = Q32_32(4);
+
+    Matrix<Q32_32> product = m * m;
+
+    EXPECT_EQ(product(0, 0), Q32_32(1.75));
+    EXPECT_EQ(product(0, 1), Q32_32(-11));
+    EXPECT_EQ(product(1, 0), Q32_32(1.375));
+    EXPECT_EQ(product(1, 1), Q32_32(15.5));
+}
+
+#endif //! FIXED_TEST_H
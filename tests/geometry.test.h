@@ -0,0 +1,347 @@
+/**
+ * @file geometry.test.h
+ * @author Carlos Salguero
+ * @brief Test class for the geometric primitives and batched tests
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef GEOMETRY_TEST_H
+#define GEOMETRY_TEST_H
+
+// C++ Standard Library
+#include <cstdint>
+#include <numbers>
+#include <random>
+#include <vector>
+
+// Google Test Library
+#include <gtest/gtest.h>
+
+// Project headers
+#include "src/utils/math/geometry.h"
+
+using namespace Math;
+
+namespace
+{
+    /**
+     * @brief
+     * Creates a random box inside [-10, 10]^3
+     * @param generator The random generator
+     * @return Aabb The random box
+     */
+    Aabb random_box(std::mt19937 &generator)
+    {
+        std::uniform_real_distribution<float> position(-10.0f, 10.0f);
+        std::uniform_real_distribution<float> size(0.1f, 3.0f);
+        Vec3 corner(position(generator), position(generator), position(generator));
+
+        return Aabb(corner, corner + Vec3(size(generator), size(generator), size(generator)));
+    }
+
+    /**
+     * @brief
+     * Creates a perspective projection for OpenGL clip space
+     */
+    Mat4 perspective(float fov, float aspect, float near, float far)
+    {
+        float f = 1.0f / std::tan(fov / 2.0f);
+        Mat4 result;
+
+        result(0, 0) = f / aspect;
+        result(1, 1) = f;
+        result(2, 2) = (far + near) / (near - far);
+        result(2, 3) = 2.0f * far * near / (near - far);
+        result(3, 2) = -1.0f;
+
+        return result;
+    }
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestGeometry class
+ * @param TestAabb method
+ */
+TEST(TestGeometry, TestAabb)
+{
+    Aabb empty;
+    Aabb box(Vec3(-1.0f, -2.0f, -3.0f), Vec3(1.0f, 2.0f, 3.0f));
+
+    EXPECT_TRUE(empty.empty());
+    EXPECT_FALSE(box.empty());
+    EXPECT_FALSE(empty.intersects(box));
+    EXPECT_TRUE(box.contains(Vec3(1.0f, 0.0f, -3.0f)));
+    EXPECT_FALSE(box.contains(Vec3(1.1f, 0.0f, 0.0f)));
+    EXPECT_FLOAT_EQ(box.surface_area(), 2.0f * (2 * 4 + 4 * 6 + 6 * 2));
+    EXPECT_EQ(empty.merge(box).min, box.min);
+    EXPECT_EQ(empty.merge(box).max, box.max);
+
+    // Touching boxes overlap, separated ones do not
+    EXPECT_TRUE(box.intersects(Aabb(Vec3(1.0f, 0.0f, 0.0f), Vec3(2.0f, 1.0f, 1.0f))));
+    EXPECT_FALSE(box.intersects(Aabb(Vec3(1.5f, 0.0f, 0.0f), Vec3(2.0f, 1.0f, 1.0f))));
+
+    std::vector<Vec3> points = {Vec3(0.0f, 5.0f, 1.0f), Vec3(-2.0f, 1.0f, 0.0f),
+                                Vec3(1.0f, -1.0f, 4.0f)};
+    Aabb bounds = Aabb::from_points(points);
+
+    EXPECT_EQ(bounds.min, Vec3(-2.0f, -1.0f, 0.0f));
+    EXPECT_EQ(bounds.max, Vec3(1.0f, 5.0f, 4.0f));
+
+    // A quarter turn around z swaps the x and y extents
+    Quaternion<float> quarter =
+        Quaternion<float>::from_axis_angle(Vec3(0.0f, 0.0f, 1.0f), std::numbers::pi_v<float> / 2);
+    Aabb turned = box.transform(Mat4::translation(Vec3(10.0f, 0.0f, 0.0f)) * quarter.to_mat4());
+
+    EXPECT_NEAR(turned.min.x(), 8.0f, 1e-5f);
+    EXPECT_NEAR(turned.max.x(), 12.0f, 1e-5f);
+    EXPECT_NEAR(turned.min.y(), -1.0f, 1e-5f);
+    EXPECT_NEAR(turned.max.z(), 3.0f, 1e-5f);
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestGeometry class
+ * @param TestRay method
+ */
+TEST(TestGeometry, TestRay)
+{
+    Aabb box(Vec3(-1.0f), Vec3(1.0f));
+    Ray ray(Vec3(-5.0f, 0.0f, 0.0f), Vec3(1.0f, 0.0f, 0.0f));
+
+    ASSERT_TRUE(ray.intersect(box).has_value());
+    EXPECT_FLOAT_EQ(*ray.intersect(box), 4.0f);
+    EXPECT_FALSE(Ray(Vec3(-5.0f, 2.0f, 0.0f), Vec3(1.0f, 0.0f, 0.0f)).intersect(box));
+    EXPECT_FALSE(Ray(Vec3(5.0f, 0.0f, 0.0f), Vec3(1.0f, 0.0f, 0.0f)).intersect(box));
+    EXPECT_FLOAT_EQ(*Ray(Vec3(0.0f), Vec3(0.0f, 1.0f, 0.0f)).intersect(box), 0.0f);
+    EXPECT_FALSE(ray.intersect(Aabb()));
+
+    Sphere sphere(Vec3(0.0f, 0.0f, 10.0f), 2.0f);
+
+    EXPECT_FLOAT_EQ(*Ray(Vec3(0.0f), Vec3(0.0f, 0.0f, 1.0f)).intersect(sphere), 8.0f);
+    EXPECT_FALSE(Ray(Vec3(0.0f), Vec3(0.0f, 0.0f, -1.0f)).intersect(sphere));
+    EXPECT_FALSE(Ray(Vec3(3.0f, 0.0f, 0.0f), Vec3(0.0f, 0.0f, 1.0f)).intersect(sphere));
+
+    Plane ground = Plane::from_points(Vec3(0.0f), Vec3(0.0f, 0.0f, 1.0f), Vec3(1.0f, 0.0f, 0.0f));
+
+    EXPECT_NEAR(ground.normal.y(), 1.0f, 1e-6f);
+    EXPECT_FLOAT_EQ(*Ray(Vec3(0.0f, 4.0f, 0.0f), Vec3(0.0f, -2.0f, 0.0f)).intersect(ground), 2.0f);
+    EXPECT_FALSE(Ray(Vec3(0.0f, 4.0f, 0.0f), Vec3(1.0f, 0.0f, 0.0f)).intersect(ground));
+    EXPECT_THROW(Plane::from_points(Vec3(0.0f), Vec3(1.0f), Vec3(2.0f)), std::invalid_argument);
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestGeometry class
+ * @param TestSphereAndObb method
+ */
+TEST(TestGeometry, TestSphereAndObb)
+{
+    Sphere sphere(Vec3(0.0f), 1.0f);
+
+    EXPECT_TRUE(sphere.intersects(Sphere(Vec3(2.0f, 0.0f, 0.0f), 1.0f)));
+    EXPECT_FALSE(sphere.intersects(Sphere(Vec3(2.1f, 0.0f, 0.0f), 1.0f)));
+    EXPECT_TRUE(sphere.intersects(Aabb(Vec3(0.5f), Vec3(2.0f))));
+    EXPECT_FALSE(sphere.intersects(Aabb(Vec3(0.7f), Vec3(2.0f))));
+
+    // A cube turned 45 degrees around z reaches sqrt(2) along x
+    Quaternion<float> turn =
+        Quaternion<float>::from_axis_angle(Vec3(0.0f, 0.0f, 1.0f), std::numbers::pi_v<float> / 4);
+    Obb diamond(Vec3(0.0f), Vec3(1.0f), turn);
+
+    EXPECT_TRUE(diamond.contains(Vec3(1.4f, 0.0f, 0.0f)));
+    EXPECT_FALSE(diamond.contains(Vec3(1.0f, 1.0f, 0.0f)));
+    EXPECT_NEAR(diamond.bounds().max.x(), std::numbers::sqrt2_v<float>, 1e-5f);
+
+    Obb cube(Vec3(2.3f, 0.0f, 0.0f), Vec3(1.0f), Quaternion<float>());
+    EXPECT_TRUE(diamond.intersects(cube));
+
+    cube.center = Vec3(2.5f, 0.0f, 0.0f);
+    EXPECT_FALSE(diamond.intersects(cube));
+
+    // Compare the separating axis test against sampled points
+    std::mt19937 generator(31);
+    std::uniform_real_distribution<float> component(-1.0f, 1.0f);
+
+    for (int iteration = 0; iteration < 200; ++iteration)
+    {
+        auto random_obb = [&]()
+        {
+            return Obb(Vec3(component(generator), component(generator), component(generator)) * 2.0f,
+                       Vec3(0.3f + component(generator) * 0.2f, 0.5f, 0.7f),
+                       Quaternion<float>(component(generator), component(generator),
+                                         component(generator), component(generator))
+                           .normalize());
+        };
+
+        Obb a = random_obb();
+        Obb b = random_obb();
+        bool sampled = false;
+
+        // Any point of a inside b proves an overlap
+        for (int sample = 0; sample < 2000 && !sampled; ++sample)
+        {
+            Vec3 local(component(generator), component(generator), component(generator));
+            sampled = b.contains(a.center + a.orientation.rotate(local * a.half_extents));
+        }
+
+        if (sampled)
+        {
+            EXPECT_TRUE(a.intersects(b));
+        }
+
+        EXPECT_EQ(a.intersects(b), b.intersects(a));
+        EXPECT_TRUE(!a.intersects(b) || a.bounds().intersects(b.bounds()));
+    }
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestGeometry class
+ * @param TestFrustum method
+ */
+TEST(TestGeometry, TestFrustum)
+{
+    // Camera at the origin looking down -z
+    Frustum frustum =
+        Frustum::from_matrix(perspective(std::numbers::pi_v<float> / 2, 1.0f, 1.0f, 100.0f));
+
+    EXPECT_TRUE(frustum.contains(Vec3(0.0f, 0.0f, -10.0f)));
+    EXPECT_TRUE(frustum.contains(Vec3(9.0f, -9.0f, -10.0f)));
+    EXPECT_FALSE(frustum.contains(Vec3(11.0f, 0.0f, -10.0f)));
+    EXPECT_FALSE(frustum.contains(Vec3(0.0f, 0.0f, 10.0f)));
+    EXPECT_FALSE(frustum.contains(Vec3(0.0f, 0.0f, -0.5f)));
+    EXPECT_FALSE(frustum.contains(Vec3(0.0f, 0.0f, -101.0f)));
+
+    for (const Plane &plane : frustum.planes)
+        EXPECT_NEAR(plane.normal.magnitude(), 1.0f, 1e-5f);
+
+    EXPECT_TRUE(frustum.intersects(Sphere(Vec3(11.0f, 0.0f, -10.0f), 1.0f)));
+    EXPECT_FALSE(frustum.intersects(Sphere(Vec3(13.0f, 0.0f, -10.0f), 1.0f)));
+    EXPECT_TRUE(frustum.intersects(Aabb(Vec3(10.5f, -1.0f, -11.0f), Vec3(12.0f, 1.0f, -9.0f))));
+    EXPECT_FALSE(frustum.intersects(Aabb(Vec3(12.0f, -1.0f, -11.0f), Vec3(13.0f, 1.0f, -9.0f))));
+
+    // The batched tests agree with the scalar ones, tail included
+    std::mt19937 generator(32);
+    std::uniform_real_distribution<float> position(-60.0f, 60.0f);
+    std::uniform_real_distribution<float> size(0.1f, 5.0f);
+    const std::size_t count = 203;
+    std::vector<float> x(count), y(count), z(count), radii(count);
+    std::vector<float> ex(count), ey(count), ez(count);
+    std::vector<std::uint8_t> spheres_visible(count), boxes_visible(count);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        x[i] = position(generator);
+        y[i] = position(generator);
+        z[i] = position(generator) - 40.0f;
+        radii[i] = size(generator);
+        ex[i] = size(generator);
+        ey[i] = size(generator);
+        ez[i] = size(generator);
+    }
+
+    std::size_t spheres = cull_spheres(frustum, ConstSoaView(x, y, z), radii, spheres_visible);
+    std::size_t boxes = cull_boxes(frustum, ConstSoaView(x, y, z), ConstSoaView(ex, ey, ez),
+                                   boxes_visible);
+    std::size_t expected_spheres = 0;
+    std::size_t expected_boxes = 0;
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        Vec3 center(x[i], y[i], z[i]);
+        Vec3 extents(ex[i], ey[i], ez[i]);
+        bool sphere = frustum.intersects(Sphere(center, radii[i]));
+        bool box = frustum.intersects(Aabb(center - extents, center + extents));
+
+        EXPECT_EQ(spheres_visible[i], sphere) << i;
+        EXPECT_EQ(boxes_visible[i], box) << i;
+        expected_spheres += sphere;
+        expected_boxes += box;
+    }
+
+    EXPECT_EQ(spheres, expected_spheres);
+    EXPECT_EQ(boxes, expected_boxes);
+    EXPECT_GT(spheres, 0u);
+    EXPECT_LT(spheres, count);
+    EXPECT_THROW(cull_spheres(frustum, ConstSoaView(x, y, z), radii, std::span(spheres_visible).first(3)),
+                 std::invalid_argument);
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestGeometry class
+ * @param TestAabb8 method
+ */
+TEST(TestGeometry, TestAabb8)
+{
+    std::mt19937 generator(33);
+    std::uniform_real_distribution<float> component(-1.0f, 1.0f);
+
+    for (int iteration = 0; iteration < 200; ++iteration)
+    {
+        std::size_t count = 1 + iteration % 8;
+        std::vector<Aabb> boxes(count);
+
+        for (Aabb &box : boxes)
+            box = random_box(generator);
+
+        Aabb8 packet = Aabb8::load(boxes);
+        Ray ray(Vec3(component(generator), component(generator), component(generator)) * 15.0f,
+                Vec3(component(generator), component(generator), component(generator)));
+        Aabb query = random_box(generator);
+        float distances[8];
+        int hits = packet.intersect(ray, 1000.0f, distances);
+        int overlaps = packet.intersects(query);
+
+        EXPECT_EQ(hits & ~packet.lanes(), 0);
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            std::optional<float> expected = ray.intersect(boxes[i]);
+            bool hit = (hits >> i) & 1;
+
+            EXPECT_EQ(hit, expected.has_value()) << iteration << " " << i;
+
+            if (hit && expected)
+            {
+                EXPECT_NEAR(distances[i], *expected, 1e-3f * (1.0f + *expected));
+            }
+
+            EXPECT_EQ(((overlaps >> i) & 1) != 0, boxes[i].intersects(query));
+        }
+    }
+
+    // A hit beyond the maximum distance does not count
+    Aabb far(Vec3(-1.0f, -1.0f, 50.0f), Vec3(1.0f, 1.0f, 52.0f));
+    Aabb8 packet = Aabb8::load(std::span(&far, 1));
+    Ray ray(Vec3(0.0f), Vec3(0.0f, 0.0f, 1.0f));
+
+    EXPECT_EQ(packet.intersect(ray, 10.0f), 0);
+    EXPECT_EQ(packet.intersect(ray, 60.0f), 1);
+
+    // A ray running along a face of the box still hits it
+    Ray grazing(Vec3(-1.0f, 0.0f, 0.0f), Vec3(0.0f, 0.0f, 1.0f));
+    EXPECT_EQ(packet.intersect(grazing, 60.0f), 1);
+    EXPECT_THROW(Aabb8::load(std::vector<Aabb>(9)), std::invalid_argument);
+
+    // Empty boxes never report a hit, whatever the direction of the ray
+    std::vector<Aabb> mixed{far, Aabb(), far, Aabb()};
+    Aabb8 with_empty = Aabb8::load(mixed);
+
+    EXPECT_FALSE(ray.intersect(Aabb()).has_value());
+    EXPECT_EQ(with_empty.intersect(ray, 60.0f), 0b0101);
+    EXPECT_EQ(with_empty.intersect(Ray(Vec3(0.0f), Vec3(1.0f, -2.0f, 0.5f)), 60.0f), 0);
+    EXPECT_EQ(with_empty.intersects(Aabb(Vec3(-100.0f), Vec3(100.0f))), 0b0101);
+}
+
+#endif //! GEOMETRY_TEST_H
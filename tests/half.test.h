@@ -0,0 +1,156 @@
+/**
+ * @file half.test.h
+ * @author Carlos Salguero
+ * @brief Test class for the half-precision float
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef HALF_TEST_H
+#define HALF_TEST_H
+
+// C++ Standard Library
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+// Google Test Library
+#include <gtest/gtest.h>
+
+// Project headers
+#include "src/utils/math/half.h"
+#include "src/utils/math/matrix.h"
+#include "src/utils/math/vector.h"
+
+using namespace Math;
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestHalf class
+ * @param TestEncoding method
+ */
+TEST(TestHalf, TestEncoding)
+{
+    static_assert(Half(1.0f).bits() == 0x3c00);
+    static_assert(Half(-2.0f).bits() == 0xc000);
+    static_assert(Half(0.1f).bits() == 0x2e66);
+    static_assert(Half(65504.0f).bits() == 0x7bff);
+    static_assert(Half(65519.0f).bits() == 0x7bff);
+    static_assert(Half(65520.0f).bits() == 0x7c00);
+    static_assert(Half(0x1p-24f).bits() == 0x0001);
+    static_assert(Half(0x1p-25f).bits() == 0x0000);
+    static_assert(Half(0x3p-26f).bits() == 0x0001);
+    static_assert(Half(-0.0f).bits() == 0x8000);
+    static_assert(float(Half::from_bits(0x0001)) == 0x1p-24f);
+    static_assert(float(Half::from_bits(0x3555)) == 0.333251953125f);
+
+    // Ties round to even: 1 + 2^-11 is halfway between 1 and 1 + 2^-10
+    static_assert(Half(1.0f + 0x1p-11f).bits() == 0x3c00);
+    static_assert(Half(1.0f + 0x3p-11f).bits() == 0x3c02);
+
+    EXPECT_EQ(Half(std::numeric_limits<float>::infinity()).bits(), 0x7c00);
+    EXPECT_TRUE(std::isnan(float(Half(std::numeric_limits<float>::quiet_NaN()))));
+    EXPECT_EQ(Half(0.0f), Half(-0.0f));
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestHalf class
+ * @param TestRoundTrip method
+ */
+TEST(TestHalf, TestRoundTrip)
+{
+    // Every half survives the trip through float unchanged
+    for (std::uint32_t bits = 0; bits <= 0xffff; ++bits)
+    {
+        Half value = Half::from_bits(static_cast<std::uint16_t>(bits));
+        float wide = value;
+
+        if (std::isnan(wide))
+        {
+            EXPECT_TRUE(std::isnan(float(Half(wide))));
+            continue;
+        }
+
+        ASSERT_EQ(Half(wide).bits(), bits);
+    }
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestHalf class
+ * @param TestPackUnpack method
+ */
+TEST(TestHalf, TestPackUnpack)
+{
+    std::mt19937 generator(23);
+    std::vector<float> source(1003);
+
+    for (auto &value : source)
+        value = std::bit_cast<float>(static_cast<std::uint32_t>(generator()) & 0x7fffffffu) *
+                (generator() & 1 ? 1.0f : -1.0f);
+
+    // Exact ties and values around the range limits
+    source[0] = 1.0f + 0x1p-11f;
+    source[1] = 65520.0f;
+    source[2] = 0x1p-25f;
+    source[3] = std::numeric_limits<float>::infinity();
+
+    std::vector<Half> packed(source.size());
+    std::vector<float> unpacked(source.size());
+
+    pack_halves(source, packed);
+    unpack_halves(packed, unpacked);
+
+    for (std::size_t i = 0; i < source.size(); ++i)
+    {
+        if (std::isnan(source[i]))
+            continue;
+
+        ASSERT_EQ(packed[i].bits(), Half(source[i]).bits()) << source[i];
+        ASSERT_EQ(std::bit_cast<std::uint32_t>(unpacked[i]),
+                  std::bit_cast<std::uint32_t>(float(packed[i])));
+    }
+
+    std::vector<Half> short_destination(3);
+    EXPECT_THROW(pack_halves(source, short_destination), std::invalid_argument);
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestHalf class
+ * @param TestContainers method
+ */
+TEST(TestHalf, TestContainers)
+{
+    Vector<Half> a{Half(1.0f), Half(2.0f), Half(2.0f)};
+    Vector<Half> b{Half(3.0f), Half(0.5f), Half(-1.0f)};
+
+    EXPECT_EQ(a.dot(b), Half(2.0f));
+    EXPECT_EQ(a.magnitude(), Half(3.0f));
+    EXPECT_EQ(a.lerp(b, Half(0.5f)), (Vector<Half>{Half(2.0f), Half(1.25f), Half(0.5f)}));
+    EXPECT_EQ(Math::lerp(Half(2.0f), Half(4.0f), Half(0.25f)), Half(2.5f));
+
+    Matrix<Half> m(2, 2);
+    m(0, 0) = Half(1.5f);
+    m(0, 1) = Half(-2.0f);
+    m(1, 0) = Half(0.25f);
+    m(1, 1) = Half(4.0f);
+
+    Matrix<Half> product = m * m;
+
+    EXPECT_EQ(product(0, 1), Half(-11.0f));
+    EXPECT_EQ(product(1, 1), Half(15.5f));
+}
+
+#endif //! HALF_TEST_H
@@ -0,0 +1,219 @@
+/**
+ * @file matrix.test.h
+ * @author Carlos Salguero
+ * @brief Test class for the matrix class
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef MATRIX_TEST_H
+#define MATRIX_TEST_H
+
+// C++ Standard Library
+#include <cstdint>
+
+// Google Test Library
+#include <gtest/gtest.h>
+
+// Project headers
+#include "src/utils/math/matrix.h"
+
+using namespace Math;
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestMatrix class
+ * @param TestStorage method
+ */
+TEST(TestMatrix, TestStorage)
+{
+    Matrix<float> row_major(2, 3);
+    Matrix<float, MatrixLayout::ColumnMajor> column_major(2, 3);
+
+    for (std::size_t i = 0; i < 2; ++i)
+        for (std::size_t j = 0; j < 3; ++j)
+        {
+            row_major(i, j) = static_cast<float>(i * 3 + j);
+            column_major(i, j) = static_cast<float>(i * 3 + j);
+        }
+
+    EXPECT_EQ(row_major.size(), 6u);
+    EXPECT_EQ(row_major.data()[1], 1.0f);
+    EXPECT_EQ(column_major.data()[1], 3.0f);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(row_major.data()) % DEFAULT_ALIGNMENT, 0u);
+    EXPECT_THROW(row_major(2, 0), std::out_of_range);
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestMatrix class
+ * @param TestTranspose method
+ */
+TEST(TestMatrix, TestTranspose)
+{
+    Matrix<int> matrix(37, 45);
+
+    for (std::size_t i = 0; i < 37; ++i)
+        for (std::size_t j = 0; j < 45; ++j)
+            matrix(i, j) = static_cast<int>(i * 100 + j);
+
+    auto transposed = matrix.transpose();
+
+    EXPECT_EQ(transposed.rows(), 45u);
+    EXPECT_EQ(transposed.cols(), 37u);
+
+    for (std::size_t i = 0; i < 37; ++i)
+        for (std::size_t j = 0; j < 45; ++j)
+            EXPECT_EQ(transposed(j, i), matrix(i, j));
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestMatrix class
+ * @param TestMultiply method
+ */
+TEST(TestMatrix, TestMultiply)
+{
+    Matrix<int> lhs(2, 3);
+    Matrix<int> rhs(3, 2);
+    int value = 1;
+
+    for (auto &element : lhs)
+        element = value++;
+
+    for (auto &element : rhs)
+        element = value++;
+
+    lhs *= rhs;
+
+    EXPECT_EQ(lhs.rows(), 2u);
+    EXPECT_EQ(lhs.cols(), 2u);
+    EXPECT_EQ(lhs(0, 0), 58);
+    EXPECT_EQ(lhs(0, 1), 64);
+    EXPECT_EQ(lhs(1, 0), 139);
+    EXPECT_EQ(lhs(1, 1), 154);
+    EXPECT_THROW(lhs *= rhs, std::invalid_argument);
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestMatrix class
+ * @param TestBlockedMultiply method
+ */
+TEST(TestMatrix, TestBlockedMultiply)
+{
+    ThreadPool thread_pool(4);
+    Matrix<double> lhs(131, 257);
+    Matrix<double> rhs(257, 67);
+    Matrix<double, MatrixLayout::ColumnMajor> column_lhs(131, 257);
+    Matrix<double, MatrixLayout::ColumnMajor> column_rhs(257, 67);
+
+    for (std::size_t i = 0; i < lhs.rows(); ++i)
+        for (std::size_t j = 0; j < lhs.cols(); ++j)
+            column_lhs(i, j) = lhs(i, j) = static_cast<double>((i * 7 + j) % 17) - 8.0;
+
+    for (std::size_t i = 0; i < rhs.rows(); ++i)
+        for (std::size_t j = 0; j < rhs.cols(); ++j)
+            column_rhs(i, j) = rhs(i, j) = static_cast<double>((i + j * 5) % 11) - 5.0;
+
+    auto product = lhs.multiply(rhs, &thread_pool);
+    auto column_product = column_lhs * column_rhs;
+
+    for (std::size_t i = 0; i < product.rows(); ++i)
+        for (std::size_t j = 0; j < product.cols(); ++j)
+        {
+            double expected = 0.0;
+
+            for (std::size_t k = 0; k < lhs.cols(); ++k)
+                expected += lhs(i, k) * rhs(k, j);
+
+            EXPECT_EQ(product(i, j), expected);
+            EXPECT_EQ(column_product(i, j), expected);
+        }
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestMatrix class
+ * @param TestExpressions method
+ */
+TEST(TestMatrix, TestExpressions)
+{
+    Matrix<float> a(2, 2, 1.0f);
+    Matrix<float> b(2, 2, 2.0f);
+
+    Matrix<float> sum = a + b * 3.0f - a / 2.0f;
+    EXPECT_EQ(sum(1, 1), 6.5f);
+
+    sum += a - b;
+    EXPECT_EQ(sum(0, 0), 5.5f);
+
+    Matrix<float> product = (a + b) * a;
+    EXPECT_EQ(product(0, 0), 6.0f);
+    EXPECT_EQ(Matrix<float>(-a)(0, 1), -1.0f);
+    EXPECT_THROW(a + Matrix<float>(3, 2), std::invalid_argument);
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestMatrix class
+ * @param TestStoredExpressions method
+ */
+TEST(TestMatrix, TestStoredExpressions)
+{
+    Matrix<float> a(2, 3, 1.0f);
+    a(0, 2) = 4.0f;
+
+    auto sum = a + Matrix<float>(2, 3, 2.0f);
+    EXPECT_EQ(Matrix<float>(sum)(0, 2), 6.0f);
+    EXPECT_EQ(sum(1, 0), 3.0f);
+    EXPECT_THROW(sum(2, 0), std::out_of_range);
+
+    Matrix<float> transposed = (a * 2.0f).transpose();
+    EXPECT_EQ(transposed.rows(), 3u);
+    EXPECT_EQ(transposed(2, 0), 8.0f);
+
+    Matrix<float, MatrixLayout::ColumnMajor> column(2, 3, 1.0f);
+    column(1, 2) = 5.0f;
+    EXPECT_EQ((column - column * 2.0f)(1, 2), -5.0f);
+
+    auto stored = -a;
+    float first = stored(0, 1);
+    Matrix<float> copy = stored;
+    copy(0, 0) = 7.0f;
+    a(0, 1) = 9.0f;
+    EXPECT_EQ(first, -1.0f);
+    EXPECT_EQ(stored(0, 0), -1.0f);
+    EXPECT_EQ(stored(0, 1), -9.0f);
+    EXPECT_EQ(copy(0, 0), 7.0f);
+    EXPECT_EQ(copy(0, 1), -1.0f);
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestMatrix class
+ * @param TestResize method
+ */
+TEST(TestMatrix, TestResize)
+{
+    Matrix<int> matrix(2, 2, 7);
+    matrix(1, 1) = 9;
+    matrix.resize(3, 1);
+
+    EXPECT_EQ(matrix.size(), 3u);
+    EXPECT_EQ(matrix(0, 0), 7);
+    EXPECT_EQ(matrix(1, 0), 7);
+    EXPECT_EQ(matrix(2, 0), 0);
+}
+
+#endif //! MATRIX_TEST_H
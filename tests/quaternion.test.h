@@ -0,0 +1,173 @@
+/**
+ * @file quaternion.test.h
+ * @author Carlos Salguero
+ * @brief Test class for the Quaternion class
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef QUATERNION_TEST_H
+#define QUATERNION_TEST_H
+
+// C++ Standard Library
+#include <numbers>
+#include <random>
+
+// Google Test Library
+#include <gtest/gtest.h>
+
+// Project headers
+#include "src/utils/math/quaternion.h"
+
+using namespace Math;
+
+namespace
+{
+    /**
+     * @brief
+     * Creates a random unit quaternion
+     * @tparam T Type of the components
+     * @param generator The random generator
+     * @return Quaternion<T> The random rotation
+     */
+    template <class T>
+    Quaternion<T> random_rotation(std::mt19937 &generator)
+    {
+        std::uniform_real_distribution<T> distribution(T(-1), T(1));
+
+        return Quaternion<T>(distribution(generator), distribution(generator),
+                             distribution(generator), distribution(generator))
+            .normalize();
+    }
+
+    /**
+     * @brief
+     * Checks that two quaternions are the same rotation, allowing q and -q
+     */
+    template <class T>
+    void expect_same_rotation(const Quaternion<T> &a, const Quaternion<T> &b, T tolerance)
+    {
+        T sign = a.dot(b) < T() ? T(-1) : T(1);
+
+        EXPECT_NEAR(a.x(), sign * b.x(), tolerance);
+        EXPECT_NEAR(a.y(), sign * b.y(), tolerance);
+        EXPECT_NEAR(a.z(), sign * b.z(), tolerance);
+        EXPECT_NEAR(a.w(), sign * b.w(), tolerance);
+    }
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestQuaternion class
+ * @param TestMultiplication method
+ */
+TEST(TestQuaternion, TestMultiplication)
+{
+    std::mt19937 generator(3);
+
+    for (int iteration = 0; iteration < 100; ++iteration)
+    {
+        Quaternion<float> a = random_rotation<float>(generator);
+        Quaternion<float> b = random_rotation<float>(generator);
+        Quaternion<double> a_double(a.x(), a.y(), a.z(), a.w());
+        Quaternion<double> b_double(b.x(), b.y(), b.z(), b.w());
+
+        // The SIMD float product against the scalar double one
+        Quaternion<float> product = a * b;
+        Quaternion<double> product_double = a_double * b_double;
+
+        EXPECT_NEAR(product.x(), product_double.x(), 1e-5);
+        EXPECT_NEAR(product.y(), product_double.y(), 1e-5);
+        EXPECT_NEAR(product.z(), product_double.z(), 1e-5);
+        EXPECT_NEAR(product.w(), product_double.w(), 1e-5);
+
+        // a * b rotates by b and then by a, like the matrices
+        Vec3 v(1.0f, -2.0f, 0.5f);
+        Vec3 rotated = product * v;
+        Vec3 expected = a * (b * v);
+        Vec3 by_matrix = (a.to_mat3() * b.to_mat3()) * v;
+
+        for (std::size_t i = 0; i < 3; ++i)
+        {
+            EXPECT_NEAR(rotated[i], expected[i], 1e-5f);
+            EXPECT_NEAR(rotated[i], by_matrix[i], 1e-5f);
+        }
+
+        expect_same_rotation(a * a.inverse(), Quaternion<float>::identity(), 1e-6f);
+    }
+
+    // Quarter turn around z maps x to y
+    Quaternion<float> quarter =
+        Quaternion<float>::from_axis_angle(Vec3(0.0f, 0.0f, 1.0f), std::numbers::pi_v<float> / 2);
+    Vec3 y = quarter * Vec3(1.0f, 0.0f, 0.0f);
+
+    EXPECT_NEAR(y.x(), 0.0f, 1e-6f);
+    EXPECT_NEAR(y.y(), 1.0f, 1e-6f);
+    EXPECT_THROW(Quaternion<float>(0, 0, 0, 0).inverse(), std::invalid_argument);
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestQuaternion class
+ * @param TestMatrixConversion method
+ */
+TEST(TestQuaternion, TestMatrixConversion)
+{
+    std::mt19937 generator(5);
+
+    for (int iteration = 0; iteration < 200; ++iteration)
+    {
+        Quaternion<double> rotation = random_rotation<double>(generator);
+
+        expect_same_rotation(Quaternion<double>::from_mat3(rotation.to_mat3()), rotation, 1e-12);
+        expect_same_rotation(Quaternion<double>::from_mat4(rotation.to_mat4()), rotation, 1e-12);
+    }
+
+    // Half turns take the branches where the trace is not positive
+    for (const Vec<3, double> &axis : {Vec<3, double>(1, 0, 0), Vec<3, double>(0, 1, 0),
+                                       Vec<3, double>(0, 0, 1)})
+    {
+        auto half_turn = Quaternion<double>::from_axis_angle(axis, std::numbers::pi);
+        expect_same_rotation(Quaternion<double>::from_mat3(half_turn.to_mat3()), half_turn, 1e-12);
+    }
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestQuaternion class
+ * @param TestInterpolation method
+ */
+TEST(TestQuaternion, TestInterpolation)
+{
+    Vec<3, double> axis(0, 0, 1);
+    auto from = Quaternion<double>::from_axis_angle(axis, 0.0);
+    auto to = Quaternion<double>::from_axis_angle(axis, 2.0);
+
+    // slerp moves at constant angular speed
+    for (double t : {0.0, 0.25, 0.5, 0.9, 1.0})
+        expect_same_rotation(Quaternion<double>::slerp(from, to, t),
+                             Quaternion<double>::from_axis_angle(axis, 2.0 * t), 1e-12);
+
+    // nlerp is halfway at t = 0.5 by symmetry and stays normalized elsewhere
+    expect_same_rotation(Quaternion<double>::nlerp(from, to, 0.5),
+                         Quaternion<double>::from_axis_angle(axis, 1.0), 1e-12);
+    EXPECT_NEAR(Quaternion<double>::nlerp(from, to, 0.3).magnitude(), 1.0, 1e-12);
+
+    // Both take the shorter arc when the ends are in opposite hemispheres
+    auto halfway = Quaternion<double>::slerp(from, -to, 0.5);
+    expect_same_rotation(halfway, Quaternion<double>::from_axis_angle(axis, 1.0), 1e-12);
+    EXPECT_GT(halfway.w(), 0.0);
+
+    // Nearly equal rotations use the nlerp fallback
+    auto close = Quaternion<double>::from_axis_angle(axis, 1e-4);
+    expect_same_rotation(Quaternion<double>::slerp(from, close, 0.5),
+                         Quaternion<double>::from_axis_angle(axis, 5e-5), 1e-9);
+}
+
+#endif //! QUATERNION_TEST_H
@@ -0,0 +1,462 @@
+/**
+ * @file random.test.h
+ * @author Carlos Salguero
+ * @brief Test class for the random generators, distributions and engine
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef RANDOM_TEST_H
+#define RANDOM_TEST_H
+
+// C++ Standard Library
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+// Google Test Library
+#include <gtest/gtest.h>
+
+// Project headers
+#include "src/utils/random/random.h"
+#include "src/threads/thread_pool.h"
+
+using namespace Math;
+
+namespace
+{
+    /**
+     * @brief
+     * Hashes the bits of generated samples with 64-bit FNV-1a
+     * @tparam F Type of the sampler
+     * @param count Number of samples
+     * @param sample Returns the next float or double
+     * @return std::uint64_t The hash
+     */
+    template <class F>
+    std::uint64_t hash_samples(int count, F sample)
+    {
+        std::uint64_t hash = 0xcbf29ce484222325u;
+
+        for (int i = 0; i < count; ++i)
+        {
+            auto value = sample();
+            unsigned char bytes[sizeof(value)];
+            std::memcpy(bytes, &value, sizeof(value));
+
+            for (unsigned char byte : bytes)
+            {
+                hash ^= byte;
+                hash *= 0x100000001b3u;
+            }
+        }
+
+        return hash;
+    }
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestRandom class
+ * @param TestGenerators method
+ */
+TEST(TestRandom, TestGenerators)
+{
+    static_assert(std::uniform_random_bit_generator<SplitMix64>);
+    static_assert(std::uniform_random_bit_generator<Xoshiro256StarStar>);
+    static_assert(std::uniform_random_bit_generator<Pcg64>);
+
+    // Outputs of the reference implementations
+    static_assert(SplitMix64(1234567)() == 6457827717110365317u);
+
+    SplitMix64 splitmix(1234567);
+    splitmix();
+    EXPECT_EQ(splitmix(), 3203168211198807973u);
+    EXPECT_EQ(splitmix(), 9817491932198370423u);
+
+    Xoshiro256StarStar xoshiro(std::array<std::uint64_t, 4>{1, 2, 3, 4});
+    EXPECT_EQ(xoshiro(), 11520u);
+    EXPECT_EQ(xoshiro(), 0u);
+    EXPECT_EQ(xoshiro(), 1509978240u);
+    EXPECT_EQ(xoshiro(), 1215971899390074240u);
+
+    Pcg64 pcg(42, 54);
+    EXPECT_EQ(pcg(), 0x86b1da1d72062b68u);
+    EXPECT_EQ(pcg(), 0x1304aa46c9853d39u);
+    EXPECT_EQ(pcg(), 0xa3670e9e0dd50358u);
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestRandom class
+ * @param TestStreams method
+ */
+TEST(TestRandom, TestStreams)
+{
+    // Advancing skips exactly the same values as stepping
+    Pcg64 pcg(9, 4);
+    Pcg64 stepped = pcg;
+
+    pcg.advance({0, 1000});
+
+    for (int i = 0; i < 1000; ++i)
+        stepped();
+
+    EXPECT_EQ(pcg, stepped);
+
+    SplitMix64 splitmix(5);
+    SplitMix64 skipped = splitmix;
+
+    splitmix.advance(10);
+
+    for (int i = 0; i < 10; ++i)
+        skipped();
+
+    EXPECT_EQ(splitmix, skipped);
+
+    // split() hands out the current position and moves past it
+    Xoshiro256StarStar xoshiro(11);
+    Xoshiro256StarStar copy = xoshiro;
+    Xoshiro256StarStar stream = xoshiro.split();
+
+    EXPECT_EQ(stream, copy);
+    EXPECT_NE(xoshiro, copy);
+
+    copy.jump();
+    EXPECT_EQ(xoshiro, copy);
+
+    Pcg64 first(3);
+    Pcg64 second = first.split();
+    EXPECT_NE(first(), second());
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestRandom class
+ * @param TestDistributions method
+ */
+TEST(TestRandom, TestDistributions)
+{
+    // Golden values: the portable distributions must never change them
+    Xoshiro256StarStar generator(7);
+    UniformRealDistribution<float> uniform(-1.0f, 1.0f);
+
+    EXPECT_EQ(uniform(generator), 0x1.9ac7dp-2f);
+    EXPECT_EQ(uniform(generator), -0x1.c51e18p-2f);
+    EXPECT_EQ(uniform(generator), 0x1.5bc74cp-1f);
+
+    UniformRealDistribution<double> unit;
+
+    for (int i = 0; i < 10000; ++i)
+    {
+        double value = unit(generator);
+        ASSERT_TRUE(value >= 0.0 && value < 1.0);
+    }
+
+    // Every value of a small range, none outside it, about equally often
+    UniformIntDistribution<int> dice(-3, 3);
+    std::array<int, 7> counts{};
+
+    for (int i = 0; i < 70000; ++i)
+    {
+        int value = dice(generator);
+        ASSERT_TRUE(value >= -3 && value <= 3);
+        ++counts[value + 3];
+    }
+
+    for (int count : counts)
+        EXPECT_NEAR(count, 10000, 500);
+
+    UniformIntDistribution<std::uint64_t> full;
+    EXPECT_EQ(full.max(), UINT64_MAX);
+    full(generator);
+
+    NormalDistribution<double> normal(2.0, 3.0);
+    Pcg64 source(5);
+    double sum = 0.0;
+    double squares = 0.0;
+    const int samples = 200000;
+
+    for (int i = 0; i < samples; ++i)
+    {
+        double value = normal(source);
+        sum += value;
+        squares += value * value;
+    }
+
+    double mean = sum / samples;
+    EXPECT_NEAR(mean, 2.0, 0.03);
+    EXPECT_NEAR(squares / samples - mean * mean, 9.0, 0.1);
+
+    for (double value : {1e-300, 0.001, 0.5, 0.9999, 1.0, 1.5, 10.0, 1e300})
+        EXPECT_NEAR(Detail::portable_log(value), std::log(value), 4e-16 * std::fabs(std::log(value)) + 1e-300);
+
+    EXPECT_DOUBLE_EQ(Detail::portable_log(4.9406564584124654e-324), std::log(4.9406564584124654e-324));
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestRandom class
+ * @param TestGoldenHashes method
+ */
+TEST(TestRandom, TestGoldenHashes)
+{
+    // A million samples of each distribution, hashed bit for bit. Any
+    // change of rounding, such as a fused multiply-add, changes the hash.
+    Xoshiro256StarStar generator(2026);
+    const int samples = 1000000;
+
+    UniformRealDistribution<float> uniform_float(-3.0f, 5.0f);
+    EXPECT_EQ(hash_samples(samples, [&]
+                           { return uniform_float(generator); }),
+              0x53996309306e4506u);
+
+    UniformRealDistribution<double> uniform_double(-3.0, 5.0);
+    EXPECT_EQ(hash_samples(samples, [&]
+                           { return uniform_double(generator); }),
+              0xbb763643ec71462du);
+
+    NormalDistribution<double> normal_double(1.0, 2.0);
+    EXPECT_EQ(hash_samples(samples, [&]
+                           { return normal_double(generator); }),
+              0x9f671730502807e4u);
+
+    NormalDistribution<float> normal_float(1.0f, 2.0f);
+    EXPECT_EQ(hash_samples(samples, [&]
+                           { return normal_float(generator); }),
+              0x096a61ac9426e130u);
+
+    EXPECT_EQ(hash_samples(samples, [&]
+                           { return Detail::portable_log(word_to_unit_double(generator()) * 1e6 + 1e-300); }),
+              0x92a830eddb27f4ebu);
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestRandom class
+ * @param TestPhilox method
+ */
+TEST(TestRandom, TestPhilox)
+{
+    static_assert(std::uniform_random_bit_generator<Philox4x32>);
+
+    // Known answers of the reference implementation
+    constexpr auto zeros = Detail::philox({0, 0, 0, 0}, {0, 0});
+    static_assert(zeros == std::array<std::uint32_t, 4>{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8});
+
+    EXPECT_EQ(Detail::philox({0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, {0xffffffff, 0xffffffff}),
+              (std::array<std::uint32_t, 4>{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}));
+    EXPECT_EQ(Detail::philox({0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}, {0xa4093822, 0x299f31d0}),
+              (std::array<std::uint32_t, 4>{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}));
+
+    // Any value can be read directly, or reached by seeking
+    Philox4x32 generator(17, 3);
+    std::vector<std::uint64_t> values(9);
+
+    for (auto &value : values)
+        value = generator();
+
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        EXPECT_EQ(generator.at(i), values[i]);
+
+        Philox4x32 seeked(17, 3);
+        seeked.seek(i);
+        EXPECT_EQ(seeked(), values[i]);
+    }
+
+    Philox4x32 skipped(17, 3);
+    skipped();
+    skipped.discard(4);
+    EXPECT_EQ(skipped(), values[5]);
+    EXPECT_EQ(skipped.get_position(), 6u);
+
+    EXPECT_NE(Philox4x32(17, 4)(), values[0]);
+    EXPECT_NE(Philox4x32(18, 3)(), values[0]);
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestRandom class
+ * @param TestParallelGenerate method
+ */
+TEST(TestRandom, TestParallelGenerate)
+{
+    // Rejection sampling draws a varying number of values per element
+    const std::size_t count = 3 * Detail::RANDOM_BAND + 5;
+
+    auto generate = [count](ThreadPool *thread_pool)
+    {
+        std::vector<double> values(count);
+
+        parallel_generate(count, 2026, [&values](std::size_t i, Philox4x32 &generator)
+                          {
+                              NormalDistribution<double> normal;
+                              values[i] = normal(generator); }, thread_pool);
+
+        return values;
+    };
+
+    std::vector<double> serial = generate(nullptr);
+
+    ThreadPool one(1);
+    ThreadPool four(4);
+
+    EXPECT_EQ(generate(&one), serial);
+    EXPECT_EQ(generate(&four), serial);
+
+    // Each element reads its own stream
+    Philox4x32 last(2026, count - 1);
+    NormalDistribution<double> normal;
+    EXPECT_EQ(normal(last), serial.back());
+
+    // A throwing band only returns once the queued bands are done
+    std::atomic<std::size_t> calls = 0;
+    const std::size_t queued = 3 * Detail::RANDOM_BAND;
+
+    EXPECT_THROW(parallel_generate(count, 2026, [&calls, queued](std::size_t i, Philox4x32 &)
+                                   {
+                                       if (i == queued)
+                                           throw std::runtime_error("band failed");
+
+                                       ++calls; }, &one),
+                 std::runtime_error);
+
+    EXPECT_EQ(calls.load(), queued);
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestRandom class
+ * @param TestBatch method
+ */
+TEST(TestRandom, TestBatch)
+{
+    // Odd sizes cover the partial chunk, register and pair
+    const std::size_t count = 2 * Detail::RANDOM_CHUNK + 13;
+
+    // Uniform values are the halves of the generator words
+    std::vector<float> uniform(count);
+    Xoshiro256StarStar generator(21);
+    fill_uniform(uniform, -2.0f, 6.0f, generator);
+
+    Xoshiro256StarStar words(21);
+
+    for (std::size_t i = 0; i < count; i += 2)
+    {
+        std::uint64_t word = words();
+        ASSERT_EQ(uniform[i], -2.0f + 8.0f * word_to_unit_float(word << 32));
+
+        if (i + 1 < count)
+        {
+            ASSERT_EQ(uniform[i + 1], -2.0f + 8.0f * word_to_unit_float(word));
+        }
+    }
+
+    EXPECT_EQ(generator, words);
+
+    std::vector<float> normal(100001);
+    Pcg64 source(8);
+    fill_normal(normal, 1.0f, 2.0f, source);
+
+    double sum = 0.0;
+    double squares = 0.0;
+
+    for (float value : normal)
+    {
+        ASSERT_TRUE(std::isfinite(value));
+        sum += value;
+        squares += static_cast<double>(value) * value;
+    }
+
+    double mean = sum / normal.size();
+    EXPECT_NEAR(mean, 1.0, 0.03);
+    EXPECT_NEAR(squares / normal.size() - mean * mean, 4.0, 0.1);
+
+    // Directions have unit length and no preferred side
+    std::vector<float> x(count), y(count), z(count);
+    RandomEngine<float> engine(0.0f, 1.0f, 4);
+    engine.fill_unit_vectors3({x, y, z});
+
+    double center[3] = {};
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        ASSERT_NEAR(x[i] * x[i] + y[i] * y[i] + z[i] * z[i], 1.0f, 1e-5f);
+        center[0] += x[i];
+        center[1] += y[i];
+        center[2] += z[i];
+    }
+
+    for (double sum : center)
+        EXPECT_NEAR(sum / count, 0.0, 0.05);
+
+    std::vector<float> short_z(count - 1);
+    EXPECT_THROW(engine.fill_unit_vectors3({x, y, short_z}), std::invalid_argument);
+
+    // The same seed fills the same values
+    std::vector<float> first(37), second(37);
+    RandomEngine<float> a(0.0f, 1.0f, 77);
+    RandomEngine<float> b(0.0f, 1.0f, 77);
+    a.fill_normal(first, 0.0f, 1.0f);
+    b.fill_normal(second, 0.0f, 1.0f);
+    EXPECT_EQ(first, second);
+
+    a.fill_uniform(first, 0.0f, 1.0f);
+    EXPECT_TRUE(std::all_of(first.begin(), first.end(), [](float value)
+                            { return value >= 0.0f && value < 1.0f; }));
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestRandom class
+ * @param TestEngine method
+ */
+TEST(TestRandom, TestEngine)
+{
+    RandomEngine<float> a(0.0f, 10.0f, 99);
+    RandomEngine<float> b(0.0f, 10.0f, 99);
+
+    for (int i = 0; i < 100; ++i)
+    {
+        float value = a.get_random_number();
+        ASSERT_EQ(value, b.get_random_number());
+        ASSERT_TRUE(value >= 0.0f && value < 10.0f);
+    }
+
+    // Streams of split engines differ from each other and the parent
+    auto stream = a.split();
+    EXPECT_NE(stream.get_random_number(), a.get_random_number());
+
+    RandomEngine<double, Pcg64> pcg(-1.0, 1.0, 5);
+    auto direction = pcg.get_random_direction_vector3D();
+    EXPECT_NEAR(direction.magnitude(), 1.0, 1e-12);
+
+    auto rotation = pcg.get_random_rotation();
+    EXPECT_NEAR(rotation.magnitude(), 1.0, 1e-12);
+
+    RandomEngine<float, Philox4x32> counter_based(0.0f, 1.0f, 8);
+    EXPECT_EQ(counter_based.get_random_number(), word_to_unit_float(Philox4x32(8).at(0)));
+
+    RandomEngine<float> clock_seeded(0.0f, 1.0f);
+    float value = clock_seeded.get_random_number();
+    EXPECT_TRUE(value >= 0.0f && value < 1.0f);
+}
+
+#endif //! RANDOM_TEST_H
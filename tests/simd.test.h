@@ -0,0 +1,166 @@
+/**
+ * @file simd.test.h
+ * @author Carlos Salguero
+ * @brief Test class for the SIMD vector and matrix classes
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef SIMD_TEST_H
+#define SIMD_TEST_H
+
+// C++ Standard Library
+#include <random>
+
+// Google Test Library
+#include <gtest/gtest.h>
+
+// Project headers
+#include "src/utils/math/simd.h"
+
+using namespace Math;
+
+namespace
+{
+    /**
+     * @brief
+     * Creates a matrix with random elements in [-2, 2]
+     * @param generator The random generator
+     * @return Mat4 The random matrix
+     */
+    Mat4 random_mat4(std::mt19937 &generator)
+    {
+        std::uniform_real_distribution<float> distribution(-2.0f, 2.0f);
+        Mat4 result;
+
+        for (std::size_t i = 0; i < 4; ++i)
+            for (std::size_t j = 0; j < 4; ++j)
+                result(i, j) = distribution(generator);
+
+        return result;
+    }
+
+    /**
+     * @brief
+     * Inverts a matrix by cofactor expansion, as the scalar reference
+     * @param matrix The matrix to invert
+     * @return Mat4 The inverse matrix
+     */
+    Mat4 cofactor_inverse(const Mat4 &matrix)
+    {
+        Mat4 result;
+        float determinant = matrix.determinant();
+
+        for (std::size_t i = 0; i < 4; ++i)
+            for (std::size_t j = 0; j < 4; ++j)
+            {
+                float sign = (i + j) % 2 == 0 ? 1.0f : -1.0f;
+                result(j, i) = sign * matrix.minor(i, j).determinant() / determinant;
+            }
+
+        return result;
+    }
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestSimd class
+ * @param TestVectorOperations method
+ */
+TEST(TestSimd, TestVectorOperations)
+{
+    Vec3 a(1.0f, -2.0f, 3.5f);
+    Vec3 b(0.5f, 4.0f, -1.0f);
+    Simd::Float4 simd_a(a[0], a[1], a[2], 7.0f);
+    Simd::Float4 simd_b(b[0], b[1], b[2], 9.0f);
+
+    Vec3 cross = a.cross(b);
+    Simd::Float4 simd_cross = simd_a.cross(simd_b);
+
+    for (std::size_t i = 0; i < 3; ++i)
+        EXPECT_FLOAT_EQ(simd_cross[i], cross[i]);
+
+    EXPECT_EQ(simd_cross.w(), 0.0f);
+    EXPECT_FLOAT_EQ(simd_a.dot3(simd_b), a.dot(b));
+    EXPECT_FLOAT_EQ(simd_a.dot(simd_b), a.dot(b) + 63.0f);
+
+    Vec3 normalized = a.normalize();
+    Simd::Float4 simd_normalized = simd_a.normalize3();
+
+    for (std::size_t i = 0; i < 3; ++i)
+        EXPECT_FLOAT_EQ(simd_normalized[i], normalized[i]);
+
+    EXPECT_EQ(simd_normalized.w(), 7.0f);
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestSimd class
+ * @param TestMatrixOperations method
+ */
+TEST(TestSimd, TestMatrixOperations)
+{
+    std::mt19937 generator(42);
+
+    for (int iteration = 0; iteration < 100; ++iteration)
+    {
+        Mat4 a = random_mat4(generator);
+        Mat4 b = random_mat4(generator);
+        Vec4 v(1.0f, -0.5f, 2.0f, 1.0f);
+
+        Simd::Float4x4 simd_a(a);
+        Simd::Float4x4 simd_b(b);
+
+        EXPECT_EQ(simd_a.to_mat(), a);
+        EXPECT_EQ(simd_a.transpose().to_mat(), a.transpose());
+
+        Mat4 product = a * b;
+        Mat4 simd_product = (simd_a * simd_b).to_mat();
+        Vec4 transformed = a * v;
+        Vec4 simd_transformed = (simd_a * Simd::Float4(v)).to_vec();
+
+        for (std::size_t i = 0; i < 4; ++i)
+        {
+            EXPECT_NEAR(simd_transformed[i], transformed[i], 1e-5f);
+
+            for (std::size_t j = 0; j < 4; ++j)
+                EXPECT_NEAR(simd_product(i, j), product(i, j), 1e-5f);
+        }
+    }
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestSimd class
+ * @param TestInverse method
+ */
+TEST(TestSimd, TestInverse)
+{
+    std::mt19937 generator(7);
+
+    for (int iteration = 0; iteration < 100; ++iteration)
+    {
+        Mat4 matrix = random_mat4(generator);
+
+        if (std::abs(matrix.determinant()) < 0.1f)
+            continue;
+
+        Mat4 expected = cofactor_inverse(matrix);
+        Mat4 inverse = Simd::Float4x4(matrix).inverse().to_mat();
+
+        for (std::size_t i = 0; i < 4; ++i)
+            for (std::size_t j = 0; j < 4; ++j)
+                EXPECT_NEAR(inverse(i, j), expected(i, j),
+                            1e-4f * (1.0f + std::abs(expected(i, j))));
+    }
+
+    EXPECT_THROW(Simd::Float4x4(Mat4()).inverse(), std::invalid_argument);
+}
+
+#endif //! SIMD_TEST_H
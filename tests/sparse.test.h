@@ -0,0 +1,284 @@
+/**
+ * @file sparse.test.h
+ * @author Carlos Salguero
+ * @brief Test class for the sparse matrices and iterative solvers
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef SPARSE_TEST_H
+#define SPARSE_TEST_H
+
+// C++ Standard Library
+#include <cmath>
+#include <random>
+#include <vector>
+
+// Google Test Library
+#include <gtest/gtest.h>
+
+// Project headers
+#include "src/utils/math/sparse.h"
+
+using namespace Math;
+
+namespace
+{
+    /**
+     * @brief
+     * Builds the 5-point Laplacian of a size x size grid, a symmetric
+     * positive definite matrix like those of cloth and fluid solvers
+     * @param size Nodes per side of the grid
+     * @return SparseMatrix<double> The matrix
+     */
+    SparseMatrix<double> grid_laplacian(std::size_t size)
+    {
+        std::vector<SparseEntry<double>> entries;
+
+        for (std::size_t y = 0; y < size; ++y)
+            for (std::size_t x = 0; x < size; ++x)
+            {
+                std::size_t i = y * size + x;
+                entries.push_back({i, i, 4.0});
+
+                if (x > 0)
+                    entries.push_back({i, i - 1, -1.0});
+                if (x + 1 < size)
+                    entries.push_back({i, i + 1, -1.0});
+                if (y > 0)
+                    entries.push_back({i, i - size, -1.0});
+                if (y + 1 < size)
+                    entries.push_back({i, i + size, -1.0});
+            }
+
+        return SparseMatrix<double>::from_entries(size * size, size * size, std::move(entries));
+    }
+
+    /**
+     * @brief
+     * Creates a random sparse matrix with about density of its elements set
+     */
+    Matrix<double> random_sparse_dense(std::size_t rows, std::size_t cols, double density,
+                                       std::mt19937 &generator)
+    {
+        std::uniform_real_distribution<double> distribution(0.0, 1.0);
+        Matrix<double> result(rows, cols);
+
+        for (std::size_t i = 0; i < rows; ++i)
+            for (std::size_t j = 0; j < cols; ++j)
+                if (distribution(generator) < density)
+                    result(i, j) = distribution(generator) - 0.5;
+
+        return result;
+    }
+
+    /**
+     * @brief
+     * Calculates the dense product A x
+     */
+    Vector<double> dense_product(const Matrix<double> &a, const Vector<double> &x)
+    {
+        Vector<double> result(a.rows());
+
+        for (std::size_t i = 0; i < a.rows(); ++i)
+            for (std::size_t j = 0; j < a.cols(); ++j)
+                result[i] += a(i, j) * x[j];
+
+        return result;
+    }
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestSparseMatrix class
+ * @param TestConversion method
+ */
+TEST(TestSparseMatrix, TestConversion)
+{
+    std::mt19937 generator(21);
+    Matrix<double> dense = random_sparse_dense(13, 9, 0.3, generator);
+    auto sparse = SparseMatrix<double>::from_dense(dense);
+
+    EXPECT_EQ(sparse.rows(), 13u);
+    EXPECT_EQ(sparse.cols(), 9u);
+    EXPECT_LT(sparse.non_zeros(), 13u * 9u);
+
+    Matrix<double> round_trip = sparse.to_dense();
+    Matrix<double> transposed = sparse.transpose().to_dense();
+
+    for (std::size_t i = 0; i < 13; ++i)
+        for (std::size_t j = 0; j < 9; ++j)
+        {
+            EXPECT_EQ(sparse(i, j), dense(i, j));
+            EXPECT_EQ(round_trip(i, j), dense(i, j));
+            EXPECT_EQ(transposed(j, i), dense(i, j));
+        }
+
+    // Repeated entries add up, and empty rows are allowed
+    auto assembled = SparseMatrix<double>::from_entries(
+        4, 4, {{2, 1, 1.0}, {0, 3, 2.0}, {2, 1, 0.5}, {0, 0, 1.0}});
+
+    EXPECT_EQ(assembled.non_zeros(), 3u);
+    EXPECT_EQ(assembled(2, 1), 1.5);
+    EXPECT_EQ(assembled(0, 3), 2.0);
+    EXPECT_EQ(assembled(1, 1), 0.0);
+    EXPECT_EQ(assembled(3, 3), 0.0);
+
+    EXPECT_THROW(SparseMatrix<double>::from_entries(2, 2, {{2, 0, 1.0}}), std::out_of_range);
+    EXPECT_THROW(SparseMatrix<double>(2, 2, {0, 1, 1}, {0}, {}), std::invalid_argument);
+    EXPECT_THROW(SparseMatrix<double>(1, 2, {0, 2}, {1, 0}, {1.0, 1.0}), std::invalid_argument);
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestSparseMatrix class
+ * @param TestMultiply method
+ */
+TEST(TestSparseMatrix, TestMultiply)
+{
+    std::mt19937 generator(22);
+    std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+    ThreadPool thread_pool(4);
+
+    // Large enough to be split into several bands
+    Matrix<double> dense = random_sparse_dense(600, 300, 0.2, generator);
+    Vector<double> x(300);
+
+    for (std::size_t i = 0; i < x.size(); ++i)
+        x[i] = distribution(generator);
+
+    auto sparse = SparseMatrix<double>::from_dense(dense);
+    BlockSparseMatrix<double, 3> blocked(sparse);
+    Vector<double> expected = dense_product(dense, x);
+    Vector<double> serial = sparse * x;
+    Vector<double> parallel = sparse.multiply(x, &thread_pool);
+    Vector<double> block_product = blocked * x;
+
+    ASSERT_GT(sparse.non_zeros(), Detail::SPARSE_BAND);
+
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+        EXPECT_NEAR(serial[i], expected[i], 1e-12);
+        EXPECT_NEAR(parallel[i], expected[i], 1e-12);
+        EXPECT_NEAR(block_product[i], expected[i], 1e-12);
+    }
+
+    std::vector<double> x_values(x.size());
+    std::vector<double> y_values(expected.size());
+
+    for (std::size_t i = 0; i < x.size(); ++i)
+        x_values[i] = x[i];
+
+    blocked.multiply(x_values, y_values, &thread_pool);
+
+    for (std::size_t i = 0; i < expected.size(); ++i)
+        EXPECT_NEAR(y_values[i], expected[i], 1e-12);
+
+    EXPECT_THROW(sparse * Vector<double>(3), std::invalid_argument);
+    EXPECT_THROW((BlockSparseMatrix<double, 7>(sparse)), std::invalid_argument);
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestSparseMatrix class
+ * @param TestBlockConversion method
+ */
+TEST(TestSparseMatrix, TestBlockConversion)
+{
+    std::mt19937 generator(23);
+    Matrix<double> dense = random_sparse_dense(12, 8, 0.15, generator);
+    dense(5, 5) = 2.0;
+
+    auto blocked = BlockSparseMatrix<double, 2>::from_dense(dense);
+    Matrix<double> round_trip = blocked.to_dense();
+    std::vector<double> diagonal = blocked.diagonal();
+
+    EXPECT_EQ(blocked.rows(), 12u);
+    EXPECT_EQ(blocked.cols(), 8u);
+    ASSERT_EQ(diagonal.size(), 8u);
+
+    for (std::size_t i = 0; i < 12; ++i)
+        for (std::size_t j = 0; j < 8; ++j)
+            EXPECT_EQ(round_trip(i, j), dense(i, j));
+
+    for (std::size_t i = 0; i < 8; ++i)
+        EXPECT_EQ(diagonal[i], dense(i, i));
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestSparseMatrix class
+ * @param TestSolvers method
+ */
+TEST(TestSparseMatrix, TestSolvers)
+{
+    ThreadPool thread_pool(4);
+    auto laplacian = grid_laplacian(24);
+    std::size_t n = laplacian.rows();
+    Vector<double> expected(n);
+
+    for (std::size_t i = 0; i < n; ++i)
+        expected[i] = std::sin(0.1 * static_cast<double>(i));
+
+    Vector<double> b = laplacian * expected;
+    SolverOptions<double> options;
+    options.tolerance = 1e-10;
+    options.thread_pool = &thread_pool;
+
+    std::size_t iterations[3] = {};
+    Preconditioner preconditioners[3] = {Preconditioner::None, Preconditioner::Jacobi,
+                                         Preconditioner::SymmetricGaussSeidel};
+
+    for (std::size_t p = 0; p < 3; ++p)
+    {
+        options.preconditioner = preconditioners[p];
+        Vector<double> x(n);
+        SolverResult<double> result = conjugate_gradient(laplacian, b, x, options);
+
+        EXPECT_TRUE(result.converged);
+        EXPECT_LE(result.residual, 1e-10);
+        iterations[p] = result.iterations;
+
+        for (std::size_t i = 0; i < n; ++i)
+            EXPECT_NEAR(x[i], expected[i], 1e-8);
+    }
+
+    // Symmetric Gauss-Seidel roughly halves the iterations of plain CG
+    EXPECT_LT(iterations[2], iterations[0]);
+
+    // The blocked matrix gives the same answer
+    BlockSparseMatrix<double, 2> blocked(laplacian);
+    Vector<double> x(n);
+    options.preconditioner = Preconditioner::Jacobi;
+
+    EXPECT_TRUE(conjugate_gradient(blocked, b, x, options).converged);
+    EXPECT_NEAR(x[100], expected[100], 1e-8);
+
+    options.preconditioner = Preconditioner::SymmetricGaussSeidel;
+    EXPECT_THROW(conjugate_gradient(blocked, b, x, options), std::invalid_argument);
+
+    // Plain Gauss-Seidel converges more slowly but gets there
+    options.max_iterations = 5000;
+    options.tolerance = 1e-8;
+    Vector<double> y(n);
+    SolverResult<double> result = gauss_seidel(laplacian, b, y, options);
+
+    EXPECT_TRUE(result.converged);
+    EXPECT_GT(result.iterations, iterations[2]);
+    EXPECT_NEAR(y[100], expected[100], 1e-6);
+
+    SparseMatrix<double> no_diagonal(2, 2, {0, 1, 2}, {1, 0}, {1.0, 1.0});
+    Vector<double> z(2);
+
+    EXPECT_THROW(gauss_seidel(no_diagonal, Vector<double>(2), z), std::invalid_argument);
+    EXPECT_THROW(conjugate_gradient(laplacian, Vector<double>(3), z), std::invalid_argument);
+}
+
+#endif //! SPARSE_TEST_H
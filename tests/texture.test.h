@@ -0,0 +1,245 @@
+/**
+ * @file texture.test.h
+ * @author Carlos Salguero
+ * @brief Test class for the mipmap generator and cooked textures
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef TEXTURE_TEST_H
+#define TEXTURE_TEST_H
+
+// C++ Standard Library
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Google Test Library
+#include <gtest/gtest.h>
+
+// Project headers
+#include "src/graphics/texture/mipmap.h"
+#include "src/graphics/texture/texture.h"
+#include "src/threads/thread_pool.h"
+
+namespace
+{
+    /**
+     * @brief
+     * Builds an image whose columns alternate between two pixels
+     * @param width Width of the image
+     * @param height Height of the image
+     * @param even Pixel of the even columns
+     * @param odd Pixel of the odd columns
+     * @return Image The image, with as many channels as the pixels
+     */
+    Image striped_image(std::uint32_t width, std::uint32_t height,
+                        const std::vector<std::uint8_t> &even,
+                        const std::vector<std::uint8_t> &odd)
+    {
+        auto channels = static_cast<std::uint32_t>(even.size());
+        Image image(width, height, channels);
+
+        for (std::uint32_t y = 0; y < height; ++y)
+            for (std::uint32_t x = 0; x < width; ++x)
+                for (std::uint32_t c = 0; c < channels; ++c)
+                    image.get_pixel(x, y)[c] = x % 2 == 0 ? even[c] : odd[c];
+
+        return image;
+    }
+
+    /**
+     * @brief
+     * Overwrites an unsigned integer stored in little endian order
+     * @param data Buffer to write to
+     * @param offset Offset of the integer
+     * @param value Value to write
+     * @param bytes Number of bytes of the integer
+     */
+    void write_integer(std::string &data, std::size_t offset, std::uint64_t value, int bytes)
+    {
+        for (int i = 0; i < bytes; ++i)
+            data[offset + i] = static_cast<char>((value >> (8 * i)) & 0xFF);
+    }
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestTexture class
+ * @param TestMipChain method
+ */
+TEST(TestTexture, TestMipChain)
+{
+    EXPECT_EQ(MipmapGenerator::get_mip_count(8, 4), 4u);
+    EXPECT_EQ(MipmapGenerator::get_mip_count(1, 1), 1u);
+    EXPECT_EQ(MipmapGenerator::get_mip_count(300, 7), 9u);
+
+    auto gray = striped_image(8, 4, {0, 0, 0, 255}, {255, 255, 255, 255});
+
+    MipmapGenerator linear(MipFilter::Box, false);
+    auto mips = linear.generate(gray);
+
+    ASSERT_EQ(mips.size(), 4u);
+    EXPECT_EQ(mips[1].get_width(), 4u);
+    EXPECT_EQ(mips[1].get_height(), 2u);
+    EXPECT_EQ(mips[2].get_width(), 2u);
+    EXPECT_EQ(mips[2].get_height(), 1u);
+    EXPECT_EQ(mips[3].get_width(), 1u);
+    EXPECT_EQ(mips[3].get_height(), 1u);
+    EXPECT_EQ(linear.generate(gray, 2).size(), 2u);
+
+    for (std::size_t level = 1; level < mips.size(); ++level)
+    {
+        EXPECT_EQ(mips[level].get_pixel(0, 0)[0], 128);
+        EXPECT_EQ(mips[level].get_pixel(0, 0)[3], 255);
+    }
+
+    // Averaged in linear light, half white is brighter than 128 in sRGB
+    MipmapGenerator srgb(MipFilter::Box, true);
+    EXPECT_NEAR(srgb.downsample(gray).get_pixel(0, 0)[0], 188, 1);
+
+    // Transparent texels do not darken the opaque ones
+    auto cutout = striped_image(8, 4, {255, 0, 0, 255}, {0, 0, 0, 0});
+    auto reduced = srgb.downsample(cutout);
+    EXPECT_EQ(reduced.get_pixel(0, 0)[0], 255);
+    EXPECT_EQ(reduced.get_pixel(0, 0)[3], 128);
+
+    // The rows split across the pool give the same levels
+    ThreadPool thread_pool(4);
+    MipmapGenerator pooled(MipFilter::Kaiser, true, &thread_pool);
+    MipmapGenerator serial(MipFilter::Kaiser, true);
+    auto noise = striped_image(64, 48, {10, 200, 30, 255}, {250, 40, 90, 100});
+
+    auto pooled_mips = pooled.generate(noise);
+    auto serial_mips = serial.generate(noise);
+    ASSERT_EQ(pooled_mips.size(), serial_mips.size());
+
+    for (std::size_t level = 0; level < pooled_mips.size(); ++level)
+        EXPECT_EQ(pooled_mips[level].get_pixels(), serial_mips[level].get_pixels());
+
+    EXPECT_THROW(linear.generate(Image()), std::invalid_argument);
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestTexture class
+ * @param TestGrayAlphaMips method
+ */
+TEST(TestTexture, TestGrayAlphaMips)
+{
+    MipmapGenerator srgb(MipFilter::Box, true);
+
+    // Alpha is coverage: half covered is 128, not the sRGB encoding of 0.5
+    auto reduced = srgb.downsample(striped_image(4, 4, {200, 255}, {200, 0}));
+
+    ASSERT_EQ(reduced.get_channels(), 2u);
+    EXPECT_EQ(reduced.get_pixel(0, 0)[0], 200);
+    EXPECT_EQ(reduced.get_pixel(0, 0)[1], 128);
+
+    auto opaque = srgb.downsample(striped_image(4, 4, {0, 255}, {255, 255}));
+    EXPECT_NEAR(opaque.get_pixel(1, 1)[0], 188, 1);
+    EXPECT_EQ(opaque.get_pixel(1, 1)[1], 255);
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestTexture class
+ * @param TestCookRoundTrip method
+ */
+TEST(TestTexture, TestCookRoundTrip)
+{
+    auto image = striped_image(16, 8, {10, 20, 30, 40}, {200, 150, 100, 250});
+    auto texture = Texture::from_image(image, MipmapGenerator());
+    auto data = texture.cook();
+
+    auto header = Texture::read_cooked_header(data);
+    EXPECT_EQ(header.width, 16u);
+    EXPECT_EQ(header.height, 8u);
+    EXPECT_EQ(header.channels, 4u);
+    ASSERT_EQ(header.mip_count, 5u);
+
+    // The smallest level comes first, right after the table
+    EXPECT_EQ(header.mip_offsets[4], Texture::get_cooked_header_size(5));
+    EXPECT_EQ(header.mip_offsets[0] + header.mip_sizes[0], data.size());
+
+    auto loaded = Texture::from_cooked(data);
+    ASSERT_EQ(loaded.get_mip_count(), texture.get_mip_count());
+    EXPECT_EQ(loaded.get_width(), 16u);
+    EXPECT_EQ(loaded.get_height(), 8u);
+
+    for (std::size_t level = 0; level < loaded.get_mip_count(); ++level)
+    {
+        EXPECT_EQ(loaded.get_mip(level).get_width(), texture.get_mip(level).get_width());
+        EXPECT_EQ(loaded.get_mip(level).get_pixels(), texture.get_mip(level).get_pixels());
+    }
+
+    EXPECT_EQ(loaded.cook(), data);
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestTexture class
+ * @param TestCorruptedCooked method
+ */
+TEST(TestTexture, TestCorruptedCooked)
+{
+    auto data = Texture::from_image(Image(8, 8, 1), MipmapGenerator()).cook();
+
+    auto expect_rejected = [](const std::string &corrupted)
+    {
+        EXPECT_THROW(Texture::from_cooked(corrupted), std::runtime_error);
+    };
+
+    // Magic, version, channels and mip count
+    std::string corrupted = data;
+    corrupted[0] = 'X';
+    expect_rejected(corrupted);
+
+    corrupted = data;
+    write_integer(corrupted, 4, 2, 4);
+    expect_rejected(corrupted);
+
+    corrupted = data;
+    write_integer(corrupted, 16, 5, 4);
+    expect_rejected(corrupted);
+
+    corrupted = data;
+    write_integer(corrupted, 20, 40, 4);
+    expect_rejected(corrupted);
+
+    // Dimensions far beyond the data are rejected before any allocation
+    corrupted = data;
+    write_integer(corrupted, 8, 0xFFFFFFFF, 4);
+    write_integer(corrupted, 12, 0xFFFFFFFF, 4);
+    expect_rejected(corrupted);
+
+    // Offsets and sizes that do not describe the cooked layout
+    corrupted = data;
+    write_integer(corrupted, 24, 0xFFFFFFFFFFFFFFF0ull, 8);
+    expect_rejected(corrupted);
+
+    corrupted = data;
+    write_integer(corrupted, 32, 0xFFFFFFFFFFFFFFF0ull, 8);
+    expect_rejected(corrupted);
+
+    corrupted = data;
+    write_integer(corrupted, 24 + 3 * 16, Texture::get_cooked_header_size(4) + 1, 8);
+    expect_rejected(corrupted);
+
+    // Truncated inside the table and inside the pixels
+    expect_rejected(data.substr(0, 30));
+    expect_rejected(data.substr(0, data.size() - 1));
+    expect_rejected("");
+
+    EXPECT_NO_THROW(Texture::from_cooked(data));
+}
+
+#endif //! TEXTURE_TEST_H
@@ -0,0 +1,163 @@
+/**
+ * @file texture_atlas.test.h
+ * @author Carlos Salguero
+ * @brief Test class for the skyline packer and the texture atlas
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef TEXTURE_ATLAS_TEST_H
+#define TEXTURE_ATLAS_TEST_H
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Google Test Library
+#include <gtest/gtest.h>
+
+// Project headers
+#include "src/graphics/texture/texture_atlas.h"
+
+namespace
+{
+    struct PackedRect
+    {
+        std::uint32_t x;
+        std::uint32_t y;
+        std::uint32_t width;
+        std::uint32_t height;
+    };
+
+    /**
+     * @brief
+     * Checks if two rectangles share any pixel
+     * @param a The first rectangle
+     * @param b The second rectangle
+     * @return true The rectangles overlap
+     * @return false The rectangles are disjoint
+     */
+    bool overlaps(const PackedRect &a, const PackedRect &b)
+    {
+        return a.x < b.x + b.width && b.x < a.x + a.width &&
+               a.y < b.y + b.height && b.y < a.y + a.height;
+    }
+
+    /**
+     * @brief
+     * Builds an RGBA8 image whose every pixel is the same color
+     * @param width Width of the image
+     * @param height Height of the image
+     * @param value Value of every channel
+     * @return Image The image
+     */
+    Image solid_image(std::uint32_t width, std::uint32_t height, std::uint8_t value)
+    {
+        Image image(width, height, 4);
+        std::fill(image.get_pixels().begin(), image.get_pixels().end(), value);
+
+        return image;
+    }
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestTextureAtlas class
+ * @param TestSkylineNoOverlap method
+ */
+TEST(TestTextureAtlas, TestSkylineNoOverlap)
+{
+    std::mt19937 generator(27);
+    std::uniform_int_distribution<std::uint32_t> side(1, 48);
+
+    SkylinePacker packer(256, 256);
+    std::vector<PackedRect> placed;
+    std::uint64_t area = 0;
+
+    for (int i = 0; i < 400; ++i)
+    {
+        PackedRect rect{0, 0, side(generator), side(generator)};
+
+        if (!packer.insert(rect.width, rect.height, rect.x, rect.y))
+            continue;
+
+        ASSERT_LE(rect.x + rect.width, 256u);
+        ASSERT_LE(rect.y + rect.height, 256u);
+
+        for (const auto &other : placed)
+            ASSERT_FALSE(overlaps(rect, other));
+
+        placed.push_back(rect);
+        area += std::uint64_t(rect.width) * rect.height;
+    }
+
+    EXPECT_GT(placed.size(), 50u);
+    EXPECT_FLOAT_EQ(packer.get_occupancy(), static_cast<float>(area) / (256.0f * 256.0f));
+
+    std::uint32_t x, y;
+    EXPECT_FALSE(packer.insert(257, 1, x, y));
+
+    packer.clear();
+    EXPECT_TRUE(packer.insert(256, 256, x, y));
+    EXPECT_EQ(x, 0u);
+    EXPECT_EQ(y, 0u);
+    EXPECT_FALSE(packer.insert(1, 1, x, y));
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestTextureAtlas class
+ * @param TestAtlasRegions method
+ */
+TEST(TestTextureAtlas, TestAtlasRegions)
+{
+    TextureAtlas atlas(64, 64, 1);
+
+    for (int i = 0; i < 12; ++i)
+        atlas.add_image("sprite" + std::to_string(i),
+                        solid_image(10 + i, 20 - i, static_cast<std::uint8_t>(i + 1)));
+
+    atlas.build();
+    ASSERT_EQ(atlas.get_regions().size(), 12u);
+    EXPECT_GT(atlas.get_page_count(), 1u);
+
+    std::vector<std::pair<std::size_t, PackedRect>> padded;
+
+    for (int i = 0; i < 12; ++i)
+    {
+        const auto &region = atlas.get_region("sprite" + std::to_string(i));
+        const auto &page = atlas.get_page(region.page);
+        PackedRect rect{region.x - 1, region.y - 1, region.width + 2, region.height + 2};
+
+        EXPECT_EQ(region.width, 10u + i);
+        EXPECT_EQ(region.height, 20u - i);
+        EXPECT_FLOAT_EQ(region.u0, region.x / 64.0f);
+        EXPECT_FLOAT_EQ(region.v1, (region.y + region.height) / 64.0f);
+
+        for (const auto &[other_page, other] : padded)
+            EXPECT_FALSE(other_page == region.page && overlaps(rect, other));
+
+        padded.emplace_back(region.page, rect);
+
+        // Every pixel of the padded rectangle holds the sprite, including
+        // the extruded border
+        for (std::uint32_t row = rect.y; row < rect.y + rect.height; ++row)
+            for (std::uint32_t col = rect.x; col < rect.x + rect.width; ++col)
+                ASSERT_EQ(page.get_pixel(col, row)[0], i + 1);
+    }
+
+    EXPECT_THROW(atlas.insert("large", solid_image(63, 10, 1)), std::invalid_argument);
+    EXPECT_THROW(atlas.insert("gray", Image(4, 4, 1)), std::invalid_argument);
+    EXPECT_THROW(atlas.get_region("missing"), std::out_of_range);
+}
+
+#endif //! TEXTURE_ATLAS_TEST_H
@@ -0,0 +1,187 @@
+/**
+ * @file texture_streamer.test.h
+ * @author Carlos Salguero
+ * @brief Test class for the texture streamer
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef TEXTURE_STREAMER_TEST_H
+#define TEXTURE_STREAMER_TEST_H
+
+// C++ Standard Library
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+
+// Google Test Library
+#include <gtest/gtest.h>
+
+// Project headers
+#include "src/graphics/texture/texture.h"
+#include "src/graphics/texture/texture_streamer.h"
+#include "src/resource/virtual_file_system.h"
+#include "src/threads/thread_pool.h"
+
+namespace
+{
+    /**
+     * @brief
+     * Cooks a square RGBA8 texture of a single color with its full mip chain
+     * @param side Width and height of level 0
+     * @param value Value of every channel
+     * @return std::string Cooked texture
+     */
+    std::string cooked_texture(std::uint32_t side, std::uint8_t value)
+    {
+        Image image(side, side, 4);
+        std::fill(image.get_pixels().begin(), image.get_pixels().end(), value);
+
+        return Texture::from_image(image, MipmapGenerator()).cook();
+    }
+
+    /**
+     * @brief
+     * Updates the streamer until a condition holds, checking on every frame
+     * that the memory in use stays within the budget
+     * @param streamer The streamer
+     * @param done Condition to wait for
+     * @return true The condition holds
+     * @return false The condition still fails after two seconds
+     */
+    bool stream_until(TextureStreamer &streamer, const std::function<bool()> &done)
+    {
+        for (int frame = 0; frame < 2000; ++frame)
+        {
+            streamer.update();
+            EXPECT_LE(streamer.get_resident_bytes() + streamer.get_pending_bytes(),
+                      streamer.get_budget());
+
+            if (done())
+                return true;
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        return false;
+    }
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestTextureStreamer class
+ * @param TestBudgetEviction method
+ */
+TEST(TestTextureStreamer, TestBudgetEviction)
+{
+    auto memory = std::make_shared<MemoryMount>();
+    memory->add_file("near.gtex", cooked_texture(256, 10));
+    memory->add_file("far.gtex", cooked_texture(256, 20));
+
+    VirtualFileSystem vfs;
+    vfs.mount_memory("textures", memory);
+
+    ThreadPool thread_pool(2);
+    TextureStreamer streamer(vfs, thread_pool, 1 << 20);
+
+    const auto &near = streamer.open("near", "textures/near.gtex");
+    const auto &far = streamer.open("far", "textures/far.gtex");
+
+    // The levels up to 64x64 are loaded right away and never dropped
+    ASSERT_EQ(near.get_resident_mip(), 2u);
+    std::size_t tail = near.get_resident_bytes();
+    EXPECT_EQ(streamer.get_resident_bytes(), 2 * tail);
+    EXPECT_EQ(near.get_best_mip().get_width(), 64u);
+
+    // Room for one full texture besides the tails
+    std::size_t full = tail + 128 * 128 * 4 + 256 * 256 * 4;
+    streamer.set_budget(full + tail);
+
+    streamer.set_priority("near", 256.0f, 1.0f);
+    streamer.set_priority("far", 64.0f, 1.0f);
+    EXPECT_EQ(near.get_desired_mip(), 0u);
+    EXPECT_EQ(far.get_desired_mip(), 2u);
+
+    ASSERT_TRUE(stream_until(streamer, [&]()
+                             { return near.get_resident_mip() == 0; }));
+    EXPECT_EQ(near.get_best_mip().get_pixel(255, 255)[0], 10);
+    EXPECT_EQ(far.get_resident_mip(), 2u);
+
+    // The far texture comes closer and takes the memory of the other one
+    streamer.set_priority("near", 256.0f, 50.0f);
+    streamer.set_priority("far", 256.0f, 0.0f);
+
+    ASSERT_TRUE(stream_until(streamer, [&]()
+                             { return far.get_resident_mip() == 0; }));
+    EXPECT_EQ(near.get_resident_mip(), 2u);
+    EXPECT_EQ(streamer.get_resident_bytes(), full + tail);
+
+    // A smaller budget drops back to the tails
+    streamer.set_budget(2 * tail);
+    streamer.update();
+    EXPECT_EQ(far.get_resident_mip(), 2u);
+    EXPECT_EQ(streamer.get_resident_bytes(), 2 * tail);
+    EXPECT_THROW(far.get_mip(1), std::out_of_range);
+
+    streamer.close("far");
+    EXPECT_EQ(streamer.get_resident_bytes(), tail);
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestTextureStreamer class
+ * @param TestFailedRead method
+ */
+TEST(TestTextureStreamer, TestFailedRead)
+{
+    auto data = cooked_texture(256, 30);
+    auto memory = std::make_shared<MemoryMount>();
+    memory->add_file("wall.gtex", data);
+
+    VirtualFileSystem vfs;
+    vfs.mount_memory("", memory);
+
+    ThreadPool thread_pool(2);
+    TextureStreamer streamer(vfs, thread_pool, 1 << 20);
+
+    const auto &wall = streamer.open("wall", "wall.gtex");
+
+    // Level 0 is the end of the file: losing its last byte breaks its read
+    memory->add_file("wall.gtex", data.substr(0, data.size() - 1));
+    streamer.set_priority("wall", 256.0f, 0.0f);
+
+    ASSERT_TRUE(stream_until(streamer, [&]()
+                             { return wall.get_loadable_mip() == 1 &&
+                                      streamer.get_pending_bytes() == 0; }));
+    EXPECT_EQ(wall.get_resident_mip(), 1u);
+    EXPECT_EQ(wall.get_desired_mip(), 0u);
+
+    // The failed level is not asked for again on the next frames
+    for (int frame = 0; frame < 10; ++frame)
+    {
+        streamer.update();
+        EXPECT_EQ(streamer.get_pending_bytes(), 0u);
+    }
+
+    EXPECT_EQ(wall.get_resident_mip(), 1u);
+
+    // Reopening the repaired file streams the whole chain
+    memory->add_file("wall.gtex", data);
+    const auto &repaired = streamer.open("wall", "wall.gtex");
+    streamer.set_priority("wall", 256.0f, 0.0f);
+
+    EXPECT_EQ(repaired.get_loadable_mip(), 0u);
+    ASSERT_TRUE(stream_until(streamer, [&]()
+                             { return repaired.get_resident_mip() == 0; }));
+}
+
+#endif //! TEXTURE_STREAMER_TEST_H
@@ -0,0 +1,78 @@
+/**
+ * @file thread_pool.test.h
+ * @author Carlos Salguero
+ * @brief Test class for the thread pool and its task groups
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef THREAD_POOL_TEST_H
+#define THREAD_POOL_TEST_H
+
+// C++ Standard Library
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+// Google Test Library
+#include <gtest/gtest.h>
+
+// Project headers
+#include "src/threads/thread_pool.h"
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestThreadPool class
+ * @param TestTaskGroup method
+ */
+TEST(TestThreadPool, TestTaskGroup)
+{
+    ThreadPool thread_pool(3);
+    std::atomic<int> finished = 0;
+
+    auto slow = [&finished]()
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        ++finished;
+    };
+
+    // A failed task is rethrown only once every task has stopped
+    {
+        TaskGroup tasks(thread_pool);
+        tasks.run([]()
+                  { throw std::runtime_error("band failed"); });
+
+        for (int i = 0; i < 4; ++i)
+            tasks.run(slow);
+
+        EXPECT_THROW(tasks.wait(), std::runtime_error);
+        EXPECT_EQ(finished, 4);
+    }
+
+    // The caller throwing while tasks run still waits for them
+    finished = 0;
+
+    try
+    {
+        TaskGroup tasks(thread_pool);
+
+        for (int i = 0; i < 4; ++i)
+            tasks.run(slow);
+
+        throw std::runtime_error("caller failed");
+    }
+    catch (const std::runtime_error &)
+    {
+        EXPECT_EQ(finished, 4);
+    }
+
+    TaskGroup empty(thread_pool);
+    EXPECT_NO_THROW(empty.wait());
+}
+
+#endif //! THREAD_POOL_TEST_H
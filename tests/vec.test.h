@@ -0,0 +1,139 @@
+/**
+ * @file vec.test.h
+ * @author Carlos Salguero
+ * @brief Test class for the fixed-size vector and matrix classes
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef VEC_TEST_H
+#define VEC_TEST_H
+
+// C++ Standard Library
+#include <array>
+#include <cstddef>
+
+// Google Test Library
+#include <gtest/gtest.h>
+
+// Project headers
+#include "src/utils/math/mat.h"
+
+using namespace Math;
+
+namespace
+{
+    template <class A, class B>
+    constexpr bool vectors_addable = requires(const A &a, const B &b) { a + b; };
+
+    template <class A, class B>
+    constexpr bool vectors_dottable = requires(const A &a, const B &b) { a.dot(b); };
+
+    /**
+     * @brief
+     * Builds a table of the unit directions towards the corners of a
+     * square, as a compile-time lookup table
+     */
+    constexpr std::array<Vec2, 4> make_corner_directions()
+    {
+        std::array<Vec2, 4> table{};
+
+        for (std::size_t i = 0; i < table.size(); ++i)
+            table[i] = Vec2(i & 1 ? 1.0f : -1.0f, i & 2 ? 1.0f : -1.0f).normalize();
+
+        return table;
+    }
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestVec class
+ * @param TestConstexpr method
+ */
+TEST(TestVec, TestConstexpr)
+{
+    constexpr Mat4 model = Mat4::translation(Vec3(1.0f, 2.0f, 3.0f)) *
+                           Mat4::scaling(Vec3(2.0f, 2.0f, 2.0f));
+    constexpr Vec4 point = model * Vec4(1.0f, 1.0f, 1.0f, 1.0f);
+
+    static_assert(point == Vec4(3.0f, 4.0f, 5.0f, 1.0f));
+    static_assert(Vec3(1.0f, 0.0f, 0.0f).cross(Vec3(0.0f, 1.0f, 0.0f)) ==
+                  Vec3(0.0f, 0.0f, 1.0f));
+    static_assert(sizeof(Mat4) == 16 * sizeof(float));
+
+    EXPECT_EQ(model.determinant(), 8.0f);
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestVec class
+ * @param TestNormalize method
+ */
+TEST(TestVec, TestNormalize)
+{
+    Vec3 vector(3.0f, 4.0f, 0.0f);
+
+    EXPECT_EQ(vector.magnitude(), 5.0f);
+    EXPECT_FLOAT_EQ(vector.normalize().x(), 0.6f);
+    EXPECT_EQ(Vec3().normalize(), Vec3());
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestVec class
+ * @param TestConversions method
+ */
+TEST(TestVec, TestConversions)
+{
+    Vec3 vector(1.0f, 2.0f, 3.0f);
+    Mat3 matrix(Vec3(1.0f, 2.0f, 3.0f), Vec3(4.0f, 5.0f, 6.0f), Vec3(7.0f, 8.0f, 9.0f));
+
+    EXPECT_EQ(Vec3::from_vector(vector.to_vector()), vector);
+    EXPECT_EQ(Mat3::from_matrix(matrix.to_matrix()), matrix);
+    EXPECT_EQ(Mat3::from_matrix(matrix.to_matrix<MatrixLayout::ColumnMajor>()), matrix);
+    EXPECT_EQ(matrix.to_matrix()(0, 2), 3.0f);
+    EXPECT_THROW(Vec4::from_vector(vector.to_vector()), std::invalid_argument);
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestVec class
+ * @param TestStaticSize method
+ */
+TEST(TestVec, TestStaticSize)
+{
+    constexpr Vec3 a(1.0f, 2.0f, 3.0f);
+    constexpr Vec3 b(4.0f, 5.0f, 6.0f);
+
+    static_assert(a.dot(b) == 32.0f);
+    static_assert(a.lerp(b, 0.5f) == Vec3(2.5f, 3.5f, 4.5f));
+    static_assert(2.0f * a - b == Vec3(-2.0f, -1.0f, 0.0f));
+    static_assert(Vec3(1.0f, 0.0f, 0.0f).cross(Vec3(0.0f, 1.0f, 0.0f)) ==
+                  Vec3(0.0f, 0.0f, 1.0f));
+    static_assert(Vec2(3.0f, 4.0f).magnitude() == 5.0f);
+    static_assert(Vec<2, double>(3.0, 4.0).unit_vector() == Vec<2, double>(0.6, 0.8));
+    static_assert(sizeof(Vec4) == 4 * sizeof(float));
+
+    static_assert(vectors_addable<Vec3, Vec3>);
+    static_assert(!vectors_addable<Vec3, Vec4>);
+    static_assert(!vectors_dottable<Vec2, Vec3>);
+    static_assert(!std::is_constructible_v<Vec3, float, float>);
+
+    constexpr auto directions = make_corner_directions();
+    static_assert(directions[3][0] == directions[3][1]);
+    EXPECT_FLOAT_EQ(directions[3].magnitude(), 1.0f);
+    EXPECT_FLOAT_EQ(directions[0][0], -0.70710678f);
+
+    EXPECT_EQ(a.cubic_interpolation(b, 1.0f), b);
+    EXPECT_FLOAT_EQ(Vec2(1.0f, 0.0f).angle(Vec2(0.0f, 2.0f)), pi<float> / 2);
+    EXPECT_EQ(Vec3().normalize(), Vec3());
+}
+
+#endif //! VEC_TEST_H
@@ -0,0 +1,103 @@
+/**
+ * @file vector.test.h
+ * @author Carlos Salguero
+ * @brief Test class for the vector class
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef VECTOR_TEST_H
+#define VECTOR_TEST_H
+
+// Google Test Library
+#include <gtest/gtest.h>
+
+// Project headers
+#include "src/utils/math/vector.h"
+
+using namespace Math;
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestVector class
+ * @param TestExpressions method
+ */
+TEST(TestVector, TestExpressions)
+{
+    Vector<float> a{1.0f, 2.0f, 3.0f};
+    Vector<float> b{4.0f, 5.0f, 6.0f};
+
+    Vector<float> result = a * b + 2.0f * a - b / 2.0f + 1.0f;
+
+    EXPECT_EQ(result.size(), 3u);
+    EXPECT_EQ(result[0], 5.0f);
+    EXPECT_EQ(result[1], 12.5f);
+    EXPECT_EQ(result[2], 22.0f);
+
+    a = a + a;
+    EXPECT_EQ(a[1], 4.0f);
+
+    result -= -a;
+    EXPECT_EQ(result[0], 7.0f);
+
+    EXPECT_THROW(a + Vector<float>({1.0f, 2.0f}), std::invalid_argument);
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestVector class
+ * @param TestStoredExpressions method
+ */
+TEST(TestVector, TestStoredExpressions)
+{
+    Vector<float> a{1.0f, 2.0f, 3.0f};
+    auto make = [] { return Vector<float>{4.0f, 5.0f, 6.0f}; };
+
+    // The temporary is owned by the expression, not destroyed with the
+    // statement
+    auto sum = a + make() * 2.0f;
+    Vector<float> result = sum;
+    EXPECT_EQ(result, (Vector<float>{9.0f, 12.0f, 15.0f}));
+
+    // Members evaluate the expression first
+    Vector<float> b{4.0f, 6.0f, 3.0f};
+    EXPECT_EQ((b - a).magnitude(), 5.0f);
+    EXPECT_EQ((b - a).dot(a), 11.0f);
+    EXPECT_EQ((a + make()).eval(), (Vector<float>{5.0f, 7.0f, 9.0f}));
+
+    // Reading an element never freezes a stored expression, and a
+    // writable copy comes from eval()
+    auto c = a + b;
+    float first = c[0];
+    auto copy = c.eval();
+    copy[0] = 1.0f;
+    a[1] = 100.0f;
+    EXPECT_EQ(first, 5.0f);
+    EXPECT_EQ(c[0], 5.0f);
+    EXPECT_EQ(Vector<float>(c), (Vector<float>{5.0f, 106.0f, 6.0f}));
+    EXPECT_EQ(copy, (Vector<float>{1.0f, 8.0f, 6.0f}));
+    EXPECT_EQ(Vector<float>(copy * 2.0f), (Vector<float>{2.0f, 16.0f, 12.0f}));
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestVector class
+ * @param TestInterpolation method
+ */
+TEST(TestVector, TestInterpolation)
+{
+    Vector<float> a{1.0f, 2.0f, 3.0f};
+    Vector<float> b{4.0f, 5.0f, 6.0f};
+
+    EXPECT_EQ(a.lerp(b, 0.5f), (Vector<float>{2.5f, 3.5f, 4.5f}));
+    EXPECT_EQ(a.cubic_interpolation(b, 0.0f), a);
+    EXPECT_EQ((Vector<float>{3.0f, 4.0f}.unit_vector()), (Vector<float>{0.6f, 0.8f}));
+}
+
+#endif //! VECTOR_TEST_H
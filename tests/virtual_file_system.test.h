@@ -0,0 +1,235 @@
+/**
+ * @file virtual_file_system.test.h
+ * @author Carlos Salguero
+ * @brief Test class for the virtual file system
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef VIRTUAL_FILE_SYSTEM_TEST_H
+#define VIRTUAL_FILE_SYSTEM_TEST_H
+
+// C++ Standard Library
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Google Test Library
+#include <gtest/gtest.h>
+
+// Project headers
+#include "src/resource/virtual_file_system.h"
+
+namespace
+{
+    /**
+     * @brief
+     * Builds a path in the temporary directory, unique to this process
+     * @param name Name of the file
+     * @return std::string Path of the file
+     */
+    std::string temporary_path(const std::string &name)
+    {
+        return (std::filesystem::temp_directory_path() /
+                ("vfs_test_" + std::to_string(::testing::UnitTest::GetInstance()->random_seed()) + "_" + name))
+            .string();
+    }
+
+    /**
+     * @brief
+     * Writes raw bytes to a file
+     * @param file_path Path of the file
+     * @param data Bytes to write
+     */
+    void write_bytes(const std::string &file_path, const std::string &data)
+    {
+        std::ofstream file(file_path, std::ios::binary | std::ios::trunc);
+        file.write(data.data(), static_cast<std::streamsize>(data.size()));
+    }
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestVirtualFileSystem class
+ * @param TestNormalizePath method
+ */
+TEST(TestVirtualFileSystem, TestNormalizePath)
+{
+    EXPECT_EQ(VirtualFileSystem::normalize_path("textures/wall.png"), "textures/wall.png");
+    EXPECT_EQ(VirtualFileSystem::normalize_path("/textures//wall.png/"), "textures/wall.png");
+    EXPECT_EQ(VirtualFileSystem::normalize_path("textures\\stone\\..\\.\\wall.png"), "textures/wall.png");
+    EXPECT_EQ(VirtualFileSystem::normalize_path("../../wall.png"), "wall.png");
+    EXPECT_EQ(VirtualFileSystem::normalize_path("./"), "");
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestVirtualFileSystem class
+ * @param TestOverlayPriority method
+ */
+TEST(TestVirtualFileSystem, TestOverlayPriority)
+{
+    auto base = std::make_shared<MemoryMount>();
+    base->add_file("config.ini", "base");
+    base->add_file("textures/wall.png", "wall");
+
+    auto patch = std::make_shared<MemoryMount>();
+    patch->add_file("config.ini", "patch");
+
+    auto mod = std::make_shared<MemoryMount>();
+    mod->add_file("config.ini", "mod");
+
+    VirtualFileSystem vfs;
+    vfs.mount_memory("data", base, 0);
+    auto mod_id = vfs.mount_memory("data", mod, 10);
+    vfs.mount_memory("/data/", patch, 5);
+
+    EXPECT_EQ(vfs.get_file_count(), 2u);
+    EXPECT_EQ(vfs.read("data/config.ini"), "mod");
+    EXPECT_EQ(vfs.read("data\\textures\\wall.png", 1, 100), "all");
+    EXPECT_EQ(vfs.get_file_size("data/textures/wall.png"), 4u);
+    EXPECT_EQ(vfs.list("data/textures"), std::vector<std::string>{"data/textures/wall.png"});
+
+    // Among equal priorities the most recent mount wins
+    auto late = std::make_shared<MemoryMount>();
+    late->add_file("config.ini", "late");
+    auto late_id = vfs.mount_memory("data", late, 10);
+    EXPECT_EQ(vfs.read("data/config.ini"), "late");
+
+    vfs.unmount(late_id);
+    vfs.unmount(mod_id);
+    EXPECT_EQ(vfs.read("data/config.ini"), "patch");
+
+    base->remove_file("textures/wall.png");
+    EXPECT_TRUE(vfs.exists("data/textures/wall.png"));
+    vfs.refresh();
+    EXPECT_FALSE(vfs.exists("data/textures/wall.png"));
+    EXPECT_THROW(vfs.read("data/textures/wall.png"), std::runtime_error);
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestVirtualFileSystem class
+ * @param TestMemoryMountConcurrency method
+ */
+TEST(TestVirtualFileSystem, TestMemoryMountConcurrency)
+{
+    auto memory = std::make_shared<MemoryMount>();
+    memory->add_file("stable.txt", "stable");
+
+    VirtualFileSystem vfs;
+    vfs.mount_memory("", memory);
+
+    std::atomic<bool> done = false;
+    // The mount changes under readers that only hold the file system lock
+    auto write = [&]()
+    {
+        for (int i = 0; i < 2000; ++i)
+        {
+            memory->add_file("file" + std::to_string(i % 16), std::string(i % 64, 'x'));
+            memory->remove_file("file" + std::to_string((i + 8) % 16));
+        }
+
+        done = true;
+    };
+
+    std::thread writer(write);
+
+    while (!done)
+        EXPECT_EQ(vfs.read("stable.txt", 1, 3), "tab");
+
+    writer.join();
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestVirtualFileSystem class
+ * @param TestPakRoundTrip method
+ */
+TEST(TestVirtualFileSystem, TestPakRoundTrip)
+{
+    std::string archive = temporary_path("round_trip.pak");
+    std::string binary("\0\1\2\3", 4);
+
+    PakMount::write_archive(archive, {{"maps/level1.map", "level one"},
+                                      {"empty.txt", ""},
+                                      {"binary.bin", binary}});
+
+    VirtualFileSystem vfs;
+    vfs.mount_pak("pak", archive);
+
+    EXPECT_EQ(vfs.get_file_count(), 3u);
+    EXPECT_EQ(vfs.read("pak/maps/level1.map"), "level one");
+    EXPECT_EQ(vfs.read("pak/maps/level1.map", 6, 100), "one");
+    EXPECT_EQ(vfs.read("pak/empty.txt"), "");
+    EXPECT_EQ(vfs.read("pak/binary.bin"), binary);
+    EXPECT_EQ(vfs.get_real_path("pak/binary.bin"), "");
+
+    std::filesystem::remove(archive);
+}
+
+/**
+ * @brief
+ * Construct a new TEST object
+ * @param TestVirtualFileSystem class
+ * @param TestCorruptedPak method
+ */
+TEST(TestVirtualFileSystem, TestCorruptedPak)
+{
+    std::string archive = temporary_path("corrupted.pak");
+    PakMount::write_archive(archive, {{"a.txt", "contents"}});
+
+    std::ifstream file(archive, std::ios::binary);
+    std::string valid((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    file.close();
+
+    auto expect_rejected = [&](std::string data)
+    {
+        write_bytes(archive, data);
+        EXPECT_THROW(PakMount{archive}, std::runtime_error);
+    };
+
+    // Entry count, path length, offset and size far beyond the file
+    std::string corrupted = valid;
+    corrupted[8] = '\xFF';
+    corrupted[11] = '\x7F';
+    expect_rejected(corrupted);
+
+    corrupted = valid;
+    corrupted[12] = '\xF0';
+    corrupted[15] = '\x7F';
+    expect_rejected(corrupted);
+
+    corrupted = valid;
+    corrupted[16 + 5 + 7] = '\x01';
+    expect_rejected(corrupted);
+
+    corrupted = valid;
+    corrupted[16 + 5 + 8] = '\x09';
+    expect_rejected(corrupted);
+
+    // Truncated inside the table of contents and inside the data
+    expect_rejected(valid.substr(0, 18));
+    expect_rejected(valid.substr(0, valid.size() - 1));
+    expect_rejected("GPAK");
+    expect_rejected("");
+
+    write_bytes(archive, valid);
+    EXPECT_NO_THROW(PakMount{archive});
+
+    std::filesystem::remove(archive);
+}
+
+#endif //! VIRTUAL_FILE_SYSTEM_TEST_H